@@ -0,0 +1,343 @@
+/**
+ * @file SingleCellPerfTest.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Integration tests with performance budgets over the benchmark
+ * suites. Build with -DSINGLECELL_BUILD_PERF_TESTS=ON; the target runs a
+ * representative simulation per benchmark directory, checks the
+ * trajectory against the stored reference within tolerance, and fails
+ * when wall time or memory regress past the configured margin. First
+ * runs bless the current outputs and timings as the baselines
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+
+// System Libraries
+#include <dirent.h>
+#include <sys/resource.h>
+
+// Internal Libraries
+#include "singlecell/SingleCell.h"
+#include "singlecell/AllocationGuard.h"
+
+//==========================Harness Details=================================//
+namespace {
+
+// Representative run per benchmark: long enough to exercise the leap
+// and exchange machinery, short enough that the full suite stays in CI
+constexpr double kStart = 0.0;
+constexpr double kStop = 600.0;
+constexpr double kStep = 30.0;
+constexpr unsigned long long kSeed = 42;
+
+double envOr(
+    const char* name,
+    double fallback
+) {
+
+    const char* value = std::getenv(name);
+
+    return value != nullptr ? std::atof(value) : fallback;
+}
+
+/**
+ * @brief pulls the sbml_files entries out of a benchmark's PEtab yml,
+ * resolved against the benchmark directory; a line parser is all the
+ * format needs
+ */
+std::vector<std::string> readSbmlPaths(
+    const std::string& yml_path,
+    const std::string& directory
+) {
+
+    std::ifstream yml(yml_path);
+
+    std::vector<std::string> paths;
+    std::string line;
+    bool in_sbml_block = false;
+
+    while (std::getline(yml, line)) {
+
+        size_t content = line.find_first_not_of(" \t");
+
+        if (content == std::string::npos) {
+            continue;
+        }
+
+        std::string trimmed = line.substr(content);
+
+        if (trimmed.rfind("sbml_files:", 0) == 0) {
+            in_sbml_block = true;
+            continue;
+        }
+
+        if (in_sbml_block) {
+
+            if (trimmed.rfind("- ", 0) != 0) {
+                break;
+            }
+
+            paths.push_back(directory + "/" + trimmed.substr(2));
+        }
+    }
+
+    return paths;
+}
+
+long currentMaxRssKb() {
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}
+
+/**
+ * @brief compares a trajectory against the benchmark's stored reference
+ * (raw rows/cols header plus row-major doubles); absent references are
+ * blessed from the current output
+ *
+ * @returns true when the trajectory matches or was just blessed
+ */
+bool checkReference(
+    const std::string& path,
+    const std::vector<double>& flat,
+    uint64_t rows,
+    uint64_t cols,
+    double tolerance
+) {
+
+    std::ifstream in(path, std::ios::binary);
+
+    if (!in) {
+
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+        out.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+        out.write(
+            reinterpret_cast<const char*>(flat.data()),
+            flat.size() * sizeof(double)
+        );
+
+        printf("    reference blessed (%llu x %llu)\n",
+            (unsigned long long)rows, (unsigned long long)cols);
+
+        return true;
+    }
+
+    uint64_t ref_rows = 0;
+    uint64_t ref_cols = 0;
+
+    in.read(reinterpret_cast<char*>(&ref_rows), sizeof(ref_rows));
+    in.read(reinterpret_cast<char*>(&ref_cols), sizeof(ref_cols));
+
+    if (ref_rows != rows || ref_cols != cols) {
+        printf("    FAIL: geometry %llux%llu, reference %llux%llu\n",
+            (unsigned long long)rows, (unsigned long long)cols,
+            (unsigned long long)ref_rows, (unsigned long long)ref_cols);
+        return false;
+    }
+
+    std::vector<double> reference(flat.size());
+    in.read(
+        reinterpret_cast<char*>(reference.data()),
+        reference.size() * sizeof(double)
+    );
+
+    for (size_t i = 0; i < flat.size(); i++) {
+
+        double error = std::abs(flat[i] - reference[i]);
+        double bound = tolerance * (1.0 + std::abs(reference[i]));
+
+        if (!(error <= bound)) {
+            printf("    FAIL: element %zu is %g, reference %g\n",
+                i, flat[i], reference[i]);
+            return false;
+        }
+    }
+
+    printf("    trajectory matches reference\n");
+
+    return true;
+}
+
+/**
+ * @brief checks wall time and peak RSS against the stored baseline with
+ * the configured regression margin; absent baselines are blessed
+ *
+ * @returns true when within budget or just blessed
+ */
+bool checkBudget(
+    const std::string& path,
+    double seconds,
+    long rss_kb,
+    double margin
+) {
+
+    std::ifstream in(path);
+
+    if (!in) {
+
+        std::ofstream out(path);
+        out << seconds << " " << rss_kb << "\n";
+
+        printf("    budget blessed (%.3f s, %ld KB peak RSS)\n",
+            seconds, rss_kb);
+
+        return true;
+    }
+
+    double budget_seconds = 0.0;
+    long budget_rss_kb = 0;
+
+    in >> budget_seconds >> budget_rss_kb;
+
+    bool ok = true;
+
+    if (seconds > budget_seconds * (1.0 + margin)) {
+        printf("    FAIL: %.3f s exceeds budget %.3f s (+%.0f%% margin)\n",
+            seconds, budget_seconds, margin * 100.0);
+        ok = false;
+    }
+
+    if (rss_kb > static_cast<long>(budget_rss_kb * (1.0 + margin))) {
+        printf("    FAIL: %ld KB peak RSS exceeds budget %ld KB\n",
+            rss_kb, budget_rss_kb);
+        ok = false;
+    }
+
+    if (ok) {
+        printf("    within budget: %.3f s (<= %.3f s), %ld KB RSS\n",
+            seconds, budget_seconds * (1.0 + margin), rss_kb);
+    }
+
+    return ok;
+}
+
+}
+
+int main() {
+
+    double tolerance = envOr("SINGLECELL_PERF_TOL", 1e-6);
+    double margin = envOr("SINGLECELL_PERF_MARGIN", 0.25);
+
+    std::string root = SINGLECELL_BENCHMARK_DIR;
+
+    // discover benchmark directories: any subdirectory carrying a
+    // <name>.yml problem file participates
+    std::vector<std::string> names;
+
+    DIR* dir = opendir(root.c_str());
+
+    if (dir == nullptr) {
+        printf("benchmark directory not found: %s\n", root.c_str());
+        return 1;
+    }
+
+    for (struct dirent* entry = readdir(dir); entry != nullptr;
+         entry = readdir(dir)) {
+
+        std::string name = entry->d_name;
+
+        if (name == "." || name == "..") {
+            continue;
+        }
+
+        std::ifstream yml(root + "/" + name + "/" + name + ".yml");
+
+        if (yml) {
+            names.push_back(name);
+        }
+    }
+
+    closedir(dir);
+
+    std::sort(names.begin(), names.end());
+
+    printf("SingleCellPerfTest: %zu benchmark(s), tol %g, margin %.0f%%\n",
+        names.size(), tolerance, margin * 100.0);
+
+    int failures = 0;
+
+    for (const std::string& name : names) {
+
+        std::string directory = root + "/" + name;
+
+        printf("\n[%s]\n", name.c_str());
+
+        std::vector<std::string> sbml_paths = readSbmlPaths(
+            directory + "/" + name + ".yml", directory
+        );
+
+        if (sbml_paths.empty()) {
+            printf("    FAIL: no sbml_files in problem yml\n");
+            failures++;
+            continue;
+        }
+
+        try {
+
+            SingleCell cell(sbml_paths);
+            cell.setSeed(kSeed);
+
+            auto run_start = std::chrono::steady_clock::now();
+
+            std::vector<double> flat = cell.simulateFlat(
+                kStart, kStop, kStep
+            );
+
+            double seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - run_start
+            ).count();
+
+            bool ok = checkReference(
+                directory + "/reference_trajectory.bin",
+                flat,
+                cell.last_num_timesteps,
+                cell.last_num_species,
+                tolerance
+            );
+
+            ok = checkBudget(
+                directory + "/perf_baseline.txt",
+                seconds,
+                currentMaxRssKb(),
+                margin
+            ) && ok;
+
+            if (!ok) {
+                failures++;
+            }
+
+        } catch (const std::exception& error) {
+            printf("    FAIL: %s\n", error.what());
+            failures++;
+        }
+    }
+
+    printf("\n%d of %zu benchmark(s) failed\n", failures, names.size());
+
+    // non-empty only in the allocation-profiling flavor, where the
+    // interposed allocator attributes every allocation to the phase
+    // markers around the step kernels, exchange, and recording
+    std::ostringstream alloc_report;
+    alloc_guard::reportPhaseCounts(alloc_report);
+
+    if (!alloc_report.str().empty()) {
+        printf("\nallocations by phase:\n%s", alloc_report.str().c_str());
+    }
+
+    return failures > 0 ? 1 : 0;
+}
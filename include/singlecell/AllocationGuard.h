@@ -0,0 +1,117 @@
+/**
+ * @file: AllocationGuard.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Scoped heap-allocation tally for asserting allocation-free paths
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef ALLOCATIONGUARD_h
+#define ALLOCATIONGUARD_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+
+//==========================Class Declaration===============================//
+namespace alloc_guard {
+
+    // Per-thread allocation tally. The library never bumps it; builds
+    // that link a counting operator new increment it on every heap
+    // allocation, which is what gives the scopes below teeth. Both the
+    // benchmark target and the allocation-profiling core flavor
+    // (-DSINGLECELL_ALLOC_PROFILE=ON) interpose such an allocator
+    extern thread_local uint64_t allocation_count;
+
+    // Depth of armed Scopes live on this thread. The profiling
+    // flavor's interposer aborts on any allocation while it is
+    // positive (SINGLECELL_ALLOC_ABORT=0 downgrades to counting), so a
+    // change reintroducing allocation into a guarded kernel fails
+    // loudly instead of shipping
+    extern thread_local int hot_depth;
+
+    // Capacity of the per-phase attribution table; markers beyond it
+    // tally as unattributed instead of failing
+    constexpr size_t kMaxPhases = 32;
+
+    /**
+     * @brief RAII phase marker for allocation attribution: heap
+     * allocations on this thread while the marker is live count
+     * against the named phase in the profiling flavor's table (other
+     * builds pay one thread-local pointer swap). Markers nest; the
+     * innermost name wins. Names must be string literals — the table
+     * matches by pointer identity, never by content
+     */
+    class PhaseScope {
+        public:
+        //---------------------------methods---------------------------------//
+            /**
+             * @brief makes the named phase current on this thread
+             *
+             * @param phase string literal naming the phase
+             */
+            explicit PhaseScope(
+                const char* phase
+            ); //Ctor
+
+            ~PhaseScope(); //Dtor, restores the enclosing phase
+
+        private:
+        //-----------------------------members--------------------------------//
+            const char* previous;
+    };
+
+    /**
+     * @brief writes one "phase<TAB>count" line per phase that
+     * allocated, plus an unattributed line for allocations outside any
+     * marker. Empty output in builds without an interposing allocator
+     *
+     * @param out destination stream for the report
+     */
+    void reportPhaseCounts(
+        std::ostream& out
+    );
+
+    /**
+     * @brief records the thread's allocation tally at construction;
+     * armed scopes assert at destruction (debug builds) that the tally
+     * did not move, so any return path through a guarded hot section
+     * trips on a heap allocation. Disarmed scopes only measure, for
+     * callers that report instead of abort
+     */
+    class Scope {
+        public:
+        //---------------------------methods---------------------------------//
+            /**
+             * @brief snapshots the thread's allocation tally
+             *
+             * @param armed true asserts zero allocations at destruction
+             */
+            explicit Scope(
+                bool armed = true
+            ); //Ctor
+
+            ~Scope(); //Dtor, asserts when armed
+
+            /**
+             * @brief allocations on this thread since construction
+             *
+             * @returns allocation count delta for the scope's lifetime
+             */
+            uint64_t allocations() const;
+
+        private:
+        //-----------------------------members--------------------------------//
+            uint64_t start;
+
+            bool armed;
+    };
+
+} // namespace alloc_guard
+
+#endif // ALLOCATIONGUARD_H
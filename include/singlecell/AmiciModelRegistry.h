@@ -0,0 +1,64 @@
+/**
+ * @file: AmiciModelRegistry.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Lazy, dlopen-based lookup of generated AMICI model objects
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef AMICIMODELREGISTRY_h
+#define AMICIMODELREGISTRY_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <memory>
+#include <string>
+
+// Third Party Libraries
+namespace amici { class Model; }
+
+//==========================Class Declaration===============================//
+/**
+ * @brief resolves generated AMICI models by SBML id at the moment a
+ * module first needs one, instead of hard-linking every model into every
+ * binary. Shared objects are dlopened on demand from the registered
+ * search paths (and the SINGLECELL_MODEL_PATH environment variable), so
+ * new models ship as .so files without rebuilding SingleCell; the models
+ * bundled with the repository stay available as statically linked
+ * fallbacks when SINGLECELL_STATIC_AMICI_MODELS is on
+ */
+class AmiciModelRegistry {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief constructs the AMICI model registered under model_id,
+         * dlopening its shared object on first use and caching the
+         * resolved factory for every later construction
+         *
+         * @param model_id the SBML document id, e.g. "Deterministic"
+         *
+         * @returns a freshly constructed model instance
+         *
+         * @throws std::runtime_error when no shared object or built-in
+         * fallback provides the model
+         */
+        static std::unique_ptr<amici::Model> create(
+            const std::string& model_id
+        );
+
+        /**
+         * @brief prepends a directory to the shared-object search path;
+         * later registrations win over earlier ones
+         *
+         * @param directory path searched for libmodel_<id>.so files
+         */
+        static void addSearchPath(
+            const std::string& directory
+        );
+
+};
+
+#endif // AMICIMODELREGISTRY_H
@@ -0,0 +1,79 @@
+/**
+ * @file: ArchiveReprojector.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Streaming observable re-projection over SCARC001 study archives
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef ARCHIVEREPROJECTOR_h
+#define ARCHIVEREPROJECTOR_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <utility>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief re-projects the raw state recordings of a study archive
+ * through a new set of observable expressions without a model, a solver
+ * or a re-simulation: each archived trajectory is read once, its rows
+ * run through the compiled-formula engine — a CSR row kernel for linear
+ * expressions, muParser bytecode otherwise — and the projected table
+ * appended to a new archive under the originating key. A 50,000-run
+ * study re-projects at the speed the disk streams it, so an observable
+ * tweak costs minutes of I/O instead of hours of simulation
+ */
+class ArchiveReprojector {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief binds the reprojector to one study archive
+         *
+         * @param archive_path SCARC001 archive written by saveArchive
+         */
+        explicit ArchiveReprojector(
+            const std::string& archive_path
+        ); //Ctor
+
+        ~ArchiveReprojector() = default; //Dtor
+
+        /**
+         * @brief streams the archive once, projecting every entry whose
+         * column labels cover the expressions' symbols. Expressions are
+         * compiled once per distinct label set, so a homogeneous study
+         * pays compilation a single time; entries already holding
+         * observable tables (or without labels) are skipped and tallied
+         * in member skipped_entries. A "+state" key suffix — the raw
+         * recording saveArchive keeps beside a projected task — is
+         * stripped from the output key
+         *
+         * @param observable_defs name, expression pairs; expressions may
+         * reference archived column labels and numeric literals
+         * @param output_path destination archive of projected tables
+         *
+         * @returns number of trajectories re-projected
+         */
+        size_t reproject(
+            const std::vector<std::pair<std::string, std::string>>& observable_defs,
+            const std::string& output_path
+        );
+
+    //------------------------------members---------------------------------//
+        // entries the last reproject call could not project: unlabeled,
+        // or already observable tables whose columns miss the symbols
+        size_t skipped_entries = 0;
+
+
+    private:
+    //------------------------------members---------------------------------//
+        std::string archive_path;
+
+};
+
+#endif // ARCHIVEREPROJECTOR_H
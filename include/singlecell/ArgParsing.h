@@ -1,9 +1,9 @@
 /**
  * @file: ArgParsing.h
- * 
+ *
  * @authors  Jonah R. Huggins
  * @date 30-05-2025
- * 
+ *
  * @brief Creates class for main function to interpret Command line arguments
  */
 //========================header file definition============================//
@@ -14,88 +14,152 @@
 
 //===========================Library Import=================================//
 //Std Libaries
-#include <any>
-#include <vector>
 #include <string>
-#include <memory>
-#include <optional>
+#include <vector>
 #include <unordered_map>
 
 // Internal libraries
 
 //==========================Class Declaration===============================//
+/**
+ * @brief typed run configuration, parsed once at startup. Every option
+ * has its final type here, so main never probes std::any casts; batch
+ * schedulers can supply the same keys through a --config run file
+ * instead of long argv strings
+ */
+struct RunConfig {
+
+    double start = 0.0; //seconds
+    double stop = 60.0; //seconds
+    double step = 1.0; //seconds
+
+    long long seed = -1; // negative means entropy-seeded, irreproducible
+
+    int progress_interval = 1; //steps between progress lines
+
+    int threads = 0; // shared scheduler width; <= 0 uses hardware concurrency
+
+    // ensemble width; above 1 each replicate writes its own output shard
+    // named from the template and a manifest ties the shards together
+    int replicates = 1;
+
+    double steady_state_tol = 0.0; // zero runs the full grid
+
+    bool parallel = false; // step modules on concurrent threads
+    bool analyze = false; // print the preflight cost report and exit
+    bool autotune = false; // per-model kernel autotuning on first run
+
+    // named CVODES settings bundle: screening, standard or precise
+    std::string solver_profile = "standard";
+
+    std::string stochastic_model = "../sbml_files/Stochastic.sbml";
+    std::string deterministic_model = "../sbml_files/Hybrid.sbml";
+    std::string output = "../src/results.tsv";
+    // comma-separated SBML paths to cache-warm and exit; empty disables
+    std::string preload;
+
+    // additional output sinks, "path[,every=N][,species=a+b+c]" each;
+    // when any are set they replace the single --output write and all
+    // write concurrently from the one recorded matrix
+    std::vector<std::string> sinks;
+
+    std::string perf_output; // empty disables the per-phase JSON report
+    std::string profile_entities; // empty disables the ranked entity report
+    std::string daemon_socket; // non-empty serves requests at this socket
+
+    // benchmark manifest (.yml) to run through the batch engine; empty
+    // disables manifest mode
+    std::string manifest;
+
+    // study archive to re-project through --observables definitions
+    // without re-simulating; empty disables reproject mode
+    std::string reproject;
+
+    // comma-separated observables TSV paths backing reproject mode
+    std::string observables;
+};
+
 class ArgParsing {
     public:
     // -------------------------Methods-----------------------------------//
         ArgParsing( //Constructor. ctor
-            int argc, 
+            int argc,
             char* argv[]
         );
 
         ~ArgParsing() = default; //Destructor, dtor
 
         //---------------------------Members----------------------------------//
-        std::unordered_map<std::string, std::any> cli_map;
+        RunConfig config;
         std::unordered_map<std::string, double> entity_map;
 
 
         private:
         // -------------------------Methods-----------------------------------//
         /**
-         * @brief converts key-value pair args from the command line into a map
-         * for reference in main
-         * 
+         * @brief applies CLI flags onto the config, run file first when
+         * --config appears so explicit flags override its values
+         *
          * @param argc OS-defined parameter for CLI-argument count
          * @param argv OS-defined parameter for CLI-arguements as a vector of char*,
          *  representing individual CLI args.
-         * 
-         * @returns None stores map in class-member cli_map
+         *
+         * @returns None updates class-member config
          */
-        std::unordered_map<std::string, std::any> cliToMap(
+        void cliToConfig(
             int argc,
             char* argv[]
         );
 
+        /**
+         * @brief assigns one option onto the config by key, converting the
+         * string value to the field's type; shared by the CLI pass and the
+         * run-file pass
+         *
+         * @param key the option name, leading dashes stripped
+         * @param value the raw string value
+         *
+         * @returns true when the key named a known option
+         */
+        bool applyOption(
+            const std::string& key,
+            const std::string& value
+        );
+
         //---------------------------Members----------------------------------//
 
 
         protected:
         // -------------------------Methods-----------------------------------//
         /**
-         * @brief Examine a string thats a path and return as kvp
-         * 
-         * @param argc
-         * @param argv
-         * @param index
-         * @param def
-         * @param arg_name 
-         * 
-         * @returns None updates cli_map class-member
+         * @brief reads a YAML-style run file of 'key: value' lines into the
+         * config; the keys match the CLI flags without their dashes, and a
+         * line parser is all the format needs
+         *
+         * @param path the run-file path
+         *
+         * @returns None updates class-member config
          */
-        std::string parsePathArgs(
-            int argc, 
-            char* argv[],
-            int index, 
-            std::string def,
-            const char* arg_name
+        void loadRunFile(
+            const std::string& path
         );
 
         /**
          * @brief basic print help statement, used for informing users
-         * 
+         *
          * @param None
-         * 
+         *
          * @returns None
-         * 
+         *
          */
         void printUsage();
-        
+
         /**
          * @brief convert string form perturbation list to dictionary
-         * 
+         *
          * @param None
-         * 
-         * @returns None entity-mapped reference for perturbation events, 
+         *
+         * @returns None entity-mapped reference for perturbation events,
          * stored in class member entity_map
          */
         void parseDict(
@@ -104,26 +168,17 @@ class ArgParsing {
 
         /**
          * @brief Converts key-value pair options, separated by '=', into dictionary entries
-         * 
+         *
          * @param args CLI argument separated by parenthesis
-         * 
-         * @returns None Updates class-member cli_map
+         *
+         * @returns None Updates class-member entity_map
          */
         void parseKeyValuePairs(
             std::string arg
         );
 
-        /**
-         * @brief populates the ArgParser class object with default parameters
-         * 
-         * @param None
-         * 
-         * @returns args_map map of default-args for simulator.
-         */
-        std::unordered_map<std::string, std::any>  setDefaults();
-
         //---------------------------Members----------------------------------//
-        
+
 
 };
 
@@ -0,0 +1,202 @@
+/**
+ * @file AsyncResultsWriter.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Double-buffered background writer for binary trajectory streams
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef ASYNCRESULTSWRITER_h
+#define ASYNCRESULTSWRITER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <condition_variable>
+
+// Internal Libraries
+#include "singlecell/ParquetWriter.h"
+
+//==========================Class Declaration===============================//
+class AsyncResultsWriter {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief opens the output stream and writes the binary trajectory
+         * header (row count patched at finalize), then starts the I/O thread
+         *
+         * @param output path string to where the trajectory should be saved
+         * @param num_cols row width, i.e. the species count per row
+         * @param col_labels per-column (species) labels, optional
+         * @param delta_compress true writes the SCTRJ002 encoded format:
+         * each chunk is XOR-delta'd against the previous row and
+         * zero-run-length packed on the I/O thread. Fine-grained stochastic
+         * trajectories change few species per step, so the delta rows are
+         * mostly zero bytes and archives shrink several-fold
+         *
+         * Outputs ending in ".parquet" route to the columnar ParquetWriter
+         * instead: chunks flush as Parquet row groups on the I/O thread, so
+         * the stream lands warehouse-ready. delta_compress is ignored there
+         *
+         * Binary streams are crash-safe: data accumulates under
+         * "<output>.partial" with a per-chunk checksum journal beside it,
+         * and finalize renames the completed file into place atomically.
+         * singlecell-recover salvages interrupted runs from the journal
+         *
+         * @param col_intervals optional per-column recording intervals: a
+         * non-uniform schedule selects the ragged SCTRJ003 format, where
+         * row r stores only the columns with r % interval == 0 and the
+         * header carries the schedule so the reader reassembles aligned
+         * views. Fast species keep full resolution while near-constant
+         * ones stop consuming bandwidth; overrides delta_compress
+         */
+        AsyncResultsWriter(
+            const std::string& output,
+            uint64_t num_cols,
+            std::vector<std::string> col_labels = {},
+            bool delta_compress = false,
+            std::vector<uint32_t> col_intervals = {}
+        ); //Ctor
+
+        ~AsyncResultsWriter(); //Dtor, finalizes if still open
+
+        /**
+         * @brief appends one row into the active in-memory chunk. When the
+         * chunk fills, buffers swap and the I/O thread flushes the full one
+         * while the simulation keeps appending into the other
+         *
+         * @param row pointer to the first of num_cols doubles to record
+         *
+         * @returns None
+         */
+        void appendRow(
+            const double* row
+        );
+
+        /**
+         * @brief flushes any partial chunk, patches the header row count,
+         * joins the I/O thread and closes the stream, then atomically
+         * renames the ".partial" file into place and drops the recovery
+         * journal. Idempotent
+         *
+         * @returns None
+         */
+        void finalize();
+
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief I/O thread body: waits for a full chunk, writes it to disk
+         * (encoding it first when compression is enabled), and hands the
+         * emptied buffer back to the producer side
+         */
+        void writerLoop();
+
+        /**
+         * @brief records one flushed chunk in the recovery journal: row
+         * count, payload byte count and an FNV-1a checksum, with the data
+         * stream flushed first so journal entries only ever describe
+         * bytes already handed off. singlecell-recover replays these
+         * entries to salvage the intact prefix of an interrupted run
+         *
+         * @param chunk_row_count rows the chunk carries
+         * @param payload chunk bytes exactly as written to the stream
+         * @param payload_bytes payload length
+         *
+         * @returns None
+         */
+        void appendJournalEntry(
+            uint64_t chunk_row_count,
+            const unsigned char* payload,
+            size_t payload_bytes
+        );
+
+        /**
+         * @brief packs the flush chunk's due columns into member
+         * encode_buffer: row r keeps only the columns whose interval
+         * divides r. Row indices are global (rows_written counts the
+         * chunks already flushed), so the schedule is reproducible from
+         * the header intervals alone
+         *
+         * @param chunk_row_count rows the flush chunk carries
+         *
+         * @returns None populates member encode_buffer
+         */
+        void packRaggedChunk(
+            size_t chunk_row_count
+        );
+
+        /**
+         * @brief encodes the flush chunk in place: every row's bit pattern
+         * is XOR'd against the previous row (carried across chunks), then
+         * the resulting byte stream is packed as alternating zero-run /
+         * literal-run tokens into member encode_buffer
+         *
+         * @returns None populates member encode_buffer
+         */
+        void encodeChunk();
+
+    //-------------------------------members--------------------------------//
+        std::ofstream out;
+
+        // crash-safe stream paths: data accumulates at partial_path with
+        // per-chunk checksums journaled beside it, and finalize renames
+        // the completed stream to final_path
+        std::string final_path;
+        std::string partial_path;
+        std::string journal_path;
+
+        std::ofstream journal;
+
+        // set when the output path selects the Parquet format; the binary
+        // SCTRJ stream and header are skipped entirely in that mode
+        std::unique_ptr<ParquetWriter> parquet;
+
+        uint64_t num_cols;
+
+        // Optional encoding layer: XOR-delta rows + zero-run packing
+        bool delta_compress = false;
+
+        // Per-column recording intervals; non-empty selects the ragged
+        // SCTRJ003 layout where each row stores only its due columns
+        std::vector<uint32_t> col_intervals;
+
+        // Bit patterns of the last encoded row, carried across chunks so
+        // the first row of each chunk deltas against real history
+        std::vector<uint64_t> previous_row_bits;
+
+        // Reused encoding scratch; sized by the worst chunk seen
+        std::vector<unsigned char> encode_buffer;
+
+        uint64_t rows_written = 0;
+
+        // Rows per chunk before the buffers swap
+        static constexpr size_t chunk_rows = 1024;
+
+        // Producer fills active_chunk; writerLoop drains flush_chunk
+        std::vector<double> active_chunk;
+        std::vector<double> flush_chunk;
+
+        bool flush_pending = false;
+        bool shutting_down = false;
+        bool finalized = false;
+
+        std::mutex swap_mutex;
+        std::condition_variable chunk_ready;
+        std::condition_variable chunk_drained;
+
+        std::thread io_thread;
+
+};
+
+#endif // ASYNCRESULTSWRITER_H
@@ -15,13 +15,23 @@
 
 //===========================Library Import=================================//
 //Std Libraries
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <ostream>
 #include <optional>
 #include <unordered_map>
+#include <condition_variable>
 
 //Internal Libraries
+#include "singlecell/ModelData.h"
 #include "singlecell/SBMLHandler.h"
+#include "singlecell/PerfMonitor.h"
+#include "singlecell/SolverProfile.h"
+#include "singlecell/AsyncResultsWriter.h"
 
 //Third Party Libraries
 #include "sbml/SBMLReader.h"
@@ -29,6 +39,13 @@
 //==========================Class Declaration===============================//
 class BaseModule {
     private:
+    //-------------------------------members--------------------------------//
+        // Backing-store mapping bookkeeping; results_data aliases mmap_base
+        // when a mapping is live
+        void* mmap_base = nullptr;
+        size_t mmap_bytes = 0;
+        int mmap_fd = -1;
+
     //---------------------------------methods------------------------------//
 
 
@@ -38,41 +55,88 @@ class BaseModule {
     protected:
     //---------------------------------methods------------------------------//    
         /**
-         * @brief creates a matrix of results to be implemented within a derived class
+         * @brief allocates the flat results buffer to be filled within a
+         * derived class. One contiguous allocation, row-major with
+         * stride = numSpecies, replacing the old vector-of-vectors layout
          *
          * @param numSpecies integer number of species within the derived class model
          * @param numTimeSteps integer number of timesteps for simulation to load results to
-         * 
-         * @returns results_matrix species-by-timesteps matrix of doubles
+         *
+         * @returns None sizes members results_buffer & results_stride
          */
-        std::vector<std::vector<double>> createResultsMatrix(
+        void createResultsMatrix(
             int numSpecies,
             int numTimeSteps
-        ); 
+        );
 
         /**
-         * @brief Records timestep to internal results matrix
+         * @brief Records timestep to internal results matrix. Always updates
+         * member current_state; the results buffer only receives every
+         * record_interval-th step, filtered through record_mask when set
          * 
          * @param state_vector array of model states at timepoint
          * @param timepoint timepoint in simulation states were recorded for
          * 
-         * @returns None assigns new states to member results_matrix
+         * @returns None assigns new states to members current_state & results_buffer
          */
         void recordStepResult(
-            const std::vector<double>& state_vector, 
+            const std::vector<double>& state_vector,
             int timepoint
         );
 
         /**
-         * @brief Getter method for last recorded value in results matrix
-         * 
-         * @param timepoint position in results matrix being returned
-         * 
-         * @returns state_vector vector of species states recorded in results_matrix object
+         * @brief recordStepResult with a fused per-species unit
+         * conversion: state * scale_factors lands in member
+         * current_state in one multiply-and-store sweep, then records as
+         * usual. Lets steppers keep their working state in native units
+         * (e.g. whole molecules) end-to-end, paying the conversion once
+         * per step instead of once per sub-leap
+         *
+         * @param state end-of-step state in the stepper's native units
+         * @param scale_factors per-species factors into recorded units
+         * @param count species count of both arrays
+         * @param timepoint timepoint in simulation states were recorded for
          */
-        virtual std::vector<double> getLastStepResult(
+        void recordStepResultScaled(
+            const double* state,
+            const double* scale_factors,
+            size_t count,
             int timepoint
-        ) = 0;
+        );
+
+        /**
+         * @brief records whatever member current_state already holds into
+         * the results row for timepoint, without re-copying the state.
+         * Steppers that write their end state straight into current_state
+         * use this to skip the intermediate buffer of recordStepResult
+         *
+         * @param timepoint current simulation step
+         */
+        void recordCurrentState(
+            int timepoint
+        );
+
+        /**
+         * @brief unmaps and closes the backing-store mapping; safe to call
+         * when no mapping exists. Dirty pages flush through the file
+         *
+         * @returns None resets the mapping members
+         */
+        void releaseResultsMapping();
+
+        /**
+         * @brief read-only view of the previous step's full state. Backed
+         * by member current_state, so stepping reads state in place with no
+         * copy, and stays correct when the results buffer is thinned or
+         * masked
+         *
+         * @param timepoint current step position (state is always step - 1)
+         *
+         * @returns const reference to the previous step's state vector
+         */
+        const std::vector<double>& getLastStepResult(
+            int timepoint
+        ) const;
 
     //-------------------------------Members--------------------------------//
         std::string algorithm_id = "";
@@ -86,7 +150,7 @@ class BaseModule {
             SBMLHandler Module
         ); //Ctor
 
-        virtual ~BaseModule() = default; //Dtor
+        virtual ~BaseModule(); //Dtor, releases the results mapping if any
 
         /**
          * @brief retrieves private member algorithm_id for determining which simulation
@@ -114,8 +178,27 @@ class BaseModule {
          * @returns timepoints vector of float values 
          */
         static std::vector<double> setTimeSteps(
-            double start, 
-            double stop, 
+            double start,
+            double stop,
+            double step
+        );
+
+        /**
+         * @brief memoized variant of setTimeSteps: one immutable grid per
+         * distinct (start, stop, step) window, built once per process and
+         * shared by every module and session simulating it. At 1e7 steps
+         * the redundant per-module grid constructions are measurable setup
+         * cost; the shared pointer makes them a lookup
+         *
+         * @param start
+         * @param stop
+         * @param step
+         *
+         * @returns shared immutable timepoints vector
+         */
+        static std::shared_ptr<const std::vector<double>> sharedTimeSteps(
+            double start,
+            double stop,
             double step
         );
 
@@ -136,23 +219,357 @@ class BaseModule {
          * @param timepoints vector of timepoints for the simulation
          */
         virtual void run(
-            std::vector<double> timepoints
-        ) = 0;        
+            const std::vector<double>& timepoints
+        ) = 0;
 
-        void findOverlappingIds(
+        /**
+         * @brief identifies parameters here that mirror species in the
+         * target model and resolves each match once into a direct
+         * pointer pair, so per-step exchange never performs string
+         * lookups. Derived modules extend the resolution with their own
+         * per-pair bindings
+         *
+         * @param alternate_model target module's SBML model
+         */
+        virtual void findOverlappingIds(
             const Model* alternate_model
         );
     
         virtual void setSimulationSettings(
-            double start, 
-            double stop, 
+            double start,
+            double stop,
             double step
         ) = 0;
 
+        /**
+         * @brief assigns a deterministic seed to the module's random number
+         * stream. No-op for modules without stochastic sampling
+         *
+         * @param seed integer seed value for this module's RNG stream
+         *
+         * @returns None reseeds internal generator where one exists
+         */
+        virtual void setRandomSeed(
+            unsigned long long seed
+        ) {}
+
+        /**
+         * @brief serializes the module's RNG stream for checkpointing.
+         * Modules without stochastic sampling return an empty string
+         *
+         * @returns serialized generator state, replayable via setRngState
+         */
+        virtual std::string getRngState() { return ""; }
+
+        /**
+         * @brief restores a previously serialized RNG stream so a resumed
+         * run draws the same samples the original would have. No-op for
+         * modules without stochastic sampling
+         *
+         * @param state serialized generator state from getRngState
+         */
+        virtual void setRngState(const std::string& state) {}
+
+        /**
+         * @brief selects model parameters for sensitivity computation on
+         * the next full run. No-op for modules without solver-level
+         * sensitivity support; the ODE modules override it
+         *
+         * @param parameter_ids model parameter identifiers to differentiate
+         * against
+         */
+        virtual void setSensitivityParameters(
+            const std::vector<std::string>& parameter_ids
+        ) {}
+
+        /**
+         * @brief sets how many co-simulation micro-steps one solver
+         * invocation covers. No-op for modules that natively step at
+         * delta_t; the ODE module overrides it to integrate a whole
+         * macro-interval per call and serve the intermediate micro-steps
+         * from dense solver output
+         *
+         * @param micro_steps micro-steps per macro-interval; 1 disables
+         */
+        virtual void setMacroInterval(
+            int micro_steps
+        ) {}
+
+        /**
+         * @brief arms speculative lookahead stepping for modules that
+         * can cheaply roll a step back. No-op here; the ODE module
+         * overrides it to integrate the next interval under
+         * extrapolated exchange inputs and commit the result when the
+         * actual inputs land within tolerance of the prediction
+         *
+         * @param tolerance relative mismatch allowed between predicted
+         * and actual exchange inputs before a lookahead commits; 0
+         * disables
+         */
+        virtual void setSpeculativeStepping(
+            double tolerance
+        ) {}
+
+        /**
+         * @brief enables conservation-law elimination for modules whose
+         * state arrays are built at runtime. No-op here; the stochastic
+         * module overrides it to detect conserved moieties in the
+         * stoichiometry, drop the dependent species from the per-leap
+         * update and recover them algebraically
+         *
+         * @param enable true arms the analysis on the next step
+         */
+        virtual void setConservationElimination(
+            bool enable
+        ) {}
+
+        /**
+         * @brief sets the leap length for modules that sub-step inside
+         * one co-simulation interval. No-op for modules without an inner
+         * time step; the tau-leap module overrides it to cover each
+         * exchange interval with fixed-length sub-leaps
+         *
+         * @param leap_seconds leap length; <= 0 leaps the full interval
+         */
+        virtual void setLeapInterval(
+            double leap_seconds
+        ) {}
+
+        /**
+         * @brief resolves a set of override parameter ids once, so every
+         * later applyParameterOverrides call is raw array writes with no
+         * string lookups. The base resolution binds each id to its libSBML
+         * Parameter; derived modules extend it with their own engine
+         * bindings (compiled-formula slots, AMICI indices)
+         *
+         * @param parameter_ids parameter identifiers, in the order the
+         * override values will arrive
+         */
+        virtual void bindParameterOverrides(
+            const std::vector<std::string>& parameter_ids
+        );
+
+        /**
+         * @brief writes one value per bound override id into the module's
+         * live engines. Resolution happened in bindParameterOverrides, so
+         * this is the optimizer's hot path: pointer writes only
+         *
+         * @param values one value per bound id, same order as the binding
+         */
+        virtual void applyParameterOverrides(
+            const std::vector<double>& values
+        );
+
+        /**
+         * @brief pushes one compartment's new volume into the module's
+         * live evaluation state without re-resolving symbols. The base
+         * refreshes the handler's per-species volume registry; the
+         * tau-leap module extends it to patch the compartment's
+         * eval_values slot and the housed species' conversion-factor
+         * lanes in place, so growth-coupled models pay O(species in the
+         * compartment) per volume change instead of a full re-resolution
+         *
+         * @param compartment_id the compartment whose volume changed
+         * @param volume the new volume
+         */
+        virtual void applyCompartmentVolume(
+            const std::string& compartment_id,
+            double volume
+        );
+
+        /**
+         * @brief bounds results-matrix memory: record every interval-th
+         * step only, and restrict recorded columns to a species subset.
+         * Stepping state is unaffected; only persistence is thinned
+         *
+         * @param interval record every interval-th step (1 records all)
+         * @param species_subset identifiers to record; empty records all
+         *
+         * @returns None populates members record_interval & record_mask
+         */
+        void setRecordingOptions(
+            int interval,
+            const std::vector<std::string>& species_subset
+        );
+
+        /**
+         * @brief bounds the results buffer at a trailing window: only the
+         * last recorded_rows recorded rows are held, with recording
+         * wrapping modulo the window, so memory stays constant however
+         * long the grid runs. Rows pushed out of the window survive only
+         * through an attached stream writer; zero disables the window
+         *
+         * @param recorded_rows trailing recorded rows to retain
+         *
+         * @returns None populates member results_window
+         */
+        void setResultsWindow(
+            int recorded_rows
+        );
+
+        /**
+         * @brief bounds recorded precision: values written into the
+         * results rows keep only the top mantissa_bits mantissa bits
+         * (24 matches float32's ~7 significant digits). Truncated rows
+         * read back as ordinary doubles, and the zeroed low bits
+         * collapse into runs under the delta compressor, so files
+         * shrink without a format change. Stepping state keeps full
+         * precision; 52 or more bits disables truncation
+         *
+         * @param mantissa_bits mantissa bits to keep per recorded value
+         *
+         * @returns None populates member record_mantissa_mask
+         */
+        void setRecordingPrecisionBits(
+            int mantissa_bits
+        );
+
+        /**
+         * @brief enables windowed envelope summaries alongside recording:
+         * every step feeds per-species min/max/mean/variance accumulators
+         * ahead of any thinning, and each completed window of
+         * window_steps steps appends one row per statistic to a small
+         * side buffer — plot-ready downsampled envelopes without a
+         * post-processing pass over the full matrix
+         *
+         * @param window_steps steps per summary window; 0 disables
+         *
+         * @returns None resets the summary accumulators and rows
+         */
+        void setSummaryRecording(
+            int window_steps
+        );
+
+        /**
+         * @brief splits stepping and recording into a two-stage pipeline:
+         * the step thread copies each fresh state into a pending slot and
+         * returns to compute, while a per-module recorder thread runs the
+         * record stage — summary accumulation, thinning, masking,
+         * mantissa quantization and the stream append. One pending slot
+         * is the backpressure, as in the streaming writer's double
+         * buffer, so recording-heavy configurations hide the stage
+         * behind the next step's compute
+         *
+         * @param enable true starts the recorder on the next record
+         */
+        void setPipelinedRecording(
+            bool enable
+        );
+
+        /**
+         * @brief blocks until every handed-off state has been recorded;
+         * callers must drain before reading the results buffer or the
+         * summary rows. A no-op when recording is synchronous
+         */
+        void drainRecorder();
+
+        /**
+         * @brief overwrites current_state with an externally supplied
+         * state and re-records it at timepoint: the write path for
+         * mid-run interventions driven from outside the stepper, such
+         * as state forks and steering injections. The next step reads
+         * the adopted values exactly as if the stepper produced them
+         *
+         * @param state full module state to adopt
+         * @param timepoint simulation step the state belongs to
+         */
+        void adoptState(
+            const std::vector<double>& state,
+            int timepoint
+        );
+
+    protected:
+        /**
+         * @brief the recording stage itself: summary accumulation ahead
+         * of thinning, the masked row copy, mantissa quantization, the
+         * stream append and backing-store page drops. Runs inline on the
+         * step thread, or on the recorder thread when pipelined
+         *
+         * @param state full state to record, in recorded units
+         * @param timepoint current simulation step
+         */
+        void recordStage(
+            const std::vector<double>& state,
+            int timepoint
+        );
+
+        /**
+         * @brief recorder thread body: swaps the pending slot out under
+         * the lock, runs the record stage unlocked, and signals drain
+         * waiters between rows
+         */
+        void recorderLoop();
+
+        /**
+         * @brief drains outstanding work, joins the recorder thread and
+         * resets the pipeline flags; called from the destructor and when
+         * pipelining is switched off
+         */
+        void stopRecorder();
+
+    public:
+
+        /**
+         * @brief folds a trailing partial window into the summary rows;
+         * idempotent, called once when summaries are read back
+         */
+        void flushSummaryWindow();
+
+        /**
+         * @brief drops reactions the observable reachability pass proved
+         * irrelevant to the requested outputs; a no-op for modules whose
+         * solver owns the reaction network
+         *
+         * @param keep_reactions per-reaction flags; zero prunes
+         */
+        virtual void setReactionPruning(
+            const std::vector<char>& keep_reactions
+        ) { (void)keep_reactions; }
+
+        /**
+         * @brief enables per-model kernel autotuning on the next configured
+         * run; a no-op for modules without candidate kernel dispatch
+         *
+         * @param enable true resolves the dispatch before stepping
+         */
+        virtual void setKernelAutotune(
+            bool enable
+        ) { (void)enable; }
+
+        /**
+         * @brief getter for the identifiers actually recorded per row,
+         * i.e. the module's species list filtered through record_mask
+         *
+         * @returns recorded_ids string vector of recorded species identifiers
+         */
+        std::vector<std::string> getRecordedSpeciesIds();
+
+        /**
+         * @brief toggles per-entity cost accounting: stochastic modules
+         * accumulate per-reaction evaluation time and firing counts,
+         * AMICI modules accumulate CVODES work counters per step. Off by
+         * default since the extra clock reads land on hot paths
+         *
+         * @param enable true accumulates, false leaves the paths untouched
+         */
+        virtual void setEntityProfiling(
+            bool enable
+        ) { this->entity_profiling = enable; }
+
+        /**
+         * @brief writes this module's ranked entity cost report; emits
+         * nothing unless profiling was enabled for the run
+         *
+         * @param out destination stream for the report section
+         */
+        virtual void reportEntityProfile(
+            std::ostream& out
+        ) { (void)out; }
+
         /**
          * @brief Exchange method for swapping parameters with species values in modules
          *  @NOTE: required method in Stochastic- & Deterministic- Modules
-         * 
+         *
          * @returns None updates internal models.
          */
         virtual void updateParameters() = 0;
@@ -161,17 +578,264 @@ class BaseModule {
         SBMLHandler handler;
         Model* sbml;
 
-        std::vector<std::vector<double>> stoichmat;
+        // Immutable per-model data (stoichiometry, formulas, index maps),
+        // shared read-only with every module loaded from the same file
+        std::shared_ptr<const ModelData> model_data;
 
-        std::vector<std::string> formulas_vector;
+        /**
+         * @brief points recording at an external column block inside a
+         * caller-owned global matrix: rows advance by the global row
+         * stride while this module writes only its own columns, so the
+         * end-of-run combine step becomes a view instead of a copy
+         *
+         * @param base first column of this module's block, row zero
+         * @param row_stride the global matrix row width in doubles
+         *
+         * @returns None createResultsMatrix skips its own allocation
+         */
+        void bindExternalResults(
+            double* base,
+            int row_stride
+        );
+
+        /**
+         * @brief grows module-owned results storage to a longer horizon
+         * while keeping every recorded row in place, so a finished run
+         * can be extended without resimulating. In-memory buffers resize;
+         * backing-store mappings grow through ftruncate and remap. A
+         * no-op for externally bound storage, whose owner grows it
+         *
+         * @param numTimeSteps total timestep count of the extended run
+         *
+         * @returns None resizes the results storage behind results_data
+         */
+        void growResultsMatrix(
+            int numTimeSteps
+        );
+
+        // Row-major timesteps-by-species results storage, single allocation
+        std::vector<double> results_buffer;
+
+        // Points at results_buffer, or at the file mapping when a backing
+        // store is set; every read and write path goes through this
+        double* results_data = nullptr;
+
+        // When non-empty, createResultsMatrix maps the results into this
+        // file instead of allocating, so trajectories larger than RAM
+        // record sequentially while the OS evicts cold rows
+        std::string mmap_backing_path;
+
+        // Row length of results_buffer, i.e. the module's species count
+        int results_stride = 0;
 
-        std::vector<std::vector<double>> results_matrix;
+        // Distance between consecutive rows of this module's results;
+        // equals results_stride for module-owned storage, or the global
+        // row width when bound into a shared matrix
+        int results_row_stride = 0;
+
+        // Set by bindExternalResults; cleared when storage is module-owned
+        bool external_results = false;
+
+        /**
+         * @brief row-view accessor into the flat results buffer
+         *
+         * @param timepoint row in the results buffer being returned
+         *
+         * @returns pointer to the first species value recorded at timepoint
+         */
+        const double* getResultsRow(
+            int timepoint
+        ) const;
+
+        /**
+         * @brief fills every recording row from from_step through the end
+         * of the grid with the module's current state. Used when a run
+         * terminates early at steady state, so the results grid keeps its
+         * requested shape with the equilibrium value in the remaining rows
+         *
+         * @param from_step first step index to back-fill
+         * @param num_steps total step count of the recording grid
+         */
+        void backfillResults(
+            int from_step,
+            int num_steps
+        );
 
         std::vector<std::string> overlapping_params;
 
+        // interned handles aligned with overlapping_params; the exchange
+        // wiring matches producers by integer equality on these
+        std::vector<uint32_t> overlapping_symbols;
+
+        /**
+         * @brief one resolved parameter-species exchange binding: the
+         * local parameter receiving a value and the target-model species
+         * supplying it, both looked up exactly once
+         */
+        struct ExchangePair {
+            Parameter* parameter;
+            const Species* source;
+        };
+
+        // Resolved exchange bindings, aligned with overlapping_params
+        std::vector<ExchangePair> exchange_pairs;
+
+        // Pre-resolved override targets, one per bound id; nullptr marks
+        // ids this module's SBML document does not define
+        std::vector<Parameter*> override_parameters;
+
+        // Change tracking for the exchange phase: last value written per
+        // pair (NaN until first write) and the tolerance below which a
+        // pair is considered quiescent and skipped entirely
+        std::vector<double> last_exchanged_values;
+        double exchange_tolerance = 0.0;
+
+        // Declared exchange view: when non-empty, overlap resolution
+        // probes exactly these boundary ids instead of scanning the full
+        // entity sets of every module pair
+        std::vector<std::string> exchange_view;
+
+        // Active solver settings bundle; the ODE modules apply it in
+        // setSimulationSettings, stochastic modules ignore it
+        SolverProfile solver_profile;
+
+        // Per-entity cost accounting toggle; see setEntityProfiling
+        bool entity_profiling = false;
+
+        // Lock-free SPSC exchange slots, aligned with exchange_pairs on
+        // the consumer side; null when a pair has no producing module
+        std::vector<std::atomic<double>*> exchange_slots_in;
+
+        // Producer side: (species index, slot) pairs published after each
+        // step, one writer (this module's step thread) per slot
+        std::vector<std::pair<int, std::atomic<double>*>> exchange_slots_out;
+
+        /**
+         * @brief stores this module's exchanged species values into their
+         * slots with release ordering; called on the module's step thread,
+         * so each slot keeps a single producer
+         *
+         * @returns None publishes member current_state entries
+         */
+        void publishExchanges();
+
+        /**
+         * @brief consumer-side read of exchange pair i: an acquire load
+         * from its slot when wired, falling back to the producer's libSBML
+         * object for sessions without slot wiring
+         *
+         * @param i index into member exchange_pairs
+         *
+         * @returns the freshest published value for the pair
+         */
+        double readExchangedValue(
+            size_t i
+        ) const;
+
+        /**
+         * @brief mirrors the last exchanged value of every pair into its
+         * libSBML Parameter. The per-step exchange writes the simulation
+         * engines only; this explicit sync is for the infrequent moments
+         * the documents themselves are read — end of run, checkpointing,
+         * user introspection
+         *
+         * @returns None writes member last_exchanged_values into libSBML
+         */
+        void syncExchangedParameters();
+
+        /**
+         * @brief mirrors the final current_state into the libSBML document
+         * once at run end; stepping itself never writes species into the
+         * document, so this is what keeps post-run introspection and
+         * repeat-run continuation consistent. current_state is the one
+         * authoritative state buffer — the handler registry and the
+         * document are mirrors written only through this call — and debug
+         * builds verify all three agree after the write
+         *
+         * @returns None writes member current_state into libSBML
+         */
+        void syncStateToDocument();
+
+        // Concrete-type tag fixed at construction. The step loop
+        // switches on it and calls step through the exact type, turning
+        // the hottest virtual boundary into a direct, inlinable call;
+        // Generic keeps plain virtual dispatch
+        enum class ModuleKind {
+            Generic,
+            Deterministic,
+            Stochastic,
+            SSA,
+            Hybrid
+        };
+
+        ModuleKind module_kind = ModuleKind::Generic;
+
         std::vector<BaseModule*> targets;
 
-        std::vector<double> timesteps;
+        // Optional streaming sink; rows recorded here flush on the I/O
+        // thread while the simulation keeps stepping
+        std::shared_ptr<AsyncResultsWriter> stream_writer;
+
+        // Borrowed per-phase timing sink; null disables instrumentation
+        PerfMonitor* perf = nullptr;
+
+        // Full state of the most recent step; stepping reads this, so
+        // thinned or masked recording never degrades the simulation itself
+        std::vector<double> current_state;
+
+        // Forward sensitivities from the last full run, flat row-major
+        // (timepoints x parameters x states); empty unless enabled
+        std::vector<double> sensitivities;
+        int num_sensitivity_parameters = 0;
+        int num_sensitivity_states = 0;
+
+        // Record every k-th step into the results buffer
+        int record_interval = 1;
+
+        // Trailing recorded rows retained when positive; recording wraps
+        // modulo this window so the buffer never grows with the grid
+        int results_window = 0;
+
+        // Mantissa mask applied to every recorded value; all-ones keeps
+        // full precision, see setRecordingPrecision
+        uint64_t record_mantissa_mask = ~0ull;
+
+        // Species indices persisted per recorded row; empty means all
+        std::vector<int> record_mask;
+
+        // Windowed envelope summaries: steps per window (0 disables),
+        // the open window's per-species accumulators, and one appended
+        // row of results_stride values per statistic per closed window
+        int summary_window = 0;
+        int summary_count = 0;
+        std::vector<double> summary_min;
+        std::vector<double> summary_max;
+        std::vector<double> summary_sum;
+        std::vector<double> summary_sumsq;
+        std::vector<double> summary_min_rows;
+        std::vector<double> summary_max_rows;
+        std::vector<double> summary_mean_rows;
+        std::vector<double> summary_var_rows;
+
+        // Pipelined recording: the step thread publishes each fresh
+        // state into pending_record; the recorder thread swaps it into
+        // record_stage_state and runs the record stage. One pending slot
+        // is the backpressure between the two stages
+        bool pipelined_recording = false;
+        bool record_pending = false;
+        bool record_stage_active = false;
+        bool recorder_shutdown = false;
+        int pending_timepoint = 0;
+        std::vector<double> pending_record;
+        std::vector<double> record_stage_state;
+        std::thread recorder_thread;
+        std::mutex record_mutex;
+        std::condition_variable record_ready;
+        std::condition_variable record_drained;
+
+        // Immutable time grid shared across every module (and the
+        // session) simulating the same window; see sharedTimeSteps
+        std::shared_ptr<const std::vector<double>> time_grid;
 
 
 };
@@ -0,0 +1,452 @@
+/**
+ * @file: CellPopulation.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Class Creator For multi-cell population simulations in one process
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef CELLPOPULATION_h
+#define CELLPOPULATION_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <vector>
+#include <string>
+#include <memory>
+#include <optional>
+
+//Internal Libraries
+#include "singlecell/SingleCell.h"
+#include "singlecell/P2Quantile.h"
+#include "singlecell/PopulationLayout.h"
+
+//==========================Class Declaration===============================//
+class CellPopulation {
+    public:
+        /**
+         * @brief one division of the lockstep run: which cell forked,
+         * the index its daughter received and the grid time it happened.
+         * The event table is the lineage record — daughters carry no
+         * trajectory history before their fork step
+         */
+        struct DivisionEvent {
+            double time;
+            int parent_index;
+            int child_index;
+        };
+
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief builds a population of num_cells SingleCell instances from
+         * one set of SBML paths, all within the current process
+         *
+         * @param sbml_paths strings of paths to SBML model files
+         * @param num_cells integer number of cells to simulate
+         */
+        CellPopulation(
+            std::vector<std::string> sbml_paths,
+            int num_cells
+        ); //Ctor
+
+        virtual ~CellPopulation() = default; //Dtor
+
+        /**
+         * @brief assigns a base RNG seed; cell i receives substream
+         * seed + i so every cell's trajectory is independent and replayable
+         *
+         * @param seed integer base seed value for the population
+         */
+        void setSeed(
+            unsigned long long seed
+        );
+
+        /**
+         * @brief thins what each cell records and returns: every Nth row,
+         * optionally restricted to a species subset. For large populations
+         * the recordings are the only data leaving the resident sessions,
+         * so thinning directly shrinks the returned slab
+         *
+         * @param interval record every Nth timestep (1 records all)
+         * @param species_subset species ids to keep; empty keeps all
+         */
+        void setRecording(
+            int interval,
+            const std::vector<std::string>& species_subset = {}
+        );
+
+        /**
+         * @brief declares the boundary ids every cell session exchanges,
+         * forwarded as each cell's exchange view. Tissue-scale couplings
+         * trade only a handful of ligand concentrations per cell, so
+         * overlap resolution across N cells probes N x view ids instead
+         * of scanning full entity sets pairwise
+         *
+         * @param name view label, carried for reporting
+         * @param entity_ids boundary identifiers the coupling exchanges
+         */
+        void setExchangeView(
+            const std::string& name,
+            const std::vector<std::string>& entity_ids
+        );
+
+        /**
+         * @brief simulates every cell in the population across a pool of
+         * worker threads, each cell running its full trajectory
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_threads worker thread count; 0 uses hardware concurrency
+         *
+         * @returns per-cell results matrices, indexed [cell][timestep][species]
+         */
+        std::vector<std::vector<std::vector<double>>> simulate(
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0, //seconds
+            int num_threads = 0
+        );
+
+        /**
+         * @brief simulates the population in lockstep: every cell holds a
+         * resident stepping session and the whole population advances one
+         * exchange interval at a time behind a barrier. Each worker owns
+         * a contiguous cell range for the entire run — construction,
+         * every step and teardown happen on the same (NUMA-pinned)
+         * thread — so per-cell state stays cache-warm between the short
+         * per-step visits instead of being evicted by full-trajectory
+         * runs. Identical delta_t across cells is what makes the layout
+         * cell-major: step s of all cells runs before step s+1 of any.
+         * When division is armed through setDivision, daughters fork in
+         * and join the lockstep mid-run
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_threads worker thread count; 0 uses hardware concurrency
+         *
+         * @returns per-cell results matrices, indexed [cell][timestep][species];
+         * with division armed the vector spans the daughter capacity and
+         * slots never spawned stay empty
+         */
+        std::vector<std::vector<std::vector<double>>> simulateSynchronized(
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0, //seconds
+            int num_threads = 0
+        );
+
+        /**
+         * @brief selects the memory layout of the slab
+         * simulateSynchronizedFlat returns, the population analogue of
+         * the single-cell setResultsLayout toggle. "cell" keeps each
+         * cell's trajectory contiguous, "species" keeps one (timestep,
+         * species) value contiguous across all cells for population
+         * reductions, "tiled" interleaves blocks of cells per value so
+         * both patterns stay cache-resident, and "auto" times the
+         * candidates once per run and keeps the fastest
+         *
+         * @param layout "cell", "species", "tiled" or "auto"
+         */
+        void setSlabLayout(
+            const std::string& layout
+        );
+
+        /**
+         * @brief lockstep run returning one flat slab instead of nested
+         * per-cell matrices: simulateSynchronized gathers into the layout
+         * setSlabLayout chose, in one cache-blocked packing pass.
+         * Dimensions land in last_slab_cells, last_slab_timesteps and
+         * last_slab_species; cell slots never spawned hold NaN rows.
+         * Population-level aggregation reads species-across-cells
+         * contiguously under the species and tiled layouts instead of
+         * striding across per-cell allocations
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_threads worker thread count; 0 uses hardware concurrency
+         *
+         * @returns flat population slab laid out per getSlabLayout
+         */
+        std::vector<double> simulateSynchronizedFlat(
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0, //seconds
+            int num_threads = 0
+        );
+
+        /**
+         * @brief getter for the resolved layout of the last flat slab —
+         * "cell", "species" or "tiled:<width>" — so callers (and the
+         * binding layer) can interpret the buffer; autotuned runs report
+         * the winner here
+         *
+         * @returns layout description of the last simulateSynchronizedFlat
+         */
+        std::string getSlabLayout() const;
+
+        /**
+         * @brief arms growth and division for the lockstep mode: after
+         * each global step, any cell whose trigger species has reached
+         * the threshold forks. The daughter adopts the parent's state
+         * through forkSteppingFrom — a per-module buffer copy, not a
+         * fresh trajectory — with the trigger species halved in both so
+         * neither re-fires immediately, and joins the lockstep grid from
+         * the next step on its creating worker. Daughters draw the RNG
+         * substream of their global index (seed + index), and indices
+         * come from per-worker reserved ranges, so a run is replayable
+         * at a fixed thread count. Divisions land in the event table
+         * read back through getDivisionEvents
+         *
+         * @param trigger_species species id whose level triggers division
+         * @param threshold trigger level at or above which a cell divides
+         * @param max_cells population cap including the starting cells;
+         * 0 caps at four times the starting population
+         */
+        void setDivision(
+            const std::string& trigger_species,
+            double threshold,
+            int max_cells = 0
+        );
+
+        /**
+         * @brief getter for the division events of the last
+         * simulateSynchronized run, in no particular order across
+         * workers; the lineage record for dividing populations
+         *
+         * @returns one DivisionEvent per division that occurred
+         */
+        const std::vector<DivisionEvent>& getDivisionEvents() const;
+
+        /**
+         * @brief toggles NUMA-aware worker placement. When enabled (the
+         * default) and the machine exposes more than one NUMA node,
+         * worker shards are pinned round-robin across the nodes before
+         * they build their resident sessions, so first-touch lands each
+         * shard's model data, state and results in socket-local memory
+         * instead of crossing the interconnect
+         *
+         * @param enable false forces plain unpinned workers
+         */
+        void setNumaAware(
+            bool enable
+        );
+
+        /**
+         * @brief selects the quantiles the streaming statistics mode
+         * estimates per timestep and species, via P-squared markers
+         *
+         * @param quantiles targets in (0, 1), e.g. {0.05, 0.5, 0.95}
+         */
+        void setSummaryQuantiles(
+            const std::vector<double>& quantiles
+        );
+
+        /**
+         * @brief registers threshold-crossing tracking for percent-death
+         * style readouts: per thresholded species, the streaming mode
+         * accumulates the fraction of cells whose trajectory has crossed
+         * the threshold by each timestep, retrievable afterwards through
+         * getCrossingFractions
+         *
+         * @param thresholds species id, threshold value pairs
+         */
+        void setCrossingThresholds(
+            const std::vector<std::pair<std::string, double>>& thresholds
+        );
+
+        /**
+         * @brief simulates the population like simulate, but reduces each
+         * cell's trajectory into streaming accumulators (Welford moments,
+         * P-squared quantiles, threshold crossings) and discards it, so
+         * memory is independent of the cell count. Population sizes that
+         * could never hold every trajectory fit on one node
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_threads worker thread count; 0 uses hardware concurrency
+         *
+         * @returns statistics indexed [statistic][timestep][species], in
+         * the order: mean, standard deviation, then one per set quantile
+         */
+        std::vector<std::vector<std::vector<double>>> simulateStatistics(
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0, //seconds
+            int num_threads = 0
+        );
+
+        /**
+         * @brief restricts this instance to one shard of the population:
+         * cells whose global index lands in the shard are simulated, the
+         * rest are skipped. Seeds stay keyed by global index, so the
+         * union of all shards reproduces the unsharded population
+         * exactly. Shards run on separate nodes (one per MPI rank in the
+         * population driver) and their accumulators merge afterwards
+         * through exportAccumulators and mergeAccumulators
+         *
+         * @param shard_index this shard's index in [0, num_shards)
+         * @param num_shards total shard count across all nodes
+         */
+        void setShard(
+            int shard_index,
+            int num_shards
+        );
+
+        /**
+         * @brief packs the last simulateStatistics run's accumulators —
+         * Welford moments, P-squared marker states, threshold crossings
+         * and the folded cell count — into one flat double vector. The
+         * packed form is the only thing shards exchange; raw
+         * trajectories never leave a node
+         *
+         * @returns the packed accumulator state
+         */
+        std::vector<double> exportAccumulators() const;
+
+        /**
+         * @brief folds another shard's packed accumulators into this
+         * instance: Welford moments combine by the parallel (Chan)
+         * update, P-squared markers by their compact-state merge, and
+         * crossing counts by summation. An instance that has not run
+         * adopts the packed state wholesale, so tree reductions can
+         * merge on any rank
+         *
+         * @param packed a vector produced by exportAccumulators
+         */
+        void mergeAccumulators(
+            const std::vector<double>& packed
+        );
+
+        /**
+         * @brief materializes the summary matrices from the current
+         * accumulator state, exactly as simulateStatistics returns them;
+         * called on the reduction root after the last merge
+         *
+         * @returns statistics indexed [statistic][timestep][species], in
+         * the order: mean, standard deviation, then one per set quantile
+         */
+        std::vector<std::vector<std::vector<double>>> finalizeStatistics();
+
+        /**
+         * @brief re-simulates one cell of the population in isolation at
+         * full recording resolution. The counter-based RNG substream for
+         * (seed + cell_index) reproduces the population run's draws
+         * exactly, so an interesting trajectory spotted in a thinned or
+         * reduced run can be reconstructed without re-running the rest
+         *
+         * @param cell_index index of the cell to replay
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         *
+         * @returns the cell's full results matrix, [timestep][species]
+         */
+        std::vector<std::vector<double>> replayCell(
+            int cell_index,
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0 //seconds
+        );
+
+        /**
+         * @brief getter for the threshold-crossing fractions of the last
+         * simulateStatistics run, indexed [timestep][species]; columns of
+         * species without a registered threshold stay zero
+         *
+         * @returns fraction of cells crossed by each timestep
+         */
+        std::vector<std::vector<double>> getCrossingFractions();
+
+        /**
+         * @brief getter method for the population's species identifiers,
+         * identical across cells since all share the same model files
+         *
+         * @returns global_ids string vector of species identifiers
+         */
+        std::vector<std::string> getGlobalSpeciesIds();
+
+    //------------------------------members---------------------------------//
+        int num_cells;
+
+        // Dimensions of the slab returned by the last
+        // simulateSynchronizedFlat call; cells spans the daughter
+        // capacity when division is armed
+        size_t last_slab_cells = 0;
+        size_t last_slab_timesteps = 0;
+        size_t last_slab_species = 0;
+
+
+    private:
+    //------------------------------members---------------------------------//
+        std::vector<std::string> sbml_paths;
+
+        // Base seed for the population; cell substreams offset from it
+        std::optional<unsigned long long> rng_seed;
+
+        // Recording thinning forwarded into every cell session
+        int record_interval = 1;
+        std::vector<std::string> record_species;
+
+        // Exchange view forwarded into every cell session; empty ids
+        // keep full pairwise overlap discovery
+        std::string exchange_view_name = "";
+        std::vector<std::string> exchange_view_ids;
+
+        // Pin worker shards across NUMA nodes when more than one exists
+        bool numa_aware = true;
+
+        // Requested slab layout and the layout the last flat run
+        // resolved it to (autotuning replaces "auto" with a winner)
+        std::string slab_layout_request = "cell";
+        PopulationLayout slab_layout;
+
+        // Division trigger for the lockstep mode; an empty species id
+        // leaves division disarmed
+        std::string division_species = "";
+        double division_threshold = 0.0;
+        int division_max_cells = 0;
+
+        // Lineage record of the last simulateSynchronized run
+        std::vector<DivisionEvent> division_events;
+
+        // Streaming statistics configuration and the last run's
+        // threshold-crossing fractions, [timestep][species]
+        std::vector<double> summary_quantiles;
+        std::vector<std::pair<std::string, double>> crossing_thresholds;
+        std::vector<std::vector<double>> crossing_fractions;
+
+        // Shard assignment: this instance simulates global cell indices
+        // congruent to shard_index modulo num_shards
+        int shard_index = 0;
+        int num_shards = 1;
+
+        // One running-moment accumulator per (timestep, species) cell
+        struct Welford {
+            double count = 0.0;
+            double mean = 0.0;
+            double m2 = 0.0;
+        };
+
+        // Streaming accumulators of the last simulateStatistics run,
+        // kept so shards can export, merge and re-finalize them
+        std::vector<Welford> moments;
+        std::vector<std::vector<P2Quantile>> quantile_markers;
+        std::vector<double> first_crossings;
+        std::vector<double> column_thresholds;
+        size_t stat_rows = 0;
+        size_t stat_cols = 0;
+
+        // Cells folded into the accumulators so far; after merging this
+        // is the population total, the crossing-fraction denominator
+        double folded_cells = 0.0;
+
+};
+
+#endif // CELLPOPULATION_H
@@ -0,0 +1,117 @@
+/**
+ * @file: DaemonServer.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Persistent daemon serving simulate requests over a Unix socket
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef DAEMONSERVER_h
+#define DAEMONSERVER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <memory>
+
+//Internal Libraries
+#include "singlecell/SingleCell.h"
+
+//==========================Class Declaration===============================//
+/**
+ * @brief keeps one resident SingleCell session alive and serves simulate
+ * requests over a Unix domain socket, so repeated short simulations pay
+ * model loading, AMICI construction and formula compilation exactly once
+ * per daemon lifetime instead of once per process launch.
+ *
+ * The wire protocol is binary and native-endian, one request per frame:
+ *
+ *   request:  int32 num_overrides      (negative shuts the daemon down)
+ *             per override: int32 id_length, id bytes, double value
+ *             double start, stop, step
+ *
+ *   response: int32 status             (0 ok; 1 error, then int32
+ *             message_length + message bytes)
+ *             int32 rows, int32 cols
+ *             rows * cols doubles, row-major (timesteps-by-species)
+ *
+ * Overrides apply through the bound fast-parameter path onto the
+ * resident session after a reset, so they persist only for their own
+ * request's run; each request re-states its full override set
+ */
+class DaemonServer {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief builds the resident session from one set of SBML paths;
+         * all per-model setup cost is paid here, before the first request
+         *
+         * @param sbml_paths strings of paths to SBML model files
+         */
+        DaemonServer(
+            const std::vector<std::string>& sbml_paths
+        ); //Ctor
+
+        ~DaemonServer() = default; //Dtor
+
+        /**
+         * @brief binds the Unix socket at socket_path and serves requests
+         * until a shutdown frame (negative override count) arrives.
+         * Clients are handled one at a time: the resident session is the
+         * shared resource, and request latency is the simulation itself
+         *
+         * @param socket_path filesystem path for the listening socket; an
+         * existing socket file at the path is replaced
+         *
+         * @returns 0 on clean shutdown, 1 on a socket setup failure
+         */
+        int serve(
+            const std::string& socket_path
+        );
+
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief reads request frames from one connected client and
+         * answers each with a result frame, until the client disconnects
+         * or sends the shutdown frame
+         *
+         * @param client_fd connected stream socket descriptor
+         *
+         * @returns false when the client requested daemon shutdown
+         */
+        bool handleConnection(
+            int client_fd
+        );
+
+        /**
+         * @brief runs one simulate request on the resident session:
+         * reset, apply the overrides through bindParameters and
+         * setParameters, simulate the requested grid
+         *
+         * @param overrides per-request (entity_id, value) parameter set
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         *
+         * @returns flat row-major buffer, timesteps-by-species
+         */
+        std::vector<double> runRequest(
+            const std::vector<std::pair<std::string, double>>& overrides,
+            double start,
+            double stop,
+            double step
+        );
+
+    //------------------------------members---------------------------------//
+        // The resident session; alive for the daemon's whole lifetime
+        std::unique_ptr<SingleCell> cell;
+
+};
+
+#endif // DAEMONSERVER_h
@@ -27,7 +27,7 @@
 #include "amici/amici.h"
 
 //==========================Class Declaration===============================//
-class DeterministicModule : public BaseModule {
+class DeterministicModule final : public BaseModule {
     public:
     //----------------------------Methods-----------------------------------//
         DeterministicModule(
@@ -67,15 +67,105 @@ class DeterministicModule : public BaseModule {
          * @param timepoints vector of timepoints for the simulation
          */
         void run(
-            std::vector<double> timepoints
+            const std::vector<double>& timepoints
+        ) override;
+
+        /**
+         * @brief overrides the base no-op: maps each identifier to its
+         * AMICI parameter index and arms first-order forward sensitivities
+         * for the next full run. One instrumented solve then returns the
+         * trajectory and its gradient together, replacing N+1
+         * finite-difference simulate calls per fitting iteration
+         *
+         * @param parameter_ids AMICI parameter identifiers to
+         * differentiate against; empty disables sensitivities
+         */
+        void setSensitivityParameters(
+            const std::vector<std::string>& parameter_ids
+        ) override;
+
+        /**
+         * @brief arms multirate coupling: one CVODES invocation per
+         * micro_steps co-simulation steps, with dense output at every
+         * micro-step so the exchange phase still hands the stochastic
+         * module interpolated values each delta_t. Stochastic feedback
+         * re-enters the solver at macro boundaries
+         *
+         * @param micro_steps micro-steps per macro-interval; 1 disables
+         */
+        void setMacroInterval(
+            int micro_steps
+        ) override;
+
+        /**
+         * @brief arms speculative lookahead: at the end of each
+         * lockstep solve the next interval integrates immediately under
+         * linearly extrapolated exchange inputs, and commits at the
+         * following step when the actual inputs land within tolerance —
+         * in weakly-coupled regimes the whole solve then hides inside
+         * the partner's stepping time under parallel stepping. A miss
+         * costs nothing: the recorded state was never touched, so
+         * rollback is just running the normal solve
+         *
+         * @param tolerance relative mismatch allowed between predicted
+         * and actual exchange inputs before a lookahead commits; 0
+         * disables
+         */
+        void setSpeculativeStepping(
+            double tolerance
         ) override;
 
         /**
          * @brief exchanges parameter-to-species values with target-modules
          * 
          */
+        /**
+         * @brief extends the base resolution: each exchanged parameter is
+         * additionally mapped to its AMICI fixed-parameter index, resolved
+         * once so per-step exchange updates a cached vector instead of
+         * calling setFixedParameterById per id
+         *
+         * @param alternate_model target module's SBML model
+         */
+        void findOverlappingIds(
+            const Model* alternate_model
+        ) override;
+
         void updateParameters();
-        
+
+        /**
+         * @brief extends the base binding: each override id additionally
+         * resolves to its AMICI fixed-parameter index, so applies batch
+         * into one setFixedParameters push on the live model
+         *
+         * @param parameter_ids parameter identifiers, in apply order
+         */
+        void bindParameterOverrides(
+            const std::vector<std::string>& parameter_ids
+        ) override;
+
+        /**
+         * @brief applies override values to libSBML and the live AMICI
+         * model without reconstructing either; one batched push per call
+         *
+         * @param values one value per bound id, same order as the binding
+         */
+        void applyParameterOverrides(
+            const std::vector<double>& values
+        ) override;
+
+        /**
+         * @brief CVODES work totals accumulated per step while entity
+         * profiling was on: integrator steps, right-hand-side
+         * evaluations and failure counts. Emits nothing when profiling
+         * was off
+         *
+         * @param out destination stream for the report section
+         */
+        void reportEntityProfile(
+            std::ostream& out
+        ) override;
+
     //-------------------------------Members--------------------------------//
         std::string algorithm_id;
 
@@ -83,32 +173,92 @@ class DeterministicModule : public BaseModule {
     private:
     // ---------------------------Methods-----------------------------------//
         std::vector<double> setAllSpeciesValues(
-            std::vector<double> current_states,
-            std::vector<double> update_states
+            const std::vector<double>& current_states,
+            const std::vector<double>& update_states
         );
 
-        std::vector<double> getNewStepResult(
-            const amici::ReturnData &rdata
+        /**
+         * @brief integrates the next interval from current_state under
+         * extrapolated exchange inputs and stashes the end state for
+         * the next step's commit check; restores the actual parameters
+         * afterwards so a quiescent exchange never leaves predictions
+         * in the live model
+         *
+         * @param step the step whose solve just completed
+         */
+        void speculateNextStep(
+            int step
         );
+
+        /**
+         * @brief compares the inputs the lookahead was solved under to
+         * the inputs the boundary exchange actually applied
+         *
+         * @returns true when every pair lands within the speculation
+         * tolerance, so the stashed state may commit
+         */
+        bool speculationHolds();
+
         
     //-------------------------------Members--------------------------------//
         std::unique_ptr<amici::Model> model;
+
+        // Per exchange pair: AMICI fixed-parameter index, -1 when the
+        // parameter is not an AMICI fixed parameter
+        std::vector<int> fixed_param_indices;
+
+        // Cached AMICI fixed-parameter vector, pushed once per exchange
+        std::vector<double> fixed_parameter_cache;
+
+        // Per bound override id: AMICI fixed-parameter index, -1 when the
+        // parameter is not an AMICI fixed parameter
+        std::vector<int> override_fixed_indices;
+
+        // AMICI parameter indices armed for forward sensitivities
+        std::vector<int> sensitivity_param_indices;
         std::unique_ptr<amici::Solver> solver;
 
+        // Configuration the cached solver was built with; a repeat run
+        // whose step, macro interval, profile and sensitivity selection
+        // all match keeps the configured solver instead of rebuilding it
+        double configured_step = -1.0;
+        int configured_macro_interval = 0;
+        SolverProfile configured_profile;
+        std::vector<int> configured_sensitivity_indices;
+
+        // Multirate coupling: micro-steps per macro-interval (1 = lockstep),
+        // the dense-output rows of the current macro window (time-major by
+        // species) and the step index the window starts after
+        int macro_interval = 1;
+        std::vector<double> macro_states;
+        int macro_start_step = 0;
+
+        // Speculative lookahead: relative tolerance on predicted
+        // exchange inputs (0 disables), the lookahead's end state and
+        // the step it belongs to, the predictions it was solved under,
+        // and the two-entry applied-input history the extrapolation
+        // draws its slope from (shifted at each exchange boundary)
+        double speculation_tolerance = 0.0;
+        std::vector<double> speculative_state;
+        int speculative_step = -1;
+        std::vector<double> predicted_exchange_values;
+        std::vector<double> current_exchange_inputs;
+        std::vector<double> previous_exchange_inputs;
+        uint64_t speculation_hits = 0;
+        uint64_t speculation_misses = 0;
+
+        // CVODES work totals, accumulated per profiled solve from the
+        // AMICI ReturnData counters
+        uint64_t cvodes_steps = 0;
+        uint64_t cvodes_rhs_evals = 0;
+        uint64_t cvodes_errtest_fails = 0;
+        uint64_t cvodes_nonlin_fails = 0;
+        uint64_t profiled_solves = 0;
+
+
 
     protected:
     // ---------------------------Methods-----------------------------------//
-        /**
-         * @brief Getter method for last recorded value in results matrix
-         * 
-         * @param timepoint position in results matrix being returned
-         * 
-         * @returns state_vector vector of species states recorded in results_matrix object
-         */
-        std::vector<double> getLastStepResult(
-            int timestep
-        ) override;
-
         void loadTargetModule(
             const std::vector<std::unique_ptr<BaseModule>>& module_list
         ) override;
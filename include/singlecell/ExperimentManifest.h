@@ -0,0 +1,69 @@
+/**
+ * @file: ExperimentManifest.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Loader for the benchmarks/* YAML experiment manifests
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef EXPERIMENTMANIFEST_h
+#define EXPERIMENTMANIFEST_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <utility>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief one parsed benchmark manifest: the model, condition, measurement
+ * and observable files of its problem block, with every relative path
+ * resolved against the manifest's own directory. The manifests use a
+ * fixed 'key: value' plus '- item' subset of YAML, so a line parser is
+ * all the format needs — the same stance loadRunFile takes for run files
+ */
+struct ExperimentManifest {
+
+    // problem name; defaults to the manifest's basename when the block
+    // does not declare one
+    std::string name;
+
+    std::vector<std::string> sbml_files;
+    std::vector<std::string> condition_files;
+    std::vector<std::string> measurement_files;
+    std::vector<std::string> observable_files;
+
+    int cell_count = 1; // stochastic replicate cells per condition
+
+    /**
+     * @brief parses one benchmark manifest into its typed fields,
+     * resolving each listed file against the manifest's directory so the
+     * result is usable from any working directory
+     *
+     * @param manifest_path path to the benchmark's .yml manifest
+     *
+     * @returns the populated manifest; throws runtime_error when the
+     * file cannot be opened
+     */
+    static ExperimentManifest load(
+        const std::string& manifest_path
+    );
+
+    /**
+     * @brief reads the listed observables TSVs into name, formula pairs
+     * in the shape ExperimentRunner::setObservables expects
+     *
+     * @param observable_tsvs observable table paths from the manifest
+     *
+     * @returns observableId, observableFormula pairs across all tables
+     */
+    static std::vector<std::pair<std::string, std::string>> loadObservables(
+        const std::vector<std::string>& observable_tsvs
+    );
+};
+
+#endif // EXPERIMENTMANIFEST_h
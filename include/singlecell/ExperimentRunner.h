@@ -0,0 +1,193 @@
+/**
+ * @file: ExperimentRunner.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Native orchestrator for PEtab-style condition x cell experiments
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef EXPERIMENTRUNNER_h
+#define EXPERIMENTRUNNER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <map>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <optional>
+#include <unordered_map>
+#include <condition_variable>
+
+//==========================Class Declaration===============================//
+class ExperimentRunner {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief ingests the PEtab-style conditions and measurements TSVs
+         * and builds the full condition x cell work graph: per condition
+         * the entity overrides, the stop time (largest measurement time),
+         * and the preequilibration dependency, topologically ordered so
+         * prerequisite conditions run before their dependents
+         *
+         * @param sbml_paths strings of paths to SBML model files
+         * @param conditions_tsv path to the tab-separated conditions table
+         * @param measurements_tsv path to the tab-separated measurements
+         * table
+         * @param cell_count stochastic replicate cells per condition
+         */
+        ExperimentRunner(
+            std::vector<std::string> sbml_paths,
+            std::string conditions_tsv,
+            std::string measurements_tsv,
+            int cell_count = 1
+        ); //Ctor
+
+        virtual ~ExperimentRunner() = default; //Dtor
+
+        /**
+         * @brief assigns a base RNG seed; task i receives substream
+         * seed + i so every cell's trajectory is independent and replayable
+         *
+         * @param seed integer base seed value for the experiment
+         */
+        void setSeed(
+            unsigned long long seed
+        );
+
+        /**
+         * @brief registers observable expressions forwarded into every
+         * worker session. Measurement-condition tasks then return the
+         * projected observables matrix instead of raw species; conditions
+         * serving as preequilibration prerequisites still run raw so their
+         * final state can seed dependents
+         *
+         * @param observables name, expression pairs over recorded species
+         */
+        void setObservables(
+            const std::vector<std::pair<std::string, std::string>>& observables
+        );
+
+        /**
+         * @brief executes the whole work graph over a pool of resident
+         * worker sessions, entirely in C++. Tasks are claimed in
+         * topological order from a shared counter; a task whose condition
+         * declares a preequilibration blocks until that prerequisite's
+         * final state (same cell) is published, then seeds from it before
+         * applying its own overrides. Results land in members task_ids,
+         * task_results and task_columns
+         *
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_threads worker thread count; 0 uses hardware concurrency
+         */
+        void run(
+            double step = 30.0, //seconds
+            int num_threads = 0
+        );
+
+        /**
+         * @brief getter method for the experiment's species identifiers,
+         * identical across cells since all share the same model files
+         *
+         * @returns global_ids string vector of species identifiers
+         */
+        std::vector<std::string> getGlobalSpeciesIds();
+
+        /**
+         * @brief writes every completed task's trajectory into one
+         * SCARC001 study archive keyed by task id, so downstream
+         * aggregation fetches single conditions by index instead of
+         * re-reading per-run files. Column labels are the species ids
+         * for raw tasks and the observable names for projected ones; a
+         * projected task's raw recording is appended alongside under
+         * "<taskId>+state", so the archive re-projects through new
+         * observable definitions without re-simulating
+         *
+         * @param output path string to where the archive should be saved
+         */
+        void saveArchive(
+            const std::string& output
+        );
+
+    //------------------------------members---------------------------------//
+        int cell_count;
+
+        // Per task: "<conditionId>+<cell>" identifier, flat row-major
+        // results matrix, and its column count (species or observables)
+        std::vector<std::string> task_ids;
+        std::vector<std::vector<double>> task_results;
+        std::vector<size_t> task_columns;
+
+        // Raw (masked) species recordings of projected tasks and their
+        // row widths, kept so the archive stays re-projectable after
+        // observable edits; empty slots mean the task's results are
+        // already raw
+        std::vector<std::vector<double>> task_raw_results;
+        std::vector<size_t> task_raw_columns;
+
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief loads one tab-separated table into per-row column maps
+         *
+         * @param path TSV file location
+         * @param header receives the column names in file order
+         *
+         * @returns one map of column name -> cell text per data row
+         */
+        static std::vector<std::unordered_map<std::string, std::string>>
+        readTsv(
+            const std::string& path,
+            std::vector<std::string>& header
+        );
+
+        /**
+         * @brief resolves a condition's dependency level: 0 without
+         * preequilibration, one more than the prerequisite otherwise.
+         * Cycles surface as a runtime_error
+         *
+         * @param condition_id condition whose level is requested
+         * @param visiting recursion guard for cycle detection
+         *
+         * @returns the condition's level in the dependency order
+         */
+        int resolveLevel(
+            const std::string& condition_id,
+            std::vector<std::string>& visiting
+        );
+
+    //------------------------------members---------------------------------//
+        std::vector<std::string> sbml_paths;
+
+        // Per condition: the entity overrides from its conditions row, the
+        // stop time derived from its measurements, and its dependency edge
+        struct ConditionSpec {
+            std::string id;
+            std::vector<std::pair<std::string, double>> overrides;
+            std::string preequilibration_id;  // empty when independent
+            double stop_time = 0.0;
+            bool is_prerequisite = false;
+            int level = 0;
+        };
+
+        std::vector<ConditionSpec> conditions;
+        std::unordered_map<std::string, size_t> condition_index;
+
+        // Base seed for the experiment; task substreams offset from it
+        std::optional<unsigned long long> rng_seed;
+
+        std::vector<std::pair<std::string, std::string>> observables;
+
+        // Final species states of completed prerequisite tasks, keyed by
+        // "<conditionId>+<cell>"; dependents wait on state_published
+        std::map<std::string, std::vector<double>> final_states;
+        std::mutex state_mutex;
+        std::condition_variable state_published;
+
+};
+
+#endif // EXPERIMENTRUNNER_H
@@ -27,7 +27,7 @@
 #include "amici/amici.h"
 
 //==========================Class Declaration===============================//
-class HybridModule : public BaseModule {
+class HybridModule final : public BaseModule {
     public:
     //----------------------------Methods-----------------------------------//
         HybridModule(
@@ -67,15 +67,37 @@ class HybridModule : public BaseModule {
          * @param timepoints vector of timepoints for the simulation
          */
         void run(
-            std::vector<double> timepoints
+            const std::vector<double>& timepoints
         ) override;
 
         /**
          * @brief exchanges parameter-to-species values with target-modules
          * 
          */
+        /**
+         * @brief extends the base resolution: each exchanged parameter is
+         * additionally mapped to its AMICI fixed-parameter index, resolved
+         * once so per-step exchange updates a cached vector instead of
+         * calling setFixedParameterById per id
+         *
+         * @param alternate_model target module's SBML model
+         */
+        void findOverlappingIds(
+            const Model* alternate_model
+        ) override;
+
         void updateParameters();
-        
+
+        /**
+         * @brief CVODES work totals accumulated per step while entity
+         * profiling was on; mirrors the DeterministicModule report
+         *
+         * @param out destination stream for the report section
+         */
+        void reportEntityProfile(
+            std::ostream& out
+        ) override;
+
     //-------------------------------Members--------------------------------//
         std::string algorithm_id;
 
@@ -83,32 +105,39 @@ class HybridModule : public BaseModule {
     private:
     // ---------------------------Methods-----------------------------------//
         std::vector<double> setAllSpeciesValues(
-            std::vector<double> current_states,
-            std::vector<double> update_states
+            const std::vector<double>& current_states,
+            const std::vector<double>& update_states
         );
 
-        std::vector<double> getNewStepResult(
-            const amici::ReturnData &rdata
-        );
         
     //-------------------------------Members--------------------------------//
         std::unique_ptr<amici::Model> model;
+
+        // Per exchange pair: AMICI fixed-parameter index, -1 when the
+        // parameter is not an AMICI fixed parameter
+        std::vector<int> fixed_param_indices;
+
+        // Cached AMICI fixed-parameter vector, pushed once per exchange
+        std::vector<double> fixed_parameter_cache;
         std::unique_ptr<amici::Solver> solver;
 
+        // Configuration the cached solver was built with; a repeat run
+        // with the same step and profile keeps the configured solver
+        double configured_step = -1.0;
+        SolverProfile configured_profile;
+
+        // CVODES work totals, accumulated per profiled solve from the
+        // AMICI ReturnData counters
+        uint64_t cvodes_steps = 0;
+        uint64_t cvodes_rhs_evals = 0;
+        uint64_t cvodes_errtest_fails = 0;
+        uint64_t cvodes_nonlin_fails = 0;
+        uint64_t profiled_solves = 0;
+
+
 
     protected:
     // ---------------------------Methods-----------------------------------//
-        /**
-         * @brief Getter method for last recorded value in results matrix
-         * 
-         * @param timepoint position in results matrix being returned
-         * 
-         * @returns state_vector vector of species states recorded in results_matrix object
-         */
-        std::vector<double> getLastStepResult(
-            int timestep
-        ) override;
-
         void loadTargetModule(
             const std::vector<std::unique_ptr<BaseModule>>& module_list
         ) override;
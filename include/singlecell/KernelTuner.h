@@ -0,0 +1,96 @@
+/**
+ * @file KernelTuner.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Persisted per-model kernel dispatch configuration
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef KERNELTUNER_h
+#define KERNELTUNER_h
+
+//===========================Library Import=================================//
+#include <string>
+#include <cstdint>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief load/store side of runtime kernel autotuning. The stochastic
+ * module times its candidate kernels on the first run of a model and the
+ * winning configuration is persisted beside the binary model snapshot,
+ * keyed by the SBML content hash and a host signature, so every later
+ * process on the same host skips the timing pass. A config from a
+ * different model revision or host is silently rejected and re-tuned
+ */
+class KernelTuner {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief one resolved dispatch choice per tunable kernel; the
+         * defaults match the heuristics used when tuning is off
+         */
+        struct Config {
+            // computeReactions: dirty-tracking incremental re-evaluation
+            // on, or always the full group-kernel pass
+            bool incremental_propensities = true;
+
+            // computeReactions: OpenMP-parallel muParser fallback loop
+            bool parallel_propensities = false;
+
+            // computeNewState: reaction-major scatter over the firing
+            // set instead of the species-major CSR gather
+            bool scatter_state_update = false;
+
+            // sampling: mean below which the cached per-reaction
+            // distribution beats the PTRS rejection sampler on this host
+            double ptrs_mean_cutoff = 10.0;
+        };
+
+        /**
+         * @brief reads a persisted configuration, rejecting it when the
+         * magic, model hash or host signature differ from the current run
+         *
+         * @param path tuning file beside the model snapshot
+         * @param model_hash content hash of the source SBML file
+         * @param config receives the stored choices on success
+         *
+         * @returns true when a matching configuration was loaded
+         */
+        static bool load(
+            const std::string& path,
+            uint64_t model_hash,
+            Config& config
+        );
+
+        /**
+         * @brief persists a configuration for later processes. Written to
+         * a temporary path and renamed; failures are silent since the
+         * file is only a cache
+         *
+         * @param path tuning file beside the model snapshot
+         * @param model_hash content hash of the source SBML file
+         * @param config the timed winners to store
+         */
+        static void save(
+            const std::string& path,
+            uint64_t model_hash,
+            const Config& config
+        );
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief coarse host fingerprint: core count plus the compiled
+         * threading mode. Timings move with either, so a config tuned
+         * under one fingerprint never applies under another
+         *
+         * @returns host signature string stored in the tuning file
+         */
+        static std::string hostSignature();
+
+};
+
+#endif // KERNELTUNER_H
@@ -0,0 +1,158 @@
+/**
+ * @file Logger.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Leveled logging facility with background I/O and compile-time
+ * level stripping for hot-loop call sites
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef LOGGER_h
+#define LOGGER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <sstream>
+#include <fstream>
+#include <condition_variable>
+
+//--------------------------Constants Declarations---------------------------//
+// Numeric levels double as compile-time thresholds: statements below
+// SINGLECELL_LOG_LEVEL vanish from the build entirely, so release profiles
+// pass -DSINGLECELL_LOG_LEVEL=2 and pay nothing for debug logging
+#define SINGLECELL_LOG_LEVEL_ERROR 1
+#define SINGLECELL_LOG_LEVEL_WARN  2
+#define SINGLECELL_LOG_LEVEL_INFO  3
+#define SINGLECELL_LOG_LEVEL_DEBUG 4
+
+#ifndef SINGLECELL_LOG_LEVEL
+#define SINGLECELL_LOG_LEVEL SINGLECELL_LOG_LEVEL_DEBUG
+#endif
+
+//==========================Class Declaration===============================//
+class Logger {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief process-wide logger instance; constructed on first use,
+         * flushed and joined at process exit
+         *
+         * @returns reference to the singleton logger
+         */
+        static Logger& instance();
+
+        /**
+         * @brief sets the runtime threshold: messages above it are dropped
+         * at the call site with a single relaxed atomic load
+         *
+         * @param level one of the SINGLECELL_LOG_LEVEL_* values
+         */
+        void setLevel(
+            int level
+        );
+
+        /**
+         * @brief redirects output from stderr to a file; messages already
+         * queued drain to the previous sink first
+         *
+         * @param path destination log file, appended to
+         */
+        void setOutput(
+            const std::string& path
+        );
+
+        /**
+         * @brief current runtime threshold, for the call-site fast path
+         *
+         * @returns the active level
+         */
+        int level() const { return this->runtime_level.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief enqueues one formatted line for the I/O thread; callers
+         * never block on the sink, so hot loops are not serialized by
+         * stream locks
+         *
+         * @param level severity of this message
+         * @param message formatted line, without trailing newline
+         */
+        void log(
+            int level,
+            std::string message
+        );
+
+    private:
+    //---------------------------methods------------------------------------//
+        Logger(); //Ctor, starts the I/O thread
+
+        ~Logger(); //Dtor, drains the queue and joins
+
+        /**
+         * @brief I/O thread body: drains queued lines to the active sink,
+         * batching whatever accumulated since the last wakeup into one write
+         */
+        void writerLoop();
+
+    //-------------------------------members--------------------------------//
+        std::atomic<int> runtime_level{SINGLECELL_LOG_LEVEL_INFO};
+
+        std::deque<std::string> queue;
+
+        std::ofstream file_sink;
+        bool use_file = false;
+
+        bool shutting_down = false;
+
+        std::mutex queue_mutex;
+        std::condition_variable queue_ready;
+
+        std::thread io_thread;
+
+};
+
+//--------------------------Macro Definitions--------------------------------//
+// Stream-style call sites: SC_LOG_WARN("skipping id '" << id << "'");
+// the ostringstream only exists when the level survives both the
+// compile-time strip and the runtime threshold check
+#define SC_LOG_AT(level_value, message)                                       \
+    do {                                                                      \
+        if ((level_value) <= Logger::instance().level()) {                    \
+            std::ostringstream sc_log_line;                                   \
+            sc_log_line << message;                                           \
+            Logger::instance().log((level_value), sc_log_line.str());         \
+        }                                                                     \
+    } while (0)
+
+#if SINGLECELL_LOG_LEVEL >= SINGLECELL_LOG_LEVEL_ERROR
+#define SC_LOG_ERROR(message) SC_LOG_AT(SINGLECELL_LOG_LEVEL_ERROR, message)
+#else
+#define SC_LOG_ERROR(message) do {} while (0)
+#endif
+
+#if SINGLECELL_LOG_LEVEL >= SINGLECELL_LOG_LEVEL_WARN
+#define SC_LOG_WARN(message) SC_LOG_AT(SINGLECELL_LOG_LEVEL_WARN, message)
+#else
+#define SC_LOG_WARN(message) do {} while (0)
+#endif
+
+#if SINGLECELL_LOG_LEVEL >= SINGLECELL_LOG_LEVEL_INFO
+#define SC_LOG_INFO(message) SC_LOG_AT(SINGLECELL_LOG_LEVEL_INFO, message)
+#else
+#define SC_LOG_INFO(message) do {} while (0)
+#endif
+
+#if SINGLECELL_LOG_LEVEL >= SINGLECELL_LOG_LEVEL_DEBUG
+#define SC_LOG_DEBUG(message) SC_LOG_AT(SINGLECELL_LOG_LEVEL_DEBUG, message)
+#else
+#define SC_LOG_DEBUG(message) do {} while (0)
+#endif
+
+#endif // LOGGER_H
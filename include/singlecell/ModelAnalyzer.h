@@ -0,0 +1,47 @@
+/**
+ * @file: ModelAnalyzer.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Preflight cost analysis and performance linting for SBML models
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef MODELANALYZER_h
+#define MODELANALYZER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief inspects a set of SBML model files and prints a capacity-
+ * planning report before any long run is committed: entity counts,
+ * stoichiometric sparsity, a rate-law shape histogram, estimated
+ * per-step FLOPs and memory traffic, stiffness indicators for the ODE
+ * side, and a wall-time projection calibrated by a short probe run
+ */
+class ModelAnalyzer {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief runs the full analysis and writes the report to stdout
+         *
+         * @param sbml_paths strings of paths to SBML model files
+         * @param step the delta_t the planned run would use, in seconds
+         * @param probe_steps co-simulation steps for the timing probe;
+         * 0 skips the probe and its wall-time projection
+         */
+        static void analyze(
+            const std::vector<std::string>& sbml_paths,
+            double step,
+            int probe_steps = 32
+        );
+
+};
+
+#endif // MODELANALYZER_H
@@ -0,0 +1,177 @@
+/**
+ * @file ModelData.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Immutable per-model data shared read-only across module instances
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef MODELDATA_h
+#define MODELDATA_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <map>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
+
+//Internal Libraries
+#include "SparseMatrix.h"
+
+//==========================Class Declaration===============================//
+class SBMLHandler;
+
+/**
+ * @brief everything derivable from an SBML file that never changes during
+ * simulation: stoichiometry, rate-law formulas, identifier lists and index
+ * maps, compartment volumes and the pristine initial state. Built once per
+ * file and shared via shared_ptr, so hundreds of cells pay the extraction
+ * cost once and per-cell memory is just the mutable state vectors
+ */
+class ModelData {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief returns the shared ModelData for an SBML file, extracting
+         * it through the handler on first request and serving the cached
+         * instance afterwards. Thread-safe: concurrent population or batch
+         * workers loading the same file share one extraction
+         *
+         * @param path SBML file path, used as the cache key
+         * @param handler loaded handler to extract from on a cache miss
+         * @param needs_stochastic_kernels false skips the dense-matrix and
+         * rate-law extraction that only the stochastic kernels read
+         *
+         * @returns shared pointer to the immutable per-model data
+         */
+        static std::shared_ptr<const ModelData> acquire(
+            const std::string& path,
+            SBMLHandler& handler,
+            bool needs_stochastic_kernels = true
+        );
+
+        /**
+         * @brief shared exchange ids for one model pairing: this model's
+         * parameters intersected with the other model's species, derived
+         * by a linear merge of the sorted interned-symbol views and
+         * memoized process-wide, so population workers pairing the same
+         * two models resolve the intersection exactly once
+         *
+         * @param parameter_side model whose parameters receive the values
+         * @param species_side model whose species produce the values
+         *
+         * @returns shared ids in interned-symbol order
+         */
+        static std::shared_ptr<const std::vector<std::string>> overlapIds(
+            const ModelData& parameter_side,
+            const ModelData& species_side
+        );
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief FNV-1a hash over a file's bytes, used to detect whether a
+         * binary snapshot still matches its source SBML file
+         *
+         * @param path file whose contents should be hashed
+         *
+         * @returns 64-bit content hash; 0 if the file cannot be read
+         */
+        static uint64_t hashFile(
+            const std::string& path
+        );
+
+        /**
+         * @brief reads a versioned binary snapshot written by writeSnapshot,
+         * rejecting it when the magic, version or source hash differ
+         *
+         * @param snapshot_path snapshot file beside the SBML source
+         * @param sbml_hash content hash the snapshot must match
+         *
+         * @returns deserialized model data, or nullptr on any mismatch
+         */
+        static std::shared_ptr<ModelData> loadSnapshot(
+            const std::string& snapshot_path,
+            uint64_t sbml_hash
+        );
+
+        /**
+         * @brief serializes this model data to a binary snapshot so later
+         * processes skip re-extraction. Written to a temporary path and
+         * renamed; failures are silent since the snapshot is only a cache
+         *
+         * @param snapshot_path destination file beside the SBML source
+         * @param sbml_hash content hash of the source SBML file
+         */
+        void writeSnapshot(
+            const std::string& snapshot_path,
+            uint64_t sbml_hash
+        ) const;
+
+    public:
+
+    //-------------------------------members--------------------------------//
+        // CSR stoichiometry (species-major and its reaction-major
+        // transpose), built straight from the SBML reactions — no dense
+        // matrix is ever materialized — and carried through the snapshot
+        SparseMatrix stoich_rows;
+        SparseMatrix stoich_cols;
+
+        std::vector<std::string> formulas_vector;
+
+        // Per-formula identifier tokens, the string-processing half of
+        // formula compilation; the muParser bytecode itself is bound to
+        // process-local addresses and cannot be serialized
+        std::vector<std::vector<std::string>> formula_tokens;
+
+        std::vector<std::string> species_ids;
+
+        std::vector<std::string> parameter_ids;
+
+        // interned 32-bit handles aligned with the ID vectors above;
+        // hot lookups compare these instead of strings
+        std::vector<uint32_t> species_symbols;
+
+        std::vector<uint32_t> parameter_symbols;
+
+        std::unordered_map<std::string, int> species_index;
+
+        std::unordered_map<std::string, int> parameter_index;
+
+        std::vector<double> species_volumes;
+
+        std::vector<double> initial_state;
+
+        // FNV-1a content hash of the source SBML file, the key derived
+        // caches (kernel tuning) validate against
+        uint64_t source_hash = 0;
+
+        // (symbol, index) views of the ID vectors sorted by symbol, so
+        // overlap discovery is one merge instead of a hashed full scan
+        std::vector<std::pair<uint32_t, int>> sorted_species_symbols;
+        std::vector<std::pair<uint32_t, int>> sorted_parameter_symbols;
+
+    private:
+    //-------------------------------members--------------------------------//
+        // Process-wide cache: one extraction per SBML file
+        static std::mutex cache_mutex;
+        static std::unordered_map<std::string, std::shared_ptr<const ModelData>> cache;
+
+        // Process-wide overlap memo, one entry per ordered model pairing
+        static std::mutex overlap_mutex;
+        static std::map<
+            std::pair<const ModelData*, const ModelData*>,
+            std::shared_ptr<const std::vector<std::string>>
+        > overlap_cache;
+
+};
+
+#endif // MODELDATA_H
@@ -0,0 +1,123 @@
+/**
+ * @file: P2Quantile.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Streaming quantile estimation via the P-squared algorithm
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef P2QUANTILE_h
+#define P2QUANTILE_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cstddef>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief one streaming quantile estimator (Jain & Chlamtac 1985, the
+ * P-squared algorithm): five markers track the running quantile in O(1)
+ * memory and O(1) update time, so population-scale reductions never
+ * materialize the sample set
+ */
+class P2Quantile {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief arms the estimator for one target quantile
+         *
+         * @param quantile target in (0, 1), e.g. 0.5 for the median
+         */
+        void initialize(
+            double quantile
+        );
+
+        /**
+         * @brief folds one observation into the marker state
+         *
+         * @param x the observation
+         */
+        void add(
+            double x
+        );
+
+        /**
+         * @brief current quantile estimate: the middle marker once five
+         * observations arrived, an interpolation over the partial sample
+         * before that
+         *
+         * @returns the running quantile estimate
+         */
+        double value() const;
+
+        /**
+         * @brief folds another estimator for the same target quantile
+         * into this one, operating on the compact marker state only.
+         * Warm-up partners replay their raw observations; two warmed
+         * estimators blend interior marker heights by observation count
+         * and widen the extremes, the standard approximate P-squared
+         * merge for distributed reductions
+         *
+         * @param other the estimator to absorb
+         */
+        void merge(
+            const P2Quantile& other
+        );
+
+        /**
+         * @brief packs the full marker state into kStateSize doubles, so
+         * shards can ship estimators between ranks without raw samples
+         *
+         * @param out destination for kStateSize doubles
+         */
+        void serialize(
+            double* out
+        ) const;
+
+        /**
+         * @brief restores a state packed by serialize
+         *
+         * @param in source of kStateSize doubles
+         */
+        void deserialize(
+            const double* in
+        );
+
+    //-------------------------------members--------------------------------//
+        // doubles per packed estimator state: q, count and the four
+        // five-wide marker arrays
+        static constexpr size_t kStateSize = 22;
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief piecewise-parabolic marker height prediction, the P in
+         * P-squared; falls back to linear when the parabola overshoots
+         */
+        double parabolic(
+            int i,
+            int sign
+        ) const;
+
+        double linear(
+            int i,
+            int sign
+        ) const;
+
+    //-------------------------------members--------------------------------//
+        double q = 0.5;
+
+        // Marker heights, actual positions and desired positions
+        double heights[5] = {0, 0, 0, 0, 0};
+        double positions[5] = {0, 0, 0, 0, 0};
+        double desired[5] = {0, 0, 0, 0, 0};
+        double increments[5] = {0, 0, 0, 0, 0};
+
+        size_t count = 0;
+
+};
+
+#endif // P2QUANTILE_H
@@ -0,0 +1,136 @@
+/**
+ * @file ParquetWriter.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Dependency-free Parquet file writer for trajectory matrices
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef PARQUETWRITER_h
+#define PARQUETWRITER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <utility>
+
+//==========================Class Declaration===============================//
+/**
+ * Writes standard Apache Parquet files readable by pyarrow, pandas, Spark
+ * and the usual warehouse loaders, without linking Arrow: the trajectory
+ * schema is fixed (every column a required DOUBLE), so only PLAIN-encoded
+ * data pages and the Thrift-compact footer metadata are needed. Rows are
+ * buffered per column and flushed one row group at a time, so the file is
+ * written incrementally and a crash loses at most the open row group
+ * plus the footer.
+ */
+class ParquetWriter {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief opens the output stream, writes the leading magic and
+         * fixes the schema from the column labels
+         *
+         * @param output path string to where the file should be saved
+         * @param col_labels one label per column; these become the Parquet
+         * schema field names
+         */
+        ParquetWriter(
+            const std::string& output,
+            std::vector<std::string> col_labels
+        ); //Ctor
+
+        ~ParquetWriter(); //Dtor, finalizes if still open
+
+        /**
+         * @brief appends one row into the open row group, flushing a
+         * complete row group to disk whenever the buffer fills
+         *
+         * @param row pointer to the first of num-columns doubles to record
+         *
+         * @returns None
+         */
+        void appendRow(
+            const double* row
+        );
+
+        /**
+         * @brief attaches key/value pairs to emit as the footer's
+         * key_value_metadata, where pyarrow and pandas surface them as
+         * schema metadata without touching any data pages
+         *
+         * @param metadata provenance pairs to embed; replaces any
+         * previously attached set
+         *
+         * @returns None
+         */
+        void setMetadata(
+            std::vector<std::pair<std::string, std::string>> metadata
+        );
+
+        /**
+         * @brief flushes the partial row group, writes the footer metadata
+         * and trailing magic, and closes the stream. Idempotent
+         *
+         * @returns None
+         */
+        void finalize();
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief writes the buffered columns as one row group: per column a
+         * Thrift page header followed by the PLAIN (raw little-endian)
+         * doubles, recording offsets and sizes for the footer
+         *
+         * @returns None
+         */
+        void flushRowGroup();
+
+    //-------------------------------members--------------------------------//
+        std::ofstream out;
+
+        std::vector<std::string> columns;
+
+        // footer key/value metadata, written once at finalize
+        std::vector<std::pair<std::string, std::string>> metadata;
+
+        // open row group, buffered column-wise so each chunk writes as one
+        // contiguous block
+        std::vector<std::vector<double>> column_buffers;
+
+        size_t buffered_rows = 0;
+
+        // footer bookkeeping gathered as row groups flush
+        struct ColumnChunkInfo {
+            int64_t offset = 0;
+            int64_t size = 0;
+            int64_t num_values = 0;
+        };
+
+        struct RowGroupInfo {
+            std::vector<ColumnChunkInfo> chunks;
+            int64_t total_bytes = 0;
+            int64_t num_rows = 0;
+        };
+
+        std::vector<RowGroupInfo> row_groups;
+
+        int64_t total_rows = 0;
+
+        // Rows per group before a flush; 4096 doubles per column keeps
+        // column chunks well past the reader's per-chunk overhead while
+        // bounding the buffer at 32 KB per column
+        static constexpr size_t rows_per_group = 4096;
+
+        bool finalized = false;
+
+};
+
+#endif // PARQUETWRITER_H
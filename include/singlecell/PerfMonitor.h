@@ -0,0 +1,205 @@
+/**
+ * @file PerfMonitor.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Scoped per-phase timing aggregation with JSON report output
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef PERFMONITOR_h
+#define PERFMONITOR_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+// Internal libraries
+#include "singlecell/TraceWriter.h"
+
+//==========================Class Declaration===============================//
+class PerfMonitor {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief RAII timer: measures from construction to destruction and
+         * adds the elapsed time to its phase's aggregate. Cost per scope is
+         * two clock reads plus one locked accumulate
+         */
+        class ScopedTimer {
+            public:
+                ScopedTimer(
+                    PerfMonitor* monitor,
+                    const char* phase
+                ) : monitor(monitor), phase(phase),
+                    traced(TraceWriter::instance().enabled()) {
+                    if (monitor != nullptr) {
+                        start = std::chrono::steady_clock::now();
+                    }
+                    // every phase timer doubles as a trace span, so an
+                    // armed trace covers the stepping pipeline without
+                    // separate instrumentation
+                    if (traced) {
+                        trace_start = TraceWriter::nowMicros();
+                    }
+                }
+
+                ~ScopedTimer() {
+                    if (monitor != nullptr) {
+                        std::chrono::duration<double> elapsed =
+                            std::chrono::steady_clock::now() - start;
+                        monitor->addSample(phase, elapsed.count());
+                    }
+                    if (traced) {
+                        TraceWriter::instance().emit(
+                            phase, "step", trace_start,
+                            TraceWriter::nowMicros() - trace_start
+                        );
+                    }
+                }
+
+            private:
+                PerfMonitor* monitor;
+                const char* phase;
+                bool traced;
+                std::chrono::steady_clock::time_point start;
+                uint64_t trace_start = 0;
+        };
+
+        /**
+         * @brief accumulates one timing sample into the named phase
+         *
+         * @param phase identifier for the simulation phase being timed
+         * @param seconds elapsed wall time to accumulate
+         *
+         * @returns None updates member phase_totals
+         */
+        void addSample(
+            const std::string& phase,
+            double seconds
+        );
+
+        /**
+         * @brief accumulates one latency sample into the named
+         * histogram. Buckets are geometric — eight sub-buckets per
+         * octave from 100 ns — so a histogram occupies constant memory
+         * no matter how many samples land in it while keeping relative
+         * error under ~9% at any magnitude, and the report can quote
+         * percentiles instead of just means
+         *
+         * @param name identifier for the latency distribution
+         * @param seconds elapsed wall time to accumulate
+         *
+         * @returns None updates member histograms
+         */
+        void addHistogramSample(
+            const std::string& name,
+            double seconds
+        );
+
+        /**
+         * @brief accumulates allocated bytes against a named subsystem
+         * (results matrices, backing-store mappings, exchange
+         * structures), so the report shows where run memory went
+         *
+         * @param subsystem identifier for the allocating subsystem
+         * @param bytes allocation size to accumulate
+         *
+         * @returns None updates member byte_totals
+         */
+        void addBytes(
+            const std::string& subsystem,
+            uint64_t bytes
+        );
+
+        /**
+         * @brief attaches one run-configuration fact to the report, so
+         * timings stay attributable to the settings that produced them
+         *
+         * @param key metadata field name
+         * @param value metadata field value
+         *
+         * @returns None updates member metadata
+         */
+        void setMetadata(
+            const std::string& key,
+            const std::string& value
+        );
+
+        /**
+         * @brief writes the aggregated per-phase totals as a JSON report:
+         * {"phase": {"calls": N, "total_seconds": T, "mean_seconds": M}},
+         * preceded by a "metadata" object when facts were attached, a
+         * "memory" object — per-subsystem byte tallies plus the process
+         * peak RSS — when allocations were accounted, and a
+         * "histograms" object quoting count/p50/p90/p99/max per
+         * recorded latency distribution
+         *
+         * @param output path string to where the report should be saved
+         *
+         * @returns None
+         */
+        void writeReport(
+            const std::string& output
+        );
+
+
+    private:
+    //-------------------------------members--------------------------------//
+        struct PhaseStats {
+            uint64_t calls = 0;
+            double total_seconds = 0.0;
+        };
+
+        // fixed-size geometric latency histogram; 256 buckets at eight
+        // per octave span 100 ns to ~400 s before the top bucket clamps
+        static constexpr size_t kHistogramBuckets = 256;
+
+        struct Histogram {
+            uint64_t counts[kHistogramBuckets] = {};
+            uint64_t total_count = 0;
+            double max_seconds = 0.0;
+        };
+
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief maps one latency to its geometric bucket index
+         */
+        static size_t bucketIndex(
+            double seconds
+        );
+
+        /**
+         * @brief walks the bucket counts to the requested rank and
+         * returns that bucket's upper-bound latency, clamped to the
+         * observed maximum
+         */
+        static double histogramPercentile(
+            const Histogram& histogram,
+            double fraction
+        );
+
+        // ordered map keeps report output stable across runs
+        std::map<std::string, PhaseStats> phase_totals;
+
+        // run-configuration facts emitted at the top of the report
+        std::map<std::string, std::string> metadata;
+
+        // bytes accounted per subsystem, emitted as the "memory" object
+        std::map<std::string, uint64_t> byte_totals;
+
+        // latency distributions, emitted as the "histograms" object
+        std::map<std::string, Histogram> histograms;
+
+        // addSample may be called from concurrent module-step threads
+        std::mutex totals_mutex;
+
+};
+
+#endif // PERFMONITOR_H
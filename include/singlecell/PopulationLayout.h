@@ -0,0 +1,132 @@
+/**
+ * @file: PopulationLayout.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Indexing policies for flat population result slabs
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef POPULATIONLAYOUT_h
+#define POPULATIONLAYOUT_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <cstddef>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief resolved memory layout of a flat population slab: num_cells
+ * cells by num_items per-cell values. Cell-major keeps one cell's values
+ * contiguous (per-cell reads, the single-cell analogue of time-major
+ * recording); species-major keeps one value contiguous across all cells
+ * (population-level reductions); tiled interleaves blocks of tile_cells
+ * cells per value, so both access patterns stay within one resident
+ * tile. index is branch-light and inline because the aggregation loops
+ * call it per element
+ */
+class PopulationLayout {
+    public:
+        enum class Kind { CellMajor, SpeciesMajor, Tiled };
+
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief flat offset of one (cell, item) element under this layout
+         *
+         * @param cell cell index in [0, num_cells)
+         * @param item per-cell value index in [0, num_items)
+         *
+         * @returns element offset into the slab
+         */
+        size_t index(
+            size_t cell,
+            size_t item
+        ) const {
+
+            switch (this->kind) {
+
+                case Kind::CellMajor:
+                    return cell * this->num_items + item;
+
+                case Kind::SpeciesMajor:
+                    return item * this->num_cells + cell;
+
+                default:
+                    // block of tile_cells cells, values interleaved per
+                    // item within it; the last block pads to full width
+                    return (cell / this->tile_cells)
+                            * (this->num_items * this->tile_cells)
+                        + item * this->tile_cells
+                        + (cell % this->tile_cells);
+            }
+        }
+
+        /**
+         * @brief element count a slab under this layout must allocate;
+         * tiled layouts pad the last cell block to full tile width
+         *
+         * @returns required slab size in elements
+         */
+        size_t size() const;
+
+        /**
+         * @brief human-readable layout tag ("cell", "species" or
+         * "tiled:<width>"), the form the binding layer reports so callers
+         * can interpret a returned slab
+         *
+         * @returns layout description string
+         */
+        std::string describe() const;
+
+        /**
+         * @brief builds the layout a request names: "cell", "species",
+         * "tiled" (default tile width), or "auto", which times the
+         * candidates on a scratch slab and keeps the fastest — the same
+         * measure-once policy the kernel autotuner applies to dispatch
+         * choices
+         *
+         * @param name requested layout tag
+         * @param num_cells cell count of the slab being laid out
+         * @param num_items per-cell value count of the slab
+         *
+         * @returns the resolved layout
+         */
+        static PopulationLayout resolve(
+            const std::string& name,
+            size_t num_cells,
+            size_t num_items
+        );
+
+        /**
+         * @brief times a cell-major sweep plus a species-major sweep over
+         * a scratch slab for each candidate layout and returns the one
+         * with the lowest combined cost on this host. The probe is capped
+         * well under cache-thrash sizes so tuning stays a startup blip
+         *
+         * @param num_cells cell count of the slab being laid out
+         * @param num_items per-cell value count of the slab
+         *
+         * @returns the fastest candidate under the mixed workload
+         */
+        static PopulationLayout autotune(
+            size_t num_cells,
+            size_t num_items
+        );
+
+    //------------------------------members---------------------------------//
+        Kind kind = Kind::CellMajor;
+
+        size_t num_cells = 0;
+
+        size_t num_items = 0;
+
+        // cells interleaved per block in the tiled layout; ignored by
+        // the two flat layouts
+        size_t tile_cells = 16;
+
+};
+
+#endif // POPULATIONLAYOUT_H
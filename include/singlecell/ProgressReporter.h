@@ -0,0 +1,86 @@
+/**
+ * @file ProgressReporter.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Background progress sampler reporting rate and smoothed ETA
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef PROGRESSREPORTER_h
+#define PROGRESSREPORTER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <cstddef>
+#include <condition_variable>
+
+//==========================Class Declaration===============================//
+class ProgressReporter {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief starts the sampling thread: every interval_seconds it
+         * reads the step counter, computes steps/sec and a smoothed ETA,
+         * and reports to stderr or rewrites a status file for schedulers
+         * to poll
+         *
+         * @param total_steps step count the run will reach at completion
+         * @param interval_seconds seconds between reports
+         * @param status_path status file rewritten each sample; empty
+         * reports to stderr instead
+         */
+        ProgressReporter(
+            size_t total_steps,
+            double interval_seconds,
+            std::string status_path = ""
+        ); //Ctor
+
+        ~ProgressReporter(); //Dtor, stops and joins the sampler
+
+        /**
+         * @brief publishes the current step. A single relaxed atomic store,
+         * so the step loop carries no locks, I/O or clock reads
+         *
+         * @param step the step just completed
+         */
+        void update(
+            int step
+        ) {
+            this->current_step.store(step, std::memory_order_relaxed);
+        }
+
+    private:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief sampler thread body: wakes every interval, derives the
+         * instantaneous rate from the step delta, smooths it exponentially
+         * and emits one progress line
+         */
+        void reporterLoop();
+
+    //-------------------------------members--------------------------------//
+        std::atomic<int> current_step{0};
+
+        size_t total_steps;
+
+        double interval_seconds;
+
+        std::string status_path;
+
+        bool shutting_down = false;
+
+        std::mutex wake_mutex;
+        std::condition_variable wake_signal;
+
+        std::thread sampler;
+
+};
+
+#endif // PROGRESSREPORTER_H
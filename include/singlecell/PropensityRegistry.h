@@ -0,0 +1,74 @@
+/**
+ * @file: PropensityRegistry.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Lazy, dlopen-based lookup of generated native propensity kernels
+ */
+
+//========================header file definition============================//
+#pragma once
+
+#ifndef PROPENSITYREGISTRY_h
+#define PROPENSITYREGISTRY_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <cstddef>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief resolves compiled propensity libraries emitted by
+ * createModels.py (libpropensity_<id>.so) the same way
+ * AmiciModelRegistry resolves generated AMICI models. A resolved kernel
+ * evaluates every rate law into a propensity array in one native call;
+ * when no library exists the caller keeps its interpreted muParser path
+ */
+class PropensityRegistry {
+    public:
+    //----------------------------Methods-----------------------------------//
+        /**
+         * @brief one call evaluating all rate laws: species in SBML
+         * document order, parameters in document order, propensities out
+         */
+        using PropensityFn = void (*)(
+            const double* species,
+            const double* parameters,
+            double* propensities
+        );
+
+        /**
+         * @brief resolves the native propensity kernel for a model id,
+         * probing the shared search paths for libpropensity_<id>.so and
+         * validating the library's species, parameter and reaction counts
+         * against the caller's layout. Resolutions are cached per id
+         *
+         * @param model_id SBML model identifier the library was built for
+         * @param num_species species count the caller will pass
+         * @param num_parameters parameter count the caller will pass
+         * @param num_reactions propensity count the caller expects back
+         *
+         * @returns kernel function pointer, or nullptr when no matching
+         * library is found; nullptr means stay interpreted
+         */
+        static PropensityFn resolve(
+            const std::string& model_id,
+            size_t num_species,
+            size_t num_parameters,
+            size_t num_reactions
+        );
+
+        /**
+         * @brief prepends a directory to the library search path, ahead
+         * of SINGLECELL_MODEL_PATH entries and the amici_models default
+         *
+         * @param directory directory to probe for libpropensity_<id>.so
+         */
+        static void addSearchPath(
+            const std::string& directory
+        );
+};
+
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file: ResultSink.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Composable output sinks: one recorded run, many products
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef RESULTSINK_h
+#define RESULTSINK_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief one configured output product: a destination path whose
+ * extension selects the format (.bin packed binary, .parquet columnar,
+ * anything else TSV), plus an optional row thinning and species subset
+ * derived from the full-resolution matrix at write time. Parsed from
+ * the CLI/run-file value "path[,every=N][,species=a+b+c]"
+ */
+struct SinkSpec {
+
+    std::string path;
+
+    // keep every Nth recorded row; 1 keeps all
+    int every = 1;
+
+    // columns to keep, by species id; empty keeps all
+    std::vector<std::string> species;
+
+    /**
+     * @brief parses one sink value from the CLI or run file
+     *
+     * @param text "path[,every=N][,species=a+b+c]"
+     *
+     * @returns the parsed spec; throws on an unknown or malformed field
+     */
+    static SinkSpec parse(
+        const std::string& text
+    );
+};
+
+/**
+ * @brief fans one recorded results matrix out to every configured sink.
+ * Each sink derives its own product (thinned rows, species subset) and
+ * writes on its own thread, so a full-resolution binary, a small TSV
+ * subset and a parquet export all land in one pass over the run instead
+ * of downstream jobs re-reading the big file to derive the small ones
+ */
+class SinkSet {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief registers one sink for writeAll to serve
+         *
+         * @param spec parsed sink configuration
+         */
+        void addSink(
+            const SinkSpec& spec
+        );
+
+        /**
+         * @brief writes the matrix to every registered sink, one thread
+         * per sink running concurrently; a sink that fails (bad species
+         * id, unwritable path) is reported on stderr without touching
+         * the others
+         *
+         * @param results_matrix recorded rows to write
+         * @param timesteps row labels
+         * @param species_ids column labels of the full matrix
+         *
+         * @returns the number of sinks that failed
+         */
+        int writeAll(
+            const std::vector<std::vector<double>>& results_matrix,
+            const std::vector<std::string>& timesteps,
+            const std::vector<std::string>& species_ids
+        ) const;
+
+        /**
+         * @brief getter for the number of registered sinks
+         *
+         * @returns registered sink count
+         */
+        size_t size() const;
+
+
+    private:
+    //------------------------------members---------------------------------//
+        std::vector<SinkSpec> sinks;
+
+};
+
+#endif // RESULTSINK_h
@@ -0,0 +1,166 @@
+/**
+ * @file: ResultsArchive.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Multi-run trajectory archive with a random-access footer index
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef RESULTSARCHIVE_h
+#define RESULTSARCHIVE_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <unordered_map>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief appends many binary trajectories into one SCARC001 study file.
+ * Each entry is a complete SCTRJ001 stream, so single trajectories stay
+ * readable by the existing trajectory tooling once sliced out; finalize
+ * writes a footer index of condition key -> byte range plus a 16-byte
+ * trailer locating it, so readers reach any run with one seek
+ */
+class ResultsArchiveWriter {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief opens the archive stream and writes the format magic
+         *
+         * @param output path string to where the archive should be saved
+         */
+        ResultsArchiveWriter(
+            const std::string& output
+        ); //Ctor
+
+        ~ResultsArchiveWriter(); //Dtor, finalizes if still open
+
+        /**
+         * @brief appends one trajectory under a condition key: the flat
+         * row-major matrix is serialized as a self-contained SCTRJ001
+         * blob and its byte range recorded for the footer index
+         *
+         * @param key condition identifier the trajectory indexes under
+         * @param flat_results flat row-major results matrix
+         * @param num_cols row width, i.e. the species count per row
+         * @param col_labels per-column (species) labels, optional
+         * @param row_labels per-row (timestep) labels, optional
+         */
+        void append(
+            const std::string& key,
+            const std::vector<double>& flat_results,
+            uint64_t num_cols,
+            const std::vector<std::string>& col_labels = {},
+            const std::vector<std::string>& row_labels = {}
+        );
+
+        /**
+         * @brief writes the footer index and trailer, then closes the
+         * stream. Idempotent
+         */
+        void finalize();
+
+    private:
+    //-------------------------------members--------------------------------//
+        /**
+         * @brief one footer-index record: where a key's blob lives
+         */
+        struct IndexEntry {
+            std::string key;
+            uint64_t offset;
+            uint64_t length;
+        };
+
+        std::ofstream out;
+
+        std::vector<IndexEntry> entries;
+
+        bool finalized = false;
+};
+
+/**
+ * @brief random-access reader for SCARC001 archives: construction loads
+ * only the footer index, and each requested trajectory is fetched with
+ * one seek plus one read of its byte range. Aggregation over a
+ * 50,000-run study therefore streams the index instead of re-opening
+ * 50,000 files
+ */
+class ResultsArchiveReader {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief opens the archive, validates the trailer magic and loads
+         * the footer index into memory
+         *
+         * @param path archive file written by ResultsArchiveWriter
+         */
+        ResultsArchiveReader(
+            const std::string& path
+        ); //Ctor
+
+        ~ResultsArchiveReader() = default; //Dtor
+
+        /**
+         * @brief lists the archived condition keys in append order
+         *
+         * @returns vector of condition identifiers
+         */
+        std::vector<std::string> keys() const;
+
+        /**
+         * @brief reports whether a condition key exists in the index
+         *
+         * @param key condition identifier to look up
+         *
+         * @returns true when the archive holds a trajectory for the key
+         */
+        bool contains(
+            const std::string& key
+        ) const;
+
+        /**
+         * @brief fetches one trajectory by key: a single seek and read of
+         * its byte range, then an in-memory parse of the SCTRJ001 blob
+         *
+         * @param key condition identifier to fetch
+         * @param num_rows receives the trajectory's row count
+         * @param num_cols receives the trajectory's column count
+         * @param col_labels receives the per-column labels, possibly empty
+         * @param row_labels receives the per-row labels, possibly empty
+         *
+         * @returns flat row-major results matrix for the key
+         */
+        std::vector<double> read(
+            const std::string& key,
+            uint64_t& num_rows,
+            uint64_t& num_cols,
+            std::vector<std::string>& col_labels,
+            std::vector<std::string>& row_labels
+        );
+
+    private:
+    //-------------------------------members--------------------------------//
+        /**
+         * @brief byte range of one archived blob
+         */
+        struct Entry {
+            uint64_t offset;
+            uint64_t length;
+        };
+
+        std::ifstream in;
+
+        // append-ordered keys, for iteration matching write order
+        std::vector<std::string> ordered_keys;
+
+        std::unordered_map<std::string, Entry> index;
+};
+
+#endif // RESULTSARCHIVE_H
@@ -0,0 +1,67 @@
+/**
+ * @file RunMetadata.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Process-wide provenance registry embedded into every output format
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef RUNMETADATA_h
+#define RUNMETADATA_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <utility>
+
+//==========================Class Declaration===============================//
+/**
+ * Collects the facts that identify a run — model content hashes, seed,
+ * solver profile, thread count, kernel dispatch choices, build version,
+ * wall time — as the components that own them configure themselves, then
+ * hands the collected set to every writer over one shared code path. TSV
+ * carries them as leading comment lines, the packed binary as a trailer
+ * block behind the payload, Parquet as footer key/value metadata, so a
+ * regression hunt across archived outputs queries the files themselves
+ * instead of re-running the simulations that produced them
+ */
+class RunMetadata {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief records or overwrites one provenance fact
+         *
+         * @param key metadata field name; dotted per-module keys keep
+         * multi-module facts apart (e.g. "kernels.Stochastic")
+         * @param value metadata field value
+         *
+         * @returns None
+         */
+        static void set(
+            const std::string& key,
+            const std::string& value
+        );
+
+        /**
+         * @brief copies the recorded facts, ordered by key so embedded
+         * metadata is byte-stable across runs with equal settings
+         *
+         * @returns key/value pairs, always including the "build" tag
+         */
+        static std::vector<std::pair<std::string, std::string>> snapshot();
+
+        /**
+         * @brief flattens the recorded facts into newline-joined
+         * "key=value" lines, the form the binary trailer block stores
+         *
+         * @returns the serialized block
+         */
+        static std::string serialize();
+
+};
+
+#endif // RUNMETADATA_H
@@ -19,6 +19,9 @@
 #include <unordered_map>
 #include <sbml/SBMLTypes.h>
 #include <sbml/SBMLReader.h>
+
+// Internal Libraries
+#include "singlecell/ModelData.h"
 //--------------------------Constants Declarations---------------------------//
 
 //--------------------------Class Declaration-------------------------------//
@@ -26,30 +29,50 @@ class SBMLHandler {
     public:
         SBMLHandler( // Constructor method
             const std::string& filename
-        ); 
+        );
+
+        // Copies are cheap handles: the document is shared_ptr-owned, so
+        // every copy references the same libSBML document and it is freed
+        // exactly once when the last handle goes away
+        ~SBMLHandler() = default; // Destructor Method
 
-        ~SBMLHandler(); // Destructor Method
+        /**
+         * @brief deep-clones the underlying libSBML document into a new
+         * handler with private mutable state. Plain copies share the
+         * document; clone is for the cases that genuinely need isolated
+         * documents, e.g. concurrent sessions mutating the same model
+         *
+         * @returns a handler owning its own document copy
+         */
+        SBMLHandler clone() const;
 
-        Model* model; 
+        Model* model;
 
         /**
-        * @brief The stoichiometric matrix is a N x M matrix composed of N-number of species
-        * by M-number of reactions. 
-        * 
-        * @param None
-        * 
-        * @returns stoichmat A stochiometric matrix 
+        * @brief builds both CSR forms of the N-species x M-reaction
+        * stoichiometric matrix in one pass over the reactions, using
+        * libSBML's typed reactant/product accessors and the species
+        * registry built at construction — no dynamic_cast per species
+        * reference and no dense intermediate
+        *
+        * @param species_rows receives the species-major CSR matrix
+        * @param reaction_rows receives the reaction-major (transposed)
+        * CSR matrix
         * */
-        std::vector<std::vector<double>> getStoichiometricMatrix();
+        void getStoichiometryCSR(
+            SparseMatrix& species_rows,
+            SparseMatrix& reaction_rows
+        );
 
         /**
-         * @brief creates a map of species identifiers to thier corresponding index
+         * @brief map of species identifiers to thier corresponding index,
+         * served from the registry built at construction
          * 
          * @param numSpecies integer count of species in the SBML model
          * 
          * @returns speciesIndexMap map of species identifiers and the corresponding index
          */
-        std::unordered_map<std::string, unsigned int> speciesMap(
+        const std::unordered_map<std::string, unsigned int>& speciesMap(
             const int& numSpecies
         );
 
@@ -62,6 +85,38 @@ class SBMLHandler {
         */
         std::vector<std::string> getReactionExpressions();
 
+        // One assignment or rate rule: the variable it targets and its
+        // math as an L3 infix string, ready for the formula compiler
+        struct RuleSpec {
+            std::string variable;
+            std::string formula;
+            bool is_rate;
+        };
+
+        // One discrete event: the trigger condition and its variable,
+        // formula assignment pairs, both as L3 infix strings
+        struct EventSpec {
+            std::string trigger_formula;
+            std::vector<std::pair<std::string, std::string>> assignments;
+        };
+
+        /**
+         * @brief extracts the document's assignment and rate rules as
+         * formula strings, in document order. Algebraic rules have no
+         * explicit target and are skipped with a warning
+         *
+         * @returns one RuleSpec per supported rule
+         */
+        std::vector<RuleSpec> getRuleSpecs();
+
+        /**
+         * @brief extracts the document's events: each trigger condition
+         * and its event assignments as formula strings, in document order
+         *
+         * @returns one EventSpec per event carrying a trigger
+         */
+        std::vector<EventSpec> getEventSpecs();
+
         /**
          * @brief getter method for returning all model ids as a vector
          * 
@@ -69,7 +124,7 @@ class SBMLHandler {
          * 
          * @returns species_ids vector of species identifiers in SBML model
          */
-        std::vector<std::string> getSpeciesIds();
+        const std::vector<std::string>& getSpeciesIds();
 
         /**
          * @brief getter method for obtaining SBML intial state values
@@ -78,12 +133,15 @@ class SBMLHandler {
          * 
          * @returns initial_state vector of double initial model states for every species
          */
-        std::vector<double> getInitialState();
+        const std::vector<double>& getInitialState();
 
         /**
-         * @todo add method docstring
+         * @brief getter method for returning all parameter ids as a vector,
+         * served from the registry built at construction
+         *
+         * @returns parameter_ids vector of parameter identifiers in SBML model
          */
-        std::vector<std::string> getParameterIds();
+        const std::vector<std::string>& getParameterIds();
 
         /**
          * @brief Method for modifying model entity species || parameter|| compartment
@@ -94,10 +152,27 @@ class SBMLHandler {
          * @returns None updates model SBML object
          */
         void setModelEntityValue(
-        std::string entity_id, 
+        std::string entity_id,
         double new_value
         );
 
+        /**
+         * @brief quiet write-through variant of setModelEntityValue: one
+         * index-map lookup resolves the id, and unknown ids are reported
+         * to the caller instead of printed. The bulk-override path uses
+         * this so a condition file's unknowns surface as one collective
+         * message rather than a line per entity
+         *
+         * @param entity_id parameter, species or compartment identifier
+         * @param new_value updating value for model
+         *
+         * @returns true when the id resolved to an entity in this model
+         */
+        bool trySetEntityValue(
+            const std::string& entity_id,
+            double new_value
+        );
+
         /**
          * @brief gets list of reactionId strings
          * 
@@ -105,7 +180,7 @@ class SBMLHandler {
          * 
          * @returns reactionIds list of reaction identifiers
          */
-        std::vector<std::string> getReactionIds();
+        const std::vector<std::string>& getReactionIds();
 
         /**
          * @brief getter method for retrieving species-specific compartmental volumes
@@ -115,13 +190,13 @@ class SBMLHandler {
          * @returns cell_volumes vector list of compartmental volumes, as defined in
          * class member this->model
          */
-        std::vector<double> getGlobalSpeciesCompartmentVals();
+        const std::vector<double>& getGlobalSpeciesCompartmentVals();
 
         /**
          * @brief add method docstring
          */
         void convertSpeciesUnits(
-            std::vector<double> conversion_factor
+            const std::vector<double>& conversion_factor
         );
 
         /**
@@ -133,25 +208,57 @@ class SBMLHandler {
          * @returns None updates SBML model species globally
          */
         void setState(
-            std::vector<double> new_state
+            const std::vector<double>& new_state
         );
 
         /**
          * @brief returns a vector of all parameter values within the 
-         * sbml model
+         * sbml model. Exchange writes parameters through raw libSBML
+         * pointers, so the registry row is refreshed in place on every
+         * call; the reference stays allocation-free but always current
          */
-        std::vector<double> getParameterValues();
+        const std::vector<double>& getParameterValues();
 
     //----------------------------members-----------------------------------//
         std::vector<double> species_volumes;
         std::string name;
 
+        // Path the document was read from; derived caches (snapshot,
+        // kernel tuning) live beside it
+        std::string source_path;
+
+        // Immutable derived model data, shared across every handler and
+        // module instance loaded from the same SBML file
+        std::shared_ptr<const ModelData> data;
+
 
     private:
     //---------------------------------methods------------------------------//
+        /**
+         * @brief walks the libSBML document exactly once, filling the
+         * struct-of-arrays registry below. Every structural getter serves
+         * const references into this registry afterwards; the mutating
+         * methods write through to both the registry and the document
+         *
+         * @returns None populates the registry members
+         */
+        void populateRegistry();
 
     //-------------------------------members--------------------------------//
-        SBMLDocument* doc; 
+        // Shared document ownership: handle copies bump the refcount, the
+        // last one deletes the document. Deep copies only through clone()
+        std::shared_ptr<SBMLDocument> doc;
+
+        // Struct-of-arrays registry: identifier lists, index map and value
+        // rows cached at construction so getters stop re-walking libSBML
+        // and re-allocating vectors on every call
+        std::vector<std::string> species_ids;
+        std::vector<std::string> parameter_ids;
+        std::vector<std::string> reaction_ids;
+        std::unordered_map<std::string, unsigned int> species_index;
+        std::unordered_map<std::string, unsigned int> parameter_index;
+        std::vector<double> species_values;
+        std::vector<double> parameter_values;
 
 };
 
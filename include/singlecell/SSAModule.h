@@ -0,0 +1,112 @@
+/**
+ * @file: SSAModule.h
+ *
+ * @authors  Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Class Creator For derived class SSAModule (from StochasticModule).
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef SSAMODULE_h
+#define SSAMODULE_h
+
+//===========================Library Import=================================//
+//Std Libaries
+#include <vector>
+
+// Internal libraries
+#include "StochasticModule.h"
+#include "SBMLHandler.h"
+
+//==========================Class Declaration===============================//
+/**
+ * @brief exact stochastic simulation via the next-reaction method. Reuses
+ * the parent's compiled rate laws and CSR stoichiometry; putative firing
+ * times live in an indexed binary min-heap and a reaction dependency graph
+ * limits per-firing propensity work to the reactions actually affected, so
+ * sparse networks stay competitive with tau-leaping while trajectories
+ * remain exact. Selected by giving the SBML model the id "SSA"
+ */
+class SSAModule final : public StochasticModule {
+    public:
+    // -------------------------Methods-----------------------------------//
+        SSAModule( //Constructor. ctor
+            SBMLHandler ExactModel
+        );
+
+        ~SSAModule() override = default; //Destructor, dtor
+
+        /**
+         * @brief advances the exact trajectory across one recording
+         * interval, firing individual reactions until the interval's end
+         * and recording the state reached. The event queue is rebuilt at
+         * the top of every interval since the exchange phase may have
+         * changed parameter values between calls
+         *
+         * @param step current step of the simulation
+         *
+         * @returns None records the interval-end state
+         */
+        void step(
+            int step
+        ) override;
+
+    private:
+    // -------------------------Methods-----------------------------------//
+        /**
+         * @brief draws an exponentially distributed absolute firing time
+         * for a reaction with the given propensity
+         *
+         * @param t_now current absolute time within the interval
+         * @param propensity the reaction's current propensity
+         *
+         * @returns putative firing time; infinity when propensity is zero
+         */
+        double drawFiringTime(
+            double t_now,
+            double propensity
+        );
+
+        /**
+         * @brief restores the min-heap property after firing_times for one
+         * reaction changed, moving it up or down as needed
+         *
+         * @param reaction index of the reaction whose time changed
+         */
+        void heapUpdate(
+            unsigned int reaction
+        );
+
+        void heapSiftUp(
+            size_t pos
+        );
+
+        void heapSiftDown(
+            size_t pos
+        );
+
+    //---------------------------Members----------------------------------//
+        // Dependency graph: reaction i -> reactions whose propensity reads
+        // a species that firing i changes (i itself always included)
+        std::vector<std::vector<unsigned int>> dependents;
+
+        // Current propensity per reaction, refreshed only for dependents
+        std::vector<double> propensities;
+
+        // Absolute putative firing time per reaction within the interval
+        std::vector<double> firing_times;
+
+        // Indexed binary min-heap over firing_times: heap holds reaction
+        // indices, heap_pos maps a reaction back to its heap slot
+        std::vector<unsigned int> heap;
+        std::vector<unsigned int> heap_pos;
+
+        // Working state in whole molecules and molecules-per-volume
+        std::vector<double> state_molecules;
+        std::vector<double> state_mpv;
+
+};
+
+#endif // SSAMODULE_H
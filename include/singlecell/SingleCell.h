@@ -14,50 +14,68 @@
 
 //===========================Library Import=================================//
 #include <map>
+#include <mutex>
+#include <chrono>
+#include <thread>
 #include <vector>
 #include <memory>
+#include <future>
+#include <utility>
+#include <istream>
 #include <optional>
 #include <functional>
 #include <type_traits>
 #include <unordered_map>
+#include <condition_variable>
 
 //Internal Libraries
+#include "singlecell/SparseMatrix.h"
 #include "singlecell/SBMLHandler.h"
+#include "singlecell/PerfMonitor.h"
 #include "singlecell/BaseModule.h"
 #include "singlecell/StochasticModule.h"
 #include "singlecell/DeterministicModule.h"
 
 // Third Party Libraries
+#include "muParser.h"
 #include "sbml/SBMLReader.h"
 
 //==========================Class Declaration===============================//
+/**
+ * @brief one co-simulation session over a set of SBML modules.
+ *
+ * Thread-safety contract: distinct SingleCell instances may be
+ * constructed, configured and simulated concurrently from different
+ * threads of one process — every piece of cross-instance state (the
+ * module factory, the AMICI model and propensity registries, the
+ * ModelData and shared-time-grid caches, the symbol table, the task
+ * scheduler and the logger) is immutable or internally locked. A single
+ * instance is not synchronized: interleaving calls on the same object
+ * from two threads is undefined. TaskScheduler::configure and
+ * Logger::setOutput are process-wide and belong at startup, before
+ * concurrent sessions exist
+ */
 class SingleCell {
     private:
     //---------------------------methods----------------------------------//
         /**
-         * @brief loads all typenamem sbml_paths into public class member handlers
-         * 
-         * @param sbml_paths strings of paths to SBML model files.ADD_FILTERED_PLIST
-         * 
+         * @brief loads all sbml_paths into public class member handlers.
+         * Files are parsed and post-processed on concurrent threads since
+         * the libSBML parses and derived-data extraction are independent
+         * per file; handler order matches the input path order
+         *
+         * @param sbml_paths strings of paths to SBML model files
+         *
          * @returns loaded_sbmls list of SBMLHandler objects
          */
-        template <typename... Paths>
-        std::vector<SBMLHandler> loadSBMLModels(
-            const Paths&... paths
-        ) {
-            std::vector<std::string> sbml_path_strings = { std::string(paths)... };
-            std::vector<SBMLHandler> handler_list;
-
-            for (const auto& path : sbml_path_strings) {
-                handler_list.emplace_back(path);
-            }
-
-            return handler_list;
-
-        }
+        static std::vector<SBMLHandler> loadSBMLModels(
+            const std::vector<std::string>& sbml_paths
+        );
 
     //---------------------------members--------------------------------//
-        static std::map<std::string, std::function<std::unique_ptr<BaseModule>(const SBMLHandler&)>> moduleFactory;
+        // const so concurrent sessions can resolve modules without
+        // synchronization; registration happens at static-init time only
+        static const std::map<std::string, std::function<std::unique_ptr<BaseModule>(const SBMLHandler&)>> moduleFactory;
 
 
     protected:
@@ -71,7 +89,96 @@ class SingleCell {
         void loadSimulationModules();
 
         /**
-         * @brief Iterates over stored class member modules, assigns targets 
+         * @brief builds the session on first use: module construction,
+         * then target assignment and overlap resolution — which a lone
+         * module skips outright, since it has no partner to exchange
+         * with. Every entry point funnels through here, so the
+         * deterministic-only screening case pays model load and solver
+         * setup and none of the co-simulation scaffolding
+         */
+        void ensureSessionLoaded();
+
+        /**
+         * @brief compiles every registered observable expression against
+         * the session's recorded species layout, binding each recorded id
+         * to its slot in member observable_input. Runs once per session;
+         * evaluation afterwards is pure bytecode
+         */
+        void compileObservables();
+
+        /**
+         * @brief classifies one observable formula as a linear combination
+         * of recorded species — the PEtab offset/scale shape: terms joined
+         * by top-level +/-, each a product of numeric literals, constant
+         * model symbols (parameters, compartments) and at most one
+         * recorded species. Qualifying terms emit observation-matrix
+         * triplets, species-free terms accumulate into the offset
+         *
+         * @param formula the observable expression
+         * @param column_of recorded species id -> matrix column
+         * @param row the observable's matrix row
+         * @param triplets receives the row's column, coefficient entries
+         * @param offset receives the row's constant offset
+         *
+         * @returns true when the whole formula fit the linear form
+         */
+        bool classifyLinearObservable(
+            const std::string& formula,
+            const std::unordered_map<std::string, unsigned int>& column_of,
+            unsigned int row,
+            std::vector<SparseMatrix::Triplet>& triplets,
+            double& offset
+        );
+
+        /**
+         * @brief resolves a formula token that is constant over a run —
+         * a parameter or compartment of any loaded model — to its current
+         * document value, so linear observables fold PEtab scale/offset
+         * parameters into their matrix coefficients at compile time
+         *
+         * @param token the identifier to resolve
+         * @param value receives the resolved value
+         *
+         * @returns true when some model defines the token
+         */
+        bool resolveConstantSymbol(
+            const std::string& token,
+            double& value
+        );
+
+        /**
+         * @brief resolves every registered event probe for the coming
+         * run: species targets bind to (module, offset) pairs, predicate
+         * expressions compile against the global species ids, and all
+         * running event state is reset. Seeds crossing detection from the
+         * initial state when the modules already hold one
+         */
+        void compileEventProbes();
+
+        /**
+         * @brief advances every probe one step against the modules'
+         * current state: first crossings and first-true predicates fire
+         * once, peak probes update their running maximum
+         *
+         * @param t simulation time of the completed step, in seconds
+         */
+        void evaluateEventProbes(
+            double t
+        );
+
+        /**
+         * @brief applies the requested observable pruning to the loaded
+         * modules: walks the stoichiometry and rate-law token graph
+         * backwards from the observable (and exchange-exported) species,
+         * hands each stochastic module its kept-reaction mask and narrows
+         * the recording subset to the observable species. Runs once per
+         * module load; a no-op when pruning is off or no observables are
+         * registered
+         */
+        void applyObservablePruning();
+
+        /**
+         * @brief Iterates over stored class member modules, assigns targets
          * to modules
          */
         void assignGlobalTargets();
@@ -90,19 +197,107 @@ class SingleCell {
          * @param step double iteration size delta-t
          */
         void setGlobalSimulationSettings(
-            double start, 
-            double stop, 
+            double start,
+            double stop,
             double step
         );
 
+        /**
+         * @brief resolves the stepping-grid spacing: the exchange
+         * interval when interval controls are set, the entry point's
+         * step argument otherwise
+         *
+         * @param step step argument from the public entry point
+         *
+         * @returns grid spacing in seconds
+         */
+        double gridStep(
+            double step
+        ) const;
+
+        /**
+         * @brief greedy nearest-neighbour chain through the conditions'
+         * parameter space, starting from the smallest-magnitude
+         * condition: for a one-dimensional dose sweep this visits doses
+         * in ascending order, so consecutive solves differ by one small
+         * parameter nudge
+         *
+         * @param conditions per-condition (entity_id, value) override sets
+         *
+         * @returns condition indices in continuation order
+         */
+        std::vector<int> continuationOrder(
+            const std::vector<std::vector<std::pair<std::string, double>>>&
+                conditions
+        ) const;
 
         /**
          * @brief class method to run modules, stepwise
          * 
          * @param timesteps vector of double steps to length of simulation
+         * @param first_step step index to begin at; > 1 when resuming from
+         * a checkpoint
          */
         void runGlobal(
-            std::vector<double> timesteps
+            const std::vector<double>& timesteps,
+            int first_step = 1
+        );
+
+        /**
+         * @brief serializes the co-simulation to a compact binary
+         * checkpoint: per module its id, current state vector, RNG stream
+         * and the recorded rows written so far. The file is written to a
+         * temporary path and renamed, so a preemption mid-write never
+         * corrupts the previous checkpoint
+         *
+         * @param step last completed simulation step
+         */
+        void writeCheckpoint(
+            int step
+        );
+
+        /**
+         * @brief the light half of the two-level cadence: serializes per
+         * module only the current state vector and RNG counters into an
+         * in-memory blob, then hands the file write (to checkpoint_path
+         * + ".light", via the usual temporary-and-rename) to a background
+         * thread. The stepping loop pays the snapshot memcpy only, so the
+         * tight cadence stays well under a percent of step throughput
+         *
+         * @param step last completed simulation step
+         */
+        void writeLightCheckpoint(
+            int step
+        );
+
+        /**
+         * @brief restores module states, RNG streams and recorded rows from
+         * a checkpoint written by writeCheckpoint; light checkpoints from
+         * writeLightCheckpoint restore state and RNG only. Must be called
+         * after setGlobalSimulationSettings so the results buffers are sized
+         *
+         * @param path checkpoint file to restore from
+         *
+         * @returns last completed step recorded in the checkpoint
+         */
+        int loadCheckpoint(
+            const std::string& path
+        );
+
+        /**
+         * @brief the parse-and-restore half of loadCheckpoint, reading
+         * from any input stream positioned at the checkpoint's first
+         * byte; resume feeds it bytes prefetched on a background thread
+         * so the file read overlaps module reconstruction
+         *
+         * @param in stream holding the checkpoint bytes
+         * @param path origin of the bytes, for error messages
+         *
+         * @returns last completed step recorded in the checkpoint
+         */
+        int loadCheckpointStream(
+            std::istream& in,
+            const std::string& path
         );
 
         /**
@@ -117,7 +312,17 @@ class SingleCell {
         void updateGlobalParameters();
 
         /**
-         * @brief creates combined results matrix for every module in 
+         * @brief body of the streaming producer thread: drives the step
+         * and exchange loop, and at every chunk boundary assembles the
+         * newly completed recorded rows and parks them in the handoff
+         * slot, blocking there while the consumer still holds the
+         * previous chunk. Failures are captured and rethrown in
+         * nextChunk on the consumer thread
+         */
+        void streamWorker();
+
+        /**
+         * @brief creates combined results matrix for every module in
          * class member this->modules
          * 
          * @param numTimesteps integer number of timepoints, specifying how long 
@@ -131,15 +336,293 @@ class SingleCell {
             int numTimesteps
         );
 
+        /**
+         * @brief folds the cache-line padding out of the global results
+         * matrix after the stepping threads have joined, restoring the
+         * dense timesteps-by-species layout every reader expects. A
+         * no-op for the serial layout, which is laid out dense already
+         */
+        void compactGlobalResults();
+
+        /**
+         * @brief resolves a recorded species id to its column in the
+         * global results layout, and to the owning module's local column
+         *
+         * @param species_id recorded species identifier
+         * @param owner receives the owning module
+         * @param local_col receives the column inside the owner's block
+         *
+         * @returns the global column index
+         */
+        size_t findRecordedColumn(
+            const std::string& species_id,
+            BaseModule*& owner,
+            size_t& local_col
+        );
+
     //------------------------------members---------------------------------//
         std::vector<std::unique_ptr<BaseModule>> modules;
 
+        // User-supplied RNG seed; modules get offset substreams when set
+        std::optional<unsigned long long> rng_seed;
+
+        // When set, independent modules step on concurrent threads
+        bool parallel_stepping = false;
+
+        // Running average of each module's step wall time, feeding the
+        // scheduler's cost-steered placement for parallel stepping
+        std::vector<double> module_step_costs;
+
+        // Exchange-barrier instrumentation: precomputed per-module
+        // histogram names (so the step hot path builds no strings) and
+        // each module's step-completion stamp, from which the wait
+        // until the slowest module is derived after the barrier
+        std::vector<std::string> module_step_phases;
+        std::vector<std::string> module_wait_phases;
+        std::vector<std::chrono::steady_clock::time_point> module_step_finished;
+
+        // Path prefix for per-module streamed binary trajectories
+        std::string stream_output = "";
+
+        // true streams the delta-encoded SCTRJ002 trajectory format
+        bool stream_compress = false;
+
+        // Per-species streamed-recording schedule; parallel id/interval
+        // lists, empty keeps every column at the uniform row rate
+        std::vector<std::string> stream_interval_ids;
+        std::vector<int> stream_interval_values;
+
+        // Recording controls forwarded to every module
+        int record_interval = 1;
+
+        // Recorded-mantissa width forwarded to every module; 0 keeps
+        // full double precision
+        int record_mantissa_bits = 0;
+
+        // Envelope-summary window forwarded to every module; 0 disables
+        int summary_window_steps = 0;
+
+        // Per-model kernel autotuning forwarded to every module
+        bool kernel_autotune = false;
+
+        // Pipelined step/record split forwarded to every module
+        bool pipelined_recording = false;
+
+        // Rolling-window mode: trailing recorded rows retained (0 keeps
+        // every row), and the recorded-row index the retained window
+        // starts at after the last run
+        int results_window = 0;
+        size_t last_window_offset = 0;
+
+        // Observable-reachability pruning: requested by the user, and
+        // whether the loaded modules have already been pruned (pruning
+        // is one-way until the modules reload)
+        bool observable_pruning = false;
+        bool observable_pruning_applied = false;
+
+        // Projected-memory ceiling enforced before allocation; over
+        // budget spills to memory_spill_path or refuses the run
+        size_t memory_budget_bytes = 0;
+        std::string memory_spill_path;
+
+        // Exchange change-tracking tolerance applied to every module
+        double exchange_tolerance = 0.0;
+
+        // Declared exchange view forwarded to every module; empty ids
+        // keep full pairwise overlap discovery
+        std::string exchange_view_name = "";
+        std::vector<std::string> exchange_view_ids;
+
+        // Micro-steps per ODE macro-interval; 1 keeps lockstep coupling
+        int macro_interval = 1;
+
+        // Speculative-lookahead input tolerance; 0 keeps solves on the
+        // critical path
+        double speculation_tolerance = 0.0;
+
+        // Conservation-law elimination for the stochastic modules
+        bool conservation_elimination = false;
+
+        // Interval controls in seconds: stochastic leap length, exchange
+        // interval and recording interval. Zeros keep the corresponding
+        // interval tied to simulate's single step argument
+        double leap_seconds = 0.0;
+        double exchange_seconds = 0.0;
+        double record_seconds = 0.0;
+
+        // Geometry of the last configured run, kept so extend can append
+        // to the same grid; a zero step marks no run configured yet
+        double last_sim_start = 0.0;
+        double last_sim_stop = 0.0;
+        double last_sim_step = 0.0;
+
+        // Set while extend drives runGlobal: event probe state carries
+        // across the extension instead of recompiling from scratch
+        bool extending_run = false;
+
+        // Transpose finished flat results to species-major before return
+        bool results_species_major = false;
+
+        // Open stepping session: its time grid and the next step index;
+        // 0 marks no session open
+        std::vector<double> stepping_timesteps;
+        int stepping_next_step = 0;
+
+        // Session-persistent state view stepOnce refreshes in place, so
+        // the steering round trip performs no allocation
+        std::vector<double> stepping_state_view;
+
+        // Streaming session: the background producer, the single-chunk
+        // handoff slot and its flags. One slot is the backpressure: the
+        // producer blocks until the consumer takes the pending chunk
+        std::thread stream_thread;
+        std::mutex stream_mutex;
+        std::condition_variable stream_cv;
+        std::vector<double> stream_pending;
+        size_t stream_pending_rows = 0;
+        bool stream_pending_full = false;
+        bool stream_finished = false;
+        bool stream_cancelled = false;
+        std::exception_ptr stream_error;
+        int stream_chunk_steps = 1;
+        size_t stream_emitted_rows = 0;
+
+        // Sensitivity parameter selection applied to every ODE module
+        std::vector<std::string> sensitivity_parameter_ids;
+
+        // Bound override ids; modules re-bind them at load so the fast
+        // setParameters path survives session rebuilds
+        std::vector<std::string> override_parameter_ids;
+
+        // Active solver settings bundle, forwarded to every ODE module
+        SolverProfile solver_profile;
+
+        // Steady-state early termination: relative per-step change bound
+        // (0 disables) and how many consecutive steps must stay below it
+        double steady_state_tolerance = 0.0;
+        int steady_state_window = 5;
+
+        // Warm-started batch continuation: chain conditions by parameter
+        // distance and start each from its predecessor's final state
+        bool batch_continuation = false;
+
+        // Registered observables: names, expressions, per-session compiled
+        // parsers and the contiguous input row the parsers are bound to
+        std::vector<std::string> observable_names;
+        std::vector<std::string> observable_formulas;
+        std::vector<mu::Parser> observable_parsers;
+        std::vector<double> observable_input;
+
+        // Sparse observation matrix over the recorded species: one CSR
+        // row plus constant offset per observable whose formula is a
+        // linear combination (the common PEtab scale/offset shape); the
+        // flags select the dgemv-like projection kernel per observable,
+        // everything else keeps its compiled parser
+        SparseMatrix observable_matrix;
+        std::vector<double> observable_offsets;
+        std::vector<unsigned char> observable_is_linear;
+        std::vector<std::string> record_species;
+
+        /**
+         * @brief one registered event probe and its running state: the
+         * resolved species location (or compiled predicate), the last
+         * observed value for crossing detection, and the event once fired
+         */
+        struct EventProbe {
+            enum Kind { Threshold, Peak, Predicate };
+
+            std::string name;
+            Kind kind;
+            std::string target;
+            double threshold = 0.0;
+            bool rising = true;
+
+            // resolved once per run by compileEventProbes
+            int module_index = -1;
+            int species_offset = -1;
+            mu::Parser parser;
+
+            // running state across the stepping loop
+            bool fired = false;
+            double previous_value = 0.0;
+            bool seeded = false;
+            double event_time = 0.0;
+            double event_value = 0.0;
+        };
+
+        // Registered probes, evaluated per step inside the run loop,
+        // and the shared predicate input bound to global species ids
+        std::vector<EventProbe> event_probes;
+        std::vector<double> event_probe_input;
+
+        // Per-phase timing aggregator shared with the modules
+        PerfMonitor perf;
+
+        // Path for the end-of-run JSON perf report; empty disables it
+        std::string perf_output = "";
+
+        // Print a progress line every N steps
+        int progress_interval = 1;
+
+        // Ranked per-entity cost report destination; empty disables the
+        // per-reaction and CVODES accounting entirely
+        std::string entity_profile_output;
+
+        // Background progress reporting; <= 0 keeps the in-loop printf
+        double progress_seconds = 0.0;
+        std::string progress_status_path;
+
+        // Path prefix for memory-mapped results backing files
+        std::string results_backing_path;
+
+        // One global recorded matrix, written in place by the modules'
+        // column blocks during the run; empty in backing-store mode
+        std::vector<double> global_results;
+
+        // Live row stride of global_results and each module's column
+        // offset within it. Under parallel stepping the blocks are
+        // padded out to whole cache lines, so the stride exceeds the
+        // species count until compactGlobalResults runs
+        size_t global_row_stride = 0;
+        std::vector<size_t> global_block_offsets;
+
+        // Owned storage for the lock-free exchange slots wired between
+        // producer and consumer modules in findModuleOverlaps
+        std::vector<std::unique_ptr<std::atomic<double>>> exchange_slots;
+
+        // Construction-time initial state per module, for session reset
+        std::vector<std::vector<double>> pristine_states;
+
+        // Checkpoint destination and cadence; interval 0 disables it
+        std::string checkpoint_path = "";
+        int checkpoint_interval = 0;
+
+        // Light-checkpoint cadence between full ones; 0 disables it
+        int light_checkpoint_interval = 0;
+
+        // The one in-flight background light-checkpoint write; waiting
+        // on it before launching the next bounds outstanding files to one
+        std::future<void> light_checkpoint_inflight;
+
 
     public:
     //---------------------------methods------------------------------------//
-        template<typename... SBML_Paths>
-        SingleCell(SBML_Paths&&... sbml_paths) {
-            this->handlers = loadSBMLModels(std::forward<SBML_Paths>(sbml_paths)...);
+        template<typename... SBML_Paths,
+                 typename = std::enable_if_t<
+                     (std::is_convertible_v<SBML_Paths, std::string> && ...)>>
+        SingleCell(SBML_Paths&&... sbml_paths)
+            : model_paths({ std::string(sbml_paths)... }) {
+            // timed so the perf report breaks cold start out of the run:
+            // libSBML parsing plus the cached ModelData extraction
+            PerfMonitor::ScopedTimer timer(&this->perf, "startup_sbml_load");
+            this->handlers = loadSBMLModels(this->model_paths);
+        } //Ctor
+
+        // Overload for callers holding a runtime list of model paths
+        SingleCell(const std::vector<std::string>& sbml_paths)
+            : model_paths(sbml_paths) {
+            PerfMonitor::ScopedTimer timer(&this->perf, "startup_sbml_load");
+            this->handlers = loadSBMLModels(this->model_paths);
         } //Ctor
 
         virtual ~SingleCell() = default; //Dtor
@@ -160,29 +643,1098 @@ class SingleCell {
         );
 
         /**
-         * @brief assignment method to update model attributes 
+         * @brief simulate variant returning one contiguous row-major buffer
+         * (stride = total species count) instead of nested vectors, so
+         * callers such as the pybind11 layer can adopt the memory without
+         * copying. Dimensions are published in members last_num_timesteps
+         * and last_num_species
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         *
+         * @returns flat row-major buffer of global states, timesteps-by-species
+         */
+        std::vector<double> simulateFlat(
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0 //seconds
+        );
+
+        /**
+         * @brief resumes a previously checkpointed run: rebuilds the
+         * modules for the same simulation window, restores their states,
+         * RNG streams and recorded rows from the checkpoint, then continues
+         * stepping from the next step. Restart cost is file I/O plus model
+         * loading, not re-simulation
+         *
+         * @param ckpt_path checkpoint file written during a prior simulate
+         * @param start is the simulation start time of the original run
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         *
+         * @returns matrix of global states for both models
+         */
+        std::vector<std::vector<double>> resume(
+            std::string ckpt_path,
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0 //seconds
+        );
+
+        /**
+         * @brief extends a completed run to a later stop time without
+         * resimulating: the live modules resume from their final state,
+         * solver internals and step-keyed RNG substreams, the results
+         * storage grows in place, and the appended rows land on the same
+         * recording grid. Draws match a single longer run exactly because
+         * each step's RNG block keys on its absolute step index
+         *
+         * @param new_stop extended stop time in seconds; must lie beyond
+         * the previous stop
+         *
+         * @returns matrix of global states over the full extended window
+         */
+        std::vector<std::vector<double>> extend(
+            double new_stop
+        );
+
+        /**
+         * @brief enables periodic checkpointing: every interval-th step the
+         * full co-simulation state is serialized to path, replacing the
+         * previous checkpoint atomically. Pair with resume to survive
+         * preemptible-node restarts without re-simulating.
+         *
+         * A nonzero light_interval adds a second, tighter cadence: those
+         * steps snapshot only the state vectors and RNG counters —
+         * kilobytes against the full checkpoint's recorded rows — into an
+         * in-memory blob a background thread writes to path + ".light",
+         * so frequent capture costs the stepping loop a memcpy, not a
+         * file write. Resuming from a light checkpoint restores the
+         * simulation state but not the rows recorded before it
+         *
+         * @param path destination file for the rolling checkpoint
+         * @param interval steps between full checkpoints (>= 1)
+         * @param light_interval steps between light checkpoints; 0 keeps
+         * full checkpoints only
+         */
+        void setCheckpoint(
+            std::string path,
+            int interval,
+            int light_interval = 0
+        );
+
+        /**
+         * @brief runs a batch of conditions fully in C++: each condition is
+         * a set of (entity_id, value) overrides applied on a fresh cell
+         * before simulating the shared time window. Conditions are claimed
+         * from a work counter by a thread pool, each writing its own slab
+         * of the stacked conditions-by-timesteps-by-species buffer.
+         * Dimensions are published in members last_num_timesteps and
+         * last_num_species
+         *
+         * @param conditions per-condition (entity_id, value) override sets
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_threads worker count; <= 0 uses hardware concurrency
+         *
+         * @returns flat row-major buffer, conditions-by-timesteps-by-species
+         */
+        std::vector<double> simulateBatch(
+            const std::vector<std::vector<std::pair<std::string, double>>>& conditions,
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0, //seconds
+            int num_threads = 0
+        );
+
+        /**
+         * @brief runs a stochastic replicate ensemble that shares one
+         * deterministic trajectory: a reference replicate is simulated in
+         * full, then every other replicate replays the reference ODE states
+         * read-only and only steps its own stochastic modules. A replicate
+         * forks to its own deterministic solve from the first step where
+         * its stochastic feedback deviates from the reference beyond
+         * feedback_tolerance (relative max-norm), so unremarkable
+         * replicates skip nearly the entire ODE cost. Replicates are
+         * claimed from a work counter by a thread pool, each writing its
+         * own slab of the stacked replicates-by-timesteps-by-species
+         * buffer; dimensions land in members last_num_timesteps and
+         * last_num_species
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_replicates ensemble size, including the reference
+         * @param feedback_tolerance relative deviation of a replicate's
+         * stochastic state from the reference before its deterministic
+         * side forks; <= 0 forks on any deviation
+         * @param num_threads worker count; <= 0 uses hardware concurrency
+         *
+         * @returns flat row-major buffer, replicates-by-timesteps-by-species
+         */
+        std::vector<double> simulateEnsembleFlat(
+            double start,
+            double stop,
+            double step,
+            int num_replicates,
+            double feedback_tolerance = 0.05,
+            int num_threads = 0
+        );
+
+        /**
+         * @brief runs num_replicates independent draws of the configured
+         * system fully in C++, the variance-study pattern that otherwise
+         * re-invokes simulate from Python R times paying setup each time.
+         * Replicates are claimed from the process-wide scheduler, share
+         * the immutable per-model data through its cache, and draw from
+         * derived RNG substreams (base seed plus replicate index) so each
+         * replicate replays in isolation. Each worker writes its own slab
+         * of the stacked replicates-by-timesteps-by-species buffer;
+         * dimensions land in members last_num_timesteps and
+         * last_num_species
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param num_replicates independent replicate count
+         *
+         * @returns flat row-major buffer, replicates-by-timesteps-by-species
+         */
+        std::vector<double> simulateReplicatesFlat(
+            double start,
+            double stop,
+            double step,
+            int num_replicates
+        );
+
+        /**
+         * @brief rewinds a reused session between simulate() calls:
+         * restores every module's species to the construction-time initial
+         * state, or to a caller-supplied global state vector, without
+         * rebuilding modules, stoichiometry, compiled formulas or AMICI
+         * objects. Parameter scans pay setup once, then reset + simulate
+         *
+         * @param initial_state optional global state in module order;
+         * empty restores the construction-time initial state
+         */
+        void reset(
+            const std::vector<double>& initial_state = {}
+        );
+
+        /**
+         * @brief assignment method to update model attributes
          * 
          * @param entity_id SBML identifier of entity (parameter || species || compartment) to be updated
          * @param value updating value, for now; float only
          */
         void modify(
-            std::string entity_id, 
+            std::string entity_id,
             double value
         );
 
         /**
-         * @brief getter method for retrieving all speciesIds from all associated submodels
-         * uses each model's SBMLHandler->getSpeciesIds() method.
-         * 
+         * @brief applies a whole set of entity overrides in one pass:
+         * each id resolves once per handler through the registry index
+         * maps, values land grouped by handler, and ids unknown to every
+         * model are reported in a single collective message instead of a
+         * line per entity. Condition files overriding hundreds of
+         * entities go through here rather than per-entity modify calls
+         *
+         * @param entity_values map of entity identifier to override value
+         */
+        void modifyBulk(
+            const std::unordered_map<std::string, double>& entity_values
+        );
+
+        /**
+         * @brief enables per-phase instrumentation: scoped timers around
+         * propensity evaluation, sampling, AMICI solves, exchange and
+         * recording aggregate into a JSON report written at end of run
+         *
+         * @param output path string for the JSON perf report
+         */
+        void setPerfOutput(
+            std::string output
+        );
+
+        /**
+         * @brief enables per-entity cost attribution: stochastic modules
+         * accumulate per-reaction evaluation time and firing counts, ODE
+         * modules accumulate CVODES work counters, and a ranked report
+         * is written to the given path at end of run. Opt-in because the
+         * per-reaction clock reads are measurable on hot paths
+         *
+         * @param output path string for the ranked entity report
+         */
+        void setEntityProfiling(
+            std::string output
+        );
+
+        /**
+         * @brief demotes the per-iteration progress line to every N steps
+         *
+         * @param interval steps between progress lines (>= 1)
+         */
+        void setProgressInterval(
+            int interval
+        );
+
+        /**
+         * @brief replaces the in-loop progress printf with a background
+         * sampler: the step loop only bumps an atomic counter, and a
+         * reporter thread emits steps/sec and a smoothed ETA every
+         * interval_seconds, to stderr or to a status file schedulers
+         * can poll
+         *
+         * @param interval_seconds seconds between reports; <= 0 disables
+         * @param status_path status file rewritten each sample; empty
+         * reports to stderr
+         */
+        void setProgressReporting(
+            double interval_seconds,
+            std::string status_path = ""
+        );
+
+        /**
+         * @brief backs every module's results matrix with a memory-mapped
+         * file under path_prefix instead of an in-RAM allocation, so
+         * high-resolution runs whose trajectory exceeds node memory still
+         * record; rows behind the write head are flushed and evicted as
+         * the run advances. Read results back in slices through
+         * getResultsWindow
+         *
+         * @param path_prefix one backing file per module is created as
+         * <prefix>.<module>.resmap; empty restores in-RAM buffers
+         */
+        void setResultsBackingStore(
+            std::string path_prefix
+        );
+
+        /**
+         * @brief projects the memory a run with this grid would allocate:
+         * each module's recorded trajectory plus one full-state
+         * trajectory for the solver side (AMICI's ReturnData or the
+         * stochastic state arenas). Loads the modules if needed so model
+         * sizes are known; exchange wiring is negligible and excluded
+         *
+         * @param start simulation start time
+         * @param stop simulation stop time
+         * @param step recording/exchange step size
+         *
+         * @returns projected allocation in bytes
+         */
+        size_t estimateRunMemory(
+            double start,
+            double stop,
+            double step
+        );
+
+        /**
+         * @brief caps projected run memory: before allocating, simulate
+         * compares estimateRunMemory against the budget and either
+         * spills results to the memory-mapped backing store under
+         * spill_path_prefix or, with no spill path, refuses the run.
+         * Zero disables the check. Accounted allocations appear in the
+         * perf report's "memory" object alongside the peak RSS
+         *
+         * @param max_bytes projected-memory ceiling; 0 disables
+         * @param spill_path_prefix backing-store prefix to auto-enable
+         * when over budget; empty makes over-budget runs throw
+         */
+        void setMemoryBudget(
+            size_t max_bytes,
+            std::string spill_path_prefix = ""
+        );
+
+        /**
+         * @brief assembles a window of recorded rows across modules, in
+         * the same column order as simulate, without forcing the whole
+         * matrix resident; pair with the backing store for
+         * larger-than-RAM trajectories
+         *
+         * @param first_row first recorded row of the window
+         * @param num_rows rows to assemble; clamped to the recorded count
+         *
+         * @returns flat row-major buffer, num_rows x last_num_species
+         */
+        std::vector<double> getResultsWindow(
+            size_t first_row,
+            size_t num_rows
+        );
+
+        /**
+         * @brief bounds results memory: record every interval-th step and
+         * optionally only a subset of species, applied to every module and
+         * honored by combineResultsMatrix and the output writers
+         *
+         * @param interval record every interval-th step (1 records all)
+         * @param species_subset identifiers to record; empty records all
+         */
+        void setRecording(
+            int interval,
+            std::vector<std::string> species_subset = {}
+        );
+
+        /**
+         * @brief truncates recorded values to mantissa_bits of mantissa:
+         * the rows stay doubles, so the buffer layout, binary formats and
+         * readers are unchanged, but the zeroed low bits collapse under
+         * the delta-compressed trajectory stream. 24 bits keeps roughly
+         * float32 precision; stepping state is never truncated
+         *
+         * @param mantissa_bits mantissa bits to keep; 0 or >= 52 records
+         * full precision
+         */
+        void setRecordingPrecision(
+            int mantissa_bits
+        );
+
+        /**
+         * @brief enables windowed envelope summaries: every step feeds
+         * per-species min/max/mean/variance accumulators and each window
+         * of window_steps steps emits one summary row, so dashboards get
+         * plot-ready downsampled envelopes from 1e7-step runs without a
+         * post-processing pass over the full matrix
+         *
+         * @param window_steps steps per summary window; 0 disables
+         */
+        void setSummaryRecording(
+            int window_steps
+        );
+
+        /**
+         * @brief assembles one statistic's summary rows across modules:
+         * window-major, modules side by side in the combined results
+         * column order, one row per completed window (a trailing partial
+         * window is folded in)
+         *
+         * @param statistic one of "min", "max", "mean" or "variance"
+         *
+         * @returns flat row-major buffer, num_windows x recorded species
+         */
+        std::vector<double> getSummary(
+            const std::string& statistic
+        );
+
+        /**
+         * @brief sets the tolerance for change-tracked data exchange:
+         * an overlapping value is only pushed to its partner module (and
+         * into AMICI, which triggers solver re-setup) when it moved more
+         * than this since the last push. Zero still skips exact repeats
+         *
+         * @param tolerance absolute change below which a pair is skipped
+         */
+        void setExchangeTolerance(
+            double tolerance
+        );
+
+        /**
+         * @brief declares a named exchange view: only the listed boundary
+         * ids are considered during overlap resolution, compiled to the
+         * same pointer pairs, lock-free slots and change-tracked
+         * dirty-values as discovered overlaps. Multi-scale couplings
+         * where cells trade only a handful of ligand concentrations then
+         * resolve in O(view) per module pair instead of scanning full
+         * entity sets pairwise. An empty id list restores full discovery
+         *
+         * @param name view label, carried for reporting
+         * @param entity_ids boundary identifiers the coupling exchanges
+         */
+        void setExchangeView(
+            const std::string& name,
+            const std::vector<std::string>& entity_ids
+        );
+
+        /**
+         * @brief enables multirate coupling: the deterministic module
+         * integrates macro-intervals of micro_steps stochastic steps per
+         * CVODES invocation and serves the intermediate exchange values
+         * from dense solver output, so the stochastic side still sees
+         * interpolated values every delta_t. Feedback from the stochastic
+         * side reaches the ODE solver at macro boundaries only
+         *
+         * @param micro_steps micro-steps per macro-interval; 1 disables
+         */
+        void setMacroStepping(
+            int micro_steps
+        );
+
+        /**
+         * @brief enables speculative lookahead on the deterministic
+         * side: after each lockstep solve the ODE module immediately
+         * integrates the next interval under linearly extrapolated
+         * exchange inputs, committing the result when the actual
+         * stochastic outputs land within tolerance and re-solving
+         * otherwise. Under parallel stepping a committed lookahead
+         * hides the ODE solve inside the stochastic stepping time of
+         * the previous interval
+         *
+         * @param tolerance relative mismatch allowed between predicted
+         * and actual exchange inputs before a lookahead commits; 0
+         * disables
+         */
+        void setSpeculativeStepping(
+            double tolerance
+        );
+
+        /**
+         * @brief enables conservation-law elimination on the stochastic
+         * side: conserved moieties (total receptor = free + bound, and
+         * kin) are detected in the stoichiometry once per session, one
+         * dependent species per law drops out of the per-leap state
+         * update, and its value is recovered algebraically from the
+         * conserved total instead — which also pins totals that
+         * rounding and clamping would otherwise let drift. The AMICI
+         * side is untouched; its state dimension is fixed when the
+         * model is compiled
+         *
+         * @param enable true arms the analysis on the next step
+         */
+        void setConservationElimination(
+            bool enable
+        );
+
+        /**
+         * @brief decouples the three intervals simulate's single step
+         * otherwise conflates: the stochastic leap length, the
+         * module-exchange interval and the recording resolution, all in
+         * seconds. The stepping grid runs at the exchange interval — the
+         * coarsest spacing the modules must meet at — stochastic modules
+         * cover it with fixed-length sub-leaps, and recording thins to
+         * whole exchange steps. A typical hybrid run leaps at 0.01 s,
+         * exchanges at 1 s and records at 10 s instead of running all
+         * three at 0.01 s
+         *
+         * @param leap_seconds tau-leap length; 0 leaps a full interval
+         * @param exchange_seconds spacing between module exchanges; 0
+         * keeps simulate's step argument as the grid
+         * @param record_seconds spacing between recorded rows; 0 records
+         * every exchange step
+         */
+        void setStepIntervals(
+            double leap_seconds,
+            double exchange_seconds,
+            double record_seconds
+        );
+
+        /**
+         * @brief enables warm-started continuation for simulateBatch:
+         * conditions are chained by nearest parameter distance and each
+         * solve starts from the previous condition's final state instead
+         * of the cold initial state, so tightly spaced dose sweeps pay
+         * only the transient between neighbouring doses. Pairs with
+         * setSteadyStateTolerance, which ends each solve once its
+         * transient settles. Concurrent batches split the chain into one
+         * contiguous segment per worker; each segment's first condition
+         * cold-starts. Meant for sweeps that override the same entities
+         * in every condition
+         *
+         * @param enabled true chains batch conditions; false (the
+         * default) runs every condition independently
+         */
+        void setBatchContinuation(
+            bool enabled
+        );
+
+        /**
+         * @brief enables steady-state detection: when every module's
+         * relative state change stays below tolerance for window
+         * consecutive steps, the stepping loop terminates early and the
+         * remaining results rows are back-filled with the equilibrium
+         * state, so output shapes match the requested grid. Zero disables
+         *
+         * @param tolerance relative max-norm change bound per step
+         * @param window consecutive quiescent steps required
+         */
+        void setSteadyStateTolerance(
+            double tolerance,
+            int window = 5
+        );
+
+        /**
+         * @brief selects a named solver profile (screening, standard or
+         * precise) applied to every ODE module: tolerances, step budget,
+         * linear solver and stability-limit detection as one bundle.
+         * Screening trades tolerance for several-fold solver throughput;
+         * precise is fitting-grade. The profile name lands in the perf
+         * report metadata so outputs stay attributable to their settings
+         *
+         * @param name profile name; unknown names throw
+         */
+        void setSolverProfile(
+            const std::string& name
+        );
+
+        /**
+         * @brief selects model parameters to differentiate against on the
+         * ODE modules: the next full run performs one instrumented solve
+         * and keeps the forward sensitivities beside the trajectory,
+         * retrievable via getSensitivities
+         *
+         * @param parameter_ids AMICI parameter identifiers
+         */
+        void setSensitivityParameters(
+            const std::vector<std::string>& parameter_ids
+        );
+
+        /**
+         * @brief resolves a set of override parameter ids once against
+         * every module's engines (libSBML, compiled formulas, live AMICI
+         * model). After binding, setParameters applies a full override
+         * vector in microseconds, so an optimizer can run thousands of
+         * evaluate-update cycles per second on a resident session
+         *
+         * @param parameter_ids parameter identifiers, in the order
+         * setParameters values will arrive
+         */
+        void bindParameters(
+            const std::vector<std::string>& parameter_ids
+        );
+
+        /**
+         * @brief fast override path: writes one value per bound id into
+         * the live modules with no string lookups, logging, or model
+         * reconstruction. Requires a prior bindParameters call
+         *
+         * @param values one value per bound id, binding order
+         */
+        void setParameters(
+            const std::vector<double>& values
+        );
+
+        /**
+         * @brief forward sensitivities from the last run, flat row-major
+         * with shape (timepoints x parameters x states); empty when
+         * sensitivities were not armed. Sets the last_num_sensitivity_*
+         * members to the returned geometry
+         *
+         * @returns reference to the module-owned sensitivity buffer
+         */
+        const std::vector<double>& getSensitivities();
+
+        /**
+         * @brief registers named observable expressions over the recorded
+         * species ids, compiled once per session through the same muParser
+         * engine the stochastic rate laws use. With observables registered,
+         * simulateObservablesFlat projects each recorded step on the fly
+         * and returns only the observables matrix, instead of
+         * materializing the full species matrix for Python post-processing
+         *
+         * @param observables name, expression pairs; expressions may
+         * reference any recorded species id
+         */
+        void setObservables(
+            const std::vector<std::pair<std::string, std::string>>& observables
+        );
+
+        /**
+         * @brief runs the simulation and returns the registered
+         * observables evaluated at every recorded step, row-major with
+         * one column per observable. Sets last_num_timesteps and
+         * last_num_species to the returned geometry
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         *
+         * @returns flat row-major observables matrix
+         */
+        std::vector<double> simulateObservablesFlat(
+            double start,
+            double stop,
+            double step
+        );
+
+        /**
+         * @brief projects an already-recorded raw species matrix through
+         * the registered observable expressions: the simulation half of
+         * simulateObservablesFlat factored away, so callers can keep the
+         * raw recording and derive the observables from it in the same
+         * pass. Compiles the expressions on first use
+         *
+         * @param flat_results flat row-major recorded species matrix
+         * @param stride row width of flat_results, i.e. the recorded
+         * species count
+         *
+         * @returns flat row-major observables matrix, one column per
+         * registered observable
+         */
+        std::vector<double> projectObservables(
+            const std::vector<double>& flat_results,
+            size_t stride
+        );
+
+        /**
+         * @brief getter for the registered observable names, in the column
+         * order simulateObservablesFlat returns
+         *
+         * @returns observable name vector
+         */
+        std::vector<std::string> getObservableNames();
+
+        /**
+         * @brief restricts the run to work that can influence the
+         * registered observables. Stochastic modules drop reactions
+         * outside the backward dependency closure of the observable
+         * species (exchange-exported species stay as roots so coupling
+         * is preserved), and recording narrows to the observable
+         * species when no explicit recording subset is set. ODE modules
+         * still integrate every state — AMICI models cannot skip states
+         * without recompiling — so their savings come from the narrowed
+         * recording alone. Takes effect at the next configured run
+         *
+         * @param enable true prunes, false restores full evaluation on
+         * the next module reload
+         */
+        void setObservablePruning(bool enable);
+
+        /**
+         * @brief enables per-model kernel autotuning: on the first run of
+         * a model on a host, each stochastic module times its candidate
+         * kernels over a few hundred warmup evaluations and persists the
+         * winning dispatch beside the binary model cache, keyed by the
+         * model's content hash and a host signature. Later runs load the
+         * verdict and pay nothing
+         *
+         * @param enable true tunes the dispatch on the next run
+         */
+        void setKernelAutotune(bool enable);
+
+        /**
+         * @brief overlaps recording with compute: each module's step
+         * thread hands fresh states to a per-module recorder thread that
+         * applies summary accumulation, masking, quantization and stream
+         * appends, so recording-heavy configurations (full species at
+         * fine resolution) hide the recording cost behind the next step.
+         * Results and summaries are drained before any read, so observed
+         * values are unchanged
+         *
+         * @param enable true pipelines recording on the next run
+         */
+        void setPipelinedRecording(bool enable);
+
+        /**
+         * @brief warms the per-model caches without running a simulation:
+         * each SBML file is parsed once through ModelData::acquire — which
+         * writes (or loads) the binary snapshot and builds the derived
+         * structure memos — and its generated AMICI shared object, when
+         * one exists, is dlopened so its pages are resident. Schedulers
+         * call this minutes ahead of a queued job so the job's startup
+         * hits warm caches
+         *
+         * @param sbml_paths SBML files the upcoming jobs will load
+         */
+        static void preload(const std::vector<std::string>& sbml_paths);
+
+        /**
+         * @brief bounds results at a trailing window of recorded rows:
+         * every module's buffer (and the shared global matrix) holds only
+         * the last recorded_rows rows, recording wraps in place, and the
+         * retained rows are rotated chronological when the run finishes —
+         * so arbitrarily long homeostasis runs hold constant memory.
+         * Rows that leave the window survive only through a configured
+         * stream output. Zero restores full retention
+         *
+         * @param recorded_rows trailing recorded rows to retain
+         */
+        void setResultsWindow(int recorded_rows);
+
+        /**
+         * @brief recorded-row index of the first retained results row
+         * after the last run: zero unless a rolling window pushed early
+         * rows out, in which case row i of the results corresponds to
+         * recorded step getFirstRetainedRow() + i
+         *
+         * @returns offset of results row 0 in recorded steps
+         */
+        size_t getFirstRetainedRow() const;
+
+        /**
+         * @brief one fired (or never-fired) event probe result: the
+         * probe's name, the event time in seconds (NaN when the probe
+         * never fired) and the observed value at the event
+         */
+        struct EventRecord {
+            std::string probe;
+            double time;
+            double value;
+        };
+
+        /**
+         * @brief registers a first-crossing probe evaluated inside the
+         * stepping loop: the event fires the first time species_id
+         * crosses threshold in the given direction. Time-to-event
+         * readouts then need no trajectory storage or post-hoc scanning
+         *
+         * @param name probe label in the returned event table
+         * @param species_id species whose state (nM) is watched
+         * @param threshold crossing value in nM
+         * @param rising true fires on upward crossings, false downward
+         */
+        void addThresholdProbe(
+            const std::string& name,
+            const std::string& species_id,
+            double threshold,
+            bool rising = true
+        );
+
+        /**
+         * @brief registers a peak probe: tracks the species' running
+         * maximum across the run and reports the peak value and the time
+         * it occurred
+         *
+         * @param name probe label in the returned event table
+         * @param species_id species whose state (nM) is watched
+         */
+        void addPeakProbe(
+            const std::string& name,
+            const std::string& species_id
+        );
+
+        /**
+         * @brief registers a predicate probe: the expression is compiled
+         * once against the global species ids (same muParser engine the
+         * observables use) and evaluated per step; the event fires the
+         * first step the expression is nonzero
+         *
+         * @param name probe label in the returned event table
+         * @param expression boolean/numeric expression over species ids
+         */
+        void addPredicateProbe(
+            const std::string& name,
+            const std::string& expression
+        );
+
+        /**
+         * @brief compact event table for the last run: one record per
+         * registered probe, in registration order. Probes that never
+         * fired report NaN times
+         *
+         * @returns vector of EventRecord entries
+         */
+        std::vector<EventRecord> getEventTable() const;
+
+        /**
+         * @brief removes every registered event probe
+         */
+        void clearEventProbes();
+
+        /**
+         * @brief getter for the column identifiers actually recorded, i.e.
+         * getGlobalSpeciesIds filtered through the active recording mask
+         *
+         * @returns recorded_ids string vector of recorded species identifiers
+         */
+        std::vector<std::string> getRecordedSpeciesIds();
+
+        /**
+         * @brief writes the last run as one SCARC001 archive with one
+         * member per module, keyed by module id, each carrying its own
+         * species header. Members copy straight out of each module's
+         * column block — the combined matrix is never materialized — so
+         * downstream tooling fetches only the module it analyzes. The
+         * Python ResultsArchive reader offers a combined view for
+         * consumers that still want one matrix
+         *
+         * @param output destination path for the archive
+         */
+        void saveModuleResults(
+            const std::string& output
+        );
+
+        /**
+         * @brief enables streaming persistence: each module gets an
+         * asynchronous double-buffered writer flushing its recorded rows to
+         * <path_prefix>.<moduleId>.bin while the simulation runs
+         *
+         * @param path_prefix output location prefix for the streamed files
+         * @param delta_compress true streams the delta-encoded SCTRJ002
+         * format: rows are XOR'd against their predecessor and zero-run
+         * packed on the I/O thread, shrinking fine-grained trajectory
+         * archives several-fold
+         */
+        void setStreamOutput(
+            std::string path_prefix,
+            bool delta_compress = false
+        );
+
+        /**
+         * @brief per-species recording resolution for streamed output:
+         * species_ids[i] lands in the stream every intervals[i]-th
+         * recorded row, unlisted species on every row. A non-uniform
+         * schedule switches the stream to the ragged SCTRJ003 format —
+         * each row stores only its due columns, and the header carries
+         * the schedule — and the Python BinaryTrajectory reader
+         * reassembles an aligned forward-filled view. Mixed-timescale
+         * models stop spending most of their output bandwidth on
+         * effectively-constant species
+         *
+         * @param species_ids identifiers to thin, parallel to intervals
+         * @param intervals per-species row intervals, floored at one
+         */
+        void setSpeciesRecordingIntervals(
+            const std::vector<std::string>& species_ids,
+            const std::vector<int>& intervals
+        );
+
+        /**
+         * @brief enables or disables concurrent module stepping. Within a
+         * timestep the modules only exchange data afterwards in
+         * updateGlobalParameters, so their step() calls are independent and
+         * the exchange phase acts as the synchronization barrier
+         *
+         * @param enable true to step modules on concurrent threads
+         */
+        void setParallelStepping(
+            bool enable
+        );
+
+        /**
+         * @brief assigns a global RNG seed for reproducible simulations.
+         * Each module receives its own substream (seed + module index), so
+         * parallel replicates stay independent yet replayable
+         *
+         * @param seed integer seed value for the simulation
+         */
+        void setSeed(
+            unsigned long long seed
+        );
+
+        /**
+         * @brief getter method for retrieving all speciesIds from all associated submodels.
+         * Built once from the shared per-model ID lists and cached, since
+         * the model set is fixed at construction
+         *
          * @param None non-static, uses class-members
-         * 
-         * @returns global_ids string vector of all species identifiers from all models
-         * in parent class SingleCell
+         *
+         * @returns reference to the cached concatenated species identifiers
          */
-        std::vector<std::string> getGlobalSpeciesIds();
+        const std::vector<std::string>& getGlobalSpeciesIds();
+
+        /**
+         * @brief one species' recorded trajectory from the completed run,
+         * without materializing the rest of the matrix
+         *
+         * @param species_id recorded species identifier
+         *
+         * @returns the species' value at every recorded timestep
+         */
+        std::vector<double> getTrajectory(
+            const std::string& species_id
+        );
+
+        /**
+         * @brief one recorded timestep's full state row
+         *
+         * @param t recorded timestep index (0 is the initial state)
+         *
+         * @returns all recorded species values at timestep t
+         */
+        std::vector<double> getTimeSlice(
+            size_t t
+        );
+
+        /**
+         * @brief a rectangular window of the results: the selected species
+         * over recorded timesteps [t0, t1). Only the requested bytes are
+         * gathered, so slicing a handful of species out of a large run
+         * never touches the full matrix
+         *
+         * @param species_ids recorded species identifiers, in output order
+         * @param t0 first recorded timestep of the window
+         * @param t1 one past the last recorded timestep of the window
+         *
+         * @returns row-major buffer, (t1 - t0) x species_ids.size()
+         */
+        std::vector<double> getWindow(
+            const std::vector<std::string>& species_ids,
+            size_t t0,
+            size_t t1
+        );
+
+        /**
+         * @brief direct view of the in-memory recorded matrix backing the
+         * last run, row-major at stride last_num_species; empty in
+         * backing-store mode. The binding layer wraps it in zero-copy
+         * NumPy views
+         *
+         * @returns reference to the session's flat results buffer
+         */
+        const std::vector<double>& getResultsView() const;
+
+        /**
+         * @brief opens a resumable stepping session for external
+         * co-simulation drivers: builds (or reuses) the modules, lays out
+         * the recording grid and arms the persistent solvers, but leaves
+         * the time loop to the caller. Pair with advanceTo and
+         * finishStepping
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         */
+        void beginStepping(
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0 //seconds
+        );
+
+        /**
+         * @brief advances the open stepping session through every step
+         * and exchange point at or before time t, then returns control.
+         * Each resume reuses the live solvers and compiled formulas, so
+         * the per-call cost is the steps themselves — no session setup
+         * and no fresh runAmiciSimulation beyond the steps taken
+         *
+         * @param t simulation time to advance to, in seconds
+         *
+         * @returns the simulation time actually reached
+         */
+        double advanceTo(
+            double t
+        );
+
+        /**
+         * @brief advances the open stepping session exactly one grid step
+         * — the latency path for interactive steering loops. The returned
+         * reference is a view into a session-persistent buffer refreshed
+         * in place, so a steer/step round trip allocates nothing; the
+         * binding layer wraps it as a zero-copy array. Throws when no
+         * session is open or the session's grid is exhausted
+         *
+         * @returns every module's new state concatenated in module order,
+         * valid until the next stepOnce or finishStepping
+         */
+        const std::vector<double>& stepOnce();
+
+        /**
+         * @brief view of the exchanged state at the last completed step:
+         * every module's current state concatenated in module order, the
+         * same values the exchange phase just published
+         *
+         * @returns concatenated current-state vector across modules
+         */
+        std::vector<double> getCurrentState();
+
+        /**
+         * @brief overwrites the open stepping session's state with a
+         * concatenated vector in getCurrentState's layout, scattered back
+         * into every module and re-recorded at the last completed step.
+         * Mid-run interventions — division triggers, external couplings —
+         * write through here so the engines, the recording and the next
+         * step's inputs all agree on the injected values
+         *
+         * @param state concatenated per-module state, module order
+         */
+        void setCurrentState(
+            const std::vector<double>& state
+        );
+
+        /**
+         * @brief forks this open stepping session from another: every
+         * module adopts the parent's current state (one buffer copy per
+         * module, no SBML or solver work) and the step cursor jumps to
+         * the parent's, so the next advanceTo resumes from the parent's
+         * position. Both sessions must be open over the same model set.
+         * Rows before the fork step keep this session's opening state;
+         * lineage bookkeeping is the caller's
+         *
+         * @param parent the open session whose state this one adopts
+         */
+        void forkSteppingFrom(
+            SingleCell& parent
+        );
+
+        /**
+         * @brief closes the stepping session: mirrors the final exchanged
+         * parameters into the SBML documents and ends the run, leaving
+         * the recorded results readable through the query API
+         */
+        void finishStepping();
+
+        /**
+         * @brief opens a streaming session: the run executes on a
+         * background thread while the caller consumes completed result
+         * chunks through nextChunk. The handoff slot holds exactly one
+         * chunk, so a slow consumer backpressures the producer and
+         * resident hand-off memory stays bounded at one chunk regardless
+         * of run length
+         *
+         * @param start is the simulation start time
+         * @param stop is the simulation stop time, in seconds
+         * @param step is the delta_t step between simulation updates in seconds
+         * @param chunk_steps simulation steps per delivered chunk
+         */
+        void beginStreaming(
+            double start = 0.0, //seconds
+            double stop = 60.0, //seconds
+            double step = 30.0, //seconds
+            int chunk_steps = 1
+        );
+
+        /**
+         * @brief blocks until the producer completes the next chunk of
+         * recorded rows and moves it out of the handoff slot. A producer
+         * failure rethrows here on the consumer thread
+         *
+         * @param chunk receives the rows, row-major at stride
+         * last_num_species
+         * @param num_rows receives the row count of this chunk
+         *
+         * @returns false when the run has finished and no chunk remains
+         */
+        bool nextChunk(
+            std::vector<double>& chunk,
+            size_t& num_rows
+        );
+
+        /**
+         * @brief closes the streaming session: cancels a still-running
+         * producer, joins it and finishes the underlying stepping
+         * session, leaving the recorded results readable through the
+         * query API. Safe to call at any point after beginStreaming
+         */
+        void endStreaming();
+
+        /**
+         * @brief selects the layout of the buffers simulateFlat returns.
+         * Recording always writes time-major (one row per step); with
+         * species_major enabled the finished matrix is converted once
+         * through the cache-blocked transpose, so fitting code that scans
+         * one species across a million timesteps reads contiguously
+         *
+         * @param species_major true returns species-by-timestep buffers
+         */
+        void setResultsLayout(
+            bool species_major
+        );
+
+        /**
+         * @brief getter for the configured output layout, so the binding
+         * layer shapes the returned array to match
+         *
+         * @returns true when simulateFlat returns species-major buffers
+         */
+        bool isResultsSpeciesMajor() const;
 
         //---------------------------members--------------------------------//
         std::vector<SBMLHandler> handlers;
+
+        // cache for getGlobalSpeciesIds; empty until the first call
+        std::vector<std::string> global_species_ids;
+
+        // Dimensions of the buffer returned by the last simulateFlat call
+        size_t last_num_timesteps = 0;
+        size_t last_num_species = 0;
+
+        // geometry of the buffer returned by getSensitivities
+        int last_num_sensitivity_parameters = 0;
+        int last_num_sensitivity_states = 0;
+
+        // Source model paths, kept so batch workers can build fresh cells
+        std::vector<std::string> model_paths;
        
 
 };
@@ -0,0 +1,75 @@
+/**
+ * @file: SolverProfile.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Named solver configuration profiles for the ODE modules
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef SOLVERPROFILE_h
+#define SOLVERPROFILE_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief one named bundle of CVODES settings, applied by the ODE modules
+ * in setSimulationSettings instead of the former hard-coded values.
+ * Screening runs trade tolerance for several-fold solver throughput;
+ * fitting keeps the tight settings. The active profile name travels into
+ * the perf-report metadata so results stay attributable
+ */
+struct SolverProfile {
+
+    std::string name = "standard";
+
+    double absolute_tolerance = 1e-10;
+    double relative_tolerance = 1e-6;
+    int max_steps = 100000;
+
+    // "dense", "KLU" or "auto". Dense CVODES linear algebra scales
+    // cubically with the state count, so auto switches to KLU sparse
+    // factorization once a model crosses sparse_threshold states and
+    // the solve cost follows the Jacobian nnz instead
+    std::string linear_solver = "auto";
+
+    // state count above which auto selects KLU
+    static constexpr int sparse_threshold = 256;
+
+    // BDF stability-limit detection; costs extra order-control work,
+    // worthwhile only near the tight end of the tolerance range
+    bool stability_limit = true;
+
+    /**
+     * @brief field-wise equality over the applied settings (name is
+     * metadata and ignored); the ODE modules use it to decide whether
+     * a cached solver's configuration is still current
+     *
+     * @param other profile to compare against
+     *
+     * @returns true when both profiles apply identical solver settings
+     */
+    bool matches(
+        const SolverProfile& other
+    ) const;
+
+    /**
+     * @brief resolves a profile name to its settings bundle
+     *
+     * @param name "screening", "standard" or "precise"
+     *
+     * @returns the named profile
+     *
+     * @throws std::runtime_error on an unknown profile name
+     */
+    static SolverProfile named(
+        const std::string& name
+    );
+};
+
+#endif // SOLVERPROFILE_h
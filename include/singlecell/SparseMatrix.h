@@ -0,0 +1,67 @@
+/**
+ * @file SparseMatrix.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Compressed-sparse-row matrix for stoichiometric operations
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef SPARSEMATRIX_h
+#define SPARSEMATRIX_h
+
+//===========================Library Import=================================//
+#include <vector>
+#include <cstddef>
+
+//==========================Class Declaration===============================//
+class SparseMatrix {
+    public:
+    //---------------------------members------------------------------------//
+        // one (row, col, value) entry for fromTriplets construction
+        struct Triplet {
+            unsigned int row;
+            unsigned int col;
+            double value;
+        };
+
+    //---------------------------methods------------------------------------//
+        SparseMatrix() = default; //Ctor
+
+        /**
+         * @brief builds a CSR representation straight from coordinate
+         * triplets, skipping any dense intermediate. Duplicate
+         * coordinates are summed (a species that is both reactant and
+         * product of one reaction accumulates, matching dense fill) and
+         * entries that cancel to zero are dropped
+         *
+         * @param num_rows row count of the matrix
+         * @param num_cols column count of the matrix
+         * @param triplets coordinate entries in any order
+         *
+         * @returns sparse CSR matrix with rows in order and columns
+         * ascending within each row
+         */
+        static SparseMatrix fromTriplets(
+            size_t num_rows,
+            size_t num_cols,
+            std::vector<Triplet> triplets
+        );
+
+    //-------------------------------members--------------------------------//
+        // row_ptr[i] .. row_ptr[i+1] bound row i's entries in col_idx/values
+        std::vector<size_t> row_ptr;
+
+        std::vector<unsigned int> col_idx;
+
+        std::vector<double> values;
+
+        size_t num_rows = 0;
+
+        size_t num_cols = 0;
+
+};
+
+#endif // SPARSEMATRIX_H
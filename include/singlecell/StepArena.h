@@ -0,0 +1,59 @@
+/**
+ * @file StepArena.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Monotonic per-step arena for hot-path temporaries
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef STEPARENA_h
+#define STEPARENA_h
+
+//===========================Library Import=================================//
+#include <vector>
+#include <cstddef>
+
+//==========================Class Declaration===============================//
+class StepArena {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief hands out count contiguous doubles by bumping an offset
+         * into preallocated block storage. Blocks are never reallocated, so
+         * pointers stay valid until the next reset; after the first step
+         * every allocation is a pointer bump with no heap traffic
+         *
+         * @param count number of doubles requested
+         *
+         * @returns pointer to uninitialized storage for count doubles
+         */
+        double* allocate(
+            size_t count
+        );
+
+        /**
+         * @brief rewinds the arena to empty without releasing its blocks,
+         * called once at the top of every step
+         *
+         * @returns None resets members block_index & offset
+         */
+        void reset();
+
+    private:
+    //-------------------------------members--------------------------------//
+        // Owned storage blocks; inner buffers never move once created
+        std::vector<std::vector<double>> blocks;
+
+        size_t block_index = 0;
+
+        size_t offset = 0;
+
+        // Minimum doubles per block; oversize requests get their own block
+        static constexpr size_t block_size = 4096;
+
+};
+
+#endif // STEPARENA_H
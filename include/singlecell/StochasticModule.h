@@ -14,14 +14,26 @@
 
 //===========================Library Import=================================//
 //Std Libaries
+#include <cmath>
 #include <vector>
 #include <memory>
+#include <random>
 #include <optional>
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 // Internal libraries
 #include "BaseModule.h"
+#include "StepArena.h"
+#include "CounterRng.h"
 #include "SBMLHandler.h"
+#include "KernelTuner.h"
+#include "SparseMatrix.h"
+#include "PropensityRegistry.h"
+
+// Third Party Libraries
+#include "muParser.h"
 
 //==========================Class Declaration===============================//
 class StochasticModule : public BaseModule{
@@ -60,10 +72,13 @@ class StochasticModule : public BaseModule{
 
         
         /**
-         * @brief Calculates a single timestep for the stochastic module, returning to call
-         * 
+         * @brief Calculates a single timestep for the stochastic module, returning to call.
+         * Dispatches to a fixed-capacity stack kernel when the model fit one
+         * of the pre-instantiated size tiers at load, otherwise to the
+         * general arena-backed path
+         *
          * @param step current step of the simulation
-         * 
+         *
          * @returns new_state t+1 values for stochastic step.
         */
         void step(
@@ -76,11 +91,171 @@ class StochasticModule : public BaseModule{
          * @param timepoints vector of timepoints for the simulation
          */
         void run(
-            std::vector<double> timepoints
+            const std::vector<double>& timepoints
+        ) override;
+
+        /**
+         * @brief reseeds the module's persistent RNG stream so runs are
+         * reproducible. Overrides the BaseModule no-op
+         *
+         * @param seed integer seed value for this module's RNG stream
+         *
+         * @returns None reseeds member generator
+         */
+        void setRandomSeed(
+            unsigned long long seed
+        ) override;
+
+        /**
+         * @brief ranked per-reaction cost report: seconds spent in each
+         * rate law and realized firing counts, worst first. Emits nothing
+         * unless entity profiling was enabled for the run
+         *
+         * @param out destination stream for the report section
+         */
+        void reportEntityProfile(
+            std::ostream& out
+        ) override;
+
+        /**
+         * @brief enables runtime fast/slow reaction partitioning. Every
+         * repartition_interval leaps the expected firing counts are
+         * re-examined: reactions staying above the threshold have become
+         * effectively continuous (e.g. a species crossed the copy-number
+         * threshold mid-run) and are advanced by their deterministic
+         * expectation, so sampling cost tracks the truly-stochastic
+         * subsystem. Threshold zero disables partitioning
+         *
+         * @param fast_mean_threshold expected firings per leap above which
+         * a reaction is treated deterministically
+         * @param repartition_interval leaps between partition refreshes
+         */
+        void setRuntimePartitioning(
+            double fast_mean_threshold,
+            int repartition_interval = 16
+        );
+
+        /**
+         * @brief enables model-partitioned parallel stepping for large
+         * weakly-coupled networks: the reaction graph's connected
+         * components (from the sparse stoichiometry) are balanced across
+         * num_threads groups, and each leap samples, constrains and
+         * applies its groups on separate cores. Components own disjoint
+         * species, so state updates are conflict-free with no boundary
+         * synchronization; each group draws from its own counter-RNG
+         * substream keyed by (seed, step, group), so results are
+         * deterministic and independent of the thread count. Falls back
+         * to serial stepping when the network is one component
+         *
+         * @param num_threads parallel group count; <= 1 disables
+         */
+        void setPartitionedStepping(
+            int num_threads
+        );
+
+        /**
+         * @brief enables adaptive tau selection inside step: each recording
+         * interval is covered by leaps sized so no species' expected change
+         * or standard deviation exceeds the Cao-Gillespie epsilon bound,
+         * instead of one fixed-length leap. Long quiescent phases then take
+         * few large leaps while bursts are resolved finely. Zero disables
+         *
+         * @param epsilon relative change bound, typically 0.01 - 0.05
+         */
+        void setAdaptiveTau(
+            double epsilon
+        );
+
+        /**
+         * @brief sets a fixed sub-leap length so one exchange interval is
+         * covered by several tau-leaps instead of a single full-length
+         * one. Adaptive tau, when enabled, can still shorten a leap
+         * further; the interval's last leap is clipped as before. <= 0
+         * restores one leap per interval
+         *
+         * @param leap_seconds leap length in seconds
+         */
+        void setLeapInterval(
+            double leap_seconds
+        ) override;
+
+        /**
+         * @brief arms conservation-law elimination: the first step after
+         * arming finds conserved moieties (left null vectors of the
+         * stoichiometry), picks one dependent species per law and drops
+         * its entries from both CSR orientations, so every subsequent
+         * leap skips that species' delta gather and recovers its value
+         * algebraically from the law's total instead. Totals recapture
+         * at each step boundary, so exchanges, rules and events that
+         * move law members between steps are absorbed. Overrides the
+         * BaseModule no-op
+         *
+         * @param enable true arms the analysis on the next step
+         */
+        void setConservationElimination(
+            bool enable
+        ) override;
+
+        /**
+         * @brief sets the reaction count above which propensity evaluation
+         * runs OpenMP-parallel. The compiled parsers are independent and
+         * only read shared state during evaluation, so large reaction sets
+         * split across threads; small ones stay serial to avoid fork/join
+         * overhead
+         *
+         * @param threshold minimum reactions for parallel evaluation
+         */
+        void setParallelPropensityThreshold(
+            size_t threshold
+        );
+
+        /**
+         * @brief enables per-model kernel autotuning: the first configured
+         * run either loads the persisted dispatch configuration beside the
+         * model snapshot or times the candidate kernels — full versus
+         * incremental propensity evaluation, serial versus parallel
+         * fallback, gather versus scatter state update, and the sampling
+         * cutoff — over a few hundred warmup evaluations and persists the
+         * winners. Overrides the BaseModule no-op
+         *
+         * @param enable true resolves the dispatch on the next configure
+         */
+        void setKernelAutotune(
+            bool enable
+        ) override;
+
+        /**
+         * @brief drops reactions that provably cannot affect the
+         * requested outputs: pruned reactions leave the product-group
+         * kernels, the muParser fallback list and the incremental
+         * dirty-tracking CSR, and their propensities pin to zero so they
+         * never fire. Applied once per session by the observable
+         * reachability pass; there is no un-prune short of reloading
+         *
+         * @param keep_reactions per-reaction flags, sized to the
+         * reaction count; zero prunes the reaction
+         */
+        void setReactionPruning(
+            const std::vector<char>& keep_reactions
         ) override;
 
         /**
-         * @brief public method for updating the simulation states at every timestep. 
+         * @brief serializes member generator for checkpointing
+         *
+         * @returns serialized counter-generator state string
+         */
+        std::string getRngState() override;
+
+        /**
+         * @brief restores member generator from a checkpointed state so the
+         * resumed run draws the same sample stream
+         *
+         * @param state serialized generator state from getRngState
+         */
+        void setRngState(const std::string& state) override;
+
+        /**
+         * @brief public method for updating the simulation states at every timestep.
          * 
          * @param state vector of timestep values to be calculated. 
          * 
@@ -92,65 +267,460 @@ class StochasticModule : public BaseModule{
 
         /**
          * @brief Override class for BaseModule, exchanges data with target
-         * modules at each timestep
+         * modules at each timestep. A tight loop over pre-resolved
+         * pointer pairs; no string lookups on this path
          */
         void updateParameters();
-        
+
+        /**
+         * @brief extends the base resolution: each exchanged parameter is
+         * additionally bound to its compiled-formula slot in eval_values,
+         * resolved once so per-step mirroring is a raw pointer write
+         *
+         * @param alternate_model target module's SBML model
+         */
+        void findOverlappingIds(
+            const Model* alternate_model
+        ) override;
+
+        /**
+         * @brief extends the base binding: each override id additionally
+         * resolves to its compiled-formula slot in eval_values, so applies
+         * reach the propensity engine without string work
+         *
+         * @param parameter_ids parameter identifiers, in apply order
+         */
+        void bindParameterOverrides(
+            const std::vector<std::string>& parameter_ids
+        ) override;
+
+        /**
+         * @brief applies override values to libSBML and the compiled
+         * formulas, then invalidates the incremental propensity cache
+         *
+         * @param values one value per bound id, same order as the binding
+         */
+        void applyParameterOverrides(
+            const std::vector<double>& values
+        ) override;
+
+        /**
+         * @brief extends the base: patches the compartment's eval_values
+         * slot so every rate law referencing it reads the new volume on
+         * the next evaluation, and recomputes the housed species' entries
+         * in the packed volume and conversion-factor lanes in place. The
+         * nM -> per-volume factor is volume-independent and stays; the
+         * cached propensities were evaluated under the old volume, so the
+         * incremental baseline re-establishes on the next full pass
+         *
+         * @param compartment_id the compartment whose volume changed
+         * @param volume the new volume
+         */
+        void applyCompartmentVolume(
+            const std::string& compartment_id,
+            double volume
+        ) override;
+
     //---------------------------Members----------------------------------//
-        std::string algorithm_id;    
+        std::string algorithm_id;
 
 
-    private:
+    protected:
     // -------------------------Methods-----------------------------------//
-        std::vector<double> computeReactions(
-            const std::vector<double>& state
+        // Compiled-formula machinery and step kernels are protected so the
+        // exact-SSA derivative reuses them; StochasticKernelBench grants
+        // the microbenchmarks access without widening the public interface
+        friend class StochasticKernelBench;
+
+        /**
+         * @brief evaluates every compiled rate law against the given state,
+         * writing the propensities into a caller-provided span
+         *
+         * @param state species state span (molecules per volume)
+         * @param numSpecies length of the state span
+         * @param v output span receiving one propensity per reaction
+         */
+        void computeReactions(
+            const double* state,
+            size_t numSpecies,
+            double* v
         );
 
 
         /**
-        * @brief class instance to calculate a reaction formula using the muParser object
-        * 
-        * @param formula_str reaction formula to be calculated
-        * 
-        * @return v_i reaction i's left hand result
-        */
-        double computeReaction(
-            std::string formula_str
+         * @brief compiles every formula in member formulas_vector into a
+         * persistent muParser instance, one per reaction. Each parser has its
+         * variables bound to stable addresses in member component_values, so
+         * the hot path re-evaluates bytecode instead of re-parsing strings
+         *
+         * @param None operates on class members
+         *
+         * @returns None populates members compiled_formulas & component_values
+         */
+        void compileFormulas();
+
+        /**
+         * @brief rewrites the rate-law set before compilation: symbols
+         * immutable for the run fold to numeric literals, pow with a
+         * small integer exponent reduces to repeated multiplication,
+         * and parenthesized subexpressions repeated across the
+         * rewritten set hoist into the shared temporary pool, evaluated
+         * once per propensity pass instead of once per reference.
+         * Species, compartments, rule and event targets, and parameters
+         * bound by exchanges or overrides never fold
+         *
+         * @returns None populates members optimized_formulas,
+         * folded_symbols & shared_subexpressions
+         */
+        void optimizeFormulaSet();
+
+        /**
+         * @brief binds and warm-Evals one parser per optimized formula
+         * plus one per hoisted subexpression. Split out of
+         * compileFormulas so re-optimization can recompile against the
+         * same slot storage without re-running symbol resolution
+         *
+         * @returns None populates members compiled_formulas,
+         * formula_valid & the subexpression parsers
+         */
+        void compileOptimizedFormulas();
+
+        /**
+         * @brief marks the given parameter ids runtime-mutable and, if
+         * any of them was folded into a literal, re-runs the optimizer
+         * and recompiles — an exchange binding or override set arriving
+         * after construction would otherwise write a slot no compiled
+         * formula reads anymore
+         *
+         * @param ids parameter ids that just became runtime-mutable
+         */
+        void reoptimizeFormulas(
+            const std::vector<std::string>& ids
         );
 
         /**
-         * @brief Finds all species in the formula string 
-         *      NOTE: species must be initialConcentration only. 
-         *      TODO: make compatible with Species initialAmount
-         * 
-         * @param formula_str string form of the reaction formula
-         * 
-         * @returns Map of component IDs to their numerical value
+         * @brief evaluates every hoisted subexpression into its pool
+         * slot, in creation order so later temps see earlier ones; runs
+         * once at the top of a propensity pass
          */
-        std::unordered_map<std::string,double> mapComponentsToValues(
-            const std::string& formula_str
+        void refreshSharedSubexpressions();
+
+        /**
+         * @brief rewrites one rate law with every immutable resolved
+         * symbol replaced by its numeric literal, recording the folded
+         * ids so a later mutability change can trigger re-optimization
+         *
+         * @param formula original rate-law text
+         * @param mutable_names symbols that must survive as variables
+         *
+         * @returns the rewritten formula text
+         */
+        std::string foldConstants(
+            const std::string& formula,
+            const std::unordered_set<std::string>& mutable_names
         );
-        
+
         /**
-         * @brief Creates a list of strings based on formula contents
-         * 
-         * @param formula_str string type reaction formula
-         * 
-         * @returns tokens a list of components from the formula, without operators
+         * @brief compiles the model's assignment rules, rate rules and
+         * event triggers/assignments through the same muParser pipeline
+         * the rate laws use, binding every symbol to its eval_values slot
+         * (slots were reserved during resolveSymbols, so no parser address
+         * dangles). Assignment rules are topologically ordered on their
+         * variable references so dependent rules evaluate after their
+         * inputs; a reference cycle degrades those rules to document order
+         * with a warning. Event triggers arm against the initial
+         * evaluation context, so a trigger already true at load never
+         * fires spuriously on the first step
+         *
+         * @returns None populates members assignment_rules, rate_rules,
+         * compiled_events & rules_active
+         */
+        void compileRulesAndEvents();
+
+        /**
+         * @brief resolves rules and events once per co-simulation step at
+         * the step boundary, against the step's recorded end state — the
+         * leap kernels inside the interval stay rule-free, so the compiled
+         * propensity path keeps its speed. Assignment rules re-evaluate in
+         * dependency order, rate rules integrate one forward-Euler span of
+         * delta_t, and events fire on the false -> true edge of their
+         * trigger. Targets write their eval slot; species targets
+         * additionally write current_state (values in nM, the recorded
+         * unit) and the step's row is re-recorded
+         *
+         * @param step the co-simulation step that just completed
+         */
+        void applyRulesAndEvents(
+            int step
+        );
+
+        /**
+         * @brief packs the per-species constants (compartment volume and
+         * the three unit-conversion factor tables) into one cache-aligned
+         * structure-of-arrays block at a shared lane stride, so the fused
+         * conversion sweeps on the step hot path stream a single
+         * prefetch-friendly region instead of four scattered allocations
+         *
+         * @param volumes per-species compartment volumes from the handler
+         * @param lane_stride species capacity each lane is padded to; the
+         * fixed-tier kernels pass their tier capacity so full-lane sweeps
+         * multiply against zeroed tail lanes
+         *
+         * @returns None populates member species_constant_block and the
+         * lane pointers indexing it
+         */
+        void packSpeciesConstants(
+            const std::vector<double>& volumes,
+            size_t lane_stride
+        );
+
+        /**
+         * @brief classifies compiled rate laws by shape: a formula that is
+         * a pure product of resolved symbols (k*A, k*A*B, ...) joins the
+         * gather-multiply group for its factor count instead of the
+         * per-reaction muParser path. Mass-action networks collapse into a
+         * handful of groups, each evaluated as one vectorizable kernel
+         *
+         * @returns None populates members product_groups &
+         * fallback_reactions
+         */
+        void classifyFormulaShapes();
+
+        /**
+         * @brief inverts formula membership once: species index -> reactions
+         * whose rate law reads that species, stored CSR-style. The dirty
+         * pass in computeReactions walks only the rows of species that
+         * actually changed since the previous evaluation
+         *
+         * @returns None populates members reader_row_ptr & reader_reactions
+         */
+        void buildPropensityReaders();
+
+        /**
+         * @brief resolves the ahead-of-time propensity kernel emitted by
+         * createModels.py through the PropensityRegistry and wires its
+         * parameter inputs to the eval_values slots the exchange phase
+         * writes. When no matching library exists the members stay empty
+         * and every evaluation path remains interpreted
+         *
+         * @returns None populates members native_propensities,
+         * native_param_slots & native_param_values
+         */
+        void loadNativePropensities();
+
+        /**
+         * @brief resolves the kernel dispatch configuration for this model
+         * and host: a persisted tuning file beside the model snapshot is
+         * applied directly; on a miss the candidate kernels are each timed
+         * against the initial state and the winners are applied and
+         * persisted for later processes. Runs at most once per session
+         */
+        void autotuneKernels();
+
+        /**
+         * @brief installs one dispatch configuration into the members the
+         * hot-path kernels branch on
+         *
+         * @param config the loaded or freshly timed choices
+         */
+        void applyKernelConfig(
+            const KernelTuner::Config& config
+        );
+
+        /**
+         * @brief once-per-pass vectorized NaN/Inf reduction over the
+         * propensity array, the replacement for per-evaluation exception
+         * handling on the hot path. Reports through the logging facility
+         * the first time a module produces non-finite propensities
+         *
+         * @param v evaluated propensity array
+         * @param numReactions length of the propensity array
+         */
+        void scanForNonFinite(
+            const double* v,
+            size_t numReactions
+        );
+
+        /**
+         * @brief evaluates one reaction's rate law in isolation: a scalar
+         * gather-multiply when the reaction joined a product group, the
+         * compiled parser otherwise. The incremental path uses this for the
+         * scattered dirty set, where the full group kernels cannot help
+         *
+         * @param i reaction index
+         *
+         * @returns the reaction's propensity at the current eval_values
          */
-        std::vector<std::string> tokenizeFormula(
-            const std::string& formula_str
+        double evaluateSingleReaction(
+            unsigned int i
         );
 
+        /**
+         * @brief one-time symbol-resolution pass over every formula token.
+         * Each parameter || species || compartment identifier is assigned a
+         * slot in the contiguous member eval_values, classified through
+         * libSBML exactly once. Species slots are recorded by species index
+         * so per-step refresh is a straight array copy with no string work
+         *
+         * @param formula_tokens per-formula token lists from the single
+         * construction-time tokenization pass
+         *
+         * @returns None populates members eval_values, symbol_slots
+         * & species_slots
+         */
+        void resolveSymbols(
+            const std::vector<std::vector<std::string>>& formula_tokens
+        );
+        
         /** 
          * @brief Update stoichiometric values by setting as the mean for a poission distribution
          * 
          * @param mu the rate vector calculated from each reaction, per second time unit
+         * @param tau leap length the propensities are scaled by
          * 
          * @returns m_i vector of Poisson-dist informed scalar values for righthand side v of x_dot = S*v
         */
-        std::vector<double> samplePoisson(
-            std::vector<double> mu
+        void samplePoisson(
+            const double* mu,
+            size_t numReactions,
+            double tau,
+            double* m_i
+        );
+
+        /**
+         * @brief Cao-Gillespie leap-size selection: bounds every species'
+         * expected change and standard deviation over the leap to
+         * max(epsilon * x_i / g_i, 1), scanning the species-major CSR once
+         *
+         * @param propensities current per-reaction propensities
+         * @param state_molecules current state in whole molecules
+         *
+         * @returns largest leap length satisfying the bounds, floored to
+         * a small fraction of delta_t
+         */
+        double selectTau(
+            const double* propensities,
+            const double* state_molecules
+        );
+
+        /**
+         * @brief Hoermann's PTRS transformed-rejection Poisson sampler for
+         * moderate means. Cost is a couple of uniform draws per sample
+         * regardless of the mean's magnitude; valid for mean >= ~10
+         *
+         * @param mean Poisson mean (propensity times delta_t)
+         * @param uniforms the uniform pool backing the draws; partitioned
+         * stepping hands each group a pool over its own substream
+         *
+         * @returns one Poisson-distributed realization
+         */
+        double samplePoissonPTRS(
+            double mean,
+            UniformPool& uniforms
+        );
+
+        /**
+         * @brief conservation analysis over the stoichiometry: Gaussian
+         * elimination on the dense species-by-reaction matrix with an
+         * identity tracker yields the left null vectors, each a conserved
+         * moiety. One dependent species per law — the member with the
+         * heaviest CSR row, so elimination removes the most update work —
+         * leaves both CSR orientations; its value is recovered per leap
+         * by applyConservationLaws. Runs once, on the first step after
+         * setConservationElimination arms it
+         *
+         * @returns None fills conservation_laws and compacts the CSRs
+         */
+        void findConservationLaws();
+
+        /**
+         * @brief snapshots each law's conserved total from the step's
+         * starting state, in whole molecules. Called at the top of every
+         * step so boundary-phase writes (exchange, rules, events) to law
+         * members are folded into the totals they now imply
+         *
+         * @param state_molecules step-start state in whole molecules
+         */
+        void captureConservationTotals(
+            const double* state_molecules
+        );
+
+        /**
+         * @brief recovers each law's dependent species from its total
+         * and the independent members' current values, rounded to whole
+         * molecules and clamped at zero. Called after every sub-leap
+         * state update in place of the dropped stoichiometric gather;
+         * also re-pins the conserved total exactly, where accumulated
+         * rounding and clamping would otherwise let it drift
+         *
+         * @param state_molecules sub-leap end state in whole molecules
+         */
+        void applyConservationLaws(
+            double* state_molecules
+        );
+
+        /**
+         * @brief builds the reaction/species groups for partitioned
+         * stepping: union-find over the sparse stoichiometry yields the
+         * network's connected components, which are then greedy-balanced
+         * across partition_threads groups by reaction count
+         *
+         * @returns None fills members partition_reactions & partition_species
+         */
+        void buildPartitions();
+
+        /**
+         * @brief samples one group's reactions from its own RNG stream;
+         * the per-reaction strategy mirrors samplePoisson, and the cached
+         * distribution slots are per-reaction, so disjoint groups touch
+         * disjoint cache entries
+         *
+         * @param means per-reaction Poisson means, propensity times tau
+         * @param reactions the group's reaction indices
+         * @param generator the group's counter-RNG substream
+         * @param m_i receives the group's realizations
+         */
+        void samplePoissonSubset(
+            const double* means,
+            const std::vector<unsigned int>& reactions,
+            CounterRng& generator,
+            double* m_i
+        );
+
+        /**
+         * @brief constrainTau restricted to one group's reactions
+         *
+         * @param m_i sampled realizations
+         * @param xhat_tn current state in molecules
+         * @param reactions the group's reaction indices
+         * @param mhat_actual receives the constrained realizations
+         */
+        void constrainTauSubset(
+            const double* m_i,
+            const double* xhat_tn,
+            const std::vector<unsigned int>& reactions,
+            double* mhat_actual
+        );
+
+        /**
+         * @brief computeNewState restricted to one group's species; each
+         * group owns its species exclusively, so the parallel writes into
+         * the shared output buffers never conflict. The post-update policy
+         * matches computeNewState; the clamp tally is returned so the
+         * caller can fold the disjoint group counts after the join
+         *
+         * @param state_t prior state in molecules
+         * @param real_vec constrained realizations
+         * @param species the group's species indices
+         * @param new_state receives the group's updated molecule counts
+         *
+         * @returns number of species clamped to zero in this group
+         */
+        double computeNewStateSubset(
+            const double* state_t,
+            const double* real_vec,
+            const std::vector<unsigned int>& species,
+            double* new_state
         );
 
         /**
@@ -160,9 +730,10 @@ class StochasticModule : public BaseModule{
          * 
          * @returns  m_actual minimum choice between negative reactants per reaction
         */
-        std::vector<double> constrainTau(
-            std::vector<double> m_i,
-            std::vector<double> xhat_tn
+        void constrainTau(
+            const double* m_i,
+            const double* xhat_tn,
+            double* mhat_actual
         ); 
 
         /**
@@ -170,34 +741,498 @@ class StochasticModule : public BaseModule{
          *  the new rates (Schilling and Palsson, 1998)
          * 
          * @param state_t the vector of states (in molecules) of the prior timestep
-         * @param real_vec vector of propensity realizations, sampled from a poisson dist. 
+         * @param real_vec vector of propensity realizations, sampled from a poisson dist.
          * and constrained to perserve moiety
-         * 
-         * @returns new_state vector of doubles equal to X_t = X_{t-1} + delta
+         *
+         * @returns new_state vector of doubles equal to X_t = X_{t-1} + delta,
+         * in whole molecules; the nanomolar conversion happens at recording.
+         * The update ends in one branch-free policy sweep: round, clamp to
+         * zero and count the clamps, since constrainTau bounds reactions one
+         * at a time and their combined drain can still push a low-copy
+         * species negative
          */
-        std::vector<double> computeNewState(
-        std::vector<double> state_t,
-        std::vector<double> real_vec
+        void computeNewState(
+        const double* state_t,
+        size_t numSpecies,
+        const double* real_vec,
+        double* new_state
         );
 
-        //---------------------------Members----------------------------------//
-        std::vector<double> molecules2nM_conversion_factors;
-        std::vector<double> nM2mpv_conversion_factors;
- 
+        /**
+         * @brief single fused pass over the sparse structure for the
+         * serial leap: per reaction the Poisson sample, the reactant
+         * constraint and the stoichiometry scatter run back to back
+         * while the realization is still in a register, replacing the
+         * separate sample/constrain/update sweeps whose intermediate
+         * arrays each round-tripped through memory once per leap. Draw
+         * order matches samplePoisson exactly, so seeded runs replay
+         * unchanged
+         *
+         * @param propensities current per-reaction propensities
+         * @param tau leap length the propensities are scaled by
+         * @param state_t prior state in whole molecules
+         * @param numReactions reaction count
+         * @param numSpecies species count
+         * @param new_state receives the updated molecule counts
+         */
+        void fusedLeap(
+            const double* propensities,
+            double tau,
+            const double* state_t,
+            size_t numReactions,
+            size_t numSpecies,
+            double* new_state
+        );
 
-    protected:
-        // -------------------------Methods-----------------------------------//
         /**
-         * @brief Getter method for last recorded value in results matrix
-         * 
-         * @param timepoint position in results matrix being returned
-         * 
-         * @returns state_vector vector of species states recorded in results_matrix object
+         * @brief general arena-backed leap loop; the original step body,
+         * reached when the model exceeded every fixed-capacity tier
+         *
+         * @param step current step of the simulation
          */
-        std::vector<double> getLastStepResult(
-            int timestep
-        ) override;
+        void stepGeneral(
+            int step
+        );
+
+        /**
+         * @brief fixed-capacity leap loop for small models: every buffer is
+         * a stack array sized by the tier's compile-time constants and the
+         * dense conversion sweeps run full fixed-width lanes over the
+         * capacity-padded factor tables, so the whole step inlines with
+         * known trip counts and never touches the arena. Per-step perf
+         * timers are deliberately omitted; at billions of steps their cost
+         * is comparable to the kernel itself
+         *
+         * @tparam MaxSpecies tier species capacity the model fits within
+         * @tparam MaxReactions tier reaction capacity the model fits within
+         *
+         * @param step current step of the simulation
+         */
+        template <size_t MaxSpecies, size_t MaxReactions>
+        void stepFixed(
+            int step
+        ) {
+
+            // step-keyed RNG block, as in stepGeneral; pooled uniforms
+            // from the prior block are stale once the block changes
+            this->generator.setBlock(static_cast<uint64_t>(step));
+            this->uniform_pool.invalidate();
+
+            const std::vector<double>& last_state_nM =
+                this->getLastStepResult(step);  // nM
+
+            size_t numSpecies = last_state_nM.size();
+            size_t numReactions = this->reactant_entries.num_rows;
+
+            // every leap buffer lives on the stack at the tier's capacity
+            double state_nM[MaxSpecies] = {0.0};
+            double state_mpv[MaxSpecies];
+            double state_molecules[MaxSpecies];
+            double new_state[MaxSpecies];
+            double propensities[MaxReactions];
+            double realizations[MaxReactions];
+            double constrained_realizations[MaxReactions];
+
+            for (size_t s = 0; s < numSpecies; s++) {
+                state_nM[s] = last_state_nM[s];
+            }
+
+            const double* to_mpv = this->nM2mpv_conversion_factors;
+            const double* to_molecules = this->nM2molecules_conversion_factors;
+            const double* to_nM = this->molecules2nM_conversion_factors;
+
+            // full-lane conversions: padded factor lanes are zero, so the
+            // extra lanes compute zeros instead of branching
+            for (size_t s = 0; s < MaxSpecies; s++) {
+                state_mpv[s] = state_nM[s] * to_mpv[s];
+                state_molecules[s] = state_nM[s] * to_molecules[s];
+            }
+
+            // refit each law's total to the post-boundary state
+            if (!this->conservation_laws.empty()) {
+                this->captureConservationTotals(state_molecules);
+            }
+
+            double t_local = 0.0;
+
+            while (true) {
+
+                this->computeReactions(state_mpv, numSpecies, propensities);
+
+                double tau = this->delta_t - t_local;
+
+                if (this->fixed_leap_dt > 0.0) {
+                    tau = std::min(tau, this->fixed_leap_dt);
+                }
+
+                if (this->adaptive_tau_epsilon > 0.0) {
+                    tau = std::min(
+                        tau, this->selectTau(propensities, state_molecules)
+                    );
+                }
+
+                this->samplePoisson(
+                    propensities, numReactions, tau, realizations
+                );
+
+                this->constrainTau(
+                    realizations, state_molecules, constrained_realizations
+                );
+
+                // sparse delta gather stays scalar; CSR indices never
+                // reach the padded lanes
+                for (size_t s = 0; s < numSpecies; s++) {
+
+                    double delta = 0.0;
+
+                    for (size_t n = this->stoich_rows.row_ptr[s];
+                         n < this->stoich_rows.row_ptr[s + 1]; n++) {
+                        delta += this->stoich_rows.values[n] *
+                            constrained_realizations[
+                                this->stoich_rows.col_idx[n]];
+                    }
+
+                    new_state[s] = delta;
+                }
+
+                for (size_t s = numSpecies; s < MaxSpecies; s++) {
+                    new_state[s] = 0.0;
+                }
+
+                // branch-free policy sweep over full fixed-width lanes:
+                // round, clamp to zero, count the clamps; padded lanes
+                // hold zeros and never trip the tally
+                double clamped = 0.0;
+
+                for (size_t s = 0; s < MaxSpecies; s++) {
+
+                    double rounded = std::round(
+                        state_molecules[s] + new_state[s]
+                    );
 
+                    clamped += (rounded < 0.0) ? 1.0 : 0.0;
+                    new_state[s] = (rounded > 0.0) ? rounded : 0.0;
+                }
+
+                this->negative_clamp_events +=
+                    static_cast<uint64_t>(clamped);
+
+                // dependent species left the CSR; recover them from
+                // their laws before anything reads the new state
+                if (!this->conservation_laws.empty()) {
+                    this->applyConservationLaws(new_state);
+                }
+
+                t_local += tau;
+
+                if (t_local >= this->delta_t * (1.0 - 1e-12)) {
+                    break;
+                }
+
+                for (size_t s = 0; s < MaxSpecies; s++) {
+                    state_molecules[s] = new_state[s];
+                }
+
+                // feed the sub-leap's end state back in per-volume units
+                for (size_t s = 0; s < numSpecies; s++) {
+
+                    double volume = this->species_volume_factors[s];
+
+                    state_mpv[s] = volume > 0.0
+                        ? new_state[s] / volume
+                        : new_state[s];
+                }
+            }
+
+            // partners read the exchange slots after the step returns, so
+            // nothing publishes into libSBML here; the molecules -> nM
+            // conversion fuses into the recording copy
+            BaseModule::recordStepResultScaled(
+                new_state, to_nM, numSpecies, step
+            );
+        }
+
+        //---------------------------Members----------------------------------//
+        // Per-species constant block: volume, nM -> per-volume,
+        // fused nM -> whole-molecule and molecules -> nM factor lanes
+        // sit back to back at one cache-line-rounded stride inside a
+        // single allocation; the pointers below index its lanes
+        std::vector<double> species_constant_block;
+        const double* species_volume_factors = nullptr;
+        const double* nM2mpv_conversion_factors = nullptr;
+        const double* nM2molecules_conversion_factors = nullptr;
+        const double* molecules2nM_conversion_factors = nullptr;
+
+        // Writable view of the block for incremental volume updates:
+        // aligned base of the first lane and the shared lane stride
+        double* species_lane_base = nullptr;
+        size_t species_lane_stride = 0;
+
+        // compartment id -> indices of the species it houses, built once
+        // at construction so a volume change touches only its own lanes
+        std::unordered_map<std::string, std::vector<unsigned int>>
+            compartment_species;
+
+        // One compiled rule: its parser over eval_values, the target's
+        // slot, and the target's species index (-1 for parameter or
+        // compartment targets, which live in slots only)
+        struct CompiledRule {
+            mu::Parser parser;
+            size_t target_slot = 0;
+            int target_species = -1;
+        };
+
+        // Assignment rules in dependency order, then rate rules in
+        // document order; both empty for rule-free models
+        std::vector<CompiledRule> assignment_rules;
+        std::vector<CompiledRule> rate_rules;
+
+        // One compiled event: trigger parser, per-assignment parsers and
+        // their resolved targets, and the trigger's last observed truth
+        // for edge detection
+        struct CompiledEvent {
+            mu::Parser trigger;
+            std::vector<mu::Parser> assignments;
+            std::vector<size_t> target_slots;
+            std::vector<int> target_species;
+            unsigned char trigger_was_true = 0;
+        };
+
+        std::vector<CompiledEvent> compiled_events;
+
+        // set once in compileRulesAndEvents; the step dispatch skips the
+        // boundary pass entirely when nothing compiled
+        bool rules_active = false;
+
+        // step-boundary clock the SBML time csymbol binds to
+        double rule_clock = 0.0;
+
+        // construction scaffolding: specs are pulled before formula
+        // compilation so resolveSymbols can reserve their slots, then
+        // consumed and cleared by compileRulesAndEvents
+        std::vector<SBMLHandler::RuleSpec> rule_specs;
+        std::vector<SBMLHandler::EventSpec> event_specs;
+
+        // One pre-compiled parser per reaction, built once at construction
+        std::vector<mu::Parser> compiled_formulas;
+
+        // Ahead-of-time propensity kernel from libpropensity_<id>.so;
+        // nullptr keeps the interpreted paths. Parameter inputs gather
+        // from eval_values through native_param_slots (-1 marks
+        // parameters no formula references, whose document value stays)
+        PropensityRegistry::PropensityFn native_propensities = nullptr;
+        std::vector<int> native_param_slots;
+        std::vector<double> native_param_values;
+
+        // Per-reaction validation verdict from the build-time warm Eval;
+        // invalid formulas evaluate to NaN without entering the parser,
+        // so the runtime evaluation paths carry no exception frames
+        std::vector<unsigned char> formula_valid;
+
+        // One-shot flag so a persistent NaN/Inf propensity does not spam
+        // the log on every step
+        bool nonfinite_reported = false;
+
+        // Contiguous storage every compiled parser's variables point into
+        std::vector<double> eval_values;
+
+        // Resolved identifier -> index into eval_values, built once
+        std::unordered_map<std::string, size_t> symbol_slots;
+
+        // Optimizer output: the rewritten rate-law text each parser was
+        // compiled from, the symbols folded into it as literals, and
+        // the names that may change at run time and therefore must
+        // never fold. The mutable set only grows — exchange bindings
+        // and override sets add to it after construction
+        std::vector<std::string> optimized_formulas;
+        std::unordered_set<std::string> folded_symbols;
+        std::unordered_set<std::string> runtime_mutable_symbols;
+
+        // One hoisted common subexpression: its source text, the pool
+        // slot its value lands in, and the parser that refreshes it
+        // once per propensity pass. valid mirrors formula_valid — a
+        // temp that failed its warm Eval pins NaN instead of throwing
+        struct SharedSubexpression {
+            std::string name;
+            std::string expression;
+            size_t slot = 0;
+            mu::Parser parser;
+            unsigned char valid = 0;
+        };
+
+        std::vector<SharedSubexpression> shared_subexpressions;
+
+        // Fixed-capacity temporary pool appended to eval_values once,
+        // before any parser binds an address; re-optimization reuses
+        // the same slots, so the storage never moves after compilation
+        size_t cse_pool_base = 0;
+        static constexpr size_t cse_pool_capacity = 32;
+
+        // species index -> slot in eval_values (-1 if species is unused)
+        std::vector<int> species_slots;
+
+        // One group per rate-law shape: reactions whose formula is a pure
+        // product of num_factors symbols, with factor slots flattened
+        // [member * num_factors + f] for the gather-multiply kernel
+        struct ProductGroup {
+            size_t num_factors;
+            std::vector<unsigned int> reactions;
+            std::vector<unsigned int> factor_slots;
+        };
+
+        std::vector<ProductGroup> product_groups;
+
+        // Reactions whose shape did not qualify; evaluated via muParser
+        std::vector<unsigned int> fallback_reactions;
+
+        // Per-reaction span into reaction_factor_slots_flat for scalar
+        // product evaluation; offset -1 marks muParser-only reactions
+        std::vector<int> reaction_factor_offset;
+        std::vector<unsigned int> reaction_factor_count;
+        std::vector<unsigned int> reaction_factor_slots_flat;
+
+        // CSR species -> reactions whose rate law reads that species
+        std::vector<size_t> reader_row_ptr;
+        std::vector<unsigned int> reader_reactions;
+
+        // Reactions removed by observable pruning; their propensities
+        // are pinned to zero after every evaluation pass
+        std::vector<unsigned int> pruned_reactions;
+
+        // Entity profiling accumulators, sized on the first profiled
+        // pass: seconds spent evaluating each rate law, and realized
+        // firings per reaction
+        std::vector<double> reaction_eval_seconds;
+        std::vector<double> reaction_firings;
+
+        // Post-update policy audit: species-steps where the rounded update
+        // landed negative despite constrainTau and was clamped to zero.
+        // The tally rides the branch-free update sweep, so it costs
+        // nothing to keep and is reported with the entity profile
+        uint64_t negative_clamp_events = 0;
+
+        // Incremental propensity state: cached propensities, the state
+        // they were evaluated at, and per-reaction dirty scratch flags.
+        // Exchange updates invalidate the whole cache
+        std::vector<double> propensity_cache;
+        std::vector<double> propensity_state_cache;
+        std::vector<unsigned char> dirty_reactions;
+        bool propensity_cache_valid = false;
+
+        // CSR stoichiometry, species-major: rows are species
+        SparseMatrix stoich_rows;
+
+        // CSR stoichiometry transpose, reaction-major: rows are reactions
+        SparseMatrix stoich_cols;
+
+        // Reaction-major CSR of reactant entries only: per reaction the
+        // consumed species and |coefficient|, precomputed so the tau
+        // constraint scans nothing but candidate rate limiters
+        SparseMatrix reactant_entries;
+
+        // Counter-based RNG keyed (seed, step, draw): each step blocks its
+        // own substream, so any (seed, cell, step) draw sequence replays
+        // in isolation regardless of earlier steps' draw counts
+        CounterRng generator;
+
+        // Lazily refilled block of bulk-generated uniforms over the
+        // member stream; invalidated wherever the generator is
+        // re-seeded, re-blocked or restored
+        UniformPool uniform_pool{generator};
+
+        // Per exchange pair: eval_values address of the exchanged
+        // parameter, nullptr when no compiled formula references it
+        std::vector<double*> exchange_value_slots;
+
+        // Per bound override id: eval_values address, nullptr when no
+        // compiled formula references the parameter
+        std::vector<double*> override_value_slots;
+
+        // Reaction count above which computeReactions goes parallel
+        size_t parallel_propensity_threshold = 512;
+
+        // Kernel autotuning: requested via setKernelAutotune, resolved at
+        // most once per session on the first configured run
+        bool autotune_kernels = false;
+        bool kernels_tuned = false;
+
+        // Tuned dispatch choices; the defaults match the untuned
+        // heuristics, so behaviour without tuning is unchanged
+        bool use_incremental_propensities = true;
+        bool scatter_state_update = false;
+
+        // one conserved moiety: dependent = (total - sum of coefficient
+        // times member) / dependent_coefficient, all in whole molecules
+        struct ConservationLaw {
+            size_t dependent_species = 0;
+            double dependent_coefficient = 1.0;
+            std::vector<std::pair<size_t, double>> terms;
+            double total = 0.0;
+        };
+
+        // Conservation-law elimination: requested via the setter,
+        // analyzed at most once on the first armed step
+        bool conservation_elimination = false;
+        bool conservation_analyzed = false;
+        std::vector<ConservationLaw> conservation_laws;
+
+        // Cao-Gillespie relative change bound; 0 keeps fixed-length leaps
+        double adaptive_tau_epsilon = 0.0;
+
+        // Fixed sub-leap length in seconds; 0 leaps the full interval
+        double fixed_leap_dt = 0.0;
+
+        // set after the first propensity pass (which may build muParser
+        // bytecode); debug builds assert the heap stays untouched after
+        bool eval_warmed = false;
+
+        // Runtime fast/slow partition: nonzero entries mark reactions
+        // currently advanced by expectation instead of sampled
+        std::vector<unsigned char> reaction_is_fast;
+        double fast_mean_threshold = 0.0;
+        int repartition_interval = 16;
+        uint64_t leaps_since_repartition = 0;
+
+        // Model-partitioned stepping: connected-component reaction and
+        // species groups, balanced across partition_threads cores; empty
+        // or single-group partitions mean the serial path runs
+        int partition_threads = 1;
+        std::vector<std::vector<unsigned int>> partition_reactions;
+        std::vector<std::vector<unsigned int>> partition_species;
+
+        // Per-species g_i: highest reactant order among touching reactions
+        std::vector<double> tau_g_values;
+
+        // Monotonic arena: every per-step temporary lives here and the
+        // whole allocation is rewound with one reset at the top of step
+        StepArena step_arena;
+
+        // Per-reaction cached small-mean distributions; re-parameterized
+        // only when a reaction's mean actually changes between steps
+        std::vector<std::poisson_distribution<int>> poisson_dists;
+        std::vector<double> cached_dist_means;
+
+        // Shared draws for the normal-approximation branch; uniforms
+        // come from the pool instead
+        std::normal_distribution<double> standard_normal{0.0, 1.0};
+
+        // Fixed-capacity kernel tier selected at construction, -1 when the
+        // model exceeded every tier and steps take the general path.
+        // Tier t caps species at 8 << t and reactions at 16 << t
+        int fixed_tier = -1;
+
+        // Sampling strategy cutoffs: below ptrs_mean_cutoff the cached
+        // std::poisson_distribution wins; above normal_approx_mean_cutoff
+        // the normal approximation is statistically indistinguishable.
+        // The PTRS cutoff is an instance member so autotuning can move
+        // the crossover to wherever this host actually puts it
+        double ptrs_mean_cutoff = 10.0;
+        static constexpr double normal_approx_mean_cutoff = 1000.0;
+
+
+
+    protected:
+        // -------------------------Methods-----------------------------------//
         void loadTargetModule(
         const std::vector<std::unique_ptr<BaseModule>>& module_list
         ) override;
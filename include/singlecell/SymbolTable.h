@@ -0,0 +1,81 @@
+/**
+ * @file: SymbolTable.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Process-wide string interning for model entity identifiers
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef SYMBOLTABLE_h
+#define SYMBOLTABLE_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief one process-wide table mapping entity identifiers to stable
+ * 32-bit symbols. Species, parameter and reaction IDs are interned once
+ * at model load; hot structures then carry the handles, so comparisons
+ * are integer equality and a population of cells shares one copy of
+ * every ID string instead of duplicating them per cell
+ */
+class SymbolTable {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief returns the symbol for an identifier, assigning the next
+         * free one on first sight. Thread-safe; symbols are stable for
+         * the process lifetime
+         *
+         * @param id identifier text to intern
+         *
+         * @returns 32-bit symbol handle for the identifier
+         */
+        static uint32_t intern(
+            const std::string& id
+        );
+
+        /**
+         * @brief interns a list of identifiers in order
+         *
+         * @param ids identifier texts to intern
+         *
+         * @returns symbol handles aligned with the input order
+         */
+        static std::vector<uint32_t> internAll(
+            const std::vector<std::string>& ids
+        );
+
+        /**
+         * @brief getter for the identifier text behind a symbol; the
+         * reference stays valid for the process lifetime
+         *
+         * @param symbol handle previously returned by intern
+         *
+         * @returns the interned identifier text
+         */
+        static const std::string& text(
+            uint32_t symbol
+        );
+
+    private:
+    //-------------------------------members--------------------------------//
+        // deque keeps every interned string at a stable address, so
+        // text() can hand out references without copying
+        static std::mutex table_mutex;
+        static std::deque<std::string> symbols;
+        static std::unordered_map<std::string, uint32_t> index;
+
+};
+
+#endif // SYMBOLTABLE_h
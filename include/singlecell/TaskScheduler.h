@@ -0,0 +1,184 @@
+/**
+ * @file: TaskScheduler.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Process-wide work-stealing task scheduler for all parallel modes
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef TASKSCHEDULER_h
+#define TASKSCHEDULER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief one process-wide pool of worker threads with per-worker task
+ * deques and work stealing. Every parallel feature — concurrent module
+ * stepping, population cells, propensity partitions, batch conditions —
+ * submits here instead of spawning its own pool, so nested parallelism
+ * composes into one fixed set of threads instead of oversubscribing the
+ * node. Tasks are placed by index onto a stable home queue (the
+ * affinity hint: cell i lands on worker i mod T every run), workers pop
+ * their own queue LIFO for cache warmth and steal FIFO from others when
+ * idle, and a caller inside parallelFor helps execute tasks rather than
+ * blocking, which is what makes nested submission deadlock-free
+ */
+class TaskScheduler {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief the process-wide scheduler instance; workers spawn
+         * lazily on first parallel use
+         */
+        static TaskScheduler& instance();
+
+        /**
+         * @brief fixes the worker thread count, replacing any idle pool.
+         * Call once at startup (the CLI forwards --threads); calling
+         * while tasks are in flight is unsupported
+         *
+         * @param num_threads worker count; <= 0 uses hardware concurrency
+         */
+        void configure(
+            int num_threads
+        );
+
+        /**
+         * @brief getter for the worker count the pool runs (or will run
+         * once started)
+         *
+         * @returns configured worker thread count
+         */
+        int threadCount();
+
+        /**
+         * @brief index of the pool worker executing the current thread
+         *
+         * @returns worker index in [0, threadCount), or -1 off-pool
+         */
+        static int workerIndex();
+
+        /**
+         * @brief runs body(0..num_tasks) across the pool and returns when
+         * every task has finished. Task i's home queue is worker i mod T,
+         * so repeated calls with the same index space keep their state on
+         * the same worker; stealing rebalances stragglers. The calling
+         * thread executes tasks too, so nested calls from inside a task
+         * compose instead of deadlocking
+         *
+         * @param num_tasks number of task indices to run
+         * @param body callable invoked once per index, concurrently
+         */
+        void parallelFor(
+            int num_tasks,
+            const std::function<void(int)>& body
+        );
+
+        /**
+         * @brief parallelFor with a per-task cost estimate steering the
+         * home-queue placement: tasks are assigned longest-first to the
+         * least-loaded worker, so heterogeneous task classes — a heavy
+         * CVODES module next to cheap tau-leap kernels, large-model
+         * cells next to small — spread across the silicon instead of
+         * stacking one worker while others idle. Costs come from the
+         * caller's own measurements (a running average of prior runs);
+         * stealing still corrects whatever the estimates get wrong. A
+         * cost vector that does not match num_tasks falls back to the
+         * modulo placement
+         *
+         * @param num_tasks number of task indices to run
+         * @param costs estimated relative cost per task index
+         * @param body callable invoked once per index, concurrently
+         */
+        void parallelForWeighted(
+            int num_tasks,
+            const std::vector<double>& costs,
+            const std::function<void(int)>& body
+        );
+
+        ~TaskScheduler(); //Dtor
+
+
+    private:
+    //---------------------------methods------------------------------------//
+        TaskScheduler() = default; //Ctor through instance()
+
+        /**
+         * @brief spawns the worker threads on first use, pinned
+         * round-robin across NUMA nodes when more than one exists so
+         * first-touch lands each worker's data node-locally
+         */
+        void ensureStarted();
+
+        /**
+         * @brief joins and discards the current workers; queues must be
+         * empty and the caller holds lifecycle_lock (except the dtor,
+         * which runs after all users are gone)
+         */
+        void shutdown();
+
+        /**
+         * @brief takes one task, preferring the caller's own queue back
+         * (LIFO) and falling back to stealing the front (FIFO) of the
+         * other queues
+         *
+         * @param self this thread's worker index, or -1 for a helper
+         * @param task receives the claimed task
+         *
+         * @returns true when a task was claimed
+         */
+        bool claimTask(
+            int self,
+            std::function<void()>& task
+        );
+
+        /**
+         * @brief main loop of one pool worker: run tasks while any are
+         * pending, sleep otherwise
+         *
+         * @param index this worker's index
+         */
+        void workerLoop(
+            int index
+        );
+
+    //------------------------------members---------------------------------//
+        // one deque + lock per worker; the owner pops the back, thieves
+        // take the front, so contention only appears when stealing
+        struct WorkerQueue {
+            std::deque<std::function<void()>> tasks;
+            std::mutex lock;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> workers;
+
+        // requested width; 0 resolves to hardware concurrency at spawn
+        int configured_threads = 0;
+
+        // pending task count drives the workers' sleep/wake cycle
+        std::atomic<int> pending{0};
+        std::mutex wake_lock;
+        std::condition_variable wake;
+
+        std::atomic<bool> stopping{false};
+
+        // guards pool startup, reconfiguration and teardown so two
+        // sessions racing into their first parallelFor spawn one pool
+        std::mutex lifecycle_lock;
+
+};
+
+#endif // TASKSCHEDULER_h
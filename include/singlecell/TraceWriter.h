@@ -0,0 +1,168 @@
+/**
+ * @file: TraceWriter.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Chrome-trace span collection across stepping, I/O and bindings
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef TRACEWRITER_h
+#define TRACEWRITER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief process-wide collector of flame-style span events, written as
+ * one Chrome trace / Perfetto JSON file per run. Every span records
+ * name, category, start and duration against its thread, so the trace
+ * viewer nests the C++ stepping phases, the I/O threads and the Python
+ * orchestration spans (emitted through the bindings on the same clock)
+ * into a single timeline. Disabled, a span costs one relaxed atomic
+ * load; enabled, events append to per-thread buffers with no locking,
+ * so tracing a six-hour study perturbs it marginally
+ */
+class TraceWriter {
+    public:
+    //---------------------------methods------------------------------------//
+        /**
+         * @brief RAII span: measures from construction to destruction
+         * and emits one complete event on the calling thread. Name and
+         * category must outlive the span (string literals or phase
+         * names owned elsewhere)
+         */
+        class Span {
+            public:
+                Span(
+                    const char* name,
+                    const char* category
+                ) : name(name), category(category),
+                    armed(TraceWriter::instance().enabled()) {
+
+                    if (armed) {
+                        start_us = TraceWriter::nowMicros();
+                    }
+                }
+
+                ~Span() {
+                    if (armed) {
+                        TraceWriter::instance().emit(
+                            name, category, start_us,
+                            TraceWriter::nowMicros() - start_us
+                        );
+                    }
+                }
+
+            private:
+                const char* name;
+                const char* category;
+                bool armed;
+                uint64_t start_us = 0;
+        };
+
+        /**
+         * @brief process-wide writer instance; constructed on first use
+         *
+         * @returns reference to the singleton writer
+         */
+        static TraceWriter& instance();
+
+        /**
+         * @brief arms collection and fixes the trace's time origin; a
+         * second call while armed replaces the output path only
+         *
+         * @param path destination JSON file, written by endTrace
+         */
+        void beginTrace(
+            const std::string& path
+        );
+
+        /**
+         * @brief disarms collection, drains every thread's buffer and
+         * writes the Chrome trace JSON. Events arriving after the
+         * disarm are dropped; failures log and discard, a trace is
+         * only a diagnostic
+         */
+        void endTrace();
+
+        /**
+         * @brief whether collection is armed, for the span fast path
+         *
+         * @returns true while a trace is being collected
+         */
+        bool enabled() const {
+            return this->armed.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief appends one complete event to the calling thread's
+         * buffer; no-op while disarmed
+         *
+         * @param name span label shown in the viewer
+         * @param category grouping tag ("step", "io", "python", ...)
+         * @param ts_us span start in microseconds, from nowMicros
+         * @param dur_us span duration in microseconds
+         */
+        void emit(
+            const char* name,
+            const char* category,
+            uint64_t ts_us,
+            uint64_t dur_us
+        );
+
+        /**
+         * @brief labels the calling thread in the trace's metadata, so
+         * the viewer shows "recorder" or "results_writer" instead of a
+         * bare thread id
+         *
+         * @param name thread label, copied
+         */
+        void nameThread(
+            const std::string& name
+        );
+
+        /**
+         * @brief interns a transient span label for the process
+         * lifetime: events hold bare pointers, which is free for the
+         * C++ literals but unsafe for names arriving from Python
+         * through the bindings — those pass through here first
+         *
+         * @param name transient span label
+         *
+         * @returns stable pointer to an interned copy
+         */
+        static const char* internName(
+            const std::string& name
+        );
+
+        /**
+         * @brief microseconds on the shared steady clock all layers
+         * stamp spans with; exposed through the bindings so Python
+         * spans land on the same timeline as the C++ phases
+         *
+         * @returns microseconds since an arbitrary process-stable origin
+         */
+        static uint64_t nowMicros();
+
+    private:
+    //---------------------------methods------------------------------------//
+        TraceWriter() = default;
+
+    //------------------------------members---------------------------------//
+        // per-thread event buffers register themselves in translation-
+        // unit state on first use; endTrace drains them under its lock
+        std::atomic<bool> armed{false};
+
+        std::string output_path;
+
+};
+
+#endif // TRACEWRITER_H
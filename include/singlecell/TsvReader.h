@@ -0,0 +1,65 @@
+/**
+ * @file: TsvReader.h
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Memory-mapped chunk-parallel columnar TSV reader
+ */
+//========================header file definition============================//
+#pragma once
+
+#ifndef TSVREADER_h
+#define TSVREADER_h
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+
+//==========================Class Declaration===============================//
+/**
+ * @brief reads one delimited text table into columnar storage. The file
+ * is memory-mapped and parsed in chunks split on newline boundaries
+ * across the process scheduler pool, with numeric cells decoded by
+ * std::from_chars, so multi-GB measurement files ingest at storage
+ * bandwidth instead of a scalar single-thread parse rate. Comment
+ * lines ('#') and blank lines are skipped, matching the python loader
+ */
+class TsvReader {
+    public:
+
+        // One parsed table in columnar form. Types are sniffed from the
+        // first data row: a cell that parses fully as a double makes
+        // its column numeric (later unparseable cells land as NaN), any
+        // other cell keeps its column as strings. Exactly one of the
+        // two storage vectors is populated per column
+        struct Table {
+            std::vector<std::string> column_names;
+            std::vector<unsigned char> is_numeric;
+            std::vector<std::vector<double>> numeric_columns;
+            std::vector<std::vector<std::string>> text_columns;
+            size_t num_rows = 0;
+        };
+
+        /**
+         * @brief maps and parses one delimited file. A counting pass
+         * sizes every column exactly, then the parse pass writes each
+         * chunk's rows into its precomputed row range, so the chunks
+         * share no mutable state and need no locks
+         *
+         * @param path filesystem path of the file to read
+         * @param delimiter cell separator, tab by default
+         *
+         * @returns the parsed table
+         *
+         * @throws std::runtime_error when the file cannot be opened or
+         * mapped
+         */
+        static Table read(
+            const std::string& path,
+            char delimiter = '\t'
+        );
+};
+
+#endif // TSVREADER_h
@@ -37,6 +37,46 @@ namespace matrix_utils {
         std::vector<std::string> col_labels = {}
         );
 
+    /**
+     * @brief saves a matrix in the packed binary trajectory format: a
+     * "SCTRJ001" magic tag, row/column counts, newline-joined labels, then
+     * the raw row-major doubles. Roughly 10x smaller and faster than the
+     * TSV path, and memory-mappable from Python
+     *
+     * @param results_matrix the matrix to be saved
+     * @param output path string to where the trajectory should be saved
+     * @param row_labels per-row (timestep) labels, optional
+     * @param col_labels per-column (species) labels, optional
+     *
+     * @returns None
+     */
+    void save_matrix_binary(
+        std::vector<std::vector<double>> results_matrix,
+        std::string output,
+        std::vector<std::string> row_labels = {},
+        std::vector<std::string> col_labels = {}
+        );
+
+    /**
+     * @brief saves a matrix as a standard Apache Parquet file with species
+     * as required DOUBLE columns plus a leading "time" column parsed from
+     * the row labels. Loads directly into pandas/pyarrow/warehouse tooling
+     * with no TSV round-trip
+     *
+     * @param results_matrix the matrix to be saved
+     * @param output path string to where the file should be saved
+     * @param row_labels per-row (timestep) labels, optional
+     * @param col_labels per-column (species) labels, optional
+     *
+     * @returns None
+     */
+    void save_matrix_parquet(
+        std::vector<std::vector<double>> results_matrix,
+        std::string output,
+        std::vector<std::string> row_labels = {},
+        std::vector<std::string> col_labels = {}
+        );
+
     /**
      * @brief Extracts a column based on index from a matrix of nested vectors
      * 
@@ -46,9 +86,29 @@ namespace matrix_utils {
      * @returns matrix-column @ colIndex
      */
     std::vector<double> getColumn(
-        const std::vector<std::vector<double>>& matrix, 
+        const std::vector<std::vector<double>>& matrix,
         size_t colIndex
     );
+
+    /**
+     * @brief cache-blocked out-of-place transpose of a flat row-major
+     * matrix. Both source and destination are walked one block at a time
+     * so every cache line fetched is fully consumed, keeping the
+     * conversion at memory bandwidth where a naive transpose of a
+     * 1e6-row matrix would miss on every destination write
+     *
+     * @param src flat row-major source, rows x cols
+     * @param rows source row count
+     * @param cols source column count
+     * @param dst receives the flat transpose, cols x rows; must not
+     * alias src
+     */
+    void transpose_blocked(
+        const double* src,
+        size_t rows,
+        size_t cols,
+        double* dst
+    );
 }
 
 namespace unit_conversions {
@@ -62,7 +122,7 @@ namespace unit_conversions {
      * from unit  units nanomolar to molecules per cell
      */
     std::vector<double> nanomolar2mpv(
-        std::vector<double> cell_volumes
+        const std::vector<double>& cell_volumes
     );
 
     /**
@@ -75,7 +135,7 @@ namespace unit_conversions {
      * from unit molecules per cell to units nanomolar
      */
     std::vector<double> molecules2nanomolar(
-        std::vector<double> cell_volumes
+        const std::vector<double>& cell_volumes
     );
 
     /**
@@ -87,8 +147,24 @@ namespace unit_conversions {
      * @returns converted_vals element-wise multiplied values per item in prior_values
      */
     std::vector<double> convert(
-        std::vector<double> prior_values,
-        std::vector<double> conversion_factors
+        const std::vector<double>& prior_values,
+        const std::vector<double>& conversion_factors
+    );
+
+    /**
+     * @brief allocation-free convert overload writing into a caller-provided
+     * span, for hot paths whose temporaries live in a step arena
+     *
+     * @param prior_values pointer to values before conversion
+     * @param conversion_factors pointer to factors, same length
+     * @param converted_vals output span receiving the products
+     * @param count number of elements to convert
+     */
+    void convert(
+        const double* prior_values,
+        const double* conversion_factors,
+        double* converted_vals,
+        size_t count
     );
 }
 
@@ -17,8 +17,9 @@ from datetime import date
 import multiprocessing as mp
 
 sys.path.append("../")
-from Worker import Worker
+from Worker import WorkerPool
 from Manager import Manager
+from shared_utils import tracing
 from Organizer import Organizer
 import ObservableCalculator as obs
 from shared_utils.file_loader import FileLoader
@@ -99,28 +100,32 @@ class Experiment:
             self.cell_count
         )
 
-        for round_i in range(num_rounds):
-
-            # Get list of tasks for current round:
-            tasks = self.org.task_assignment(
-                rank_jobs_directory=job_directory,
-                round_i=round_i
-            )
-
-            worker_args = [
-                (
-                    task, 
-                    self.sbml_list, 
-                    self.manager
-                ) 
-                for task in tasks]
-
-            # split workload across processes:
-            with mp.Pool(processes=os.cpu_count()) as pool:
-                pool.starmap(Worker, worker_args)
-                        
+        # fork the workers once, after models are constructible in the
+        # parent; they stay warm across every round
+        pool = WorkerPool(
+            self.sbml_list,
+            self.manager,
+            processes=os.cpu_count()
+        )
+
+        try:
+            for round_i in range(num_rounds):
+
+                # Get list of tasks for current round:
+                tasks = self.org.task_assignment(
+                    rank_jobs_directory=job_directory,
+                    round_i=round_i
+                )
+
+                with tracing.span(f"round:{round_i}", "orchestration"):
+                    pool.run_round(tasks)
+
+        finally:
+            pool.shutdown()
+
         # Have root store final results of all sims and cleanup cache
-        self.__store_final_results()
+        with tracing.span("store_final_results", "orchestration"):
+            self.__store_final_results()
 
     def __sbml_getter(self) -> list:
         """Retrieves all sbml files defined in PEtab configuration file"""
@@ -136,17 +141,21 @@ class Experiment:
     def __store_final_results(self) -> None:
         """Stores all simulation results stored in cache into Rank 0 self.results_dict object"""
 
-        for key in self.manager.results_dict.keys(): 
-            
+        for key in self.manager.results_dict.keys():
+
             condition_id = self.manager.results_dict[key]['conditionId']
             cell = self.manager.results_dict[key]['cell']
 
-            df = self.manager.results_lookup(condition_id, cell)
+            view = self.manager.results_lookup(condition_id, cell)
+
+            # per-species entries are zero-copy column views over the
+            # cache's memory map; nothing materializes until export
+            for column in view.columns:
+
+                self.manager.results_dict[key][column] = view.column(column)
 
-            for column in df.columns:
+            self.manager.results_dict[key]['time'] = view.time
 
-                self.manager.results_dict[key][column] = df[column]
-                
         return # saves results to results_dict class member
 
     def save_results(self, args) -> None:
@@ -12,8 +12,6 @@ Output:
 """
 import sys
 
-import pandas as pd
-
 sys.path.append('../')
 import shared_utils.utils as utils
 from ResultsCacher import ResultCache
@@ -63,12 +61,13 @@ class Manager:
         return results
     
     def results_lookup(
-            self, 
-            condition_id: str, 
+            self,
+            condition_id: str,
             cell: int
-            ) -> pd.DataFrame:
-        """Indexes results dictionary on condition id, returns results"""
-        # results keys should all be species names paired with single numpy arrays. 
+            ):
+        """Indexes results dictionary on condition id, returns the cached
+        result: a zero-copy ResultView for schema'd records, a DataFrame
+        for legacy pickled ones"""
         for key in self.results_dict.keys():
             if self.results_dict[key]['conditionId'] == condition_id\
                 and self.results_dict[key]['cell'] == cell:
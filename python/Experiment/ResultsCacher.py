@@ -1,39 +1,252 @@
 
 import os
+import mmap
 import pickle
 import shutil
 
+import numpy as np
 import pandas as pd
 
 
+# raw-record tag: schema header then the C-order float64 buffer, so loads
+# can hand back memory-mapped views instead of unpickling a DataFrame
+RECORD_MAGIC = b"SCNPY001"
+
+
+class ResultView:
+    """Schema'd view over one cached result record.
+
+    The matrix is a NumPy array backed by the store's memory map (or the
+    writer's still-pending buffer), so column access and aggregation are
+    zero-copy; a DataFrame is only materialized by to_dataframe() at
+    final export.
+    """
+
+    def __init__(self, array: np.ndarray, columns: list, time=None):
+        self.array = array
+        self.columns = list(columns)
+        self.time = time
+
+        self._index = {name: j for j, name in enumerate(self.columns)}
+
+    def column(self, name: str) -> np.ndarray:
+        """1-D zero-copy view of one species trajectory"""
+        return self.array[:, self._index[name]]
+
+    def to_dataframe(self) -> pd.DataFrame:
+        """Materializes the view into a labeled DataFrame; export only"""
+        df = pd.DataFrame(np.asarray(self.array), columns=self.columns)
+
+        if self.time is not None:
+            df['time'] = self.time
+
+        return df
+
+
 class ResultCache:
+    """Consolidated condition-result cache.
+
+    Results are appended to one binary store per writing process plus a
+    shared index file mapping condition key -> (store, offset, length),
+    instead of one pickle file per condition. Saves are batched in memory
+    and appended in a single write; loads go through a memory map so only
+    the requested record is paged in.
+
+    Matrices saved with a schema (values + columns) are stored raw: a
+    pickled header followed by the C-order buffer. Loading one returns a
+    ResultView whose array is a view of the persistent memory map -- no
+    unpickle, no DataFrame, no copy. DataFrame saves keep the legacy
+    pickle path, and legacy records still load.
+    """
+
+    # Pending saves are flushed once this many bytes have accumulated
+    BATCH_BYTES = 32 * 1024 * 1024
 
     def __init__(self, cach_dir: str = './.cache') -> None:
         self.cache_dir = cach_dir
 
         os.makedirs(self.cache_dir, exist_ok=True)
 
-    def _key_to_path(self, key: str) -> str:
-        """Convert a dictionary key to a safe file path"""
+        # one store per writing process keeps concurrent workers from
+        # interleaving appends; the index file names the store per record
+        self.store_name = f"results.{os.getpid()}.bin"
+        self.index_path = os.path.join(self.cache_dir, 'results.idx')
+
+        # key -> (store_name, offset, length)
+        self.index = {}
+
+        # key -> record not yet appended to this process's store: either
+        # a pickled blob (legacy) or a (prefix_bytes, matrix) pair whose
+        # buffer is written directly at flush without an intermediate copy
+        self.pending = {}
+        self.pending_bytes = 0
+
+        # store_name -> open mmap backing the views handed out by load;
+        # kept open so view lifetimes are not tied to a with-block
+        self._maps = {}
+
+        self._load_index()
+
+    def _load_index(self) -> None:
+        """Read the shared index file left by earlier saves"""
+
+        if not os.path.exists(self.index_path):
+            return
+
+        with open(self.index_path, 'r') as f:
+            for line in f:
+                key, store, offset, length = line.rstrip('\n').rsplit('\t', 3)
+
+                # later appends win, matching overwrite-on-save semantics
+                self.index[key] = (store, int(offset), int(length))
+
+    def save(self, key: str, df=None, values=None, columns=None, time=None) -> None:
+        """Save a single result under a key.
+
+        The (values, columns) form stores the raw NumPy matrix with a
+        schema header and skips DataFrame construction and pickling
+        entirely; the df form keeps the legacy pickled-DataFrame record.
+        """
+
+        if values is not None:
+
+            matrix = np.ascontiguousarray(values, dtype=np.float64)
+
+            header = pickle.dumps({
+                "columns": list(columns),
+                "shape": matrix.shape,
+                "time": time,
+            })
+
+            prefix = RECORD_MAGIC + len(header).to_bytes(8, 'little') + header
+
+            # the matrix rides to flush() as a buffer reference, not bytes
+            self.pending[key] = (prefix, matrix)
+            self.pending_bytes += len(prefix) + matrix.nbytes
+
+        else:
 
-        return os.path.join(self.cache_dir, f"{key}.pkl")
+            blob = pickle.dumps(df)
 
-    def save(self, key: str, df: pd.DataFrame) -> None:
-        """Save a single DataFrame under a key"""
+            self.pending[key] = blob
+            self.pending_bytes += len(blob)
 
-        path = self._key_to_path(key)
+        if self.pending_bytes >= self.BATCH_BYTES:
+            self.flush()
 
-        with open(path, 'wb') as f:
-            pickle.dump(df, f)
+    def load(self, key: str):
+        """Load a single result by key: a ResultView for raw records, a
+        DataFrame for legacy pickled ones"""
 
-    def load(self, key: str) -> pd.DataFrame:
-        """Load a single DataFrame by key"""
+        # not yet appended: serve straight from the write batch
+        if key in self.pending:
 
-        path = self._key_to_path(key)
+            record = self.pending[key]
 
-        with open(path, 'rb') as f:
-            return pickle.load(f)
+            if isinstance(record, tuple):
+                prefix, matrix = record
+                header = pickle.loads(prefix[len(RECORD_MAGIC) + 8:])
+                return ResultView(matrix, header["columns"], header["time"])
+
+            return pickle.loads(record)
+
+        if key not in self.index:
+            # another process may have appended since this cache opened
+            self.index = {}
+            self._load_index()
+
+        store, offset, length = self.index[key]
+
+        payload = memoryview(
+            self._store_map(store, offset + length)
+        )[offset:offset + length]
+
+        if bytes(payload[:len(RECORD_MAGIC)]) == RECORD_MAGIC:
+
+            header_len = int.from_bytes(
+                payload[len(RECORD_MAGIC):len(RECORD_MAGIC) + 8], 'little'
+            )
+
+            data_start = len(RECORD_MAGIC) + 8 + header_len
+
+            header = pickle.loads(
+                payload[len(RECORD_MAGIC) + 8:data_start]
+            )
+
+            # frombuffer over the mmap slice: the view pages in on access
+            matrix = np.frombuffer(
+                payload, dtype='<f8', offset=data_start
+            ).reshape(header["shape"])
+
+            return ResultView(matrix, header["columns"], header["time"])
+
+        return pickle.loads(payload)
+
+    def _store_map(self, store: str, needed_end: int) -> mmap.mmap:
+        """Returns the persistent map of one store file, reopening it
+        when another process has appended past the mapped size"""
+
+        cached = self._maps.get(store)
+
+        if cached is None or cached.size() < needed_end:
+
+            with open(os.path.join(self.cache_dir, store), 'rb') as f:
+                self._maps[store] = mmap.mmap(
+                    f.fileno(), 0, access=mmap.ACCESS_READ
+                )
+
+        return self._maps[store]
+
+    def flush(self) -> None:
+        """Append every pending record to the store in one batched write"""
+
+        if not self.pending:
+            return
+
+        store_path = os.path.join(self.cache_dir, self.store_name)
+
+        with open(store_path, 'ab') as data_f, \
+                open(self.index_path, 'a') as index_f:
+
+            offset = data_f.tell()
+
+            for key, record in self.pending.items():
+
+                if isinstance(record, tuple):
+                    prefix, matrix = record
+                    data_f.write(prefix)
+                    data_f.write(memoryview(matrix).cast('B'))
+                    length = len(prefix) + matrix.nbytes
+                else:
+                    data_f.write(record)
+                    length = len(record)
+
+                self.index[key] = (self.store_name, offset, length)
+                index_f.write(
+                    f"{key}\t{self.store_name}\t{offset}\t{length}\n"
+                )
+
+                offset += length
+
+        self.pending = {}
+        self.pending_bytes = 0
 
     def delete_cache(self) -> None:
         """Removes cache directory after results have been saved."""
+        self.pending = {}
+        self.pending_bytes = 0
+
+        # release the maps before unlinking the stores beneath them
+        for view in self._maps.values():
+            view.close()
+        self._maps = {}
+
         shutil.rmtree(self.cache_dir, ignore_errors=False)
+
+    def __del__(self):
+        # best effort: a batch still pending when the owner goes away is
+        # appended rather than lost
+        try:
+            self.flush()
+        except Exception:
+            pass
@@ -13,6 +13,7 @@ Output: MPI tasks for each rank, MPI task assignment, and MPI results aggregatio
 """
 # -----------------------Package Import & Defined Arguements-------------------#
 import gc
+import os
 import sys
 import logging
 
@@ -23,6 +24,7 @@ import multiprocessing as mp
 sys.path.append("../")
 from Manager import Manager
 from ResultsCacher import ResultCache
+from shared_utils import tracing
 
 sys.path.append("../../build/")
 from pySingleCell import SingleCell
@@ -40,7 +42,8 @@ class Worker:
             self, 
             task: str, 
             sbml_list: list, 
-            manager: Manager
+            manager: Manager,
+            single_cell=None
             ):
 
         # Store Manager: methods for job indexing plus results dict
@@ -48,8 +51,10 @@ class Worker:
 
         self.sbmls = sbml_list
 
-        # Store instance of cell
-        self.single_cell = None
+        # Resident session handed in by a WorkerPool worker; None means
+        # construct (and tear down) a fresh cell for this task
+        self.resident = single_cell is not None
+        self.single_cell = single_cell
         
         # Run individual simulation
         self.__run_task(task)
@@ -69,31 +74,52 @@ class Worker:
 
             logger.info(f"{rank} running {condition_id} for cell {cell}")
 
-            self.single_cell = SingleCell(*self.sbmls)
+            tracing.name_thread(rank)
+
+            if self.resident:
+                # rewind the reused session instead of re-parsing SBML and
+                # rebuilding AMICI objects; conditions re-apply their full
+                # override set below
+                self.single_cell.reset()
+            else:
+                self.single_cell = SingleCell(*self.sbmls)
 
             state_ids = self.single_cell.getGlobalSpeciesIds()
 
             precondition_results = self.__extract_preequilibration_results(condition_id, cell)
-            if precondition_results:
+            if len(precondition_results):
                 self.__setModelState(state_ids, precondition_results)
 
             self.__setModelState(condition.keys(), condition.values.tolist())
 
             stop_time = self.__get_simulation_time(condition)
-            results_array = self.single_cell.simulate(0.0, stop_time, 30.0)
-
-            results = pd.DataFrame(results_array, columns=state_ids)
-            results['time'] = np.arange(0, stop_time, 30)
 
-            parcel = self.__package_results(results, condition_id, cell)
+            with tracing.span(f"simulate:{condition_id}", "worker"):
+                results_array = self.single_cell.simulate(
+                    0.0, stop_time, 30.0
+                )
+
+            # no DataFrame here: the raw matrix travels to the cache with
+            # its schema and aggregation reads zero-copy views of it; a
+            # DataFrame only exists again at final export
+            parcel = self.__package_results(
+                np.asarray(results_array),
+                state_ids,
+                np.arange(0, stop_time, 30.0),
+                condition_id,
+                cell
+            )
 
             logger.info(f"{rank} finished {condition_id} for cell {cell}")
 
-            self.__cache_results(parcel)
+            with tracing.span("cache_results", "worker"):
+                self.__cache_results(parcel)
 
-            # Reset rank internal model after simulation and take out the garbage
-            self.single_cell = None
-            gc.collect()
+            # Reset rank internal model after simulation and take out the
+            # garbage; resident sessions are kept for the next task
+            if not self.resident:
+                self.single_cell = None
+                gc.collect()
 
             logger.info(f"Rank {rank} has completed {condition_id} for cell {cell}")
 
@@ -129,13 +155,13 @@ class Worker:
                         f"for condition {condition_id}"
                     ))
 
-                    precondition_df = self.manager.results_lookup(precondition_id, cell)
-                    
-                    if precondition_df is not None:
-                        if "time" in precondition_df.columns: 
-                            precondition_df = precondition_df.drop("time", axis = 1)
+                    precondition_view = self.manager.results_lookup(precondition_id, cell)
 
-                        precondition_results = precondition_df.iloc[:, -1]
+                    if precondition_view is not None:
+                        # time is no longer a matrix column, so the last
+                        # column is the final species, as the old
+                        # drop("time") + iloc[:, -1] pair selected
+                        precondition_results = precondition_view.array[:, -1]
 
         return precondition_results
 
@@ -179,34 +205,136 @@ class Worker:
 
         condition_id = parcel['conditionId']
         cell = parcel["cell"]
-        results = parcel['results']
 
         for key in self.manager.results_dict.keys(): # <-- ToDo: Not in self
 
             if self.manager.results_dict[key]['conditionId'] == condition_id \
                 and self.manager.results_dict[key]['cell'] == cell:
 
-                # Save results
+                # raw matrix plus schema; the cache stores the buffer
+                # without pickling a DataFrame around it
                 cache = ResultCache()
-                cache.save(key=key, df=results)
+                cache.save(
+                    key=key,
+                    values=parcel['results'],
+                    columns=parcel['columns'],
+                    time=parcel['time']
+                )
 
         return # Saves individual simulation data in cache directory
 
     def __package_results(
             self,
-            results: pd.DataFrame,
+            results: np.ndarray,
+            columns: list,
+            time: np.ndarray,
             condition_id: str,
             cell: str,
         ) -> dict:
         """
-        Combines results, condition identifier, and cell number into dict for storage, 
+        Combines the result matrix, its schema, condition identifier and
+        cell number into a dict for storage
         """
 
-        # make a dict entry in rank_results for every column in results
         rank_results = {
             "conditionId": condition_id,
             "cell": int(cell),
             "results": results,
+            "columns": list(columns),
+            "time": time,
         }
 
         return rank_results
+
+
+# Queue sentinel telling a pool worker to exit its loop
+_POOL_SHUTDOWN = "__POOL_SHUTDOWN__"
+
+
+class WorkerPool:
+    """Persistent fork-based worker pool.
+
+    Workers are forked once, after the parent has fully constructed a
+    model, so the parsed SBML documents, AMICI machinery and imported
+    modules are shared copy-on-write instead of being rebuilt per task.
+    Each worker keeps one resident SingleCell session and rewinds it
+    between tasks, so task latency is simulation cost rather than the
+    ~30s of per-process setup the old one-Pool-per-round path paid.
+    """
+
+    def __init__(
+            self,
+            sbml_list: list,
+            manager: Manager,
+            processes: int = None
+            ):
+
+        self.sbml_list = list(sbml_list)
+        self.manager = manager
+        self.processes = processes or os.cpu_count()
+
+        ctx = mp.get_context("fork")
+
+        # warm the parent before forking: model parsing and derived-data
+        # extraction happen once here, and every child inherits the pages
+        warm_cell = SingleCell(*self.sbml_list)
+        del warm_cell
+        gc.collect()
+
+        self._tasks = ctx.JoinableQueue()
+
+        self._workers = [
+            ctx.Process(
+                target=self._worker_loop,
+                name=f"pool-worker-{i}",
+                daemon=True,
+            )
+            for i in range(self.processes)
+        ]
+
+        for worker in self._workers:
+            worker.start()
+
+    def _worker_loop(self) -> None:
+        """Runs in each forked worker: one resident session, many tasks"""
+
+        single_cell = SingleCell(*self.sbml_list)
+
+        while True:
+            task = self._tasks.get()
+
+            if task == _POOL_SHUTDOWN:
+                self._tasks.task_done()
+                break
+
+            try:
+                Worker(
+                    task,
+                    self.sbml_list,
+                    self.manager,
+                    single_cell=single_cell,
+                )
+            except Exception:
+                logger.exception(f"Task {task} failed")
+            finally:
+                self._tasks.task_done()
+
+    def run_round(self, tasks: list) -> None:
+        """Feeds one round of tasks to the workers and waits for them"""
+
+        for task in tasks:
+            # empty assignments are no-ops; never enqueue them since None
+            # is indistinguishable from nothing to do
+            if task is not None:
+                self._tasks.put(task)
+
+        self._tasks.join()
+
+    def shutdown(self) -> None:
+        """Stops the workers; the pool cannot be reused afterwards"""
+
+        for _ in self._workers:
+            self._tasks.put(_POOL_SHUTDOWN)
+
+        for worker in self._workers:
+            worker.join()
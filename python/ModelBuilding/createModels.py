@@ -289,6 +289,8 @@ class StochasticModel(CreateModel):
 
         self._add_annotations()
 
+        self._make_propensity_library()
+
     def _get_components(self):
         """Gets stochastic components only, converts deterministic into parameters"""
 
@@ -341,6 +343,50 @@ class StochasticModel(CreateModel):
 
         self.model_files.ratelaws.drop(index=drop_indices, inplace=True)
 
+    def _make_propensity_library(self):
+        """Emits and compiles a native propensity kernel for the stochastic
+        model, the counterpart of the generated AMICI C++ on the ODE side.
+        The simulator dlopens libpropensity_<name>.so next to the AMICI
+        models and evaluates every rate law in one compiled call; if
+        generation or compilation fails the simulator simply keeps
+        interpreting the formula strings at runtime.
+        """
+
+        output_dir = f'../../amici_models/{self.model_name}'
+
+        _make_output_dir(output_dir)
+
+        source = _generate_propensity_source(self.sbml_model, self.model_name)
+
+        if source is None:
+            return
+
+        source_path = os.path.join(output_dir, f'propensity_{self.model_name}.cpp')
+
+        with open(source_path, encoding='utf-8', mode='w') as source_file:
+            source_file.write(source)
+
+        library_path = os.path.join(output_dir, f'libpropensity_{self.model_name}.so')
+
+        compiler = os.environ.get('CXX', 'g++')
+
+        try:
+            subprocess.run([
+                compiler, '-O2', '-shared', '-fPIC', '-std=c++17',
+                '-o', library_path, source_path
+                ],
+                capture_output=True,
+                text=True,
+                check=True
+                )
+
+        except (subprocess.CalledProcessError, FileNotFoundError) as err:
+            logger.warning('Could not compile propensity library for %s; the simulator '
+                           'will interpret rate laws at runtime: %s', self.model_name, err)
+            return
+
+        logger.info('Compiled native propensity library %s', library_path)
+
 class AntimonyFile:
     """ Creates antimony file for easy conversion to SBML """
     def __init__(self, parent_model_type: SimpleNamespace, stochastic = False):
@@ -576,6 +622,142 @@ class Ratelaw:
         self.formula = self.ratelaw['ratelaw']
 
 
+@staticmethod
+def _ast_to_cxx(node, symbol_map: dict) -> str:
+    """Recursively renders a libsbml math AST node as a C++ expression.
+    Raises KeyError/ValueError on identifiers or constructs outside the
+    supported subset, which aborts codegen for the whole model."""
+
+    node_type = node.getType()
+
+    if node_type == libsbml.AST_NAME:
+        return symbol_map[node.getName()]
+
+    if node_type == libsbml.AST_INTEGER:
+        return repr(float(node.getInteger()))
+
+    if node_type in (libsbml.AST_REAL, libsbml.AST_REAL_E, libsbml.AST_RATIONAL):
+        return repr(node.getReal())
+
+    children = [_ast_to_cxx(node.getChild(i), symbol_map)
+                for i in range(node.getNumChildren())]
+
+    if node_type == libsbml.AST_PLUS:
+        return '(' + ' + '.join(children) + ')'
+
+    if node_type == libsbml.AST_MINUS:
+        if len(children) == 1:
+            return f'(-{children[0]})'
+        return f'({children[0]} - {children[1]})'
+
+    if node_type == libsbml.AST_TIMES:
+        return '(' + ' * '.join(children) + ')'
+
+    if node_type == libsbml.AST_DIVIDE:
+        return f'({children[0]} / {children[1]})'
+
+    if node_type in (libsbml.AST_POWER, libsbml.AST_FUNCTION_POWER):
+        return f'std::pow({children[0]}, {children[1]})'
+
+    unary_functions = {
+        libsbml.AST_FUNCTION_EXP: 'std::exp',
+        libsbml.AST_FUNCTION_LN: 'std::log',
+        libsbml.AST_FUNCTION_LOG: 'std::log10',
+        libsbml.AST_FUNCTION_ABS: 'std::fabs',
+        libsbml.AST_FUNCTION_SIN: 'std::sin',
+        libsbml.AST_FUNCTION_COS: 'std::cos',
+        libsbml.AST_FUNCTION_TAN: 'std::tan',
+        libsbml.AST_FUNCTION_FLOOR: 'std::floor',
+        libsbml.AST_FUNCTION_CEILING: 'std::ceil',
+    }
+
+    if node_type in unary_functions and len(children) == 1:
+        return f'{unary_functions[node_type]}({children[0]})'
+
+    raise ValueError(f'unsupported math construct (AST type {node_type})')
+
+
+@staticmethod
+def _generate_propensity_source(sbml_model, model_name: str) -> str | None:
+    """Translates every kinetic law of the model into one C++ function
+    writing the full propensity array. Species and parameters arrive in
+    SBML document order — the layout StochasticModule passes — and
+    constant compartment volumes are folded in as literals. Returns None
+    when any rate law falls outside the supported math subset."""
+
+    species_ids = [s.getId() for s in sbml_model.getListOfSpecies()]
+    parameter_ids = [p.getId() for p in sbml_model.getListOfParameters()]
+
+    symbol_map = {}
+
+    for index, species_id in enumerate(species_ids):
+        symbol_map[species_id] = f'species[{index}]'
+
+    for index, parameter_id in enumerate(parameter_ids):
+        symbol_map[parameter_id] = f'parameters[{index}]'
+
+    for compartment in sbml_model.getListOfCompartments():
+        symbol_map[compartment.getId()] = repr(float(compartment.getSize()))
+
+    expressions = []
+
+    for reaction in sbml_model.getListOfReactions():
+
+        kinetic_law = reaction.getKineticLaw()
+
+        if kinetic_law is None or kinetic_law.getMath() is None:
+            logger.warning('Reaction %s has no kinetic law; skipping propensity '
+                           'codegen for model %s', reaction.getId(), model_name)
+            return None
+
+        try:
+            expressions.append(_ast_to_cxx(kinetic_law.getMath(), symbol_map))
+
+        except (KeyError, ValueError) as err:
+            logger.warning('Rate law for %s is outside the propensity codegen '
+                           'subset (%s); model %s keeps interpreted evaluation',
+                           reaction.getId(), err, model_name)
+            return None
+
+    lines = [
+        f'// Generated by createModels.py for model {model_name}; do not edit.',
+        '// Evaluates every rate law into the propensity array in one call.',
+        '// Species and parameters arrive in SBML document order; constant',
+        '// compartment volumes are folded in as literals.',
+        '#include <cmath>',
+        '',
+        'extern "C" {',
+        '',
+        'unsigned int singlecell_propensity_num_species() '
+        f'{{ return {len(species_ids)}u; }}',
+        'unsigned int singlecell_propensity_num_parameters() '
+        f'{{ return {len(parameter_ids)}u; }}',
+        'unsigned int singlecell_propensity_num_reactions() '
+        f'{{ return {len(expressions)}u; }}',
+        '',
+        'void singlecell_propensities(',
+        '    const double* species,',
+        '    const double* parameters,',
+        '    double* v',
+        ') {',
+        '    (void)species;',
+        '    (void)parameters;',
+        '',
+    ]
+
+    for index, expression in enumerate(expressions):
+        lines.append(f'    v[{index}] = {expression};')
+
+    lines += [
+        '}',
+        '',
+        '}  // extern "C"',
+        '',
+    ]
+
+    return '\n'.join(lines)
+
+
 @staticmethod
 def _make_output_dir(amici_model_path: str | os.PathLike) -> None:
     """ Provide a path and this returns a directory. Separating from Classes for operability."""
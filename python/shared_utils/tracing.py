@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+script name: tracing.py
+date: 09-01-2026
+Author: Jonah R. Huggins
+
+Description: chrome-trace span helpers for the experiment pipeline.
+Spans emitted here land in the same perfetto file as the C++ stepping
+phases and I/O threads, stamped on the shared steady clock, so one
+trace answers where a study's wall time went across every layer.
+
+Enabled by the SINGLECELL_TRACE environment variable: set it to a path
+prefix and every process (the manager and each worker) writes
+<prefix>.<pid>.json at exit. Without it every helper is a no-op.
+
+"""
+# -----------------------Package Import & Defined Arguements-------------------#
+import os
+import sys
+import atexit
+import contextlib
+
+sys.path.append("../../build/")
+
+try:
+    import pySingleCell as _native
+except ImportError:
+    _native = None
+
+_TRACE_PREFIX = os.environ.get("SINGLECELL_TRACE")
+
+_started = False
+
+
+def _ensure_started():
+    """Arm the native collector once per process, lazily, so worker
+    processes spawned by multiprocessing each get their own file.
+    output:
+        returns True when tracing is armed in this process
+    """
+    global _started
+
+    if _native is None or _TRACE_PREFIX is None:
+        return False
+
+    if not _started:
+        _native.trace_begin(f"{_TRACE_PREFIX}.{os.getpid()}.json")
+        atexit.register(_native.trace_end)
+        _started = True
+
+    return True
+
+
+def name_thread(name):
+    """Label the calling thread in the trace metadata
+    input:
+        name: str - label shown by the trace viewer
+    """
+    if _ensure_started():
+        _native.trace_name_thread(name)
+
+
+@contextlib.contextmanager
+def span(name, category="python"):
+    """Context manager emitting one complete span around its body
+    input:
+        name: str - span label shown by the trace viewer
+        category: str - grouping tag; defaults to "python"
+    """
+    if not _ensure_started():
+        yield
+        return
+
+    start = _native.trace_now_us()
+
+    try:
+        yield
+    finally:
+        _native.trace_emit(
+            name, category, start, _native.trace_now_us() - start
+        )
+
+
+def merge_traces(paths, output_path):
+    """Concatenate per-process trace files into one viewable file;
+    events keep their pid, so the viewer nests processes side by side
+    input:
+        paths: list - per-process trace JSON files
+        output_path: str - combined trace destination
+    """
+    import json
+
+    events = []
+
+    for path in paths:
+        with open(path) as handle:
+            events.extend(json.load(handle).get("traceEvents", []))
+
+    with open(output_path, "w") as handle:
+        json.dump({"traceEvents": events}, handle)
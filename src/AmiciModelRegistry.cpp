@@ -0,0 +1,185 @@
+/**
+ * @file AmiciModelRegistry.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Lazy, dlopen-based lookup of generated AMICI model objects
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <mutex>
+#include <vector>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <dlfcn.h>
+
+// Internal Libraries
+#include "singlecell/Logger.h"
+#include "singlecell/AmiciModelRegistry.h"
+
+// Third Party Libraries
+#include "amici/amici.h"
+
+#ifdef SINGLECELL_STATIC_AMICI_MODELS
+// Built-in fallbacks: the two models bundled with the repository keep
+// working without any shared object on disk. This is the only
+// translation unit that still sees the generated headers
+#include "../amici_models/Deterministic/Deterministic.h"
+#include "../amici_models/Hybrid/Hybrid.h"
+#endif
+
+//=============================Class Details================================//
+namespace {
+
+// Generated model shared objects expose their constructor through
+// amici::generic_model::getModel; dlsym needs the mangled spelling
+constexpr const char* kGetModelSymbol = "_ZN5amici13generic_model8getModelEv";
+
+using ModelFactory = std::unique_ptr<amici::Model> (*)();
+
+std::mutex& registryMutex() {
+
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Directories probed for libmodel_<id>.so, most recently added first;
+// SINGLECELL_MODEL_PATH entries are folded in on first use
+std::vector<std::string>& searchPaths() {
+
+    static std::vector<std::string> paths = []() {
+
+        std::vector<std::string> initial;
+
+        if (const char* env = std::getenv("SINGLECELL_MODEL_PATH")) {
+
+            std::stringstream stream(env);
+            std::string entry;
+
+            while (std::getline(stream, entry, ':')) {
+
+                if (!entry.empty()) {
+                    initial.push_back(entry);
+                }
+            }
+        }
+
+        initial.push_back("amici_models");
+
+        return initial;
+    }();
+
+    return paths;
+}
+
+// Factories already resolved this process; dlopen handles are cached
+// inside and deliberately never dlclosed, since constructed models may
+// outlive any registry call
+std::unordered_map<std::string, ModelFactory>& resolvedFactories() {
+
+    static std::unordered_map<std::string, ModelFactory> factories;
+    return factories;
+}
+
+ModelFactory resolveSharedObject(
+    const std::string& model_id
+) {
+
+    for (const std::string& directory : searchPaths()) {
+
+        // AMICI's own install layout nests each model in its own
+        // directory; probe both the flat and the nested spelling
+        const std::string candidates[] = {
+            directory + "/libmodel_" + model_id + ".so",
+            directory + "/" + model_id + "/libmodel_" + model_id + ".so"
+        };
+
+        for (const std::string& path : candidates) {
+
+            void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+            if (handle == nullptr) {
+                continue;
+            }
+
+            void* symbol = dlsym(handle, kGetModelSymbol);
+
+            if (symbol == nullptr) {
+
+                SC_LOG_WARN(path << " does not export "
+                    << kGetModelSymbol << "; skipping");
+
+                dlclose(handle);
+                continue;
+            }
+
+            SC_LOG_INFO("loaded AMICI model '" << model_id
+                << "' from " << path);
+
+            return reinterpret_cast<ModelFactory>(symbol);
+        }
+    }
+
+    return nullptr;
+}
+
+}
+
+std::unique_ptr<amici::Model> AmiciModelRegistry::create(
+    const std::string& model_id
+) {
+
+    ModelFactory factory = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+
+        auto resolved = resolvedFactories().find(model_id);
+
+        if (resolved != resolvedFactories().end()) {
+
+            factory = resolved->second;
+
+        } else if ((factory = resolveSharedObject(model_id)) != nullptr) {
+
+            resolvedFactories()[model_id] = factory;
+        }
+    }
+
+    if (factory != nullptr) {
+        return factory();
+    }
+
+#ifdef SINGLECELL_STATIC_AMICI_MODELS
+    if (model_id == "Deterministic") {
+        return std::make_unique<
+            amici::model_Deterministic::Model_Deterministic>();
+    }
+
+    if (model_id == "Hybrid") {
+        return std::make_unique<amici::model_Hybrid::Model_Hybrid>();
+    }
+#endif
+
+    SC_LOG_ERROR("no AMICI model registered for '" << model_id
+        << "': no libmodel_" << model_id
+        << ".so on the search path and no built-in fallback");
+
+    throw std::runtime_error(
+        "AmiciModelRegistry: unknown model '" + model_id + "'"
+    );
+}
+
+void AmiciModelRegistry::addSearchPath(
+    const std::string& directory
+) {
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+
+    searchPaths().insert(searchPaths().begin(), directory);
+}
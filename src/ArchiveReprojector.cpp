@@ -0,0 +1,416 @@
+/**
+ * @file ArchiveReprojector.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for streaming observable re-projection over archives
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <map>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <sstream>
+#include <algorithm>
+#include <unordered_map>
+
+// Internal Libraries
+#include "muParser.h"
+#include "singlecell/Logger.h"
+#include "singlecell/SparseMatrix.h"
+#include "singlecell/ResultsArchive.h"
+#include "singlecell/ArchiveReprojector.h"
+
+//=========================Compiler Definitions=============================//
+namespace {
+
+    /**
+     * @brief one observable set compiled against one archived label set:
+     * linear expressions as CSR rows plus offsets, the rest as muParser
+     * bytecode over the bound input row. Held by unique_ptr because the
+     * parsers keep raw pointers into the input buffer
+     */
+    struct CompiledObservables {
+
+        SparseMatrix matrix;
+        std::vector<double> offsets;
+        std::vector<unsigned char> is_linear;
+
+        std::vector<mu::Parser> parsers;
+        std::vector<unsigned char> parser_ok;
+        std::vector<double> input;
+
+        // false when no expression compiled against these labels — the
+        // entry is an observable table, not a state recording
+        bool any_compiled = false;
+    };
+
+    /**
+     * @brief classifies one expression as a linear combination of the
+     * archived columns and numeric literals, filling the CSR triplets
+     * and constant offset when it is. The model-bound variant in
+     * SingleCell also folds document constants; with no model loaded
+     * here, any symbol that is not a column disqualifies the form
+     *
+     * @param formula the observable expression
+     * @param column_of archived label -> column index
+     * @param row the observable's matrix row
+     * @param triplets receives the linear coefficients
+     * @param offset receives the constant term
+     *
+     * @returns true when the expression is linear over the columns
+     */
+    bool classifyLinear(
+        const std::string& formula,
+        const std::unordered_map<std::string, unsigned int>& column_of,
+        unsigned int row,
+        std::vector<SparseMatrix::Triplet>& triplets,
+        double& offset
+    ) {
+
+        // operator shapes the linear form cannot carry
+        if (formula.find_first_of("/^") != std::string::npos) {
+            return false;
+        }
+
+        // split into terms on top-level +/-, tracking sign
+        std::vector<std::pair<std::string, double>> terms;
+
+        int depth = 0;
+        size_t term_start = 0;
+        double sign = 1.0;
+
+        for (size_t i = 0; i <= formula.size(); i++) {
+
+            char c = i < formula.size() ? formula[i] : '+';
+
+            if (c == '(') {
+                depth++;
+            } else if (c == ')') {
+                depth--;
+            }
+
+            if ((c == '+' || c == '-') && depth == 0) {
+
+                std::string term = formula.substr(term_start, i - term_start);
+
+                if (term.find_first_not_of(' ') != std::string::npos) {
+                    terms.emplace_back(term, sign);
+                }
+
+                sign = (c == '-') ? -1.0 : 1.0;
+                term_start = i + 1;
+            }
+        }
+
+        if (depth != 0 || terms.empty()) {
+            return false;
+        }
+
+        size_t kept_triplets = triplets.size();
+        double term_offset = 0.0;
+
+        for (auto& [term, term_sign] : terms) {
+
+            // parenthesized or nested terms take the parser path
+            if (term.find_first_of("()") != std::string::npos) {
+                triplets.resize(kept_triplets);
+                return false;
+            }
+
+            // factors multiply into one coefficient around at most one
+            // archived column
+            double coefficient = term_sign;
+            int column = -1;
+
+            std::stringstream factor_stream(term);
+            std::string factor;
+
+            while (std::getline(factor_stream, factor, '*')) {
+
+                size_t first = factor.find_first_not_of(' ');
+
+                if (first == std::string::npos) {
+                    triplets.resize(kept_triplets);
+                    return false;
+                }
+
+                factor = factor.substr(
+                    first, factor.find_last_not_of(' ') - first + 1
+                );
+
+                char* end = nullptr;
+                double literal = std::strtod(factor.c_str(), &end);
+
+                auto found = column_of.find(factor);
+
+                if (end == factor.c_str() + factor.size() &&
+                    end != factor.c_str()) {
+
+                    coefficient *= literal;
+
+                } else if (found != column_of.end()) {
+
+                    if (column >= 0) {
+                        triplets.resize(kept_triplets);
+                        return false;
+                    }
+
+                    column = static_cast<int>(found->second);
+
+                } else {
+                    triplets.resize(kept_triplets);
+                    return false;
+                }
+            }
+
+            if (column >= 0) {
+                triplets.push_back({
+                    row, static_cast<unsigned int>(column), coefficient
+                });
+            } else {
+                term_offset += coefficient;
+            }
+        }
+
+        offset = term_offset;
+
+        return true;
+    }
+
+    /**
+     * @brief compiles the observable set against one label set: linear
+     * expressions become CSR rows, the rest muParser bytecode with every
+     * label bound to its input slot. Expressions whose symbols the
+     * labels cannot satisfy are marked failed and project as NaN
+     *
+     * @param defs name, expression pairs
+     * @param labels the entry's column labels
+     *
+     * @returns the compiled set, any_compiled false when nothing fit
+     */
+    std::unique_ptr<CompiledObservables> compileAgainst(
+        const std::vector<std::pair<std::string, std::string>>& defs,
+        const std::vector<std::string>& labels
+    ) {
+
+        auto compiled = std::make_unique<CompiledObservables>();
+
+        std::unordered_map<std::string, unsigned int> column_of;
+
+        for (size_t s = 0; s < labels.size(); s++) {
+            column_of[labels[s]] = static_cast<unsigned int>(s);
+        }
+
+        compiled->input.assign(labels.size(), 0.0);
+        compiled->offsets.assign(defs.size(), 0.0);
+        compiled->is_linear.assign(defs.size(), 0);
+        compiled->parser_ok.assign(defs.size(), 0);
+        compiled->parsers.resize(defs.size());
+
+        std::vector<SparseMatrix::Triplet> triplets;
+
+        for (size_t o = 0; o < defs.size(); o++) {
+
+            if (classifyLinear(
+                    defs[o].second, column_of,
+                    static_cast<unsigned int>(o),
+                    triplets, compiled->offsets[o])) {
+
+                compiled->is_linear[o] = 1;
+                compiled->any_compiled = true;
+                continue;
+            }
+
+            mu::Parser& parser = compiled->parsers[o];
+
+            try {
+
+                for (size_t s = 0; s < labels.size(); s++) {
+                    parser.DefineVar(labels[s], &compiled->input[s]);
+                }
+
+                parser.SetExpr(defs[o].second);
+
+                // compile the bytecode now rather than on the first row
+                parser.Eval();
+
+                compiled->parser_ok[o] = 1;
+                compiled->any_compiled = true;
+
+            } catch (mu::Parser::exception_type& e) {
+                SC_LOG_WARN("Observable '" << defs[o].first
+                            << "' does not compile against this entry's "
+                            << "columns: " << e.GetMsg());
+            }
+        }
+
+        compiled->matrix = SparseMatrix::fromTriplets(
+            defs.size(), labels.size(), std::move(triplets)
+        );
+
+        return compiled;
+    }
+
+} // namespace
+
+//=============================Class Details================================//
+ArchiveReprojector::ArchiveReprojector(
+    const std::string& archive_path
+) : archive_path(archive_path) {}
+
+size_t ArchiveReprojector::reproject(
+    const std::vector<std::pair<std::string, std::string>>& observable_defs,
+    const std::string& output_path
+) {
+
+    ResultsArchiveReader reader(this->archive_path);
+    ResultsArchiveWriter writer(output_path);
+
+    std::vector<std::string> observable_names;
+
+    for (const auto& [name, expression] : observable_defs) {
+        observable_names.push_back(name);
+    }
+
+    // one compilation per distinct label set: a homogeneous study
+    // compiles once and streams every entry through the same bytecode
+    std::map<std::string, std::unique_ptr<CompiledObservables>> cache;
+
+    size_t projected_entries = 0;
+    this->skipped_entries = 0;
+
+    for (const std::string& key : reader.keys()) {
+
+        uint64_t num_rows = 0;
+        uint64_t num_cols = 0;
+
+        std::vector<std::string> col_labels;
+        std::vector<std::string> row_labels;
+
+        std::vector<double> flat = reader.read(
+            key, num_rows, num_cols, col_labels, row_labels
+        );
+
+        // unlabeled entries cannot bind symbols to columns
+        if (col_labels.size() != num_cols || num_cols == 0) {
+            this->skipped_entries++;
+            continue;
+        }
+
+        std::string cache_key;
+
+        for (const std::string& label : col_labels) {
+            cache_key += label;
+            cache_key += '\t';
+        }
+
+        auto cached = cache.find(cache_key);
+
+        if (cached == cache.end()) {
+            cached = cache.emplace(
+                cache_key, compileAgainst(observable_defs, col_labels)
+            ).first;
+        }
+
+        CompiledObservables& compiled = *cached->second;
+
+        // an entry no expression compiled against is an observable
+        // table from the original run, not a state recording
+        if (!compiled.any_compiled) {
+            this->skipped_entries++;
+            continue;
+        }
+
+        std::vector<double> observables_matrix;
+        observables_matrix.reserve(num_rows * observable_defs.size());
+
+        // the bound-input copy only pays off when some observable still
+        // evaluates through its parser; all-linear sets skip it
+        bool any_parser = false;
+
+        for (size_t o = 0; o < observable_defs.size(); o++) {
+            if (!compiled.is_linear[o]) {
+                any_parser = true;
+            }
+        }
+
+        for (uint64_t t = 0; t < num_rows; t++) {
+
+            const double* row = flat.data() + t * num_cols;
+
+            if (any_parser) {
+                std::copy(row, row + num_cols, compiled.input.begin());
+            }
+
+            for (size_t o = 0; o < observable_defs.size(); o++) {
+
+                // linear observables run the CSR row kernel:
+                // gather-multiply over the row's entries plus its offset
+                if (compiled.is_linear[o]) {
+
+                    double value = compiled.offsets[o];
+
+                    for (size_t e = compiled.matrix.row_ptr[o];
+                         e < compiled.matrix.row_ptr[o + 1]; e++) {
+
+                        value += compiled.matrix.values[e]
+                            * row[compiled.matrix.col_idx[e]];
+                    }
+
+                    observables_matrix.push_back(value);
+                    continue;
+                }
+
+                if (!compiled.parser_ok[o]) {
+                    observables_matrix.push_back(
+                        std::numeric_limits<double>::quiet_NaN()
+                    );
+                    continue;
+                }
+
+                try {
+                    observables_matrix.push_back(compiled.parsers[o].Eval());
+                } catch (mu::Parser::exception_type& e) {
+                    SC_LOG_ERROR("Error while evaluating observable: "
+                                 << e.GetMsg());
+                    observables_matrix.push_back(
+                        std::numeric_limits<double>::quiet_NaN()
+                    );
+                }
+            }
+        }
+
+        // the raw-recording suffix saveArchive appends folds away, so
+        // the projected table lands under the task's own key
+        std::string output_key = key;
+
+        const std::string state_suffix = "+state";
+
+        if (output_key.size() > state_suffix.size() &&
+            output_key.compare(
+                output_key.size() - state_suffix.size(),
+                state_suffix.size(), state_suffix) == 0) {
+
+            output_key.resize(output_key.size() - state_suffix.size());
+        }
+
+        writer.append(
+            output_key,
+            observables_matrix,
+            observable_defs.size(),
+            observable_names,
+            row_labels
+        );
+
+        projected_entries++;
+    }
+
+    writer.finalize();
+
+    return projected_entries;
+}
@@ -1,21 +1,18 @@
 /**
  * @file: ArgParsing.cpp
- * 
+ *
  * @authors  Jonah R. Huggins
  * @date 30-05-2025
- * 
+ *
  * @brief Creates class for main function to interpret Command line arguments
  */
 //===========================Library Import=================================//
 //Std Libaries
-#include <any>
-#include <vector>
 #include <string>
-#include <memory>
+#include <cstdlib>
+#include <fstream>
 #include <sstream>
 #include <iostream>
-#include <optional>
-#include <typeinfo>
 #include <unordered_map>
 
 //Internal Libraries
@@ -23,93 +20,221 @@
 
 //=============================Class Details================================//
 ArgParsing::ArgParsing(int argc, char* argv[]) {
-    // Populate the cli_map from args
-    this->cli_map = cliToMap(argc, argv);
 
-    // Help flag
-    if (cli_map.count("-h") || cli_map.count("--help")) {
-        printUsage();
-        return;
+    // One typed parse at startup; everything downstream reads config
+    // fields directly instead of any_cast probing
+    this->cliToConfig(argc, argv);
+}
+
+void ArgParsing::cliToConfig(
+    int argc,
+    char* argv[]
+) {
+
+    // Run file first, so explicit CLI flags override its values below
+    for (int i = 0; i + 1 < argc; i++) {
+
+        if (std::string(argv[i]) == "--config") {
+            this->loadRunFile(argv[i + 1]);
+        }
     }
 
-    // Parse key-value pair updates
-    if (cli_map.count("-m") || cli_map.count("--modify")) {
-        try {
-            std::string kv_string = std::any_cast<std::string>(cli_map["--modify"]);
-            // implement a method to restructure the input from '{}', and comma-separated
-            parseDict(kv_string);
-        } catch (const std::bad_any_cast&) {
-            std::cerr << "Error: --modify must be followed by a string like 'x=1.0'\n";
+    for (int i = 0; i < argc; i++) {
+
+        if (argv[i][0] != '-') { //starting character for argument flag
+            continue;
+        }
+
+        //flag stored as a key, leading dashes stripped
+        std::string key = argv[i];
+        key = key.substr(key.find_first_not_of('-'));
+
+        if (key == "h" || key == "help") {
+            printUsage();
+            return;
+        }
+
+        std::string value = "";
+
+        // i.e. if the flag is not boolean, like --parallel, store value
+        if (i + 1 < argc && argv[i + 1][0] != '-') {
+
+            value = std::string(argv[i + 1]);
+            i++;
+        }
+
+        if (key == "config") {
+            continue; // consumed above
+        }
+
+        if (key == "m" || key == "modify") {
+
+            if (value.empty()) {
+                std::cerr << "Error: --modify must be followed by a string like '{x=1.0}'\n";
+                std::exit(EXIT_FAILURE);
+            }
+
+            parseDict(value);
+            continue;
+        }
+
+        if (!applyOption(key, value)) {
+            std::cerr << "Unknown option: --" << key << "\n";
             std::exit(EXIT_FAILURE);
         }
     }
 }
 
-std::unordered_map<std::string, std::any> ArgParsing::cliToMap(
-    int argc, 
-    char* argv[]
+bool ArgParsing::applyOption(
+    const std::string& key,
+    const std::string& value
 ) {
 
-    // Populate with defaults for simulator args
-    std::unordered_map<std::string, std::any>args = setDefaults();
+    if (key == "start") {
+        this->config.start = std::strtod(value.c_str(), nullptr);
 
-    for (int i = 0; i < argc; i++) {
+    } else if (key == "stop") {
+        this->config.stop = std::strtod(value.c_str(), nullptr);
 
-        if (argv[i][0] == '-') { //starting character for argument flag
+    } else if (key == "step") {
+        this->config.step = std::strtod(value.c_str(), nullptr);
 
-            //flag stored as a key
-            const std::string key = argv[i];
+    } else if (key == "seed") {
+        this->config.seed = std::strtoll(value.c_str(), nullptr, 10);
 
-            std::string value = "";
+    } else if (key == "threads") {
+        this->config.threads =
+            static_cast<int>(std::strtol(value.c_str(), nullptr, 10));
 
-            // i.e. if the flag is not boolean, like --Verbose, store value
-            if (i+1 < argc && argv[i+1][0] != '-') { 
+    } else if (key == "replicates") {
+        this->config.replicates =
+            static_cast<int>(std::strtol(value.c_str(), nullptr, 10));
 
-                value = std::string(argv[i+1]);
-                i++;
-            }
+    } else if (key == "progress_interval") {
+        this->config.progress_interval =
+            static_cast<int>(std::strtol(value.c_str(), nullptr, 10));
 
+    } else if (key == "steady_state_tol") {
+        this->config.steady_state_tol = std::strtod(value.c_str(), nullptr);
 
-            try {
+    } else if (key == "parallel") {
+        this->config.parallel = true;
 
-                if (key == "--start" || key == "--stop" || key == "--step") {
+    } else if (key == "analyze") {
+        this->config.analyze = true;
 
-                    char* end = nullptr; // make end point, req' of strtod
+    } else if (key == "autotune") {
+        this->config.autotune = true;
 
-                    double value_d = std::strtod(value.c_str(), &end); 
-                    args[key] = value_d;
+    } else if (key == "stochastic_model") {
+        this->config.stochastic_model = value;
 
-                } else {
-                    args[key] = value;
-                }
+    } else if (key == "deterministic_model") {
+        this->config.deterministic_model = value;
 
-            } catch (...) {
+    } else if (key == "output") {
+        this->config.output = value;
 
-                std::cout << "Key {" << key << "}:" << "value is of type: " << typeid(value).name();
+    } else if (key == "sink") {
+        // repeatable: every occurrence adds one concurrent output sink
+        this->config.sinks.push_back(value);
 
-                args[key] = value;
-            }
-        }
-    }
+    } else if (key == "preload") {
+        this->config.preload = value;
+
+    } else if (key == "perf_output") {
+        this->config.perf_output = value;
+
+    } else if (key == "profile_entities") {
+        this->config.profile_entities = value;
+
+    } else if (key == "daemon") {
+        this->config.daemon_socket = value;
 
-    return args;
+    } else if (key == "manifest") {
+        this->config.manifest = value;
 
+    } else if (key == "reproject") {
+        this->config.reproject = value;
+
+    } else if (key == "observables") {
+        this->config.observables = value;
+
+    } else if (key == "solver_profile") {
+        this->config.solver_profile = value;
+
+    } else {
+        return false;
+    }
+
+    return true;
 }
 
-std::unordered_map<std::string, std::any> ArgParsing::setDefaults() {
+void ArgParsing::loadRunFile(
+    const std::string& path
+) {
+
+    std::ifstream run_file(path);
 
-    // empty map for storing Default values
-    std::unordered_map<std::string, std::any> args_map;
+    if (!run_file) {
+        std::cerr << "Error: cannot open run file: " << path << "\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    std::string line;
+
+    while (std::getline(run_file, line)) {
+
+        // strip comments, then skip blank lines
+        size_t comment = line.find('#');
+
+        if (comment != std::string::npos) {
+            line = line.substr(0, comment);
+        }
+
+        size_t first = line.find_first_not_of(" \t");
+
+        if (first == std::string::npos) {
+            continue;
+        }
 
-    //defaults for current simulator:
-    args_map["--start"] = 0.0;
-    args_map["--stop"] = 60.0;
-    args_map["--step"] = 1.0;
-    args_map["--stochastic_model"] = std::string("../sbml_files/Stochastic.sbml");
-    args_map["--deterministic_model"] = std::string("../sbml_files/Hybrid.sbml");
-    args_map["--output"] = std::string("../src/results.tsv");
+        size_t sep = line.find(':');
 
-    return args_map;
+        if (sep == std::string::npos) {
+            std::cerr << "Bad run-file line (expected 'key: value'): "
+                      << line << "\n";
+            std::exit(EXIT_FAILURE);
+        }
+
+        std::string key = line.substr(first, sep - first);
+        key = key.substr(0, key.find_last_not_of(" \t") + 1);
+
+        std::string value = line.substr(sep + 1);
+
+        size_t value_first = value.find_first_not_of(" \t");
+
+        value = value_first == std::string::npos
+            ? ""
+            : value.substr(
+                value_first, value.find_last_not_of(" \t") - value_first + 1
+            );
+
+        // boolean options accept explicit false in the file form
+        if ((key == "parallel" || key == "analyze" || key == "autotune") &&
+            (value == "false" || value == "0")) {
+            continue;
+        }
+
+        if (key == "modify") {
+            parseDict(value);
+            continue;
+        }
+
+        if (!applyOption(key, value)) {
+            std::cerr << "Unknown run-file option: " << key << "\n";
+            std::exit(EXIT_FAILURE);
+        }
+    }
 }
 
 void ArgParsing::printUsage() {
@@ -122,10 +247,28 @@ void ArgParsing::printUsage() {
             "     --start <Double> {[Optional] Default:0.0}\n"
             "     --stop <Double> {[Optional] Default: 60.0}\n"
             "     --step <Double> {[Optional] Default:1.0}\n"
+            "     --seed <Integer> {[Optional] Default:-1 (entropy-seeded)}\n"
+            "     --parallel {[Optional] step modules on concurrent threads}\n"
+            "     --threads <Integer> {[Optional] Default:0 shared worker pool size (0 = all cores)}\n"
+            "     --replicates <Integer> {[Optional] Default:1 ensemble width; shards output per replicate ({r} in --output names the shard)}\n"
+            "     --analyze {[Optional] print the preflight cost report and exit}\n"
+            "     --autotune {[Optional] time candidate kernels on a model's first run and persist the winners}\n"
+            "     --preload <std::string> {[Optional] comma-separated SBML paths; warm their caches and exit}\n"
+            "     --config <std::string> {[Optional] run file of 'key: value' lines; flags override}\n"
+            "     --perf_output <std::string> {[Optional] JSON per-phase timing report}\n"
+            "     --profile_entities <std::string> {[Optional] ranked per-reaction/CVODES cost report}\n"
+            "     --daemon <std::string> {[Optional] serve simulate requests at this Unix socket}\n"
+            "     --manifest <std::string> {[Optional] run every condition of a benchmarks/* .yml manifest in one launch}\n"
+            "     --reproject <std::string> {[Optional] stream a study archive through --observables definitions; no simulation}\n"
+            "     --observables <std::string> {[Optional] comma-separated observables TSVs for reproject mode}\n"
+            "     --progress_interval <Integer> {[Optional] Default:1 steps between progress lines}\n"
+            "     --steady_state_tol <Double> {[Optional] Default:0.0 early-stop change tolerance}\n"
+            "     --solver_profile <std::string> {[Optional] Default:standard (screening|standard|precise)}\n"
             "     --stochastic_model <std::string> {[Optional] Default:  ../tests/Stochastic.sbml}\n"
             "     --deterministic_model <std::string> {[Optional] Default:  ../tests/Deterministic.sbml}\n"
             "     --modify <SpeciesId || ParameterId || CompartmentId>=<Double> {[Optional]}\n"
-            "     --output <std::string>{[Optional] Default: ../src/results.tsv}\n";
+            "     --output <std::string>{[Optional] Default: ../src/results.tsv}\n"
+            "     --sink <path[,every=N][,species=a+b+c]> {[Optional] repeatable; concurrent output products replacing --output}\n";
 
             std::exit(EXIT_SUCCESS);
 }
@@ -136,7 +279,7 @@ void ArgParsing::parseDict(
 
     size_t start = arg.find('{');
     size_t end = arg.find('}');
-    
+
     if (start == std::string::npos || end == std::string::npos) {
 
         std::cerr << "Bad modifier format, must specify '{ }' to start perturbations list." << "\n";
@@ -163,7 +306,7 @@ void ArgParsing::parseKeyValuePairs(
 ) {
 
     size_t pos = arg.find('=');
-    
+
     if (pos == std::string::npos) {
 
         std::cerr << "Bad modifier format, must specify '<SBMLEntity>=<Double>" << "\n";
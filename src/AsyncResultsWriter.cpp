@@ -0,0 +1,491 @@
+/**
+ * @file AsyncResultsWriter.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for the double-buffered background trajectory writer
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
+// Internal Libraries
+#include "singlecell/AsyncResultsWriter.h"
+#include "singlecell/TraceWriter.h"
+
+//=========================Static Definitions===============================//
+namespace {
+
+    /**
+     * @brief FNV-1a over a byte range; the per-chunk checksum recorded in
+     * the recovery journal beside the stream
+     */
+    uint64_t hashBytes(const unsigned char* bytes, size_t count) {
+
+        uint64_t hash = 1469598103934665603ull;
+
+        for (size_t i = 0; i < count; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+} // namespace
+
+//=============================Class Details================================//
+AsyncResultsWriter::AsyncResultsWriter(
+    const std::string& output,
+    uint64_t num_cols,
+    std::vector<std::string> col_labels,
+    bool delta_compress,
+    std::vector<uint32_t> col_intervals
+) : num_cols(num_cols),
+    delta_compress(delta_compress) {
+
+    // normalize the per-column schedule: pad to the row width, floor at
+    // one, and drop it entirely when uniform — an all-ones schedule is
+    // just SCTRJ001 with extra framing
+    col_intervals.resize(num_cols, 1);
+
+    bool ragged = false;
+
+    for (uint32_t& interval : col_intervals) {
+
+        interval = interval > 0 ? interval : 1;
+
+        ragged = ragged || interval > 1;
+    }
+
+    if (ragged) {
+        this->col_intervals = std::move(col_intervals);
+        this->delta_compress = false;
+    }
+
+    bool parquet_output = output.size() > 8 &&
+        output.compare(output.size() - 8, 8, ".parquet") == 0;
+
+    if (parquet_output) {
+
+        // columnar route: ParquetWriter owns the stream and writes one
+        // row group per flushed chunk. Unlabeled columns still need
+        // schema field names
+        this->delta_compress = false;
+        this->col_intervals.clear();
+
+        std::vector<std::string> names = std::move(col_labels);
+
+        for (size_t i = names.size(); i < num_cols; i++) {
+            names.push_back("col_" + std::to_string(i));
+        }
+
+        this->parquet = std::make_unique<ParquetWriter>(output, names);
+
+        this->active_chunk.reserve(chunk_rows * num_cols);
+        this->flush_chunk.reserve(chunk_rows * num_cols);
+
+        this->io_thread = std::thread(&AsyncResultsWriter::writerLoop, this);
+
+        return;
+    }
+
+    // crash safety: the stream lands at "<output>.partial" with a
+    // sibling journal of per-chunk checksums, and only finalize renames
+    // it into place — so a finished file is always complete and valid,
+    // and singlecell-recover can salvage every intact chunk of a run
+    // that died mid-flight
+    this->final_path = output;
+    this->partial_path = output + ".partial";
+    this->journal_path = output + ".journal";
+
+    this->out.open(this->partial_path, std::ios::binary);
+    this->journal.open(this->journal_path, std::ios::binary);
+
+    // Same header as matrix_utils::save_matrix_binary; rows_written is a
+    // placeholder here and patched in finalize once the run length is
+    // known. SCTRJ002 marks the delta-encoded chunked payload, SCTRJ003
+    // the ragged per-column-interval layout
+    const char* magic = "SCTRJ001";
+
+    if (!this->col_intervals.empty()) {
+        magic = "SCTRJ003";
+    } else if (this->delta_compress) {
+        magic = "SCTRJ002";
+    }
+
+    this->out.write(magic, 8);
+
+    this->out.write(reinterpret_cast<const char*>(&this->rows_written), sizeof(uint64_t));
+    this->out.write(reinterpret_cast<const char*>(&this->num_cols), sizeof(uint64_t));
+
+    std::string joined;
+
+    for (size_t i = 0; i < col_labels.size(); i++) {
+        joined += col_labels[i];
+        if (i + 1 < col_labels.size()) {
+            joined += "\n";
+        }
+    }
+
+    uint64_t block_size = joined.size();
+
+    this->out.write(reinterpret_cast<const char*>(&block_size), sizeof(block_size));
+    this->out.write(joined.data(), block_size);
+
+    // streamed trajectories carry no row labels; empty block keeps the
+    // layout identical for the Python BinaryTrajectory reader
+    uint64_t empty_block = 0;
+    this->out.write(reinterpret_cast<const char*>(&empty_block), sizeof(empty_block));
+
+    // ragged streams carry their schedule in the header, so the reader
+    // reproduces every row's due-column set without side metadata
+    if (!this->col_intervals.empty()) {
+
+        uint64_t interval_count = this->col_intervals.size();
+
+        this->out.write(
+            reinterpret_cast<const char*>(&interval_count),
+            sizeof(interval_count)
+        );
+        this->out.write(
+            reinterpret_cast<const char*>(this->col_intervals.data()),
+            interval_count * sizeof(uint32_t)
+        );
+    }
+
+    this->active_chunk.reserve(chunk_rows * num_cols);
+    this->flush_chunk.reserve(chunk_rows * num_cols);
+
+    if (this->delta_compress) {
+        // the very first row deltas against zeros
+        this->previous_row_bits.assign(num_cols, 0);
+    }
+
+    this->io_thread = std::thread(&AsyncResultsWriter::writerLoop, this);
+}
+
+AsyncResultsWriter::~AsyncResultsWriter() {
+
+    this->finalize();
+}
+
+void AsyncResultsWriter::appendRow(
+    const double* row
+) {
+
+    this->active_chunk.insert(this->active_chunk.end(), row, row + this->num_cols);
+
+    if (this->active_chunk.size() >= chunk_rows * this->num_cols) {
+
+        std::unique_lock<std::mutex> lock(this->swap_mutex);
+
+        // wait for the I/O thread to drain the previous chunk if it is
+        // still behind; this bounds peak RSS at two chunks per module
+        this->chunk_drained.wait(lock, [this] { return !this->flush_pending; });
+
+        std::swap(this->active_chunk, this->flush_chunk);
+        this->active_chunk.clear();
+
+        this->flush_pending = true;
+        this->chunk_ready.notify_one();
+    }
+}
+
+void AsyncResultsWriter::writerLoop() {
+
+    TraceWriter::instance().nameThread("results_writer");
+
+    while (true) {
+
+        std::unique_lock<std::mutex> lock(this->swap_mutex);
+
+        this->chunk_ready.wait(lock, [this] {
+            return this->flush_pending || this->shutting_down;
+        });
+
+        if (!this->flush_pending && this->shutting_down) {
+            break;
+        }
+
+        // write outside the producer's fast path; only the swap is locked
+        lock.unlock();
+
+        TraceWriter::Span span("flush_chunk", "io");
+
+        if (this->parquet) {
+
+            size_t chunk_row_count = this->flush_chunk.size() / this->num_cols;
+
+            for (size_t i = 0; i < chunk_row_count; i++) {
+                this->parquet->appendRow(
+                    this->flush_chunk.data() + i * this->num_cols
+                );
+            }
+
+        } else if (!this->col_intervals.empty()) {
+
+            // ragged frame: row count, packed byte count, then only the
+            // columns due at each row; framing matches SCTRJ002 so the
+            // journal and recovery path treat both formats identically
+            uint64_t chunk_row_count = this->flush_chunk.size() / this->num_cols;
+
+            this->packRaggedChunk(static_cast<size_t>(chunk_row_count));
+
+            uint64_t packed_bytes = this->encode_buffer.size();
+
+            this->out.write(
+                reinterpret_cast<const char*>(&chunk_row_count),
+                sizeof(chunk_row_count)
+            );
+            this->out.write(
+                reinterpret_cast<const char*>(&packed_bytes),
+                sizeof(packed_bytes)
+            );
+            this->out.write(
+                reinterpret_cast<const char*>(this->encode_buffer.data()),
+                packed_bytes
+            );
+
+            this->appendJournalEntry(
+                chunk_row_count,
+                this->encode_buffer.data(),
+                packed_bytes
+            );
+
+        } else if (this->delta_compress) {
+
+            // chunk frame: row count, encoded byte count, then the packed
+            // payload; the reader walks frames until the header row count
+            // is consumed
+            uint64_t chunk_row_count = this->flush_chunk.size() / this->num_cols;
+
+            this->encodeChunk();
+
+            uint64_t encoded_bytes = this->encode_buffer.size();
+
+            this->out.write(
+                reinterpret_cast<const char*>(&chunk_row_count),
+                sizeof(chunk_row_count)
+            );
+            this->out.write(
+                reinterpret_cast<const char*>(&encoded_bytes),
+                sizeof(encoded_bytes)
+            );
+            this->out.write(
+                reinterpret_cast<const char*>(this->encode_buffer.data()),
+                encoded_bytes
+            );
+
+            this->appendJournalEntry(
+                chunk_row_count,
+                this->encode_buffer.data(),
+                encoded_bytes
+            );
+
+        } else {
+
+            this->out.write(
+                reinterpret_cast<const char*>(this->flush_chunk.data()),
+                this->flush_chunk.size() * sizeof(double)
+            );
+
+            this->appendJournalEntry(
+                this->flush_chunk.size() / this->num_cols,
+                reinterpret_cast<const unsigned char*>(this->flush_chunk.data()),
+                this->flush_chunk.size() * sizeof(double)
+            );
+        }
+
+        this->rows_written += this->flush_chunk.size() / this->num_cols;
+
+        lock.lock();
+
+        this->flush_chunk.clear();
+        this->flush_pending = false;
+        this->chunk_drained.notify_one();
+    }
+}
+
+void AsyncResultsWriter::appendJournalEntry(
+    uint64_t chunk_row_count,
+    const unsigned char* payload,
+    size_t payload_bytes
+) {
+
+    // entry: row count, payload byte count, FNV-1a of the payload. The
+    // stream flushes first so the journal never describes bytes that
+    // are not at least handed to the kernel; a killed process loses at
+    // most the chunk that was still in user-space buffers
+    this->out.flush();
+
+    uint64_t checksum = hashBytes(payload, payload_bytes);
+    uint64_t byte_count = payload_bytes;
+
+    this->journal.write(
+        reinterpret_cast<const char*>(&chunk_row_count), sizeof(chunk_row_count)
+    );
+    this->journal.write(
+        reinterpret_cast<const char*>(&byte_count), sizeof(byte_count)
+    );
+    this->journal.write(
+        reinterpret_cast<const char*>(&checksum), sizeof(checksum)
+    );
+
+    this->journal.flush();
+}
+
+void AsyncResultsWriter::packRaggedChunk(
+    size_t chunk_row_count
+) {
+
+    this->encode_buffer.clear();
+
+    for (size_t i = 0; i < chunk_row_count; i++) {
+
+        // global row index: rows_written only counts chunks already
+        // flushed, and this thread is the one that advances it
+        uint64_t row_index = this->rows_written + i;
+
+        const double* row = this->flush_chunk.data() + i * this->num_cols;
+
+        for (size_t j = 0; j < this->num_cols; j++) {
+
+            if (row_index % this->col_intervals[j] != 0) {
+                continue;
+            }
+
+            const unsigned char* bytes =
+                reinterpret_cast<const unsigned char*>(row + j);
+
+            this->encode_buffer.insert(
+                this->encode_buffer.end(), bytes, bytes + sizeof(double)
+            );
+        }
+    }
+}
+
+void AsyncResultsWriter::encodeChunk() {
+
+    size_t num_values = this->flush_chunk.size();
+
+    // Pass 1: XOR each value's bit pattern against the same column of the
+    // previous row. Species unchanged since the last step delta to all-zero
+    // bytes, which is the common case for fine-grained stochastic output
+    uint64_t* bits = reinterpret_cast<uint64_t*>(this->flush_chunk.data());
+
+    for (size_t i = 0; i < num_values; i++) {
+
+        uint64_t current = bits[i];
+
+        bits[i] = current ^ this->previous_row_bits[i % this->num_cols];
+        this->previous_row_bits[i % this->num_cols] = current;
+    }
+
+    // Pass 2: pack the delta bytes as alternating tokens of
+    // [uint16 zero_run][uint16 literal_run][literal bytes], runs capped at
+    // 65535 and continued by follow-on tokens
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(bits);
+    size_t total_bytes = num_values * sizeof(uint64_t);
+
+    this->encode_buffer.clear();
+
+    size_t pos = 0;
+
+    while (pos < total_bytes) {
+
+        size_t zero_run = 0;
+
+        while (pos + zero_run < total_bytes &&
+               bytes[pos + zero_run] == 0 &&
+               zero_run < 65535) {
+            zero_run++;
+        }
+
+        pos += zero_run;
+
+        size_t literal_run = 0;
+
+        while (pos + literal_run < total_bytes &&
+               bytes[pos + literal_run] != 0 &&
+               literal_run < 65535) {
+            literal_run++;
+        }
+
+        uint16_t zero_token = static_cast<uint16_t>(zero_run);
+        uint16_t literal_token = static_cast<uint16_t>(literal_run);
+
+        this->encode_buffer.insert(
+            this->encode_buffer.end(),
+            reinterpret_cast<const unsigned char*>(&zero_token),
+            reinterpret_cast<const unsigned char*>(&zero_token) + sizeof(zero_token)
+        );
+        this->encode_buffer.insert(
+            this->encode_buffer.end(),
+            reinterpret_cast<const unsigned char*>(&literal_token),
+            reinterpret_cast<const unsigned char*>(&literal_token) + sizeof(literal_token)
+        );
+        this->encode_buffer.insert(
+            this->encode_buffer.end(),
+            bytes + pos,
+            bytes + pos + literal_run
+        );
+
+        pos += literal_run;
+    }
+}
+
+void AsyncResultsWriter::finalize() {
+
+    if (this->finalized) {
+        return;
+    }
+
+    this->finalized = true;
+
+    {
+        std::unique_lock<std::mutex> lock(this->swap_mutex);
+
+        // push any partial chunk through the regular flush path
+        this->chunk_drained.wait(lock, [this] { return !this->flush_pending; });
+
+        if (!this->active_chunk.empty()) {
+
+            std::swap(this->active_chunk, this->flush_chunk);
+            this->active_chunk.clear();
+            this->flush_pending = true;
+        }
+
+        this->shutting_down = true;
+        this->chunk_ready.notify_one();
+    }
+
+    this->io_thread.join();
+
+    if (this->parquet) {
+
+        // footer written once all row groups are on disk
+        this->parquet->finalize();
+
+        return;
+    }
+
+    // patch the row-count placeholder now that the run length is known
+    this->out.seekp(8, std::ios::beg);
+    this->out.write(reinterpret_cast<const char*>(&this->rows_written), sizeof(uint64_t));
+
+    this->out.close();
+
+    // atomic finalization: the journal goes first, then the rename
+    // publishes the complete stream under its final name in one step
+    this->journal.close();
+
+    std::remove(this->journal_path.c_str());
+    std::rename(this->partial_path.c_str(), this->final_path.c_str());
+}
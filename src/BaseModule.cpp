@@ -9,19 +9,60 @@
 
 //===========================Library Import=================================//
 //Std Libraries
+#include <map>
+#include <tuple>
+#include <mutex>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <memory>
+#include <limits>
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
 #include <unordered_set>
 
+// System Libraries (results backing store)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
 
 // Internal Libraries
 #include "singlecell/BaseModule.h"
+#include "singlecell/Logger.h"
+#include "singlecell/TraceWriter.h"
+#include "singlecell/AllocationGuard.h"
+#include "singlecell/ModelData.h"
 #include "singlecell/SBMLHandler.h"
+#include "singlecell/SymbolTable.h"
 //=============================Class Details================================//
 BaseModule::BaseModule(
     SBMLHandler Module
-) : handler(Module) {}
+) : handler(Module), model_data(Module.data) {}
+
+BaseModule::~BaseModule() {
+
+    this->stopRecorder();
+    this->releaseResultsMapping();
+}
+
+void BaseModule::releaseResultsMapping() {
+
+    if (this->mmap_base != nullptr) {
+
+        munmap(this->mmap_base, this->mmap_bytes);
+
+        this->mmap_base = nullptr;
+        this->mmap_bytes = 0;
+    }
+
+    if (this->mmap_fd >= 0) {
+
+        close(this->mmap_fd);
+        this->mmap_fd = -1;
+    }
+}
 
 std::vector<double> BaseModule::setTimeSteps(double start, double stop, double step) {
      // Initialized array to be returned:
@@ -37,47 +78,870 @@ std::vector<double> BaseModule::setTimeSteps(double start, double stop, double s
     return timepoints;
 }
 
-std::vector<std::vector<double>> BaseModule::createResultsMatrix(
+std::shared_ptr<const std::vector<double>> BaseModule::sharedTimeSteps(
+    double start,
+    double stop,
+    double step
+) {
+
+    // process-wide grid cache, like the ModelData cache: every module
+    // and session simulating the same window shares one immutable grid
+    static std::mutex grid_mutex;
+    static std::map<std::tuple<double, double, double>,
+                    std::shared_ptr<const std::vector<double>>> grids;
+
+    std::lock_guard<std::mutex> lock(grid_mutex);
+
+    auto key = std::make_tuple(start, stop, step);
+
+    auto cached = grids.find(key);
+
+    if (cached != grids.end()) {
+        return cached->second;
+    }
+
+    auto grid = std::make_shared<const std::vector<double>>(
+        BaseModule::setTimeSteps(start, stop, step)
+    );
+
+    grids.emplace(std::move(key), grid);
+
+    return grid;
+}
+
+void BaseModule::bindExternalResults(
+    double* base,
+    int row_stride
+) {
+
+    this->releaseResultsMapping();
+
+    this->results_buffer.clear();
+    this->results_buffer.shrink_to_fit();
+
+    this->results_data = base;
+    this->results_row_stride = row_stride;
+    this->external_results = true;
+}
+
+void BaseModule::createResultsMatrix(
     int numSpecies,
     int numTimeSteps
 ) {
 
-    std::vector<std::vector<double>> results_matrix(numTimeSteps, std::vector<double>(numSpecies));
+    // a reconfigure must not race rows still inside the recorder stage
+    this->drainRecorder();
+
+    // thinning records only every record_interval-th step
+    int recorded_steps = (numTimeSteps + this->record_interval - 1) / this->record_interval;
+
+    // rolling-window mode bounds the buffer at the trailing window;
+    // recordStage wraps its row index to match
+    if (this->results_window > 0 && recorded_steps > this->results_window) {
+        recorded_steps = this->results_window;
+    }
+
+    // a fresh matrix starts a fresh summary series
+    this->summary_count = 0;
+    this->summary_min_rows.clear();
+    this->summary_max_rows.clear();
+    this->summary_mean_rows.clear();
+    this->summary_var_rows.clear();
+
+    // masking records only the selected species columns
+    this->results_stride = this->record_mask.empty()
+        ? numSpecies
+        : static_cast<int>(this->record_mask.size());
+
+    // externally bound storage was allocated (and zeroed) by the caller;
+    // only the row geometry above needed refreshing
+    if (this->external_results) {
+        return;
+    }
+
+    this->results_row_stride = this->results_stride;
+
+    size_t total_doubles =
+        static_cast<size_t>(recorded_steps) * this->results_stride;
+
+    // a previous session may have left a mapping live
+    this->releaseResultsMapping();
+
+    if (this->mmap_backing_path.empty()) {
+
+        // Single contiguous allocation; rows are recorded timesteps
+        this->results_buffer.assign(total_doubles, 0.0);
+
+        this->results_data = this->results_buffer.data();
 
-    return results_matrix;
+        if (this->perf != nullptr) {
+            this->perf->addBytes(
+                "module_results_bytes", total_doubles * sizeof(double)
+            );
+        }
+
+        return;
+    }
+
+    // backing-store mode: the matrix lives in a file mapping, so runs
+    // larger than RAM record sequentially and the OS evicts cold rows
+    size_t total_bytes = total_doubles * sizeof(double);
+
+    this->mmap_fd = open(
+        this->mmap_backing_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644
+    );
+
+    if (this->mmap_fd < 0 ||
+        ftruncate(this->mmap_fd, static_cast<off_t>(total_bytes)) != 0) {
+
+        throw std::runtime_error(
+            "Could not create results backing store: " + this->mmap_backing_path
+        );
+    }
+
+    this->mmap_base = mmap(
+        nullptr, total_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+        this->mmap_fd, 0
+    );
+
+    if (this->mmap_base == MAP_FAILED) {
+
+        this->mmap_base = nullptr;
 
+        throw std::runtime_error(
+            "Could not map results backing store: " + this->mmap_backing_path
+        );
+    }
+
+    this->mmap_bytes = total_bytes;
+
+    if (this->perf != nullptr) {
+        this->perf->addBytes("backing_store_bytes", total_bytes);
+    }
+
+    // recording walks the rows front to back exactly once
+    madvise(this->mmap_base, total_bytes, MADV_SEQUENTIAL);
+
+    this->results_buffer.clear();
+    this->results_buffer.shrink_to_fit();
+
+    this->results_data = static_cast<double*>(this->mmap_base);
+}
+
+void BaseModule::growResultsMatrix(
+    int numTimeSteps
+) {
+
+    // externally bound storage is grown and rebound by its owner
+    if (this->external_results) {
+        return;
+    }
+
+    int recorded_steps =
+        (numTimeSteps + this->record_interval - 1) / this->record_interval;
+
+    size_t total_doubles =
+        static_cast<size_t>(recorded_steps) * this->results_stride;
+
+    if (this->mmap_base == nullptr) {
+
+        // resize keeps the recorded rows and zeroes the extension
+        this->results_buffer.resize(total_doubles, 0.0);
+
+        this->results_data = this->results_buffer.data();
+
+        return;
+    }
+
+    // backing-store mode: the recorded rows live in the file, so growing
+    // is a flush, a truncate to the new length and a fresh mapping
+    size_t total_bytes = total_doubles * sizeof(double);
+
+    msync(this->mmap_base, this->mmap_bytes, MS_SYNC);
+    munmap(this->mmap_base, this->mmap_bytes);
+
+    this->mmap_base = nullptr;
+
+    if (ftruncate(this->mmap_fd, static_cast<off_t>(total_bytes)) != 0) {
+
+        throw std::runtime_error(
+            "Could not grow results backing store: " + this->mmap_backing_path
+        );
+    }
+
+    this->mmap_base = mmap(
+        nullptr, total_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+        this->mmap_fd, 0
+    );
+
+    if (this->mmap_base == MAP_FAILED) {
+
+        this->mmap_base = nullptr;
+
+        throw std::runtime_error(
+            "Could not remap results backing store: " + this->mmap_backing_path
+        );
+    }
+
+    this->mmap_bytes = total_bytes;
+
+    // the extension records front to back like the original run
+    madvise(this->mmap_base, total_bytes, MADV_SEQUENTIAL);
+
+    this->results_data = static_cast<double*>(this->mmap_base);
 }
 
 void BaseModule::recordStepResult(
     const std::vector<double>& state_vector,
     int timepoint
 ) {
-    this->results_matrix[timepoint] = state_vector;
 
+    // stepping always reads the full, unthinned state from here
+    this->current_state = state_vector;
+
+    this->recordCurrentState(timepoint);
+}
+
+void BaseModule::recordStepResultScaled(
+    const double* state,
+    const double* scale_factors,
+    size_t count,
+    int timepoint
+) {
+
+    // fused multiply straight into the inter-step carrier; current_state
+    // holds recorded units because the exchange publish and the document
+    // sync read it
+    this->current_state.resize(count);
+
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (size_t i = 0; i < count; i++) {
+        this->current_state[i] = state[i] * scale_factors[i];
+    }
+
+    this->recordCurrentState(timepoint);
+}
+
+void BaseModule::recordCurrentState(
+    int timepoint
+) {
+    alloc_guard::PhaseScope alloc_phase("recording");
+
+    if (!this->pipelined_recording) {
+
+        this->recordStage(this->current_state, timepoint);
+
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(this->record_mutex);
+
+    if (!this->recorder_thread.joinable()) {
+
+        this->recorder_shutdown = false;
+        this->recorder_thread = std::thread(&BaseModule::recorderLoop, this);
+    }
+
+    // one-slot backpressure: wait out a recorder still behind, then
+    // publish a copy — stepping keeps ownership of current_state
+    this->record_drained.wait(lock, [this] { return !this->record_pending; });
+
+    this->pending_record.assign(
+        this->current_state.begin(), this->current_state.end()
+    );
+    this->pending_timepoint = timepoint;
+    this->record_pending = true;
+
+    lock.unlock();
+    this->record_ready.notify_one();
+}
+
+void BaseModule::recordStage(
+    const std::vector<double>& state,
+    int timepoint
+) {
+
+    // envelope summaries accumulate at full step rate, ahead of the
+    // thinning below, so extremes on unrecorded steps still reach the
+    // window
+    if (this->summary_window > 0) {
+
+        size_t width = this->record_mask.empty()
+            ? state.size()
+            : this->record_mask.size();
+
+        bool open_window = this->summary_count > 0;
+
+        if (!open_window && this->summary_min.size() != width) {
+
+            this->summary_min.resize(width);
+            this->summary_max.resize(width);
+            this->summary_sum.resize(width);
+            this->summary_sumsq.resize(width);
+        }
+
+        for (size_t i = 0; i < width; i++) {
+
+            double value = this->record_mask.empty()
+                ? state[i]
+                : state[this->record_mask[i]];
+
+            if (!open_window) {
+
+                this->summary_min[i] = value;
+                this->summary_max[i] = value;
+                this->summary_sum[i] = value;
+                this->summary_sumsq[i] = value * value;
+
+            } else {
+
+                if (value < this->summary_min[i]) {
+                    this->summary_min[i] = value;
+                }
+
+                if (value > this->summary_max[i]) {
+                    this->summary_max[i] = value;
+                }
+
+                this->summary_sum[i] += value;
+                this->summary_sumsq[i] += value * value;
+            }
+        }
+
+        this->summary_count++;
+
+        if (this->summary_count == this->summary_window) {
+            this->flushSummaryWindow();
+        }
+    }
+
+    if (timepoint % this->record_interval != 0) {
+        return;
+    }
+
+    size_t recorded_row = static_cast<size_t>(timepoint / this->record_interval);
+
+    // rolling-window mode overwrites the oldest retained row; the
+    // stream writer below has already archived every prior row
+    if (this->results_window > 0) {
+        recorded_row %= static_cast<size_t>(this->results_window);
+    }
+
+    size_t row_offset = recorded_row * this->results_row_stride;
+
+    if (this->record_mask.empty()) {
+
+        std::copy(
+            state.begin(),
+            state.end(),
+            this->results_data + row_offset
+        );
+
+    } else {
+
+        for (size_t i = 0; i < this->record_mask.size(); i++) {
+
+            this->results_data[row_offset + i] =
+                state[this->record_mask[i]];
+        }
+    }
+
+    // optional mantissa truncation: downstream analysis rarely needs
+    // more than ~7 significant digits, and the zeroed low bits collapse
+    // into zero runs under the delta compressor
+    if (this->record_mantissa_mask != ~0ull) {
+
+        size_t row_width = this->record_mask.empty()
+            ? state.size()
+            : this->record_mask.size();
+
+        double* row = this->results_data + row_offset;
+
+        for (size_t i = 0; i < row_width; i++) {
+
+            uint64_t bits;
+
+            std::memcpy(&bits, &row[i], sizeof(bits));
+
+            bits &= this->record_mantissa_mask;
+
+            std::memcpy(&row[i], &bits, sizeof(bits));
+        }
+    }
+
+    if (this->stream_writer != nullptr) {
+
+        this->stream_writer->appendRow(this->results_data + row_offset);
+    }
+
+    // backing-store mode: periodically flush and drop the pages behind
+    // the write head so a larger-than-RAM run never grows resident
+    if (this->mmap_base != nullptr) {
+
+        const size_t drop_rows = 1024;
+        size_t row = recorded_row;
+
+        if (row > 0 && row % drop_rows == 0) {
+
+            size_t done_bytes = row * this->results_row_stride * sizeof(double);
+            size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            done_bytes -= done_bytes % page;
+
+            if (done_bytes > 0) {
+                msync(this->mmap_base, done_bytes, MS_ASYNC);
+                madvise(this->mmap_base, done_bytes, MADV_DONTNEED);
+            }
+        }
+    }
+
+}
+
+void BaseModule::setPipelinedRecording(
+    bool enable
+) {
+
+    if (!enable) {
+        this->stopRecorder();
+    }
+
+    this->pipelined_recording = enable;
+}
+
+void BaseModule::recorderLoop() {
+
+    TraceWriter::instance().nameThread(
+        "recorder:" + this->getModuleId()
+    );
+
+    std::unique_lock<std::mutex> lock(this->record_mutex);
+
+    while (true) {
+
+        this->record_ready.wait(lock, [this] {
+            return this->record_pending || this->recorder_shutdown;
+        });
+
+        if (!this->record_pending) {
+            return;
+        }
+
+        // swap the pending slot out under the lock; the stage itself
+        // runs unlocked so the step thread can publish the next state
+        std::swap(this->record_stage_state, this->pending_record);
+        int timepoint = this->pending_timepoint;
+        this->record_pending = false;
+        this->record_stage_active = true;
+
+        lock.unlock();
+        this->record_drained.notify_all();
+
+        {
+            TraceWriter::Span span("record_stage", "io");
+            this->recordStage(this->record_stage_state, timepoint);
+        }
+
+        lock.lock();
+        this->record_stage_active = false;
+        this->record_drained.notify_all();
+    }
+}
+
+void BaseModule::drainRecorder() {
+
+    if (!this->recorder_thread.joinable()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(this->record_mutex);
+
+    this->record_drained.wait(lock, [this] {
+        return !this->record_pending && !this->record_stage_active;
+    });
+}
+
+void BaseModule::adoptState(
+    const std::vector<double>& state,
+    int timepoint
+) {
+
+    // recordStepResult already does both halves of an adoption: the
+    // current_state overwrite every stepper reads from, and the
+    // results-row record filtered through the usual thinning
+    this->recordStepResult(state, timepoint);
+}
+
+void BaseModule::stopRecorder() {
+
+    this->pipelined_recording = false;
+
+    if (!this->recorder_thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->record_mutex);
+        this->recorder_shutdown = true;
+    }
+
+    this->record_ready.notify_one();
+    this->recorder_thread.join();
+
+    this->recorder_shutdown = false;
+}
+
+void BaseModule::setRecordingOptions(
+    int interval,
+    const std::vector<std::string>& species_subset
+) {
+
+    this->record_interval = (interval > 1) ? interval : 1;
+
+    this->record_mask.clear();
+
+    if (species_subset.empty()) {
+        return;
+    }
+
+    std::unordered_set<std::string> lookup(species_subset.begin(), species_subset.end());
+
+    // keep model order; identifiers absent from this module are ignored
+    std::vector<std::string> speciesIds = this->handler.getSpeciesIds();
+
+    for (size_t i = 0; i < speciesIds.size(); i++) {
+
+        if (lookup.count(speciesIds[i])) {
+
+            this->record_mask.push_back(static_cast<int>(i));
+        }
+    }
+}
+
+void BaseModule::setResultsWindow(
+    int recorded_rows
+) {
+
+    this->results_window = (recorded_rows > 0) ? recorded_rows : 0;
+}
+
+void BaseModule::setRecordingPrecisionBits(
+    int mantissa_bits
+) {
+
+    if (mantissa_bits >= 52 || mantissa_bits < 1) {
+
+        this->record_mantissa_mask = ~0ull;
+
+        return;
+    }
+
+    // keep sign, exponent and the top mantissa_bits mantissa bits
+    this->record_mantissa_mask = ~0ull << (52 - mantissa_bits);
+}
+
+void BaseModule::setSummaryRecording(
+    int window_steps
+) {
+
+    this->summary_window = window_steps > 0 ? window_steps : 0;
+
+    this->summary_count = 0;
+
+    this->summary_min.clear();
+    this->summary_max.clear();
+    this->summary_sum.clear();
+    this->summary_sumsq.clear();
+
+    this->summary_min_rows.clear();
+    this->summary_max_rows.clear();
+    this->summary_mean_rows.clear();
+    this->summary_var_rows.clear();
+}
+
+void BaseModule::flushSummaryWindow() {
+
+    if (this->summary_count == 0) {
+        return;
+    }
+
+    double n = static_cast<double>(this->summary_count);
+
+    for (size_t i = 0; i < this->summary_min.size(); i++) {
+
+        double mean = this->summary_sum[i] / n;
+
+        this->summary_min_rows.push_back(this->summary_min[i]);
+        this->summary_max_rows.push_back(this->summary_max[i]);
+        this->summary_mean_rows.push_back(mean);
+
+        // population variance from the running moments; clamped since
+        // the subtraction can go fractionally negative in fp
+        double variance = this->summary_sumsq[i] / n - mean * mean;
+
+        this->summary_var_rows.push_back(variance > 0.0 ? variance : 0.0);
+    }
+
+    this->summary_count = 0;
+}
+
+std::vector<std::string> BaseModule::getRecordedSpeciesIds() {
+
+    std::vector<std::string> speciesIds = this->handler.getSpeciesIds();
+
+    if (this->record_mask.empty()) {
+        return speciesIds;
+    }
+
+    std::vector<std::string> recorded_ids;
+    recorded_ids.reserve(this->record_mask.size());
+
+    for (const auto& index : this->record_mask) {
+
+        recorded_ids.push_back(speciesIds[index]);
+    }
+
+    return recorded_ids;
+}
+
+const std::vector<double>& BaseModule::getLastStepResult(
+    int timepoint
+) const {
+
+    // current_state always holds the full previous-step state, even when
+    // the results buffer is thinned or masked
+    return this->current_state;
+}
+
+void BaseModule::backfillResults(
+    int from_step,
+    int num_steps
+) {
+
+    // the system is at equilibrium, so the final state is the correct
+    // value for every remaining grid point
+    for (int t = from_step; t < num_steps; t++) {
+        this->recordStepResult(this->current_state, t);
+    }
+}
+
+const double* BaseModule::getResultsRow(
+    int timepoint
+) const {
+
+    size_t row = static_cast<size_t>(timepoint);
+
+    // rolling-window buffers wrap; runGlobal rotates the retained rows
+    // chronological once the run completes, after which indices in the
+    // window read straight through this identity
+    if (this->results_window > 0) {
+        row %= static_cast<size_t>(this->results_window);
+    }
+
+    return this->results_data + row * this->results_row_stride;
+
+}
+
+void BaseModule::publishExchanges() {
+
+    for (const auto& [species_idx, slot] : this->exchange_slots_out) {
+
+        slot->store(
+            this->current_state[species_idx], std::memory_order_release
+        );
+    }
+}
+
+double BaseModule::readExchangedValue(
+    size_t i
+) const {
+
+    if (i < this->exchange_slots_in.size() &&
+        this->exchange_slots_in[i] != nullptr) {
+
+        return this->exchange_slots_in[i]->load(std::memory_order_acquire);
+    }
+
+    return this->exchange_pairs[i].source->getInitialConcentration();
+}
+
+void BaseModule::syncExchangedParameters() {
+
+    for (size_t i = 0; i < this->exchange_pairs.size(); i++) {
+
+        double value = i < this->last_exchanged_values.size()
+            ? this->last_exchanged_values[i]
+            : std::numeric_limits<double>::quiet_NaN();
+
+        // NaN marks a pair that never exchanged; leave its document value
+        if (value == value) {
+            this->exchange_pairs[i].parameter->setValue(value);
+        }
+    }
+}
+
+void BaseModule::syncStateToDocument() {
+
+    // stepping never mirrors species into libSBML; one write here keeps
+    // post-run document reads — and the continuation semantics of a
+    // repeat simulate call — identical to the per-step mirroring era
+    if (!this->current_state.empty()) {
+        this->handler.setState(this->current_state);
+    }
+
+#ifndef NDEBUG
+    // consistency check for the single-authoritative-buffer invariant:
+    // current_state owns the engine state, and the handler registry and
+    // libSBML document are write-through mirrors updated only here. Any
+    // path that still writes one copy without the others shows up as a
+    // divergence at this balance point
+    const std::vector<double>& registry = this->handler.getInitialState();
+
+    for (size_t i = 0;
+         i < this->current_state.size() && i < registry.size(); i++) {
+
+        double document = this->sbml
+            ->getSpecies(static_cast<unsigned int>(i))
+            ->getInitialConcentration();
+
+        if (registry[i] != this->current_state[i] ||
+            document != this->current_state[i]) {
+
+            SC_LOG_WARN("state bookkeeping diverged at species index " << i
+                << ": engine " << this->current_state[i]
+                << ", registry " << registry[i]
+                << ", document " << document);
+            break;
+        }
+    }
+#endif
+}
+
+void BaseModule::bindParameterOverrides(
+    const std::vector<std::string>& parameter_ids
+) {
+
+    this->override_parameters.clear();
+    this->override_parameters.reserve(parameter_ids.size());
+
+    for (const std::string& id : parameter_ids) {
+
+        // unknown ids bind to nothing: multi-module sessions legitimately
+        // override parameters that live in only one of the documents
+        this->override_parameters.push_back(this->sbml->getParameter(id));
+    }
+}
+
+void BaseModule::applyParameterOverrides(
+    const std::vector<double>& values
+) {
+
+    size_t count = std::min(values.size(), this->override_parameters.size());
+
+    for (size_t i = 0; i < count; i++) {
+
+        if (this->override_parameters[i] != nullptr) {
+            this->override_parameters[i]->setValue(values[i]);
+        }
+    }
+}
+
+void BaseModule::applyCompartmentVolume(
+    const std::string& compartment_id,
+    double volume
+) {
+
+    // keep the module's own registry mirror current; the document copy
+    // was already written through by the handler-level entity set.
+    // Derived engines extend this with their compiled-slot updates
+    size_t numSpecies = this->handler.getSpeciesIds().size();
+
+    for (size_t i = 0; i < numSpecies; i++) {
+
+        if (this->handler.model->getSpecies(i)->getCompartment()
+                == compartment_id) {
+
+            this->handler.species_volumes[i] = volume;
+        }
+    }
 }
 
 void BaseModule::findOverlappingIds(
     const Model* alternate_model
 ) {
 
-    std::vector<std::string> alt_species_ids;
+    // A declared exchange view replaces the pairwise full-model scan:
+    // only the view's boundary ids are probed against either side, so
+    // resolution cost per module pair is the view size, not the model
+    // size. Ids the pair does not share are simply skipped - a view is
+    // declared once for the whole coupling, not per pair
+    if (!this->exchange_view.empty()) {
 
-    int numSpecies = alternate_model->getNumSpecies();
+        for (const auto& id : this->exchange_view) {
 
-    for (int i = 0; i < numSpecies; i++) {
+            Parameter* parameter = this->sbml->getParameter(id);
+            const Species* source = alternate_model->getSpecies(id);
 
-        const Species* species = alternate_model->getSpecies(i);
+            if (parameter == nullptr || source == nullptr) {
+                continue;
+            }
 
-        alt_species_ids.push_back(species->getId());
+            this->overlapping_params.push_back(id);
+            this->overlapping_symbols.push_back(SymbolTable::intern(id));
+            this->exchange_pairs.push_back({ parameter, source });
+
+            // NaN sentinel: the first exchange always writes through
+            this->last_exchanged_values.push_back(
+                std::numeric_limits<double>::quiet_NaN()
+            );
+        }
+
+        return;
     }
 
-    std::vector<std::string> param_ids = handler.getParameterIds();
+    // The pairwise scan over full entity lists is replaced by the model
+    // memo: each side keeps a symbol-sorted ID view, the intersection is
+    // one linear merge, and the merge result is cached per model pairing
+    // — so population-scale startups resolve each pairing once, however
+    // many module pairs instantiate it
+    const ModelData* target_data = nullptr;
 
-    std::unordered_set<std::string> lookup(alt_species_ids.begin(), alt_species_ids.end());
+    for (const auto& target : this->targets) {
 
-    for (const auto& id : param_ids) {
-        if (lookup.count(id)) {
-            this->overlapping_params.push_back(id);
+        if (target->sbml == alternate_model) {
+            target_data = target->model_data.get();
+            break;
         }
     }
+
+    if (this->model_data == nullptr || target_data == nullptr) {
+        SC_LOG_WARN("Overlap resolution skipped: module "
+            << this->getModuleId() << " is missing its model data.");
+        return;
+    }
+
+    std::shared_ptr<const std::vector<std::string>> shared_ids =
+        ModelData::overlapIds(*this->model_data, *target_data);
+
+    for (const auto& id : *shared_ids) {
+
+        Parameter* parameter = this->sbml->getParameter(id);
+        const Species* source = alternate_model->getSpecies(id);
+
+        // resolve once; a broken pair is dropped here instead of
+        // warned about on every timestep
+        if (parameter == nullptr || source == nullptr) {
+            SC_LOG_WARN("Skipping unresolvable exchange id '" << id << "'.");
+            continue;
+        }
+
+        this->overlapping_params.push_back(id);
+        this->overlapping_symbols.push_back(SymbolTable::intern(id));
+        this->exchange_pairs.push_back({ parameter, source });
+
+        // NaN sentinel: the first exchange always writes through
+        this->last_exchanged_values.push_back(
+            std::numeric_limits<double>::quiet_NaN()
+        );
+    }
 }
@@ -0,0 +1,1022 @@
+/**
+ * @file CellPopulation.cpp
+ *
+ * @brief Runs N-cell populations across a worker-thread pool in one process
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ */
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <mutex>
+#include <limits>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+#include <condition_variable>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Internal Libraries
+#include "singlecell/SingleCell.h"
+#include "singlecell/P2Quantile.h"
+#include "singlecell/TaskScheduler.h"
+#include "singlecell/CellPopulation.h"
+
+//=========================NUMA placement helpers===========================//
+namespace {
+
+/**
+ * @brief reads the machine's NUMA topology from sysfs: one CPU list per
+ * node. Returns empty when the information is unavailable or only one
+ * node exists, in which case pinning is pointless
+ */
+std::vector<std::vector<int>> readNumaCpuSets() {
+
+    std::vector<std::vector<int>> nodes;
+
+#ifdef __linux__
+    for (int node = 0; ; node++) {
+
+        std::ifstream cpulist(
+            "/sys/devices/system/node/node" + std::to_string(node)
+            + "/cpulist"
+        );
+
+        if (!cpulist.is_open()) {
+            break;
+        }
+
+        // cpulist entries look like "0-15,32-47"
+        std::vector<int> cpus;
+        std::string range;
+
+        while (std::getline(cpulist, range, ',')) {
+
+            size_t dash = range.find('-');
+
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash != std::string::npos
+                ? std::stoi(range.substr(dash + 1))
+                : first;
+
+            for (int cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+        }
+
+        if (!cpus.empty()) {
+            nodes.push_back(std::move(cpus));
+        }
+    }
+#endif
+
+    return nodes.size() > 1 ? nodes : std::vector<std::vector<int>>{};
+}
+
+/**
+ * @brief pins the calling thread to one node's CPU set, so everything
+ * it first-touches afterwards — the resident session's model data, the
+ * per-cell state, the results it fills — allocates node-locally
+ */
+void pinToCpuSet(
+    const std::vector<int>& cpus
+) {
+
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpus;
+#endif
+}
+
+/**
+ * @brief reusable generation barrier for the lockstep stepping mode:
+ * every worker arrives once per global step and the last arrival wakes
+ * the rest, so step s of all cells completes before step s+1 of any
+ */
+class StepBarrier {
+    public:
+        explicit StepBarrier(int parties) : parties(parties) {}
+
+        void arriveAndWait() {
+
+            std::unique_lock<std::mutex> lock(this->gate);
+
+            uint64_t arrival_generation = this->generation;
+
+            if (++this->waiting == this->parties) {
+
+                this->waiting = 0;
+                this->generation++;
+                this->wakeup.notify_all();
+                return;
+            }
+
+            this->wakeup.wait(lock, [&] {
+                return this->generation != arrival_generation;
+            });
+        }
+
+    private:
+        std::mutex gate;
+        std::condition_variable wakeup;
+        int parties;
+        int waiting = 0;
+        uint64_t generation = 0;
+};
+
+}
+
+//=============================Class Details================================//
+CellPopulation::CellPopulation(
+    std::vector<std::string> sbml_paths,
+    int num_cells
+) : num_cells(num_cells), sbml_paths(std::move(sbml_paths)) {}
+
+void CellPopulation::setSeed(
+    unsigned long long seed
+) {
+
+    this->rng_seed = seed;
+}
+
+void CellPopulation::setRecording(
+    int interval,
+    const std::vector<std::string>& species_subset
+) {
+
+    this->record_interval = interval;
+    this->record_species = species_subset;
+}
+
+void CellPopulation::setExchangeView(
+    const std::string& name,
+    const std::vector<std::string>& entity_ids
+) {
+
+    this->exchange_view_name = name;
+    this->exchange_view_ids = entity_ids;
+}
+
+void CellPopulation::setDivision(
+    const std::string& trigger_species,
+    double threshold,
+    int max_cells
+) {
+
+    this->division_species = trigger_species;
+    this->division_threshold = threshold;
+    this->division_max_cells = max_cells;
+}
+
+const std::vector<CellPopulation::DivisionEvent>&
+CellPopulation::getDivisionEvents() const {
+
+    return this->division_events;
+}
+
+std::vector<std::vector<std::vector<double>>> CellPopulation::simulate(
+    double start,
+    double stop,
+    double step,
+    int num_threads
+) {
+
+    std::vector<std::vector<std::vector<double>>> population_results(this->num_cells);
+
+    TaskScheduler& scheduler = TaskScheduler::instance();
+
+    // num_threads == 1 keeps the serial path; otherwise the width comes
+    // from the shared pool, so population runs compose with every other
+    // parallel feature instead of oversubscribing. The pool's workers
+    // are already NUMA-pinned at spawn, which replaces the pinning this
+    // method used to do per run
+    bool concurrent = num_threads != 1 && scheduler.threadCount() > 1
+        && this->num_cells > 1;
+
+    // One resident session per scheduler slot: modules, compiled
+    // formulas and solver objects are built on the slot's first cell,
+    // stay live across every cell that lands there, and are rewound
+    // between runs. The extra slot serves the off-pool caller when it
+    // helps execute tasks inside parallelFor. A slot is only ever
+    // touched by its own thread, so no lock guards the sessions
+    std::vector<std::unique_ptr<SingleCell>> sessions(
+        scheduler.threadCount() + 1
+    );
+
+    auto runCell = [&](int cell) {
+
+        int slot = TaskScheduler::workerIndex();
+
+        if (slot < 0) {
+            slot = static_cast<int>(sessions.size()) - 1;
+        }
+
+        std::unique_ptr<SingleCell>& session = sessions[slot];
+
+        if (!session) {
+
+            session = std::make_unique<SingleCell>(this->sbml_paths);
+
+            session->setRecording(
+                this->record_interval, this->record_species
+            );
+
+            if (!this->exchange_view_ids.empty()) {
+                session->setExchangeView(
+                    this->exchange_view_name, this->exchange_view_ids
+                );
+            }
+
+        } else {
+
+            // rewind the resident state instead of rebuilding the cell
+            session->reset();
+        }
+
+        if (this->rng_seed.has_value()) {
+
+            // Per-cell substream keeps replicates independent & replayable
+            session->setSeed(this->rng_seed.value() + cell);
+        }
+
+        population_results[cell] = session->simulate(start, stop, step);
+    };
+
+    if (concurrent) {
+        scheduler.parallelFor(this->num_cells, runCell);
+    } else {
+
+        for (int cell = 0; cell < this->num_cells; cell++) {
+            runCell(cell);
+        }
+    }
+
+    return population_results;
+}
+
+std::vector<std::vector<std::vector<double>>> CellPopulation::simulateSynchronized(
+    double start,
+    double stop,
+    double step,
+    int num_threads
+) {
+
+    if (num_threads <= 0) {
+        num_threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    if (num_threads > this->num_cells) {
+        num_threads = this->num_cells;
+    }
+
+    // division: reserve daughter slots up front so workers fill
+    // disjoint cells entries without a lock. Each worker spawns into
+    // its own index range, so daughter indices — and with them the
+    // seed + index RNG substreams — are deterministic at a fixed
+    // thread count; integer division rounds the effective cap down
+    // to a multiple of the worker count
+    bool dividing = !this->division_species.empty() && this->num_cells > 0;
+
+    int capacity = this->num_cells;
+
+    if (dividing) {
+        capacity = this->division_max_cells > 0
+            ? std::max(this->division_max_cells, this->num_cells)
+            : this->num_cells * 4;
+    }
+
+    int spawn_budget = dividing
+        ? (capacity - this->num_cells) / num_threads
+        : 0;
+
+    // resolve the trigger column before the pool spawns, so a bad
+    // species id fails on the caller's thread, not inside a worker
+    int trigger_index = -1;
+
+    if (dividing) {
+
+        std::vector<std::string> ids = this->getGlobalSpeciesIds();
+
+        auto found = std::find(
+            ids.begin(), ids.end(), this->division_species
+        );
+
+        if (found == ids.end()) {
+            throw std::runtime_error(
+                "Division trigger species '" + this->division_species
+                + "' not found in the model"
+            );
+        }
+
+        trigger_index = static_cast<int>(found - ids.begin());
+    }
+
+    this->division_events.clear();
+    std::mutex division_mutex;
+
+    // every cell holds a resident stepping session for the whole run
+    std::vector<std::unique_ptr<SingleCell>> cells(capacity);
+
+    // the lockstep grid all cells share; identical delta_t is what lets
+    // the population advance one exchange interval at a time
+    size_t num_steps = static_cast<size_t>((stop - start) / step) + 1;
+
+    // NUMA shards: empty on single-node machines or when pinning is off
+    std::vector<std::vector<int>> numa_nodes =
+        this->numa_aware ? readNumaCpuSets() : std::vector<std::vector<int>>{};
+
+    StepBarrier barrier(num_threads);
+
+    // contiguous cell ranges, one per worker for the entire run: the
+    // same pinned thread constructs, steps and finishes its cells, so
+    // their state stays node-local and cache-warm between step visits
+    int chunk = (this->num_cells + num_threads - 1) / num_threads;
+
+    auto worker = [&](int worker_index) {
+
+        if (!numa_nodes.empty()) {
+            pinToCpuSet(numa_nodes[worker_index % numa_nodes.size()]);
+        }
+
+        int first = worker_index * chunk;
+        int last = std::min(first + chunk, this->num_cells);
+
+        // builds one cell's resident session; divisions reuse it for
+        // daughters, which join this worker's owned list
+        auto buildCell = [&](int c) {
+
+            cells[c] = std::make_unique<SingleCell>(this->sbml_paths);
+
+            cells[c]->setRecording(
+                this->record_interval, this->record_species
+            );
+
+            if (!this->exchange_view_ids.empty()) {
+                cells[c]->setExchangeView(
+                    this->exchange_view_name, this->exchange_view_ids
+                );
+            }
+
+            if (this->rng_seed.has_value()) {
+                cells[c]->setSeed(this->rng_seed.value() + c);
+            }
+
+            cells[c]->beginStepping(start, stop, step);
+        };
+
+        // the cells this worker steps; daughters born here stay here,
+        // so every session is only ever touched by its creating thread
+        std::vector<int> owned;
+        owned.reserve(static_cast<size_t>(last - first) + spawn_budget);
+
+        for (int c = first; c < last; c++) {
+
+            buildCell(c);
+
+            owned.push_back(c);
+        }
+
+        int spawned = 0;
+
+        // construction barrier, then one barrier per global step
+        barrier.arriveAndWait();
+
+        for (size_t t = 1; t < num_steps; t++) {
+
+            double target = start + static_cast<double>(t) * step;
+
+            for (int c : owned) {
+                cells[c]->advanceTo(target);
+            }
+
+            if (dividing) {
+
+                // only cells alive before this step's scan can divide
+                // at it; daughters start checking from the next step
+                size_t alive = owned.size();
+
+                for (size_t i = 0; i < alive && spawned < spawn_budget;
+                        i++) {
+
+                    int c = owned[i];
+
+                    std::vector<double> state =
+                        cells[c]->getCurrentState();
+
+                    if (state[trigger_index] < this->division_threshold) {
+                        continue;
+                    }
+
+                    int child = this->num_cells
+                        + worker_index * spawn_budget + spawned;
+                    spawned++;
+
+                    // halve the trigger before the fork copies it, so
+                    // both daughters inherit the halved level and
+                    // neither re-fires on the next scan
+                    state[trigger_index] *= 0.5;
+                    cells[c]->setCurrentState(state);
+
+                    buildCell(child);
+
+                    cells[child]->forkSteppingFrom(*cells[c]);
+
+                    owned.push_back(child);
+
+                    {
+                        std::lock_guard<std::mutex> lock(division_mutex);
+                        this->division_events.push_back(
+                            { target, c, child }
+                        );
+                    }
+                }
+            }
+
+            barrier.arriveAndWait();
+        }
+
+        for (int c : owned) {
+            cells[c]->finishStepping();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(num_threads);
+
+    for (int t = 0; t < num_threads; t++) {
+        pool.emplace_back(worker, t);
+    }
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    // gather the recorded trajectories, [cell][timestep][species];
+    // daughter slots that were never spawned stay empty, and the
+    // division event table names the live lineage
+    std::vector<std::vector<std::vector<double>>> population_results(
+        capacity
+    );
+
+    for (int c = 0; c < capacity; c++) {
+
+        if (!cells[c]) {
+            continue;
+        }
+
+        population_results[c].resize(cells[c]->last_num_timesteps);
+
+        for (size_t t = 0; t < cells[c]->last_num_timesteps; t++) {
+            population_results[c][t] = cells[c]->getTimeSlice(t);
+        }
+    }
+
+    return population_results;
+}
+
+void CellPopulation::setSlabLayout(
+    const std::string& layout
+) {
+
+    // validate eagerly so a typo fails at configuration time, not at
+    // the end of a long lockstep run; dimensions are refit per run
+    PopulationLayout::resolve(
+        layout == "auto" ? "tiled" : layout, 1, 1
+    );
+
+    this->slab_layout_request = layout;
+}
+
+std::vector<double> CellPopulation::simulateSynchronizedFlat(
+    double start,
+    double stop,
+    double step,
+    int num_threads
+) {
+
+    std::vector<std::vector<std::vector<double>>> population_results =
+        this->simulateSynchronized(start, stop, step, num_threads);
+
+    size_t capacity = population_results.size();
+
+    // first spawned cell fixes the grid; all cells share the lockstep
+    // delta_t so their recorded geometry is identical
+    size_t num_timesteps = 0;
+    size_t num_species = 0;
+
+    for (const auto& cell_results : population_results) {
+
+        if (!cell_results.empty()) {
+
+            num_timesteps = cell_results.size();
+            num_species = cell_results[0].size();
+            break;
+        }
+    }
+
+    this->last_slab_cells = capacity;
+    this->last_slab_timesteps = num_timesteps;
+    this->last_slab_species = num_species;
+
+    this->slab_layout = PopulationLayout::resolve(
+        this->slab_layout_request,
+        capacity,
+        num_timesteps * num_species
+    );
+
+    // NaN marks daughter slots that never spawned, and the tiled
+    // layout's padding rows, so aggregation can skip them
+    std::vector<double> slab(
+        this->slab_layout.size(),
+        std::numeric_limits<double>::quiet_NaN()
+    );
+
+    // one packing pass per cell: under the cell layout each cell's
+    // trajectory lands contiguously, under the species and tiled
+    // layouts the index function scatters it across the slab. Rows are
+    // read in order either way, so the pass streams the nested source
+    for (size_t c = 0; c < capacity; c++) {
+
+        const auto& cell_results = population_results[c];
+
+        for (size_t t = 0; t < cell_results.size(); t++) {
+
+            const std::vector<double>& row = cell_results[t];
+
+            for (size_t s = 0; s < row.size(); s++) {
+
+                slab[this->slab_layout.index(c, t * num_species + s)] =
+                    row[s];
+            }
+        }
+    }
+
+    return slab;
+}
+
+std::string CellPopulation::getSlabLayout() const {
+
+    return this->slab_layout.describe();
+}
+
+void CellPopulation::setNumaAware(
+    bool enable
+) {
+
+    this->numa_aware = enable;
+}
+
+void CellPopulation::setSummaryQuantiles(
+    const std::vector<double>& quantiles
+) {
+
+    this->summary_quantiles = quantiles;
+}
+
+void CellPopulation::setCrossingThresholds(
+    const std::vector<std::pair<std::string, double>>& thresholds
+) {
+
+    this->crossing_thresholds = thresholds;
+}
+
+std::vector<std::vector<std::vector<double>>> CellPopulation::simulateStatistics(
+    double start,
+    double stop,
+    double step,
+    int num_threads
+) {
+
+    // One Welford accumulator and one P-squared estimator per quantile
+    // for every (timestep, species) cell; trajectories fold in and are
+    // discarded, so memory never scales with the cell count. The
+    // accumulators live on the instance so shards can export and merge
+    // them after the run
+    this->moments.clear();
+    this->quantile_markers.assign(this->summary_quantiles.size(), {});
+    this->first_crossings.clear();
+    this->column_thresholds.clear();
+    this->stat_rows = 0;
+    this->stat_cols = 0;
+    this->folded_cells = 0.0;
+
+    std::mutex reduce_mutex;
+
+    TaskScheduler& scheduler = TaskScheduler::instance();
+
+    // serial escape plus shared-pool width, as in simulate; resident
+    // sessions live one per scheduler slot, each only touched by its
+    // own thread
+    bool concurrent = num_threads != 1 && scheduler.threadCount() > 1
+        && this->num_cells > 1;
+
+    std::vector<std::unique_ptr<SingleCell>> sessions(
+        scheduler.threadCount() + 1
+    );
+
+    auto runCell = [&](int cell) {
+
+        // other shards own the skipped indices; seeds stay keyed by
+        // the global index so the shard union is the full population
+        if (cell % this->num_shards != this->shard_index) {
+            return;
+        }
+
+        int slot = TaskScheduler::workerIndex();
+
+        if (slot < 0) {
+            slot = static_cast<int>(sessions.size()) - 1;
+        }
+
+        std::unique_ptr<SingleCell>& session = sessions[slot];
+
+        if (!session) {
+
+            session = std::make_unique<SingleCell>(this->sbml_paths);
+
+            session->setRecording(
+                this->record_interval, this->record_species
+            );
+
+            if (!this->exchange_view_ids.empty()) {
+                session->setExchangeView(
+                    this->exchange_view_name, this->exchange_view_ids
+                );
+            }
+
+        } else {
+            session->reset();
+        }
+
+        if (this->rng_seed.has_value()) {
+            session->setSeed(this->rng_seed.value() + cell);
+        }
+
+        std::vector<std::vector<double>> trajectory =
+            session->simulate(start, stop, step);
+
+        std::lock_guard<std::mutex> lock(reduce_mutex);
+
+        // first finished cell sizes the accumulators
+        if (this->moments.empty()) {
+
+            this->stat_rows = trajectory.size();
+            this->stat_cols =
+                this->stat_rows > 0 ? trajectory[0].size() : 0;
+
+            this->moments.assign(this->stat_rows * this->stat_cols, {});
+
+            for (size_t qi = 0; qi < this->summary_quantiles.size(); qi++) {
+
+                this->quantile_markers[qi].resize(
+                    this->stat_rows * this->stat_cols
+                );
+
+                for (auto& marker : this->quantile_markers[qi]) {
+                    marker.initialize(this->summary_quantiles[qi]);
+                }
+            }
+
+            // resolve thresholds against the recorded column order
+            this->column_thresholds.assign(
+                this->stat_cols, std::numeric_limits<double>::quiet_NaN()
+            );
+
+            std::vector<std::string> recorded_ids =
+                session->getRecordedSpeciesIds();
+
+            for (const auto& [species_id, threshold] :
+                 this->crossing_thresholds) {
+
+                for (size_t c = 0; c < recorded_ids.size(); c++) {
+
+                    if (recorded_ids[c] == species_id) {
+                        this->column_thresholds[c] = threshold;
+                    }
+                }
+            }
+
+            this->first_crossings.assign(
+                this->stat_rows * this->stat_cols, 0.0
+            );
+        }
+
+        size_t num_rows = this->stat_rows;
+        size_t num_cols = this->stat_cols;
+
+        // fold the trajectory into the shared accumulators
+        for (size_t t = 0; t < num_rows && t < trajectory.size(); t++) {
+
+            for (size_t s = 0; s < num_cols; s++) {
+
+                double x = trajectory[t][s];
+                size_t flat = t * num_cols + s;
+
+                Welford& w = this->moments[flat];
+
+                w.count += 1.0;
+                double delta = x - w.mean;
+                w.mean += delta / w.count;
+                w.m2 += delta * (x - w.mean);
+
+                for (auto& markers : this->quantile_markers) {
+                    markers[flat].add(x);
+                }
+            }
+        }
+
+        for (size_t s = 0; s < num_cols; s++) {
+
+            if (std::isnan(this->column_thresholds[s])) {
+                continue;
+            }
+
+            for (size_t t = 0; t < num_rows && t < trajectory.size(); t++) {
+
+                if (trajectory[t][s] >= this->column_thresholds[s]) {
+                    this->first_crossings[t * num_cols + s] += 1.0;
+                    break;
+                }
+            }
+        }
+
+        this->folded_cells += 1.0;
+    };
+
+    if (concurrent) {
+        scheduler.parallelFor(this->num_cells, runCell);
+    } else {
+
+        for (int cell = 0; cell < this->num_cells; cell++) {
+            runCell(cell);
+        }
+    }
+
+    return this->finalizeStatistics();
+}
+
+void CellPopulation::setShard(
+    int shard_index,
+    int num_shards
+) {
+
+    this->num_shards = num_shards > 1 ? num_shards : 1;
+    this->shard_index = shard_index >= 0 && shard_index < this->num_shards
+        ? shard_index
+        : 0;
+}
+
+std::vector<double> CellPopulation::exportAccumulators() const {
+
+    size_t cells = this->stat_rows * this->stat_cols;
+    size_t num_quantiles = this->quantile_markers.size();
+
+    // header, Welford triples, packed marker states, thresholds, crossings
+    std::vector<double> packed;
+    packed.reserve(
+        4 + 3 * cells + num_quantiles * cells * P2Quantile::kStateSize +
+        this->stat_cols + cells
+    );
+
+    packed.push_back(static_cast<double>(this->stat_rows));
+    packed.push_back(static_cast<double>(this->stat_cols));
+    packed.push_back(static_cast<double>(num_quantiles));
+    packed.push_back(this->folded_cells);
+
+    for (const Welford& w : this->moments) {
+        packed.push_back(w.count);
+        packed.push_back(w.mean);
+        packed.push_back(w.m2);
+    }
+
+    double state[P2Quantile::kStateSize];
+
+    for (const auto& markers : this->quantile_markers) {
+
+        for (const P2Quantile& marker : markers) {
+
+            marker.serialize(state);
+            packed.insert(packed.end(), state, state + P2Quantile::kStateSize);
+        }
+    }
+
+    packed.insert(
+        packed.end(),
+        this->column_thresholds.begin(), this->column_thresholds.end()
+    );
+    packed.insert(
+        packed.end(),
+        this->first_crossings.begin(), this->first_crossings.end()
+    );
+
+    return packed;
+}
+
+void CellPopulation::mergeAccumulators(
+    const std::vector<double>& packed
+) {
+
+    size_t rows = static_cast<size_t>(packed[0]);
+    size_t cols = static_cast<size_t>(packed[1]);
+    size_t num_quantiles = static_cast<size_t>(packed[2]);
+    size_t cells = rows * cols;
+
+    size_t offset = 4;
+
+    // a shard whose cell range was empty has nothing to contribute
+    if (cells == 0) {
+        return;
+    }
+
+    // an instance that has not run adopts the packed state wholesale, so
+    // any rank of a tree reduction can act as a merge point
+    bool adopt = this->moments.empty();
+
+    if (adopt) {
+
+        this->stat_rows = rows;
+        this->stat_cols = cols;
+        this->moments.assign(cells, {});
+        this->quantile_markers.assign(
+            num_quantiles, std::vector<P2Quantile>(cells)
+        );
+        this->column_thresholds.assign(
+            cols, std::numeric_limits<double>::quiet_NaN()
+        );
+        this->first_crossings.assign(cells, 0.0);
+        this->folded_cells = 0.0;
+
+    } else if (rows != this->stat_rows || cols != this->stat_cols ||
+               num_quantiles != this->quantile_markers.size()) {
+
+        throw std::runtime_error(
+            "mergeAccumulators: shard accumulator geometry mismatch"
+        );
+    }
+
+    this->folded_cells += packed[3];
+
+    // Welford moments combine by the parallel (Chan) update
+    for (size_t i = 0; i < cells; i++) {
+
+        double count = packed[offset];
+        double mean = packed[offset + 1];
+        double m2 = packed[offset + 2];
+        offset += 3;
+
+        if (count <= 0.0) {
+            continue;
+        }
+
+        Welford& w = this->moments[i];
+
+        double total = w.count + count;
+        double delta = mean - w.mean;
+
+        w.mean += delta * count / total;
+        w.m2 += m2 + delta * delta * w.count * count / total;
+        w.count = total;
+    }
+
+    // P-squared markers merge on their compact serialized state
+    P2Quantile incoming;
+
+    for (size_t qi = 0; qi < num_quantiles; qi++) {
+
+        for (size_t i = 0; i < cells; i++) {
+
+            incoming.deserialize(packed.data() + offset);
+            offset += P2Quantile::kStateSize;
+
+            if (adopt) {
+                this->quantile_markers[qi][i] = incoming;
+            } else {
+                this->quantile_markers[qi][i].merge(incoming);
+            }
+        }
+    }
+
+    // thresholds are identical across shards; keep whichever is resolved
+    for (size_t s = 0; s < cols; s++) {
+
+        if (std::isnan(this->column_thresholds[s])) {
+            this->column_thresholds[s] = packed[offset + s];
+        }
+    }
+
+    offset += cols;
+
+    for (size_t i = 0; i < cells; i++) {
+        this->first_crossings[i] += packed[offset + i];
+    }
+}
+
+std::vector<std::vector<std::vector<double>>> CellPopulation::finalizeStatistics() {
+
+    size_t num_rows = this->stat_rows;
+    size_t num_cols = this->stat_cols;
+
+    // materialize the summary matrices: mean, stddev, then each quantile
+    size_t num_statistics = 2 + this->quantile_markers.size();
+
+    std::vector<std::vector<std::vector<double>>> statistics(
+        num_statistics,
+        std::vector<std::vector<double>>(
+            num_rows, std::vector<double>(num_cols, 0.0)
+        )
+    );
+
+    for (size_t t = 0; t < num_rows; t++) {
+
+        for (size_t s = 0; s < num_cols; s++) {
+
+            size_t flat = t * num_cols + s;
+            const Welford& w = this->moments[flat];
+
+            statistics[0][t][s] = w.mean;
+            statistics[1][t][s] = w.count > 1.0
+                ? std::sqrt(w.m2 / (w.count - 1.0))
+                : 0.0;
+
+            for (size_t qi = 0; qi < this->quantile_markers.size(); qi++) {
+                statistics[2 + qi][t][s] =
+                    this->quantile_markers[qi][flat].value();
+            }
+        }
+    }
+
+    // cumulative first crossings over time, as a fraction of the cells
+    // folded so far: the shard's share locally, the population after merge
+    this->crossing_fractions.assign(
+        num_rows, std::vector<double>(num_cols, 0.0)
+    );
+
+    for (size_t s = 0; s < num_cols; s++) {
+
+        double crossed = 0.0;
+
+        for (size_t t = 0; t < num_rows; t++) {
+
+            crossed += this->first_crossings[t * num_cols + s];
+
+            this->crossing_fractions[t][s] = this->folded_cells > 0.0
+                ? crossed / this->folded_cells
+                : 0.0;
+        }
+    }
+
+    return statistics;
+}
+
+std::vector<std::vector<double>> CellPopulation::replayCell(
+    int cell_index,
+    double start,
+    double stop,
+    double step
+) {
+
+    // full recording resolution on purpose: the population run may have
+    // thinned or reduced its output, the replay should not
+    SingleCell single_cell(this->sbml_paths);
+
+    if (this->rng_seed.has_value()) {
+
+        // the same substream key the population run gave this cell; the
+        // counter-based generator then reproduces its draws exactly
+        single_cell.setSeed(this->rng_seed.value() + cell_index);
+    }
+
+    return single_cell.simulate(start, stop, step);
+}
+
+std::vector<std::vector<double>> CellPopulation::getCrossingFractions() {
+
+    return this->crossing_fractions;
+}
+
+std::vector<std::string> CellPopulation::getGlobalSpeciesIds() {
+
+    SingleCell reference_cell(this->sbml_paths);
+
+    return reference_cell.getGlobalSpeciesIds();
+}
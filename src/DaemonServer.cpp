@@ -0,0 +1,265 @@
+/**
+ * @file: DaemonServer.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Persistent daemon serving simulate requests over a Unix socket
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+
+//System Libraries
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+
+//Internal Libraries
+#include "singlecell/DaemonServer.h"
+
+//=========================Function Definitions=============================//
+namespace {
+
+    /**
+     * @brief reads exactly len bytes from fd, riding out short reads
+     *
+     * @returns true on success, false on EOF or a read error
+     */
+    bool readFully(int fd, void* buffer, size_t len) {
+
+        char* out = static_cast<char*>(buffer);
+
+        while (len > 0) {
+
+            ssize_t got = read(fd, out, len);
+
+            if (got <= 0) {
+                return false;
+            }
+
+            out += got;
+            len -= static_cast<size_t>(got);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief writes exactly len bytes to fd, riding out short writes
+     *
+     * @returns true on success, false on a write error
+     */
+    bool writeFully(int fd, const void* buffer, size_t len) {
+
+        const char* in = static_cast<const char*>(buffer);
+
+        while (len > 0) {
+
+            ssize_t put = write(fd, in, len);
+
+            if (put <= 0) {
+                return false;
+            }
+
+            in += put;
+            len -= static_cast<size_t>(put);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief answers one failed request: status 1, message length, message
+     */
+    void writeError(int fd, const std::string& message) {
+
+        int32_t status = 1;
+        int32_t length = static_cast<int32_t>(message.size());
+
+        writeFully(fd, &status, sizeof(status));
+        writeFully(fd, &length, sizeof(length));
+        writeFully(fd, message.data(), message.size());
+    }
+
+} // namespace
+
+//=============================Class Details================================//
+DaemonServer::DaemonServer(
+    const std::vector<std::string>& sbml_paths
+) {
+
+    // All setup cost lands here: SBML parsing, module construction,
+    // AMICI objects and compiled formulas are resident before the
+    // socket ever opens
+    this->cell = std::make_unique<SingleCell>(sbml_paths);
+}
+
+int DaemonServer::serve(
+    const std::string& socket_path
+) {
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (listen_fd < 0) {
+        perror("DaemonServer: socket");
+        return 1;
+    }
+
+    // A stale socket file from a previous daemon would fail the bind
+    unlink(socket_path.c_str());
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(
+        address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1
+    );
+
+    if (bind(listen_fd,
+             reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        perror("DaemonServer: bind");
+        close(listen_fd);
+        return 1;
+    }
+
+    if (listen(listen_fd, 8) < 0) {
+        perror("DaemonServer: listen");
+        close(listen_fd);
+        return 1;
+    }
+
+    printf("Daemon ready on %s\n", socket_path.c_str());
+
+    bool running = true;
+
+    while (running) {
+
+        int client_fd = accept(listen_fd, nullptr, nullptr);
+
+        if (client_fd < 0) {
+            continue;
+        }
+
+        running = this->handleConnection(client_fd);
+
+        close(client_fd);
+    }
+
+    close(listen_fd);
+
+    unlink(socket_path.c_str());
+
+    return 0;
+}
+
+bool DaemonServer::handleConnection(
+    int client_fd
+) {
+
+    while (true) {
+
+        int32_t num_overrides = 0;
+
+        // A clean disconnect between frames just ends this client
+        if (!readFully(client_fd, &num_overrides, sizeof(num_overrides))) {
+            return true;
+        }
+
+        // Negative override count is the shutdown frame
+        if (num_overrides < 0) {
+            return false;
+        }
+
+        std::vector<std::pair<std::string, double>> overrides;
+        overrides.reserve(num_overrides);
+
+        bool frame_ok = true;
+
+        for (int32_t i = 0; i < num_overrides && frame_ok; i++) {
+
+            int32_t id_length = 0;
+
+            frame_ok = readFully(client_fd, &id_length, sizeof(id_length))
+                && id_length > 0;
+
+            if (!frame_ok) {
+                break;
+            }
+
+            std::string entity_id(id_length, '\0');
+            double value = 0.0;
+
+            frame_ok = readFully(client_fd, entity_id.data(), id_length)
+                && readFully(client_fd, &value, sizeof(value));
+
+            overrides.emplace_back(std::move(entity_id), value);
+        }
+
+        double grid[3] = {0.0, 0.0, 0.0};
+
+        if (!frame_ok || !readFully(client_fd, grid, sizeof(grid))) {
+            return true; // malformed frame; drop the client, stay up
+        }
+
+        try {
+
+            std::vector<double> flat = this->runRequest(
+                overrides, grid[0], grid[1], grid[2]
+            );
+
+            int32_t status = 0;
+            int32_t rows = static_cast<int32_t>(this->cell->last_num_timesteps);
+            int32_t cols = static_cast<int32_t>(this->cell->last_num_species);
+
+            if (!writeFully(client_fd, &status, sizeof(status)) ||
+                !writeFully(client_fd, &rows, sizeof(rows)) ||
+                !writeFully(client_fd, &cols, sizeof(cols)) ||
+                !writeFully(client_fd, flat.data(),
+                            flat.size() * sizeof(double))) {
+                return true;
+            }
+
+        } catch (const std::exception& error) {
+
+            // A bad request must not take down the resident session
+            writeError(client_fd, error.what());
+        }
+    }
+}
+
+std::vector<double> DaemonServer::runRequest(
+    const std::vector<std::pair<std::string, double>>& overrides,
+    double start,
+    double stop,
+    double step
+) {
+
+    // Rewind species to the pristine state; the resident solvers,
+    // stoichiometry and compiled formulas are all reused
+    this->cell->reset();
+
+    if (!overrides.empty()) {
+
+        std::vector<std::string> ids;
+        std::vector<double> values;
+        ids.reserve(overrides.size());
+        values.reserve(overrides.size());
+
+        for (const auto& [entity_id, value] : overrides) {
+            ids.push_back(entity_id);
+            values.push_back(value);
+        }
+
+        // The bound fast path writes straight into the live modules,
+        // so overrides cost string resolution once per request
+        this->cell->bindParameters(ids);
+        this->cell->setParameters(values);
+    }
+
+    return this->cell->simulateFlat(start, stop, step);
+}
@@ -10,6 +10,7 @@
 //===========================Library Import=================================//
 //Std Libraries
 #include <ctime>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <random>
@@ -22,31 +23,28 @@
 
 // Internal libraries
 #include "singlecell/utils.h"
+#include "singlecell/Logger.h"
+#include "singlecell/AllocationGuard.h"
 #include "singlecell/SBMLHandler.h"
+#include "singlecell/AmiciModelRegistry.h"
 #include "singlecell/DeterministicModule.h"
 
 // Third Party Libraries
 #include "amici/amici.h"
-#include "../amici_models/Deterministic/Deterministic.h"
 
 //=============================Class Details================================//
 DeterministicModule::DeterministicModule(
     SBMLHandler DeterministicModel
  ) : BaseModule(DeterministicModel)
  {
-    // Retrieve the Deterministic matrix from the sbml document.
-    this->stoichmat = DeterministicModel.getStoichiometricMatrix();
-
-    // List of formula strings to be parsed. <-- !!! Might swap for something ASTNode compatible later.
-    this->formulas_vector = DeterministicModel.getReactionExpressions();
+    this->module_kind = ModuleKind::Deterministic;
 
     //Instantiate SBML model
     this->sbml = DeterministicModel.model;
 
-    // Import AMICI Model from 'amici_models/$modelname
-    // this->model = std::make_unique<amici::model_Deterministic::Model_Deterministic>();
-    std::unique_ptr<amici::Model> new_model = std::make_unique<amici::model_Deterministic::Model_Deterministic>();
-    this->model = std::move(new_model);
+    // The registry dlopens the generated model on first use, so only the
+    // models a run touches ever pay construction or load cost
+    this->model = AmiciModelRegistry::create(this->sbml->getId());
     
     //Update AMICI model for any modifications present in SBML:
     this->model->setFixedParameters(DeterministicModel.getParameterValues());
@@ -71,45 +69,180 @@ void DeterministicModule::loadTargetModule(
 }
 
 void DeterministicModule::step(int step) {
-    // Get the (step - 1)th result
-    std::vector<double> last_record = this->getLastStepResult(step);
 
-    //reset SBML species values:
-    this->handler.setState(last_record);
+    alloc_guard::PhaseScope alloc_phase("deterministic_step");
 
-    // Set the single timepoint to simulate
-    std::vector<double> step_forward = {0.0, this->delta_t};
+    // Multirate mode: most micro-steps are served from the dense output
+    // of the last macro solve, so only every macro_interval-th call pays
+    // a CVODES invocation
+    int offset = this->macro_interval > 1
+        ? (step - 1) % this->macro_interval
+        : 0;
 
-    model->setTimepoints(step_forward);
+    if (this->macro_interval <= 1 || offset == 0) {
 
-    // Set initial state based on last record
-    model->setInitialStates(last_record);
+        // Speculative lookahead: the previous step already integrated
+        // this interval under predicted exchange inputs. When the
+        // boundary exchange landed within tolerance of the prediction,
+        // its end state commits and the solve below is skipped; a miss
+        // rolls back for free — the recorded previous state was never
+        // touched, the normal solve just runs
+        if (this->speculation_tolerance > 0.0 &&
+            this->speculative_step == step) {
 
-    // Run the simulation
-    std::unique_ptr<amici::ReturnData> rdata = amici::runAmiciSimulation(*solver, nullptr, *model);
+            bool holds = this->speculationHolds();
+
+            this->speculative_step = -1;
+
+            if (holds) {
+
+                this->speculation_hits++;
+                this->current_state = this->speculative_state;
+
+                this->speculateNextStep(step);
+
+                PerfMonitor::ScopedTimer timer(this->perf, "recording");
+                BaseModule::recordCurrentState(step);
+
+                return;
+            }
+
+            this->speculation_misses++;
+        }
+
+        // Get the (step - 1)th result; a view, not a copy. In macro mode
+        // this boundary is where stochastic feedback — exchanged
+        // parameters and the latest recorded state — re-enters the solver
+        const std::vector<double>& last_record = this->getLastStepResult(step);
+
+        // Set initial state based on last record, AMICI to AMICI with no
+        // SBML round-trip; timepoints, tolerances and the solver instance
+        // are configured once in setSimulationSettings
+        model->setInitialStates(last_record);
+
+        // Run the simulation with the persistent solver
+        std::unique_ptr<amici::ReturnData> rdata;
+
+        {
+            PerfMonitor::ScopedTimer timer(this->perf, "amici_solve");
+            rdata = amici::runAmiciSimulation(*solver, nullptr, *model);
+        }
+
+        // the ReturnData counters are cumulative over the solve's
+        // timepoints, so the final entry is this solve's total
+        if (this->entity_profiling) {
+
+            this->profiled_solves++;
+
+            if (!rdata->numsteps.empty()) {
+                this->cvodes_steps += rdata->numsteps.back();
+            }
+
+            if (!rdata->numrhsevals.empty()) {
+                this->cvodes_rhs_evals += rdata->numrhsevals.back();
+            }
+
+            if (!rdata->numerrtestfails.empty()) {
+                this->cvodes_errtest_fails += rdata->numerrtestfails.back();
+            }
+
+            if (!rdata->numnonlinsolvconvfails.empty()) {
+                this->cvodes_nonlin_fails +=
+                    rdata->numnonlinsolvconvfails.back();
+            }
+        }
+
+        if (this->macro_interval > 1) {
+
+            // keep every interpolated micro-step row, dropping the t=0 row
+            this->macro_states.assign(
+                rdata->x.begin() + rdata->nx, rdata->x.end()
+            );
+
+            this->macro_start_step = step - 1;
 
-    // Extract results (assuming you want the final state)
-    std::vector<double> last_vals = this->getNewStepResult(*rdata);
+        } else {
 
-    this->handler.setState(last_vals);
+            // Copy the final state straight into current_state; no
+            // intermediate step buffer, and recordCurrentState below
+            // writes the results row without another copy
+            int n_species = rdata->nx;
+            size_t last_idx = static_cast<size_t>(rdata->nt - 1) * n_species;
+
+            this->current_state.assign(
+                rdata->x.begin() + last_idx,
+                rdata->x.begin() + last_idx + n_species
+            );
+
+            // lookahead for the next interval starts here, while the
+            // stochastic partner is (under parallel stepping) still
+            // inside its own step
+            if (this->speculation_tolerance > 0.0) {
+                this->speculateNextStep(step);
+            }
+        }
+    }
 
-    // Record values to results matrix
-    BaseModule::recordStepResult(last_vals, step);
+    if (this->macro_interval > 1) {
+
+        // hand this micro-step its interpolated row; the exchange phase
+        // after the step feeds it to the stochastic module as usual
+        size_t n_species =
+            this->macro_states.size() / this->macro_interval;
+
+        this->current_state.assign(
+            this->macro_states.begin() + offset * n_species,
+            this->macro_states.begin() + (offset + 1) * n_species
+        );
+    }
+
+    // Record values to results matrix; partners read current_state
+    // through the exchange slots, so no SBML mirror here
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "recording");
+        BaseModule::recordCurrentState(step);
+    }
 
 }
 
 void DeterministicModule::run(
-    std::vector<double> timepoints
+    const std::vector<double>& timepoints
 ) {
 
-    // Starting vector for simulation
-    std::vector<double> initial_state = this->getLastStepResult(0);
+    // Starting vector for simulation; a view, not a copy. The document
+    // is never read during the run — AMICI takes the state directly and
+    // syncStateToDocument mirrors the final state once at run end — so
+    // no per-run libSBML write happens here
+    const std::vector<double>& initial_state = this->getLastStepResult(0);
+
+    // Thinned recording used to request every fine grid point from the
+    // solver and discard most rows afterwards. CVODES evaluates its
+    // dense-output interpolant at whatever output times are asked for,
+    // independent of its internal steps, so ask only for the rows that
+    // will actually be recorded: rdata shrinks by the interval factor
+    // and the integrator strides naturally across the gaps. Envelope
+    // summaries accumulate at full step rate, so they keep the fine grid
+    bool thinned_grid = this->record_interval > 1
+        && this->summary_window == 0;
+
+    if (thinned_grid) {
+
+        std::vector<double> recorded_times;
+        recorded_times.reserve(
+            timepoints.size() / this->record_interval + 1
+        );
+
+        for (size_t i = 0; i < timepoints.size(); i += this->record_interval) {
+            recorded_times.push_back(timepoints[i]);
+        }
 
-    //reset SBML species values:
-    this->handler.setState(initial_state);
+        model->setTimepoints(recorded_times);
 
-    // Set the all timepoints for total runtime
-    model->setTimepoints(timepoints);
+    } else {
+
+        // Set the all timepoints for total runtime
+        model->setTimepoints(timepoints);
+    }
 
     // Set AMICI object initial state
     model->setInitialStates(initial_state);
@@ -117,22 +250,55 @@ void DeterministicModule::run(
     // Run the simulation
     std::unique_ptr<amici::ReturnData> rdata = amici::runAmiciSimulation(*solver, nullptr, *model);
 
-    int n_species = rdata->nx; // number of species
-    int n_timepoints = rdata->nt; //timepoints
+    // keep the gradient beside the trajectory when sensitivities are armed
+    if (!this->sensitivity_param_indices.empty()) {
+        this->sensitivities = rdata->sx;
+        this->num_sensitivity_parameters = rdata->nplist;
+        this->num_sensitivity_states = rdata->nx;
+    }
+
+    if (this->record_interval == 1 && this->record_mask.empty() &&
+        this->results_window == 0) {
 
-    for (int i = 0; i < n_timepoints; i++) {
-        for (int j = 0; j < n_species; j++) {
+        // rdata->x is already flat time-major-by-species; copy it in one pass
+        std::copy(rdata->x.begin(), rdata->x.end(), this->results_data);
 
-            this->results_matrix[i][j] = rdata->x[i * n_species + j];
+    } else {
 
-        }
+        // thinned/masked/windowed recording goes row-by-row through the
+        // filter; with the thinned solver grid each row maps back to its
+        // fine step index so the filter lands it in the right results row
+        int n_species = rdata->nx;
+
+        for (int t = 0; t < rdata->nt; t++) {
 
+            std::vector<double> row(
+                rdata->x.begin() + static_cast<size_t>(t) * n_species,
+                rdata->x.begin() + static_cast<size_t>(t + 1) * n_species
+            );
+
+            int fine_step = thinned_grid ? t * this->record_interval : t;
+
+            BaseModule::recordStepResult(row, fine_step);
+        }
     }
+
+    // current_state is the one authoritative state buffer; the fast path
+    // above bypasses the recording filter that normally maintains it, so
+    // land the final solver row here. getCurrentState, continuation
+    // warm starts and the run-end document sync all read from it
+    size_t last_idx =
+        static_cast<size_t>(rdata->nt - 1) * static_cast<size_t>(rdata->nx);
+
+    this->current_state.assign(
+        rdata->x.begin() + last_idx,
+        rdata->x.begin() + last_idx + rdata->nx
+    );
 }
 
 std::vector<double> DeterministicModule::setAllSpeciesValues(
-                                        std::vector<double> current_states,
-                                        std::vector<double> update_states
+                                        const std::vector<double>& current_states,
+                                        const std::vector<double>& update_states
                                         ) {
 
     // Creating instance of list to be returned:
@@ -154,30 +320,6 @@ std::vector<double> DeterministicModule::setAllSpeciesValues(
 
 }
 
-std::vector<double> DeterministicModule::getNewStepResult(
-    const amici::ReturnData &rdata
-) {
-
-    int n_species = rdata.nx; // number of species
-    int n_timepoints = rdata.nt; 
-    
-    const std::vector<double>& all_species = rdata.x; // species trajectories flat array length n_species * n_timepoints
-
-    // this makes the start value of  our for-loop at rdata.x[-1, starting_column] in python terms
-    int last_idx = (n_timepoints-1) * n_species;
-
-    std::vector<double> last_species_values;
-    
-    // convert each species value from amici::realtype to double
-    for (int i = last_idx; i < last_idx + n_species; ++i) {
-
-        last_species_values.push_back(static_cast<double>(all_species[i]));
-    
-    }
-
-    return last_species_values;
-}
-
 void DeterministicModule::setSimulationSettings(
     double start, 
     double stop, 
@@ -186,15 +328,23 @@ void DeterministicModule::setSimulationSettings(
 
     this->delta_t = step;
 
-    // Create an instance of the solver class
-    this->solver = this->model->getSolver();
-
     int numSpecies = this->sbml->getNumSpecies();
 
-    this->timesteps = BaseModule::setTimeSteps(start, stop, step);
+    // screening services re-enter here thousands of times; when the
+    // step, macro interval, profile and sensitivity selection are all
+    // unchanged the configured solver (and its warm internals) is kept,
+    // and only the state and results resets below run
+    bool reuse_solver = this->solver != nullptr
+        && this->configured_step == step
+        && this->configured_macro_interval == this->macro_interval
+        && this->configured_sensitivity_indices ==
+            this->sensitivity_param_indices
+        && this->solver_profile.matches(this->configured_profile);
+
+    this->time_grid = BaseModule::sharedTimeSteps(start, stop, step);
 
-    // populate results_matrix member with proper size
-    this->results_matrix = BaseModule::createResultsMatrix(numSpecies, timesteps.size());
+    // populate the flat results buffer with proper size
+    BaseModule::createResultsMatrix(numSpecies, this->time_grid->size());
 
     // record initial state as first vector in results_matrix member
     BaseModule::recordStepResult(
@@ -202,47 +352,378 @@ void DeterministicModule::setSimulationSettings(
         0
     );
 
-    // Assign solver settings
-    solver->setAbsoluteTolerance(1e-10);
-    solver->setRelativeTolerance(1e-6);
-    solver->setMaxSteps(100000);
+    if (!reuse_solver) {
+
+        // Create an instance of the solver class
+        this->solver = this->model->getSolver();
+
+        // Assign solver settings from the active profile
+        solver->setAbsoluteTolerance(this->solver_profile.absolute_tolerance);
+        solver->setRelativeTolerance(this->solver_profile.relative_tolerance);
+        solver->setMaxSteps(this->solver_profile.max_steps);
+        solver->setStabilityLimitFlag(this->solver_profile.stability_limit);
+
+        // dense linear algebra is cubic in the state count; at auto the
+        // large models take KLU, whose factorizations scale with Jacobian
+        // nnz. The solver instance persists across the per-step solves, so
+        // the sparse structures are allocated once per session
+        if (this->solver_profile.linear_solver == "KLU" ||
+            (this->solver_profile.linear_solver == "auto" &&
+             numSpecies > SolverProfile::sparse_threshold)) {
+
+            solver->setLinearSolver(amici::LinearSolver::KLU);
+        }
+
+        // arm first-order forward sensitivities when parameters are selected
+        if (!this->sensitivity_param_indices.empty()) {
+            this->model->setParameterList(this->sensitivity_param_indices);
+            solver->setSensitivityMethod(amici::SensitivityMethod::forward);
+            solver->setSensitivityOrder(amici::SensitivityOrder::first);
+        }
+
+        // Stepped runs integrate over the same window every call; set it once
+        // here instead of re-sending it each step. Macro mode widens the
+        // window to macro_interval micro-steps and requests dense output at
+        // each one, so intermediate calls read rows instead of solving
+        std::vector<double> window(this->macro_interval + 1);
+
+        for (int i = 0; i <= this->macro_interval; i++) {
+            window[i] = i * this->delta_t;
+        }
+
+        model->setTimepoints(window);
+
+        this->configured_step = step;
+        this->configured_macro_interval = this->macro_interval;
+        this->configured_profile = this->solver_profile;
+        this->configured_sensitivity_indices = this->sensitivity_param_indices;
+    }
+
+    // any cached macro window belongs to the previous run
+    this->macro_states.clear();
+
+    // Reserve the stepped-run output buffer up front
+    this->current_state.reserve(numSpecies);
 
     this->updateParameters();
 }
 
-std::vector<double> DeterministicModule::getLastStepResult(
-    int timestep
+void DeterministicModule::setSensitivityParameters(
+    const std::vector<std::string>& parameter_ids
+) {
+
+    this->sensitivity_param_indices.clear();
+
+    std::vector<std::string> amici_ids = this->model->getParameterIds();
+
+    for (const auto& id : parameter_ids) {
+
+        auto position = std::find(amici_ids.begin(), amici_ids.end(), id);
+
+        if (position == amici_ids.end()) {
+            SC_LOG_WARN("Skipping unknown sensitivity parameter '" << id << "'.");
+            continue;
+        }
+
+        this->sensitivity_param_indices.push_back(
+            static_cast<int>(std::distance(amici_ids.begin(), position))
+        );
+    }
+}
+
+void DeterministicModule::setMacroInterval(
+    int micro_steps
+) {
+
+    this->macro_interval = std::max(micro_steps, 1);
+
+    // the cached window, if any, was computed on the old grid
+    this->macro_states.clear();
+}
+
+void DeterministicModule::setSpeculativeStepping(
+    double tolerance
+) {
+
+    this->speculation_tolerance = std::max(tolerance, 0.0);
+
+    // any stashed lookahead was solved under the old tolerance regime
+    this->speculative_step = -1;
+}
+
+bool DeterministicModule::speculationHolds() {
+
+    // the exchange set may have grown since the lookahead was solved
+    if (this->predicted_exchange_values.size() !=
+        this->current_exchange_inputs.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < this->predicted_exchange_values.size(); i++) {
+
+        double actual = this->current_exchange_inputs[i];
+        double predicted = this->predicted_exchange_values[i];
+
+        double scale = std::max(std::abs(actual), std::abs(predicted));
+
+        if (std::abs(actual - predicted) >
+            this->speculation_tolerance * std::max(scale, 1e-12)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DeterministicModule::speculateNextStep(
+    int step
+) {
+
+    // sensitivity runs carry gradient state the lookahead would
+    // clobber; macro mode amortizes solves already
+    if (this->macro_interval > 1 ||
+        !this->sensitivity_param_indices.empty()) {
+        return;
+    }
+
+    size_t num_pairs = this->exchange_pairs.size();
+
+    // coupled runs need at least one captured boundary exchange to
+    // extrapolate from; decoupled runs predict vacuously
+    if (num_pairs > 0 && this->current_exchange_inputs.size() != num_pairs) {
+        return;
+    }
+
+    // linear extrapolation of each input from its last two applied
+    // values; before a second boundary exists the prediction is flat
+    this->predicted_exchange_values.assign(num_pairs, 0.0);
+
+    for (size_t i = 0; i < num_pairs; i++) {
+
+        double current = this->current_exchange_inputs[i];
+
+        double previous = i < this->previous_exchange_inputs.size()
+            ? this->previous_exchange_inputs[i]
+            : current;
+
+        this->predicted_exchange_values[i] = 2.0 * current - previous;
+    }
+
+    // push the predictions; only fixed-parameter pairs reach the solver
+    bool amici_dirty = false;
+
+    if (num_pairs > 0) {
+
+        if (this->fixed_parameter_cache.empty()) {
+            this->fixed_parameter_cache = this->model->getFixedParameters();
+        }
+
+        std::vector<double> predicted_cache = this->fixed_parameter_cache;
+
+        for (size_t i = 0; i < num_pairs; i++) {
+
+            if (this->fixed_param_indices[i] >= 0 &&
+                this->predicted_exchange_values[i] !=
+                    this->current_exchange_inputs[i]) {
+
+                predicted_cache[this->fixed_param_indices[i]] =
+                    this->predicted_exchange_values[i];
+                amici_dirty = true;
+            }
+        }
+
+        if (amici_dirty) {
+            this->model->setFixedParameters(predicted_cache);
+        }
+    }
+
+    this->model->setInitialStates(this->current_state);
+
+    std::unique_ptr<amici::ReturnData> rdata;
+
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "amici_speculate");
+        rdata = amici::runAmiciSimulation(*solver, nullptr, *model);
+    }
+
+    int n_species = rdata->nx;
+    size_t last_idx = static_cast<size_t>(rdata->nt - 1) * n_species;
+
+    this->speculative_state.assign(
+        rdata->x.begin() + last_idx,
+        rdata->x.begin() + last_idx + n_species
+    );
+
+    this->speculative_step = step + 1;
+
+    // the model must leave with the actual parameters: a quiescent
+    // boundary exchange skips its push and would otherwise hand the
+    // rollback solve the predictions
+    if (amici_dirty) {
+        this->model->setFixedParameters(this->fixed_parameter_cache);
+    }
+}
+
+void DeterministicModule::findOverlappingIds(
+    const Model* alternate_model
+) {
+
+    size_t first_new = this->exchange_pairs.size();
+
+    BaseModule::findOverlappingIds(alternate_model);
+
+    std::vector<std::string> fixed_ids = this->model->getFixedParameterIds();
+
+    // map each newly resolved pair to its AMICI fixed-parameter index
+    for (size_t i = first_new; i < this->exchange_pairs.size(); i++) {
+
+        auto position = std::find(
+            fixed_ids.begin(),
+            fixed_ids.end(),
+            this->exchange_pairs[i].parameter->getId()
+        );
+
+        this->fixed_param_indices.push_back(
+            position != fixed_ids.end()
+                ? static_cast<int>(std::distance(fixed_ids.begin(), position))
+                : -1
+        );
+    }
+}
+
+void DeterministicModule::bindParameterOverrides(
+    const std::vector<std::string>& parameter_ids
 ) {
 
-    std::vector<double> state_vector(this->results_matrix.size());
+    BaseModule::bindParameterOverrides(parameter_ids);
+
+    std::vector<std::string> fixed_ids = this->model->getFixedParameterIds();
+
+    this->override_fixed_indices.clear();
+    this->override_fixed_indices.reserve(parameter_ids.size());
 
-    state_vector = this->results_matrix[
-        (timestep > 0) ? timestep - 1 : timestep
-    ];
+    for (const std::string& id : parameter_ids) {
+
+        auto position = std::find(fixed_ids.begin(), fixed_ids.end(), id);
+
+        this->override_fixed_indices.push_back(
+            position != fixed_ids.end()
+                ? static_cast<int>(std::distance(fixed_ids.begin(), position))
+                : -1
+        );
+    }
+}
+
+void DeterministicModule::applyParameterOverrides(
+    const std::vector<double>& values
+) {
+
+    BaseModule::applyParameterOverrides(values);
+
+    if (this->fixed_parameter_cache.empty()) {
+        this->fixed_parameter_cache = this->model->getFixedParameters();
+    }
+
+    bool amici_dirty = false;
+
+    size_t count = std::min(
+        values.size(), this->override_fixed_indices.size()
+    );
+
+    for (size_t i = 0; i < count; i++) {
+
+        if (this->override_fixed_indices[i] >= 0) {
+            this->fixed_parameter_cache[this->override_fixed_indices[i]] =
+                values[i];
+            amici_dirty = true;
+        }
+    }
 
-    return state_vector;
+    // one batched push into the live model; no reconstruction
+    if (amici_dirty) {
+        this->model->setFixedParameters(this->fixed_parameter_cache);
+    }
 }
 
 void DeterministicModule::updateParameters() {
-    
-    for (const auto& module : this->targets) {
 
-        SBMLHandler alternate_model = module->handler;
+    if (this->exchange_pairs.empty()) {
+        return;
+    }
 
-        for (int i = 0; i < this->overlapping_params.size(); i++) {
+    if (this->fixed_parameter_cache.empty()) {
+        this->fixed_parameter_cache = this->model->getFixedParameters();
+    }
 
-            // Deterministic model needs both AMICI and SBML set:
-            //AMICI
-            this->model->setFixedParameterById(
-                this->overlapping_params[i], 
-                alternate_model.model->getSpecies(this->overlapping_params[i])->getInitialConcentration()
-            );
+    bool amici_dirty = false;
 
-            //SBML
-            this->sbml->getParameter(this->overlapping_params[i])->setValue(
-                alternate_model.model->getSpecies(this->overlapping_params[i])->getInitialConcentration()
-            );
+    // speculation reads applied inputs at this boundary, where the
+    // partner's published slots are stable; shift the two-entry history
+    // the lookahead extrapolates from and validates against
+    if (this->speculation_tolerance > 0.0) {
+        this->previous_exchange_inputs = this->current_exchange_inputs;
+        this->current_exchange_inputs.resize(this->exchange_pairs.size());
+    }
+
+    // every lookup was resolved once in findOverlappingIds; the per-step
+    // exchange is array reads and writes against the cached vector
+    for (size_t i = 0; i < this->exchange_pairs.size(); i++) {
+
+        double value = this->readExchangedValue(i);
+
+        if (this->speculation_tolerance > 0.0) {
+            this->current_exchange_inputs[i] = value;
         }
 
+        // quiescent pairs are skipped, so an all-quiet exchange avoids
+        // the setFixedParameters push and its solver re-setup entirely
+        double last = this->last_exchanged_values[i];
+
+        if (last == last && std::abs(value - last) <= this->exchange_tolerance) {
+            continue;
+        }
+
+        this->last_exchanged_values[i] = value;
+
+        // AMICI only on the hot path, batched into one setFixedParameters
+        // push below; the libSBML mirror is deferred to the explicit
+        // syncExchangedParameters call since nothing reads it per step
+        if (this->fixed_param_indices[i] >= 0) {
+            this->fixed_parameter_cache[this->fixed_param_indices[i]] = value;
+            amici_dirty = true;
+        }
+    }
+
+    if (amici_dirty) {
+        this->model->setFixedParameters(this->fixed_parameter_cache);
+    }
+}
+
+void DeterministicModule::reportEntityProfile(
+    std::ostream& out
+) {
+
+    if (!this->entity_profiling || this->profiled_solves == 0) {
+        return;
+    }
+
+    // one totals block rather than a ranking: CVODES cost lives in the
+    // whole system's stiffness, and these counters say whether the
+    // integrator is stepping hard or failing and retrying
+    out << "module " << this->algorithm_id
+        << ": CVODES totals over " << this->profiled_solves << " solves\n";
+
+    out << "integrator_steps\t" << this->cvodes_steps << '\n'
+        << "rhs_evaluations\t" << this->cvodes_rhs_evals << '\n'
+        << "error_test_failures\t" << this->cvodes_errtest_fails << '\n'
+        << "nonlinear_conv_failures\t" << this->cvodes_nonlin_fails << '\n'
+        << "steps_per_solve\t"
+        << static_cast<double>(this->cvodes_steps)
+            / static_cast<double>(this->profiled_solves)
+        << '\n';
+
+    if (this->speculation_tolerance > 0.0) {
+        out << "speculative_commits\t" << this->speculation_hits << '\n'
+            << "speculative_rollbacks\t" << this->speculation_misses << '\n';
     }
 }
@@ -0,0 +1,242 @@
+/**
+ * @file: ExperimentManifest.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Loader for the benchmarks/* YAML experiment manifests
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+
+//Internal Libraries
+#include "singlecell/ExperimentManifest.h"
+
+//=========================Function Definitions=============================//
+
+/**
+ * @brief trims leading and trailing whitespace from one manifest token
+ *
+ * @param text the raw token
+ *
+ * @returns the trimmed token, empty when only whitespace remained
+ */
+static std::string trim(
+    const std::string& text
+) {
+
+    size_t first = text.find_first_not_of(" \t\r");
+
+    if (first == std::string::npos) {
+        return "";
+    }
+
+    size_t last = text.find_last_not_of(" \t\r");
+
+    return text.substr(first, last - first + 1);
+}
+
+/**
+ * @brief resolves one manifest-relative path against the manifest's
+ * directory; absolute paths pass through untouched
+ *
+ * @param base_dir the manifest's directory
+ * @param path the path as written in the manifest
+ *
+ * @returns the resolved path
+ */
+static std::string resolvePath(
+    const std::string& base_dir,
+    const std::string& path
+) {
+
+    if (path.empty() || path.front() == '/' || base_dir.empty()) {
+        return path;
+    }
+
+    return base_dir + "/" + path;
+}
+
+//=============================Class Details================================//
+ExperimentManifest ExperimentManifest::load(
+    const std::string& manifest_path
+) {
+
+    std::ifstream manifest_file(manifest_path);
+
+    if (!manifest_file.is_open()) {
+        throw std::runtime_error(
+            "Could not open manifest file: " + manifest_path
+        );
+    }
+
+    ExperimentManifest manifest;
+
+    // manifest-relative paths resolve against the manifest's directory,
+    // and the basename names the problem when the block declares none
+    size_t slash = manifest_path.rfind('/');
+
+    std::string base_dir =
+        slash == std::string::npos ? "" : manifest_path.substr(0, slash);
+
+    std::string basename =
+        slash == std::string::npos
+            ? manifest_path
+            : manifest_path.substr(slash + 1);
+
+    size_t dot = basename.rfind('.');
+
+    manifest.name = dot == std::string::npos
+        ? basename
+        : basename.substr(0, dot);
+
+    // the file-list key the '- item' lines below it append into; a
+    // scalar or unknown key closes the open list
+    std::vector<std::string>* active_list = nullptr;
+
+    std::string line;
+
+    while (std::getline(manifest_file, line)) {
+
+        // strip comments, then skip blank lines
+        size_t comment = line.find('#');
+
+        if (comment != std::string::npos) {
+            line = line.substr(0, comment);
+        }
+
+        std::string entry = trim(line);
+
+        if (entry.empty()) {
+            continue;
+        }
+
+        // '- ' prefixes both list items and the first key of a problem
+        // block; strip it and let the ':' test below pick the meaning
+        if (entry.front() == '-') {
+            entry = trim(entry.substr(1));
+        }
+
+        size_t sep = entry.find(':');
+
+        if (sep == std::string::npos) {
+
+            // a bare item extends the open file list
+            if (active_list != nullptr) {
+                active_list->push_back(resolvePath(base_dir, entry));
+            }
+
+            continue;
+        }
+
+        std::string key = trim(entry.substr(0, sep));
+        std::string value = trim(entry.substr(sep + 1));
+
+        active_list = nullptr;
+
+        if (key == "condition_files") {
+            active_list = &manifest.condition_files;
+
+        } else if (key == "measurement_files") {
+            active_list = &manifest.measurement_files;
+
+        } else if (key == "observable_files") {
+            active_list = &manifest.observable_files;
+
+        } else if (key == "sbml_files") {
+            active_list = &manifest.sbml_files;
+
+        } else if (key == "name" && !value.empty()) {
+            manifest.name = value;
+
+        } else if (key == "cell_count" && !value.empty()) {
+            manifest.cell_count =
+                static_cast<int>(std::strtol(value.c_str(), nullptr, 10));
+        }
+
+        // format_version, parameter_file and the problems header carry
+        // nothing the runner consumes; they fall through ignored
+    }
+
+    return manifest;
+}
+
+std::vector<std::pair<std::string, std::string>>
+ExperimentManifest::loadObservables(
+    const std::vector<std::string>& observable_tsvs
+) {
+
+    std::vector<std::pair<std::string, std::string>> observables;
+
+    for (const std::string& path : observable_tsvs) {
+
+        std::ifstream table(path);
+
+        if (!table.is_open()) {
+            throw std::runtime_error(
+                "Could not open observables file: " + path
+            );
+        }
+
+        std::string line;
+
+        if (!std::getline(table, line)) {
+            continue;
+        }
+
+        // locate the id and formula columns from the header so extra
+        // columns like noiseFormula never shift the pairing
+        std::vector<std::string> header;
+        std::stringstream header_stream(line);
+        std::string field;
+
+        while (std::getline(header_stream, field, '\t')) {
+            header.push_back(trim(field));
+        }
+
+        size_t id_col = header.size();
+        size_t formula_col = header.size();
+
+        for (size_t i = 0; i < header.size(); i++) {
+
+            if (header[i] == "observableId") {
+                id_col = i;
+            } else if (header[i] == "observableFormula") {
+                formula_col = i;
+            }
+        }
+
+        if (id_col == header.size() || formula_col == header.size()) {
+            throw std::runtime_error(
+                "Observables file missing observableId or "
+                "observableFormula column: " + path
+            );
+        }
+
+        while (std::getline(table, line)) {
+
+            std::vector<std::string> row;
+            std::stringstream row_stream(line);
+
+            while (std::getline(row_stream, field, '\t')) {
+                row.push_back(trim(field));
+            }
+
+            if (row.size() <= id_col || row.size() <= formula_col ||
+                row[id_col].empty()) {
+                continue;
+            }
+
+            observables.emplace_back(row[id_col], row[formula_col]);
+        }
+    }
+
+    return observables;
+}
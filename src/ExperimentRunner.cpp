@@ -0,0 +1,540 @@
+/**
+ * @file ExperimentRunner.cpp
+ *
+ * @brief Runs PEtab-style condition x cell experiments across a worker
+ * pool in one process, consuming the TSV tables directly
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ */
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+// Internal Libraries
+#include "singlecell/Logger.h"
+#include "singlecell/SingleCell.h"
+#include "singlecell/ResultsArchive.h"
+#include "singlecell/ExperimentRunner.h"
+
+//=============================Class Details================================//
+namespace {
+
+    /**
+     * @brief true when the cell text is empty or a spelled-out NaN, the
+     * two ways pandas-written tables mark absent values
+     */
+    bool isMissing(const std::string& text) {
+
+        if (text.empty()) {
+            return true;
+        }
+
+        std::string lowered = text;
+        std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+
+        return lowered == "nan";
+    }
+}
+
+ExperimentRunner::ExperimentRunner(
+    std::vector<std::string> sbml_paths,
+    std::string conditions_tsv,
+    std::string measurements_tsv,
+    int cell_count
+) : cell_count(cell_count > 0 ? cell_count : 1),
+    sbml_paths(std::move(sbml_paths)) {
+
+    // Conditions table: one spec per row, every column besides the id and
+    // display-name columns is an entity override
+    std::vector<std::string> condition_header;
+
+    for (const auto& row : readTsv(conditions_tsv, condition_header)) {
+
+        ConditionSpec spec;
+
+        auto id_cell = row.find("conditionId");
+
+        if (id_cell == row.end() || isMissing(id_cell->second)) {
+            continue;
+        }
+
+        spec.id = id_cell->second;
+
+        for (const std::string& column : condition_header) {
+
+            if (column == "conditionId" || column == "conditionName") {
+                continue;
+            }
+
+            auto value_cell = row.find(column);
+
+            if (value_cell == row.end() || isMissing(value_cell->second)) {
+                continue;
+            }
+
+            try {
+                spec.overrides.emplace_back(
+                    column, std::stod(value_cell->second)
+                );
+            } catch (const std::exception&) {
+                SC_LOG_WARN("Non-numeric override " << value_cell->second
+                    << " for " << column << " in condition " << spec.id);
+            }
+        }
+
+        this->condition_index[spec.id] = this->conditions.size();
+        this->conditions.push_back(std::move(spec));
+    }
+
+    // Measurements table: stop time per condition is its largest
+    // measurement time; the first preequilibration entry wires the
+    // dependency edge
+    std::vector<std::string> measurement_header;
+
+    bool has_preeq = false;
+
+    auto rows = readTsv(measurements_tsv, measurement_header);
+
+    for (const std::string& column : measurement_header) {
+        if (column == "preequilibrationConditionId") {
+            has_preeq = true;
+        }
+    }
+
+    for (const auto& row : rows) {
+
+        auto sim_cell = row.find("simulationConditionId");
+
+        if (sim_cell == row.end() || isMissing(sim_cell->second)) {
+            continue;
+        }
+
+        auto found = this->condition_index.find(sim_cell->second);
+
+        if (found == this->condition_index.end()) {
+
+            // measured but absent from the conditions table: run it with
+            // no overrides rather than dropping the measurements
+            ConditionSpec bare;
+            bare.id = sim_cell->second;
+
+            found = this->condition_index.emplace(
+                bare.id, this->conditions.size()
+            ).first;
+
+            this->conditions.push_back(std::move(bare));
+        }
+
+        ConditionSpec& spec = this->conditions[found->second];
+
+        auto time_cell = row.find("time");
+
+        if (time_cell != row.end() && !isMissing(time_cell->second)) {
+
+            try {
+                spec.stop_time = std::max(
+                    spec.stop_time, std::stod(time_cell->second)
+                );
+            } catch (const std::exception&) {
+                SC_LOG_WARN("Non-numeric measurement time "
+                    << time_cell->second << " for condition " << spec.id);
+            }
+        }
+
+        if (has_preeq) {
+
+            auto preeq_cell = row.find("preequilibrationConditionId");
+
+            if (preeq_cell != row.end() && !isMissing(preeq_cell->second)
+                && spec.preequilibration_id.empty()) {
+
+                spec.preequilibration_id = preeq_cell->second;
+            }
+        }
+    }
+
+    // resolve dependency levels and mark prerequisites; prerequisites run
+    // raw species output so dependents can seed from their final state
+    for (ConditionSpec& spec : this->conditions) {
+
+        std::vector<std::string> visiting;
+        spec.level = this->resolveLevel(spec.id, visiting);
+
+        if (!spec.preequilibration_id.empty()) {
+
+            auto preeq = this->condition_index.find(spec.preequilibration_id);
+
+            if (preeq != this->condition_index.end()) {
+                this->conditions[preeq->second].is_prerequisite = true;
+            } else {
+                SC_LOG_WARN("Preequilibration condition "
+                    << spec.preequilibration_id << " of " << spec.id
+                    << " has no conditions or measurements row; ignoring");
+                spec.preequilibration_id.clear();
+            }
+        }
+    }
+}
+
+int ExperimentRunner::resolveLevel(
+    const std::string& condition_id,
+    std::vector<std::string>& visiting
+) {
+
+    auto found = this->condition_index.find(condition_id);
+
+    if (found == this->condition_index.end()) {
+        return 0;
+    }
+
+    ConditionSpec& spec = this->conditions[found->second];
+
+    if (spec.preequilibration_id.empty()) {
+        return 0;
+    }
+
+    if (std::find(visiting.begin(), visiting.end(), condition_id)
+        != visiting.end()) {
+        throw std::runtime_error(
+            "Circular preequilibration dependency at " + condition_id
+        );
+    }
+
+    visiting.push_back(condition_id);
+
+    return 1 + this->resolveLevel(spec.preequilibration_id, visiting);
+}
+
+std::vector<std::unordered_map<std::string, std::string>>
+ExperimentRunner::readTsv(
+    const std::string& path,
+    std::vector<std::string>& header
+) {
+
+    std::ifstream table(path);
+
+    if (!table.is_open()) {
+        throw std::runtime_error("Could not open table: " + path);
+    }
+
+    auto split = [](const std::string& line) {
+
+        std::vector<std::string> cells;
+        std::stringstream stream(line);
+        std::string cell;
+
+        while (std::getline(stream, cell, '\t')) {
+
+            if (!cell.empty() && cell.back() == '\r') {
+                cell.pop_back();
+            }
+
+            cells.push_back(cell);
+        }
+
+        return cells;
+    };
+
+    std::string line;
+
+    if (!std::getline(table, line)) {
+        throw std::runtime_error("Empty table: " + path);
+    }
+
+    header = split(line);
+
+    std::vector<std::unordered_map<std::string, std::string>> rows;
+
+    while (std::getline(table, line)) {
+
+        if (line.empty()) {
+            continue;
+        }
+
+        std::vector<std::string> cells = split(line);
+
+        std::unordered_map<std::string, std::string> row;
+
+        for (size_t c = 0; c < header.size() && c < cells.size(); c++) {
+            row[header[c]] = cells[c];
+        }
+
+        rows.push_back(std::move(row));
+    }
+
+    return rows;
+}
+
+void ExperimentRunner::setSeed(
+    unsigned long long seed
+) {
+
+    this->rng_seed = seed;
+}
+
+void ExperimentRunner::setObservables(
+    const std::vector<std::pair<std::string, std::string>>& observables
+) {
+
+    this->observables = observables;
+}
+
+void ExperimentRunner::run(
+    double step,
+    int num_threads
+) {
+
+    // Tasks in topological order: conditions sorted by dependency level,
+    // then cells within each condition. The shared counter is claimed in
+    // this order, so any task a worker waits on was claimed before it
+    std::vector<size_t> condition_order(this->conditions.size());
+
+    for (size_t i = 0; i < condition_order.size(); i++) {
+        condition_order[i] = i;
+    }
+
+    std::stable_sort(
+        condition_order.begin(), condition_order.end(),
+        [this](size_t a, size_t b) {
+            return this->conditions[a].level < this->conditions[b].level;
+        }
+    );
+
+    struct Task {
+        size_t condition;
+        int cell;
+    };
+
+    std::vector<Task> tasks;
+    tasks.reserve(condition_order.size() * this->cell_count);
+
+    for (size_t i : condition_order) {
+        for (int cell = 1; cell <= this->cell_count; cell++) {
+            tasks.push_back({ i, cell });
+        }
+    }
+
+    size_t num_tasks = tasks.size();
+
+    this->task_ids.resize(num_tasks);
+    this->task_results.assign(num_tasks, {});
+    this->task_columns.assign(num_tasks, 0);
+    this->task_raw_results.assign(num_tasks, {});
+    this->task_raw_columns.assign(num_tasks, 0);
+    this->final_states.clear();
+
+    for (size_t t = 0; t < num_tasks; t++) {
+        this->task_ids[t] = this->conditions[tasks[t].condition].id
+            + "+" + std::to_string(tasks[t].cell);
+    }
+
+    if (num_threads <= 0) {
+        num_threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    if (num_threads > static_cast<int>(num_tasks)) {
+        num_threads = static_cast<int>(num_tasks);
+    }
+
+    // Shared work counter: idle workers claim the next task in order
+    std::atomic<size_t> next_task{0};
+
+    auto worker = [&]() {
+
+        // One resident session per worker: modules, compiled formulas and
+        // solver objects are built once and rewound between tasks
+        SingleCell single_cell(this->sbml_paths);
+
+        if (!this->observables.empty()) {
+            single_cell.setObservables(this->observables);
+        }
+
+        std::vector<std::string> species_ids =
+            single_cell.getGlobalSpeciesIds();
+
+        bool first_task = true;
+
+        while (true) {
+
+            size_t t = next_task.fetch_add(1);
+
+            if (t >= num_tasks) {
+                break;
+            }
+
+            const Task& task = tasks[t];
+            const ConditionSpec& spec = this->conditions[task.condition];
+
+            if (!first_task) {
+                single_cell.reset();
+            }
+
+            first_task = false;
+
+            if (this->rng_seed.has_value()) {
+
+                // Per-task substream keeps cells independent & replayable
+                single_cell.setSeed(
+                    this->rng_seed.value() + static_cast<unsigned long long>(t)
+                );
+            }
+
+            // seed from the prerequisite's final state for this cell; the
+            // claim order guarantees the producing task is already running
+            if (!spec.preequilibration_id.empty()) {
+
+                std::string preeq_key = spec.preequilibration_id
+                    + "+" + std::to_string(task.cell);
+
+                std::unique_lock<std::mutex> lock(this->state_mutex);
+
+                this->state_published.wait(lock, [this, &preeq_key] {
+                    return this->final_states.count(preeq_key) > 0;
+                });
+
+                const std::vector<double>& state =
+                    this->final_states[preeq_key];
+
+                lock.unlock();
+
+                for (size_t s = 0; s < species_ids.size() && s < state.size();
+                     s++) {
+                    single_cell.modify(species_ids[s], state[s]);
+                }
+            }
+
+            for (const auto& [entity_id, value] : spec.overrides) {
+                single_cell.modify(entity_id, value);
+            }
+
+            double stop = spec.stop_time > 0.0 ? spec.stop_time : step;
+
+            // prerequisites always run raw species so their final state
+            // can seed dependents; measurement conditions project to
+            // observables when any are registered, keeping the raw
+            // recording alongside so the archive stays re-projectable
+            bool project = !this->observables.empty()
+                && !spec.is_prerequisite;
+
+            std::vector<double> raw_results =
+                single_cell.simulateFlat(0.0, stop, step);
+
+            if (project) {
+
+                this->task_results[t] = single_cell.projectObservables(
+                    raw_results,
+                    static_cast<size_t>(single_cell.last_num_species)
+                );
+
+                this->task_columns[t] = this->observables.size();
+                this->task_raw_columns[t] =
+                    static_cast<size_t>(single_cell.last_num_species);
+                this->task_raw_results[t] = std::move(raw_results);
+
+            } else {
+
+                this->task_results[t] = std::move(raw_results);
+
+                this->task_columns[t] =
+                    static_cast<size_t>(single_cell.last_num_species);
+            }
+
+            if (spec.is_prerequisite) {
+
+                size_t cols = this->task_columns[t];
+                const std::vector<double>& results = this->task_results[t];
+
+                std::vector<double> final_state(
+                    results.end() - static_cast<long>(cols), results.end()
+                );
+
+                {
+                    std::lock_guard<std::mutex> lock(this->state_mutex);
+                    this->final_states[this->task_ids[t]] =
+                        std::move(final_state);
+                }
+
+                this->state_published.notify_all();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(num_threads);
+
+    for (int t = 0; t < num_threads; t++) {
+        pool.emplace_back(worker);
+    }
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+std::vector<std::string> ExperimentRunner::getGlobalSpeciesIds() {
+
+    SingleCell reference_cell(this->sbml_paths);
+
+    return reference_cell.getGlobalSpeciesIds();
+}
+
+void ExperimentRunner::saveArchive(
+    const std::string& output
+) {
+
+    ResultsArchiveWriter archive(output);
+
+    // column labels: species ids for raw tasks, observable names for
+    // projected ones, matched by row width per task
+    std::vector<std::string> species_ids = this->getGlobalSpeciesIds();
+
+    std::vector<std::string> observable_names;
+
+    for (const auto& [name, expression] : this->observables) {
+        observable_names.push_back(name);
+    }
+
+    for (size_t t = 0; t < this->task_ids.size(); t++) {
+
+        const std::vector<std::string>* labels = nullptr;
+
+        if (this->task_columns[t] == species_ids.size()) {
+            labels = &species_ids;
+        } else if (this->task_columns[t] == observable_names.size()) {
+            labels = &observable_names;
+        }
+
+        archive.append(
+            this->task_ids[t],
+            this->task_results[t],
+            this->task_columns[t],
+            labels != nullptr ? *labels : std::vector<std::string>{}
+        );
+
+        // projected tasks also archive their raw recording: observable
+        // tables are derivable from it, the reverse is not
+        if (t < this->task_raw_results.size() &&
+            !this->task_raw_results[t].empty()) {
+
+            archive.append(
+                this->task_ids[t] + "+state",
+                this->task_raw_results[t],
+                this->task_raw_columns[t],
+                this->task_raw_columns[t] == species_ids.size()
+                    ? species_ids : std::vector<std::string>{}
+            );
+        }
+    }
+
+    archive.finalize();
+}
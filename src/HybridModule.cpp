@@ -24,29 +24,24 @@
 #include "singlecell/utils.h"
 #include "singlecell/SBMLHandler.h"
 #include "singlecell/HybridModule.h"
+#include "singlecell/AmiciModelRegistry.h"
 
 // Third Party Libraries
 #include "amici/amici.h"
-#include "../amici_models/Hybrid/Hybrid.h"
 
 //=============================Class Details================================//
 HybridModule::HybridModule(
     SBMLHandler HybridModel
  ) : BaseModule(HybridModel)
  {
-    // Retrieve the Hybrid matrix from the sbml document.
-    this->stoichmat = HybridModel.getStoichiometricMatrix();
-
-    // List of formula strings to be parsed. <-- !!! Might swap for something ASTNode compatible later.
-    this->formulas_vector = HybridModel.getReactionExpressions();
+    this->module_kind = ModuleKind::Hybrid;
 
     //Instantiate SBML model
     this->sbml = HybridModel.model;
 
-    // // Import AMICI Model from 'bin/AMICI_MODELS/model
-    // this->model = std::make_unique<amici::model_Hybrid::Model_Hybrid>();
-    std::unique_ptr<amici::Model> new_model = std::make_unique<amici::model_Hybrid::Model_Hybrid>();
-    this->model = std::move(new_model);
+    // The registry dlopens the generated model on first use, so only the
+    // models a run touches ever pay construction or load cost
+    this->model = AmiciModelRegistry::create(this->sbml->getId());
     
     //Update AMICI model for any modifications present in SBML:
     this->model->setFixedParameters(HybridModel.getParameterValues());
@@ -71,45 +66,102 @@ void HybridModule::loadTargetModule(
 }
 
 void HybridModule::step(int step) {
-    // Get the (step - 1)th result
-    std::vector<double> last_record = this->getLastStepResult(step);
+    // Get the (step - 1)th result; a view, not a copy
+    const std::vector<double>& last_record = this->getLastStepResult(step);
 
-    //reset SBML species values:
-    this->handler.setState(last_record);
+    // Set initial state based on last record, AMICI to AMICI with no
+    // SBML round-trip; partners read the exchange slots, and the
+    // document is synced once at run end. Timepoints, tolerances and
+    // the solver instance are configured once in setSimulationSettings
+    model->setInitialStates(last_record);
 
-    // Set the single timepoint to simulate
-    std::vector<double> step_forward = {0.0, this->delta_t};
+    // Run the simulation with the persistent solver
+    std::unique_ptr<amici::ReturnData> rdata;
 
-    model->setTimepoints(step_forward);
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "amici_solve");
+        rdata = amici::runAmiciSimulation(*solver, nullptr, *model);
+    }
 
-    // Set initial state based on last record
-    model->setInitialStates(last_record);
+    // the ReturnData counters are cumulative over the solve's
+    // timepoints, so the final entry is this solve's total
+    if (this->entity_profiling) {
 
-    // Run the simulation
-    std::unique_ptr<amici::ReturnData> rdata = amici::runAmiciSimulation(*solver, nullptr, *model);
+        this->profiled_solves++;
+
+        if (!rdata->numsteps.empty()) {
+            this->cvodes_steps += rdata->numsteps.back();
+        }
+
+        if (!rdata->numrhsevals.empty()) {
+            this->cvodes_rhs_evals += rdata->numrhsevals.back();
+        }
 
-    // Extract results (assuming you want the final state)
-    std::vector<double> last_vals = this->getNewStepResult(*rdata);
+        if (!rdata->numerrtestfails.empty()) {
+            this->cvodes_errtest_fails += rdata->numerrtestfails.back();
+        }
+
+        if (!rdata->numnonlinsolvconvfails.empty()) {
+            this->cvodes_nonlin_fails +=
+                rdata->numnonlinsolvconvfails.back();
+        }
+    }
+
+    // Copy the final state straight into current_state; no intermediate
+    // step buffer, and recordCurrentState below writes the results row
+    // without another copy
+    int n_species = rdata->nx;
+    size_t last_idx = static_cast<size_t>(rdata->nt - 1) * n_species;
 
-    this->handler.setState(last_vals);
+    this->current_state.assign(
+        rdata->x.begin() + last_idx,
+        rdata->x.begin() + last_idx + n_species
+    );
 
-    // Record values to results matrix
-    BaseModule::recordStepResult(last_vals, step);
+    // Record values to results matrix; the exchange phase reads
+    // current_state through the slots, so no SBML mirror here
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "recording");
+        BaseModule::recordCurrentState(step);
+    }
 
 }
 
 void HybridModule::run(
-    std::vector<double> timepoints
+    const std::vector<double>& timepoints
 ) {
 
-    // Starting vector for simulation
-    std::vector<double> initial_state = this->getLastStepResult(0);
+    // Starting vector for simulation; a view, not a copy. The document
+    // is never read during the run — AMICI takes the state directly and
+    // syncStateToDocument mirrors the final state once at run end — so
+    // no per-run libSBML write happens here
+    const std::vector<double>& initial_state = this->getLastStepResult(0);
+
+    // As in DeterministicModule::run: with thinned recording, request
+    // only the recorded times and let CVODES dense output bridge the
+    // gaps rather than forcing an output at every fine grid point.
+    // Envelope summaries want full-rate states, so they keep the grid
+    bool thinned_grid = this->record_interval > 1
+        && this->summary_window == 0;
 
-    //reset SBML species values:
-    this->handler.setState(initial_state);
+    if (thinned_grid) {
 
-    // Set the all timepoints for total runtime
-    model->setTimepoints(timepoints);
+        std::vector<double> recorded_times;
+        recorded_times.reserve(
+            timepoints.size() / this->record_interval + 1
+        );
+
+        for (size_t i = 0; i < timepoints.size(); i += this->record_interval) {
+            recorded_times.push_back(timepoints[i]);
+        }
+
+        model->setTimepoints(recorded_times);
+
+    } else {
+
+        // Set the all timepoints for total runtime
+        model->setTimepoints(timepoints);
+    }
 
     // Set AMICI object initial state
     model->setInitialStates(initial_state);
@@ -117,22 +169,47 @@ void HybridModule::run(
     // Run the simulation
     std::unique_ptr<amici::ReturnData> rdata = amici::runAmiciSimulation(*solver, nullptr, *model);
 
-    int n_species = rdata->nx; // number of species
-    int n_timepoints = rdata->nt; //timepoints
+    if (this->record_interval == 1 && this->record_mask.empty() &&
+        this->results_window == 0) {
 
-    for (int i = 0; i < n_timepoints; i++) {
-        for (int j = 0; j < n_species; j++) {
+        // rdata->x is already flat time-major-by-species; copy it in one pass
+        std::copy(rdata->x.begin(), rdata->x.end(), this->results_data);
 
-            this->results_matrix[i][j] = rdata->x[i * n_species + j];
+    } else {
 
-        }
+        // thinned/masked/windowed recording goes row-by-row through the
+        // filter; the fine step index keeps the filter's row mapping intact
+        int n_species = rdata->nx;
 
+        for (int t = 0; t < rdata->nt; t++) {
+
+            std::vector<double> row(
+                rdata->x.begin() + static_cast<size_t>(t) * n_species,
+                rdata->x.begin() + static_cast<size_t>(t + 1) * n_species
+            );
+
+            int fine_step = thinned_grid ? t * this->record_interval : t;
+
+            BaseModule::recordStepResult(row, fine_step);
+        }
     }
+
+    // current_state is the one authoritative state buffer; the fast path
+    // above bypasses the recording filter that normally maintains it, so
+    // land the final solver row here for getCurrentState, continuation
+    // warm starts and the run-end document sync
+    size_t final_idx =
+        static_cast<size_t>(rdata->nt - 1) * static_cast<size_t>(rdata->nx);
+
+    this->current_state.assign(
+        rdata->x.begin() + final_idx,
+        rdata->x.begin() + final_idx + rdata->nx
+    );
 }
 
 std::vector<double> HybridModule::setAllSpeciesValues(
-                                        std::vector<double> current_states,
-                                        std::vector<double> update_states
+                                        const std::vector<double>& current_states,
+                                        const std::vector<double>& update_states
                                         ) {
 
     // Creating instance of list to be returned:
@@ -154,30 +231,6 @@ std::vector<double> HybridModule::setAllSpeciesValues(
 
 }
 
-std::vector<double> HybridModule::getNewStepResult(
-    const amici::ReturnData &rdata
-) {
-
-    int n_species = rdata.nx; // number of species
-    int n_timepoints = rdata.nt; 
-    
-    const std::vector<double>& all_species = rdata.x; // species trajectories flat array length n_species * n_timepoints
-
-    // this makes the start value of  our for-loop at rdata.x[-1, starting_column] in python terms
-    int last_idx = (n_timepoints-1) * n_species;
-
-    std::vector<double> last_species_values;
-    
-    // convert each species value from amici::realtype to double
-    for (int i = last_idx; i < last_idx + n_species; ++i) {
-
-        last_species_values.push_back(static_cast<double>(all_species[i]));
-    
-    }
-
-    return last_species_values;
-}
-
 void HybridModule::setSimulationSettings(
     double start, 
     double stop, 
@@ -186,15 +239,18 @@ void HybridModule::setSimulationSettings(
 
     this->delta_t = step;
 
-    // Create an instance of the solver class
-    this->solver = this->model->getSolver();
-
     int numSpecies = this->sbml->getNumSpecies();
 
-    this->timesteps = BaseModule::setTimeSteps(start, stop, step);
+    // repeat runs with the same step and profile keep the configured
+    // solver and its warm internals; only the resets below run again
+    bool reuse_solver = this->solver != nullptr
+        && this->configured_step == step
+        && this->solver_profile.matches(this->configured_profile);
+
+    this->time_grid = BaseModule::sharedTimeSteps(start, stop, step);
 
-    // populate results_matrix member with proper size
-    this->results_matrix = BaseModule::createResultsMatrix(numSpecies, timesteps.size());
+    // populate the flat results buffer with proper size
+    BaseModule::createResultsMatrix(numSpecies, this->time_grid->size());
 
     // record initial state as first vector in results_matrix member
     BaseModule::recordStepResult(
@@ -202,47 +258,127 @@ void HybridModule::setSimulationSettings(
         0
     );
 
-    // Assign solver settings
-    solver->setAbsoluteTolerance(1e-10);
-    solver->setRelativeTolerance(1e-6);
-    solver->setMaxSteps(100000);
+    if (!reuse_solver) {
+
+        // Create an instance of the solver class
+        this->solver = this->model->getSolver();
+
+        // Assign solver settings from the active profile
+        solver->setAbsoluteTolerance(this->solver_profile.absolute_tolerance);
+        solver->setRelativeTolerance(this->solver_profile.relative_tolerance);
+        solver->setMaxSteps(this->solver_profile.max_steps);
+        solver->setStabilityLimitFlag(this->solver_profile.stability_limit);
+
+        // dense linear algebra is cubic in the state count; at auto the
+        // large models take KLU, whose factorizations scale with Jacobian
+        // nnz. The solver instance persists across the per-step solves, so
+        // the sparse structures are allocated once per session
+        if (this->solver_profile.linear_solver == "KLU" ||
+            (this->solver_profile.linear_solver == "auto" &&
+             numSpecies > SolverProfile::sparse_threshold)) {
+
+            solver->setLinearSolver(amici::LinearSolver::KLU);
+        }
+
+        // Stepped runs integrate over the same [0, delta_t] window every call;
+        // set it once here instead of re-sending it each step
+        model->setTimepoints({0.0, this->delta_t});
+
+        this->configured_step = step;
+        this->configured_profile = this->solver_profile;
+    }
+
+    // Reserve the stepped-run output buffer up front
+    this->current_state.reserve(numSpecies);
 
     this->updateParameters();
 }
 
-std::vector<double> HybridModule::getLastStepResult(
-    int timestep
+void HybridModule::findOverlappingIds(
+    const Model* alternate_model
 ) {
 
-    std::vector<double> state_vector(this->results_matrix.size());
+    size_t first_new = this->exchange_pairs.size();
+
+    BaseModule::findOverlappingIds(alternate_model);
+
+    std::vector<std::string> fixed_ids = this->model->getFixedParameterIds();
+
+    // map each newly resolved pair to its AMICI fixed-parameter index
+    for (size_t i = first_new; i < this->exchange_pairs.size(); i++) {
 
-    state_vector = this->results_matrix[
-        (timestep > 0) ? timestep - 1 : timestep
-    ];
+        auto position = std::find(
+            fixed_ids.begin(),
+            fixed_ids.end(),
+            this->exchange_pairs[i].parameter->getId()
+        );
 
-    return state_vector;
+        this->fixed_param_indices.push_back(
+            position != fixed_ids.end()
+                ? static_cast<int>(std::distance(fixed_ids.begin(), position))
+                : -1
+        );
+    }
 }
 
 void HybridModule::updateParameters() {
-    
-    for (const auto& module : this->targets) {
 
-        SBMLHandler alternate_model = module->handler;
+    if (this->exchange_pairs.empty()) {
+        return;
+    }
 
-        for (int i = 0; i < this->overlapping_params.size(); i++) {
+    if (this->fixed_parameter_cache.empty()) {
+        this->fixed_parameter_cache = this->model->getFixedParameters();
+    }
 
-            // Hybrid model needs both AMICI and SBML set:
-            //AMICI
-            this->model->setFixedParameterById(
-                this->overlapping_params[i], 
-                alternate_model.model->getSpecies(this->overlapping_params[i])->getInitialConcentration()
-            );
+    bool amici_dirty = false;
 
-            //SBML
-            this->sbml->getParameter(this->overlapping_params[i])->setValue(
-                alternate_model.model->getSpecies(this->overlapping_params[i])->getInitialConcentration()
-            );
+    // every lookup was resolved once in findOverlappingIds; the per-step
+    // exchange is array reads and writes against the cached vector
+    for (size_t i = 0; i < this->exchange_pairs.size(); i++) {
+
+        double value = this->readExchangedValue(i);
+
+        // quiescent pairs are skipped, so an all-quiet exchange avoids
+        // the setFixedParameters push and its solver re-setup entirely
+        double last = this->last_exchanged_values[i];
+
+        if (last == last && std::abs(value - last) <= this->exchange_tolerance) {
+            continue;
         }
 
+        this->last_exchanged_values[i] = value;
+
+        // AMICI only, batched into one setFixedParameters push below;
+        // the SBML mirror is deferred to syncExchangedParameters
+        if (this->fixed_param_indices[i] >= 0) {
+            this->fixed_parameter_cache[this->fixed_param_indices[i]] = value;
+            amici_dirty = true;
+        }
+    }
+
+    if (amici_dirty) {
+        this->model->setFixedParameters(this->fixed_parameter_cache);
     }
 }
+
+void HybridModule::reportEntityProfile(
+    std::ostream& out
+) {
+
+    if (!this->entity_profiling || this->profiled_solves == 0) {
+        return;
+    }
+
+    out << "module " << this->algorithm_id
+        << ": CVODES totals over " << this->profiled_solves << " solves\n";
+
+    out << "integrator_steps\t" << this->cvodes_steps << '\n'
+        << "rhs_evaluations\t" << this->cvodes_rhs_evals << '\n'
+        << "error_test_failures\t" << this->cvodes_errtest_fails << '\n'
+        << "nonlinear_conv_failures\t" << this->cvodes_nonlin_fails << '\n'
+        << "steps_per_solve\t"
+        << static_cast<double>(this->cvodes_steps)
+            / static_cast<double>(this->profiled_solves)
+        << '\n';
+}
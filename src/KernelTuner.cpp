@@ -0,0 +1,118 @@
+/**
+ * @file KernelTuner.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Persisted per-model kernel dispatch configuration
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <sstream>
+
+// Internal Libraries
+#include "singlecell/KernelTuner.h"
+
+namespace {
+
+// bumped whenever the config fields or their meaning change, so stale
+// tuning files from older builds are re-tuned instead of misread
+const char* tuning_magic = "SCTUNE001";
+
+} // namespace
+
+//=============================Class Details================================//
+std::string KernelTuner::hostSignature() {
+
+    std::ostringstream signature;
+
+    signature << std::thread::hardware_concurrency();
+
+#ifdef _OPENMP
+    signature << "_omp";
+#else
+    signature << "_serial";
+#endif
+
+    return signature.str();
+}
+
+bool KernelTuner::load(
+    const std::string& path,
+    uint64_t model_hash,
+    Config& config
+) {
+
+    std::ifstream in(path);
+
+    if (!in || model_hash == 0) {
+        return false;
+    }
+
+    std::string magic;
+    uint64_t stored_hash = 0;
+    std::string stored_host;
+
+    in >> magic >> stored_hash >> stored_host;
+
+    if (!in || magic != tuning_magic || stored_hash != model_hash ||
+        stored_host != hostSignature()) {
+        return false;
+    }
+
+    Config read;
+
+    in >> read.incremental_propensities
+       >> read.parallel_propensities
+       >> read.scatter_state_update
+       >> read.ptrs_mean_cutoff;
+
+    if (!in) {
+        return false;
+    }
+
+    config = read;
+
+    return true;
+}
+
+void KernelTuner::save(
+    const std::string& path,
+    uint64_t model_hash,
+    const Config& config
+) {
+
+    if (model_hash == 0) {
+        return;
+    }
+
+    // write-then-rename, as the model snapshot does: a concurrent reader
+    // sees either the old file or the complete new one
+    std::string temp_path = path + ".tmp";
+
+    {
+        std::ofstream out(temp_path);
+
+        if (!out) {
+            return;
+        }
+
+        out << tuning_magic << '\n'
+            << model_hash << '\n'
+            << hostSignature() << '\n'
+            << config.incremental_propensities << '\n'
+            << config.parallel_propensities << '\n'
+            << config.scatter_state_update << '\n'
+            << config.ptrs_mean_cutoff << '\n';
+
+        if (!out) {
+            return;
+        }
+    }
+
+    std::rename(temp_path.c_str(), path.c_str());
+}
@@ -0,0 +1,639 @@
+/**
+ * @file LoadGenerator.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief singlecell-loadgen: saturating load harness for the daemon mode
+ *
+ * Replays a request mix — recorded from a file or synthesized from
+ * override and horizon distributions — against a running daemon socket
+ * at configurable concurrency, and reports latency percentiles and
+ * throughput. The frames it writes and the responses it checks follow
+ * the daemon's binary protocol exactly, so a run doubles as a protocol
+ * conformance pass: any malformed response counts as a violation and
+ * fails the exit status. Dependency-free like the diff and recover
+ * tools, so it builds and starts instantly on the machines that do the
+ * capacity planning
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstdio>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <algorithm>
+
+//System Libraries
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+
+//=========================Function Definitions=============================//
+namespace {
+
+    // one request of the replayed mix: its override set and time grid
+    struct RequestSpec {
+        std::vector<std::pair<std::string, double>> overrides;
+        double start = 0.0;
+        double stop = 60.0;
+        double step = 30.0;
+    };
+
+    // a synthetic override distribution: id sampled uniformly in [lo, hi]
+    struct OverrideRange {
+        std::string entity_id;
+        double lo = 0.0;
+        double hi = 0.0;
+    };
+
+    // per-worker tally merged after the run
+    struct WorkerStats {
+        std::vector<double> latencies_ms;
+        int request_errors = 0;
+        int protocol_violations = 0;
+    };
+
+    /**
+     * @brief reads exactly len bytes from fd, riding out short reads
+     *
+     * @returns true on success, false on EOF or a read error
+     */
+    bool readFully(int fd, void* buffer, size_t len) {
+
+        char* out = static_cast<char*>(buffer);
+
+        while (len > 0) {
+
+            ssize_t got = read(fd, out, len);
+
+            if (got <= 0) {
+                return false;
+            }
+
+            out += got;
+            len -= static_cast<size_t>(got);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief writes exactly len bytes to fd, riding out short writes
+     *
+     * @returns true on success, false on a write error
+     */
+    bool writeFully(int fd, const void* buffer, size_t len) {
+
+        const char* in = static_cast<const char*>(buffer);
+
+        while (len > 0) {
+
+            ssize_t put = write(fd, in, len);
+
+            if (put <= 0) {
+                return false;
+            }
+
+            in += put;
+            len -= static_cast<size_t>(put);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief connects a stream socket to the daemon's Unix socket path
+     *
+     * @returns the connected descriptor, or -1 on failure
+     */
+    int connectDaemon(const std::string& socket_path) {
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (fd < 0) {
+            return -1;
+        }
+
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(
+            address.sun_path, socket_path.c_str(),
+            sizeof(address.sun_path) - 1
+        );
+
+        if (connect(fd,
+                    reinterpret_cast<sockaddr*>(&address),
+                    sizeof(address)) < 0) {
+            close(fd);
+            return -1;
+        }
+
+        return fd;
+    }
+
+    /**
+     * @brief serializes one request into a single frame buffer, so each
+     * request costs one write call regardless of its override count
+     */
+    std::vector<char> buildFrame(const RequestSpec& request) {
+
+        std::vector<char> frame;
+
+        auto append = [&frame](const void* bytes, size_t len) {
+            const char* in = static_cast<const char*>(bytes);
+            frame.insert(frame.end(), in, in + len);
+        };
+
+        int32_t num_overrides =
+            static_cast<int32_t>(request.overrides.size());
+        append(&num_overrides, sizeof(num_overrides));
+
+        for (const auto& [entity_id, value] : request.overrides) {
+
+            int32_t id_length = static_cast<int32_t>(entity_id.size());
+            append(&id_length, sizeof(id_length));
+            append(entity_id.data(), entity_id.size());
+            append(&value, sizeof(value));
+        }
+
+        double grid[3] = {request.start, request.stop, request.step};
+        append(grid, sizeof(grid));
+
+        return frame;
+    }
+
+    /**
+     * @brief sends one request and fully consumes its response,
+     * checking every field the protocol promises. A failed simulation
+     * (status 1 with a well-formed message) is a request error; any
+     * response the protocol does not allow is a violation
+     *
+     * @returns true when the connection is still usable
+     */
+    bool runRequest(
+        int fd,
+        const RequestSpec& request,
+        WorkerStats& stats
+    ) {
+
+        std::vector<char> frame = buildFrame(request);
+
+        auto began = std::chrono::steady_clock::now();
+
+        if (!writeFully(fd, frame.data(), frame.size())) {
+            stats.request_errors++;
+            return false;
+        }
+
+        int32_t status = 0;
+
+        if (!readFully(fd, &status, sizeof(status))) {
+            stats.protocol_violations++;
+            return false;
+        }
+
+        if (status == 1) {
+
+            int32_t message_length = 0;
+
+            if (!readFully(fd, &message_length, sizeof(message_length)) ||
+                message_length < 0) {
+                stats.protocol_violations++;
+                return false;
+            }
+
+            std::string message(message_length, '\0');
+
+            if (!readFully(fd, message.data(), message_length)) {
+                stats.protocol_violations++;
+                return false;
+            }
+
+            stats.request_errors++;
+            return true;
+
+        }
+
+        if (status != 0) {
+            stats.protocol_violations++;
+            return false;
+        }
+
+        int32_t rows = 0;
+        int32_t cols = 0;
+
+        if (!readFully(fd, &rows, sizeof(rows)) ||
+            !readFully(fd, &cols, sizeof(cols)) ||
+            rows <= 0 || cols <= 0) {
+            stats.protocol_violations++;
+            return false;
+        }
+
+        std::vector<double> payload(
+            static_cast<size_t>(rows) * static_cast<size_t>(cols)
+        );
+
+        if (!readFully(fd, payload.data(),
+                       payload.size() * sizeof(double))) {
+            stats.protocol_violations++;
+            return false;
+        }
+
+        auto ended = std::chrono::steady_clock::now();
+
+        stats.latencies_ms.push_back(
+            std::chrono::duration<double, std::milli>(ended - began).count()
+        );
+
+        return true;
+    }
+
+    /**
+     * @brief reads a recorded mix file: one request per line, the grid
+     * first then any overrides, e.g. "0 3600 30 kGrowth=0.2 Ligand=50"
+     *
+     * @returns false on an unparsable line
+     */
+    bool loadMixFile(
+        const std::string& path,
+        std::vector<RequestSpec>& mix
+    ) {
+
+        std::ifstream in(path);
+
+        if (!in) {
+            return false;
+        }
+
+        std::string line;
+
+        while (std::getline(in, line)) {
+
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+
+            std::istringstream fields(line);
+            RequestSpec request;
+
+            if (!(fields >> request.start >> request.stop >> request.step)) {
+                return false;
+            }
+
+            std::string token;
+
+            while (fields >> token) {
+
+                size_t equals = token.find('=');
+
+                if (equals == std::string::npos) {
+                    return false;
+                }
+
+                request.overrides.emplace_back(
+                    token.substr(0, equals),
+                    std::stod(token.substr(equals + 1))
+                );
+            }
+
+            mix.push_back(std::move(request));
+        }
+
+        return !mix.empty();
+    }
+
+    /**
+     * @brief percentile of a sorted sample by nearest-rank
+     */
+    double percentile(const std::vector<double>& sorted, double p) {
+
+        size_t rank = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+    void printUsage() {
+
+        printf("singlecell-loadgen: load and conformance harness for the "
+               "simulate daemon\n"
+               "\n"
+               "Example usage:\n"
+               "    singlecell-loadgen /tmp/singlecell.sock --requests 1000 "
+               "--concurrency 8\n"
+               "\n"
+               "Options:\n"
+               "    --requests <n>      total requests to send (default 100)\n"
+               "    --concurrency <n>   concurrent client connections "
+               "(default 1)\n"
+               "    --mix <file>        replay a recorded mix: one request "
+               "per line,\n"
+               "                        \"start stop step [id=value ...]\", "
+               "round-robin\n"
+               "    --override <id:lo:hi>  synthetic override, sampled "
+               "uniformly per\n"
+               "                        request; repeatable\n"
+               "    --horizon <lo:hi>   sample the stop time uniformly per "
+               "request\n"
+               "    --start/--stop/--step <v>  synthetic grid defaults "
+               "(0, 60, 30)\n"
+               "    --seed <n>          base RNG seed; request i draws from "
+               "seed + i,\n"
+               "                        so a mix replays identically at any "
+               "concurrency\n"
+               "    --shutdown          send the daemon its shutdown frame "
+               "afterwards\n"
+               "\n"
+               "Reports throughput and latency percentiles; any response\n"
+               "that violates the binary protocol fails the exit status.\n"
+               "\n"
+               "Exit status: 0 clean, 1 protocol violations, 2 on a setup "
+               "error.\n");
+    }
+
+} // namespace
+
+//================================main======================================//
+int main(
+    int argc,
+    char* argv[]
+) {
+
+    std::string socket_path;
+    std::string mix_path;
+    std::vector<OverrideRange> override_ranges;
+
+    int total_requests = 100;
+    int concurrency = 1;
+    unsigned long long seed = 1;
+    double start = 0.0;
+    double stop = 60.0;
+    double step = 30.0;
+    double horizon_lo = 0.0;
+    double horizon_hi = 0.0;
+    bool shutdown_after = false;
+
+    auto parseRange = [](const std::string& spec, std::string* id,
+                         double& lo, double& hi) {
+
+        size_t first = spec.find(':');
+        size_t last = spec.rfind(':');
+
+        if (first == std::string::npos || first == last) {
+
+            // two-field form (lo:hi) has no id
+            if (id != nullptr || first == std::string::npos) {
+                return false;
+            }
+
+            lo = std::stod(spec.substr(0, first));
+            hi = std::stod(spec.substr(first + 1));
+            return true;
+        }
+
+        if (id == nullptr) {
+            return false;
+        }
+
+        *id = spec.substr(0, first);
+        lo = std::stod(spec.substr(first + 1, last - first - 1));
+        hi = std::stod(spec.substr(last + 1));
+        return true;
+    };
+
+    for (int i = 1; i < argc; i++) {
+
+        std::string arg = argv[i];
+        std::string value = i + 1 < argc ? argv[i + 1] : "";
+
+        if (arg == "-h" || arg == "--help") {
+            printUsage();
+            return 0;
+
+        } else if (arg == "--shutdown") {
+            shutdown_after = true;
+
+        } else if (arg == "--requests" && !value.empty()) {
+            total_requests = std::stoi(value);
+            i++;
+
+        } else if (arg == "--concurrency" && !value.empty()) {
+            concurrency = std::stoi(value);
+            i++;
+
+        } else if (arg == "--mix" && !value.empty()) {
+            mix_path = value;
+            i++;
+
+        } else if (arg == "--override" && !value.empty()) {
+
+            OverrideRange range;
+
+            if (!parseRange(value, &range.entity_id,
+                            range.lo, range.hi)) {
+                fprintf(stderr,
+                        "singlecell-loadgen: bad override spec %s\n",
+                        value.c_str());
+                return 2;
+            }
+
+            override_ranges.push_back(std::move(range));
+            i++;
+
+        } else if (arg == "--horizon" && !value.empty()) {
+
+            if (!parseRange(value, nullptr, horizon_lo, horizon_hi)) {
+                fprintf(stderr,
+                        "singlecell-loadgen: bad horizon spec %s\n",
+                        value.c_str());
+                return 2;
+            }
+            i++;
+
+        } else if (arg == "--start" && !value.empty()) {
+            start = std::stod(value);
+            i++;
+
+        } else if (arg == "--stop" && !value.empty()) {
+            stop = std::stod(value);
+            i++;
+
+        } else if (arg == "--step" && !value.empty()) {
+            step = std::stod(value);
+            i++;
+
+        } else if (arg == "--seed" && !value.empty()) {
+            seed = std::stoull(value);
+            i++;
+
+        } else if (socket_path.empty()) {
+            socket_path = arg;
+
+        } else {
+            fprintf(stderr,
+                    "singlecell-loadgen: unexpected argument %s\n",
+                    argv[i]);
+            return 2;
+        }
+    }
+
+    if (socket_path.empty() || total_requests < 1 || concurrency < 1) {
+        printUsage();
+        return 2;
+    }
+
+    std::vector<RequestSpec> mix;
+
+    if (!mix_path.empty() && !loadMixFile(mix_path, mix)) {
+        fprintf(stderr, "singlecell-loadgen: could not read mix file %s\n",
+                mix_path.c_str());
+        return 2;
+    }
+
+    // request i is fully determined by (mix, distributions, seed + i),
+    // never by which worker sends it, so runs replay identically at any
+    // concurrency and latency differences are the daemon's alone
+    auto specForRequest = [&](int index) {
+
+        RequestSpec request;
+
+        if (!mix.empty()) {
+            request = mix[index % mix.size()];
+        } else {
+            request.start = start;
+            request.stop = stop;
+            request.step = step;
+        }
+
+        std::mt19937_64 rng(seed + static_cast<unsigned long long>(index));
+
+        if (horizon_hi > horizon_lo) {
+            request.stop = std::uniform_real_distribution<double>(
+                horizon_lo, horizon_hi
+            )(rng);
+        }
+
+        for (const auto& range : override_ranges) {
+            request.overrides.emplace_back(
+                range.entity_id,
+                std::uniform_real_distribution<double>(
+                    range.lo, range.hi
+                )(rng)
+            );
+        }
+
+        return request;
+    };
+
+    if (concurrency > total_requests) {
+        concurrency = total_requests;
+    }
+
+    std::vector<WorkerStats> stats(concurrency);
+    std::vector<std::thread> workers;
+    workers.reserve(concurrency);
+
+    std::atomic<bool> connect_failed{false};
+
+    auto began = std::chrono::steady_clock::now();
+
+    for (int w = 0; w < concurrency; w++) {
+
+        workers.emplace_back([&, w]() {
+
+            // one connection per worker for the whole run, like a
+            // steering client; requests interleave round-robin
+            int fd = connectDaemon(socket_path);
+
+            if (fd < 0) {
+                connect_failed = true;
+                return;
+            }
+
+            for (int index = w; index < total_requests;
+                    index += concurrency) {
+
+                if (!runRequest(fd, specForRequest(index), stats[w])) {
+                    break;
+                }
+            }
+
+            close(fd);
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    auto ended = std::chrono::steady_clock::now();
+
+    if (connect_failed) {
+        fprintf(stderr, "singlecell-loadgen: could not connect to %s\n",
+                socket_path.c_str());
+        return 2;
+    }
+
+    if (shutdown_after) {
+
+        int fd = connectDaemon(socket_path);
+
+        if (fd >= 0) {
+            int32_t shutdown_frame = -1;
+            writeFully(fd, &shutdown_frame, sizeof(shutdown_frame));
+            close(fd);
+        }
+    }
+
+    // merge and report
+    std::vector<double> latencies;
+    int request_errors = 0;
+    int protocol_violations = 0;
+
+    for (const auto& tally : stats) {
+
+        latencies.insert(
+            latencies.end(),
+            tally.latencies_ms.begin(), tally.latencies_ms.end()
+        );
+
+        request_errors += tally.request_errors;
+        protocol_violations += tally.protocol_violations;
+    }
+
+    double elapsed =
+        std::chrono::duration<double>(ended - began).count();
+
+    printf("singlecell-loadgen: %zu/%d requests completed, "
+           "%d connections, %.2f s\n",
+           latencies.size(), total_requests, concurrency, elapsed);
+
+    if (!latencies.empty() && elapsed > 0.0) {
+
+        std::sort(latencies.begin(), latencies.end());
+
+        printf("  throughput: %.1f req/s\n",
+               static_cast<double>(latencies.size()) / elapsed);
+
+        printf("  latency ms: min %.2f  p50 %.2f  p90 %.2f  "
+               "p99 %.2f  max %.2f\n",
+               latencies.front(),
+               percentile(latencies, 0.50),
+               percentile(latencies, 0.90),
+               percentile(latencies, 0.99),
+               latencies.back());
+    }
+
+    printf("  errors: %d request failures, %d protocol violations\n",
+           request_errors, protocol_violations);
+
+    return protocol_violations > 0 ? 1 : 0;
+}
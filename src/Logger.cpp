@@ -0,0 +1,127 @@
+/**
+ * @file Logger.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Leveled logging facility with background I/O and compile-time
+ * level stripping for hot-loop call sites
+ */
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <iostream>
+
+// Internal Libraries
+#include "singlecell/Logger.h"
+
+//=============================Class Details================================//
+Logger& Logger::instance() {
+
+    // function-local singleton: constructed on first log call, destroyed
+    // (and therefore drained) at process exit
+    static Logger logger;
+
+    return logger;
+}
+
+Logger::Logger() {
+
+    this->io_thread = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex);
+        this->shutting_down = true;
+    }
+
+    this->queue_ready.notify_one();
+
+    if (this->io_thread.joinable()) {
+        this->io_thread.join();
+    }
+}
+
+void Logger::setLevel(
+    int level
+) {
+
+    this->runtime_level.store(level, std::memory_order_relaxed);
+}
+
+void Logger::setOutput(
+    const std::string& path
+) {
+
+    std::lock_guard<std::mutex> lock(this->queue_mutex);
+
+    this->file_sink.open(path, std::ios::app);
+
+    this->use_file = this->file_sink.is_open();
+}
+
+void Logger::log(
+    int level,
+    std::string message
+) {
+
+    static const char* labels[] = { "", "ERROR", "WARN", "INFO", "DEBUG" };
+
+    std::string line = "[";
+    line += labels[level];
+    line += "] ";
+    line += message;
+    line += "\n";
+
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex);
+
+        this->queue.push_back(std::move(line));
+    }
+
+    this->queue_ready.notify_one();
+}
+
+void Logger::writerLoop() {
+
+    std::unique_lock<std::mutex> lock(this->queue_mutex);
+
+    while (true) {
+
+        this->queue_ready.wait(lock, [this]() {
+            return !this->queue.empty() || this->shutting_down;
+        });
+
+        // batch everything queued since the last wakeup into one string,
+        // written outside the lock so producers never wait on the sink
+        std::string batch;
+
+        while (!this->queue.empty()) {
+            batch += this->queue.front();
+            this->queue.pop_front();
+        }
+
+        bool to_file = this->use_file;
+
+        lock.unlock();
+
+        if (!batch.empty()) {
+
+            if (to_file) {
+                this->file_sink << batch;
+                this->file_sink.flush();
+            } else {
+                std::cerr << batch;
+            }
+        }
+
+        lock.lock();
+
+        if (this->shutting_down && this->queue.empty()) {
+            break;
+        }
+    }
+}
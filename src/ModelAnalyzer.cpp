@@ -0,0 +1,215 @@
+/**
+ * @file ModelAnalyzer.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Preflight cost analysis and performance linting for SBML models
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+// Internal Libraries
+#include "singlecell/SingleCell.h"
+#include "singlecell/SBMLHandler.h"
+#include "singlecell/ModelAnalyzer.h"
+
+//=============================Class Details================================//
+namespace {
+
+// Crude rate-law shape buckets: the stochastic module's compiled-formula
+// fast paths cover the product shapes, division marks Michaelis-Menten
+// style laws and transcendentals always go through muParser
+struct ShapeHistogram {
+    int product_only = 0;
+    int with_division = 0;
+    int transcendental = 0;
+    int other = 0;
+};
+
+void classifyFormula(
+    const std::string& formula,
+    ShapeHistogram& histogram,
+    size_t& token_estimate
+) {
+
+    bool division = formula.find('/') != std::string::npos;
+
+    bool transcendental =
+        formula.find("pow") != std::string::npos ||
+        formula.find("exp") != std::string::npos ||
+        formula.find("log") != std::string::npos ||
+        formula.find('^') != std::string::npos;
+
+    bool additive = formula.find('+') != std::string::npos ||
+        formula.find('-') != std::string::npos;
+
+    if (transcendental) {
+        histogram.transcendental++;
+    } else if (division) {
+        histogram.with_division++;
+    } else if (!additive) {
+        histogram.product_only++;
+    } else {
+        histogram.other++;
+    }
+
+    // one operand per operator plus one, a serviceable FLOP proxy
+    size_t operators = 0;
+
+    for (char c : formula) {
+        if (c == '*' || c == '/' || c == '+' || c == '-' || c == '^') {
+            operators++;
+        }
+    }
+
+    token_estimate += operators + 1;
+}
+
+}
+
+void ModelAnalyzer::analyze(
+    const std::vector<std::string>& sbml_paths,
+    double step,
+    int probe_steps
+) {
+
+    printf("SingleCell preflight analysis\n");
+    printf("=============================\n");
+
+    size_t total_species = 0;
+    size_t total_reactions = 0;
+
+    for (const std::string& path : sbml_paths) {
+
+        SBMLHandler handler(path);
+        Model* model = handler.model;
+
+        size_t num_species = model->getNumSpecies();
+        size_t num_reactions = model->getNumReactions();
+        size_t num_parameters = model->getNumParameters();
+
+        total_species += num_species;
+        total_reactions += num_reactions;
+
+        printf("\nmodel '%s' (%s)\n", model->getId().c_str(), path.c_str());
+        printf("  species:    %zu\n", num_species);
+        printf("  reactions:  %zu\n", num_reactions);
+        printf("  parameters: %zu\n", num_parameters);
+
+        // stoichiometric sparsity: nonzero entries over the dense extent
+        size_t nonzeros = 0;
+
+        for (size_t r = 0; r < num_reactions; r++) {
+
+            const Reaction* reaction = model->getReaction(r);
+
+            nonzeros += reaction->getNumReactants()
+                + reaction->getNumProducts();
+        }
+
+        if (num_species > 0 && num_reactions > 0) {
+            printf("  stoichiometry: %zu nonzeros, %.2f%% dense "
+                "(%.1f entries/reaction)\n",
+                nonzeros,
+                100.0 * nonzeros
+                    / static_cast<double>(num_species * num_reactions),
+                static_cast<double>(nonzeros)
+                    / static_cast<double>(num_reactions));
+        }
+
+        // rate-law shape histogram and formula cost proxy
+        ShapeHistogram histogram;
+        size_t formula_flops = 0;
+
+        for (size_t r = 0; r < num_reactions; r++) {
+
+            const Reaction* reaction = model->getReaction(r);
+
+            if (reaction->getKineticLaw() != nullptr) {
+                classifyFormula(
+                    reaction->getKineticLaw()->getFormula(),
+                    histogram, formula_flops
+                );
+            }
+        }
+
+        if (num_reactions > 0) {
+            printf("  rate-law shapes: %d product-only (fast path), "
+                "%d with division, %d transcendental, %d other\n",
+                histogram.product_only, histogram.with_division,
+                histogram.transcendental, histogram.other);
+        }
+
+        // Per-step cost model: propensity math plus unit conversions and
+        // the sparse state update, each operand read or written once
+        size_t step_flops = formula_flops + 4 * num_species + 2 * nonzeros;
+        size_t step_bytes = 8 * (2 * nonzeros + 6 * num_species
+            + 3 * num_reactions);
+
+        printf("  est. per-step cost: ~%zu FLOPs, ~%zu bytes touched\n",
+            step_flops, step_bytes);
+
+        // Stiffness proxy for the ODE side: the spread of positive
+        // parameter magnitudes bounds the rate-scale separation CVODES
+        // has to bridge; > ~6 decades usually means BDF earns its keep
+        double min_magnitude = std::numeric_limits<double>::infinity();
+        double max_magnitude = 0.0;
+
+        for (double value : handler.getParameterValues()) {
+
+            double magnitude = std::abs(value);
+
+            if (magnitude > 0.0) {
+                min_magnitude = std::min(min_magnitude, magnitude);
+                max_magnitude = std::max(max_magnitude, magnitude);
+            }
+        }
+
+        if (max_magnitude > 0.0 && min_magnitude < max_magnitude) {
+            printf("  stiffness indicator: rate constants span %.1f "
+                "decades (%.3g .. %.3g)%s\n",
+                std::log10(max_magnitude / min_magnitude),
+                min_magnitude, max_magnitude,
+                std::log10(max_magnitude / min_magnitude) > 6.0
+                    ? " -- expect a stiff ODE solve" : "");
+        }
+    }
+
+    printf("\ntotal: %zu species, %zu reactions across %zu model(s)\n",
+        total_species, total_reactions, sbml_paths.size());
+
+    if (probe_steps <= 0 || !(step > 0.0)) {
+        return;
+    }
+
+    // Short probe run: measure real steps (session construction excluded)
+    // and project wall time per simulated hour from the per-step cost
+    printf("\nprobe: %d steps at delta_t = %g s\n", probe_steps, step);
+
+    SingleCell probe_cell(sbml_paths);
+
+    auto probe_start = std::chrono::steady_clock::now();
+
+    probe_cell.simulate(0.0, probe_steps * step, step);
+
+    double probe_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - probe_start
+    ).count();
+
+    double seconds_per_step = probe_seconds / probe_steps;
+    double steps_per_sim_hour = 3600.0 / step;
+    double wall_per_sim_hour = seconds_per_step * steps_per_sim_hour;
+
+    printf("  %.3f s elapsed, %.3g s/step\n", probe_seconds, seconds_per_step);
+    printf("  projected wall time per simulated hour: %.1f s (%.2f h)\n",
+        wall_per_sim_hour, wall_per_sim_hour / 3600.0);
+}
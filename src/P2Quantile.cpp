@@ -0,0 +1,265 @@
+/**
+ * @file P2Quantile.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Streaming quantile estimation via the P-squared algorithm
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <algorithm>
+
+// Internal Libraries
+#include "singlecell/P2Quantile.h"
+
+//=============================Class Details================================//
+void P2Quantile::initialize(
+    double quantile
+) {
+
+    this->q = quantile;
+    this->count = 0;
+}
+
+void P2Quantile::add(
+    double x
+) {
+
+    // Warm-up: the first five observations seed the markers directly
+    if (this->count < 5) {
+
+        this->heights[this->count] = x;
+        this->count++;
+
+        if (this->count == 5) {
+
+            std::sort(this->heights, this->heights + 5);
+
+            for (int i = 0; i < 5; i++) {
+                this->positions[i] = i + 1;
+            }
+
+            this->desired[0] = 1.0;
+            this->desired[1] = 1.0 + 2.0 * this->q;
+            this->desired[2] = 1.0 + 4.0 * this->q;
+            this->desired[3] = 3.0 + 2.0 * this->q;
+            this->desired[4] = 5.0;
+
+            this->increments[0] = 0.0;
+            this->increments[1] = this->q / 2.0;
+            this->increments[2] = this->q;
+            this->increments[3] = (1.0 + this->q) / 2.0;
+            this->increments[4] = 1.0;
+        }
+
+        return;
+    }
+
+    this->count++;
+
+    // locate the marker cell the observation lands in, widening the
+    // extremes when it falls outside them
+    int k;
+
+    if (x < this->heights[0]) {
+
+        this->heights[0] = x;
+        k = 0;
+
+    } else if (x >= this->heights[4]) {
+
+        this->heights[4] = x;
+        k = 3;
+
+    } else {
+
+        k = 0;
+
+        while (k < 3 && x >= this->heights[k + 1]) {
+            k++;
+        }
+    }
+
+    for (int i = k + 1; i < 5; i++) {
+        this->positions[i] += 1.0;
+    }
+
+    for (int i = 0; i < 5; i++) {
+        this->desired[i] += this->increments[i];
+    }
+
+    // nudge the three interior markers toward their desired positions
+    for (int i = 1; i <= 3; i++) {
+
+        double drift = this->desired[i] - this->positions[i];
+
+        bool move_right = drift >= 1.0 &&
+            this->positions[i + 1] - this->positions[i] > 1.0;
+        bool move_left = drift <= -1.0 &&
+            this->positions[i - 1] - this->positions[i] < -1.0;
+
+        if (!move_right && !move_left) {
+            continue;
+        }
+
+        int sign = move_right ? 1 : -1;
+
+        double predicted = this->parabolic(i, sign);
+
+        this->heights[i] =
+            (this->heights[i - 1] < predicted &&
+             predicted < this->heights[i + 1])
+                ? predicted
+                : this->linear(i, sign);
+
+        this->positions[i] += sign;
+    }
+}
+
+void P2Quantile::merge(
+    const P2Quantile& other
+) {
+
+    if (other.count == 0) {
+        return;
+    }
+
+    if (this->count == 0) {
+        *this = other;
+        return;
+    }
+
+    // a warm-up partner still holds raw observations; replay them
+    if (other.count < 5) {
+
+        for (size_t i = 0; i < other.count; i++) {
+            this->add(other.heights[i]);
+        }
+
+        return;
+    }
+
+    // symmetric case: adopt the warmed partner and replay our raw sample
+    if (this->count < 5) {
+
+        P2Quantile warmed = other;
+
+        for (size_t i = 0; i < this->count; i++) {
+            warmed.add(this->heights[i]);
+        }
+
+        *this = warmed;
+        return;
+    }
+
+    // both warmed: widen the extremes, blend the interior marker heights
+    // by observation count, and stack positions; the desired positions
+    // follow from the combined count and the unchanged increments
+    double n1 = static_cast<double>(this->count);
+    double n2 = static_cast<double>(other.count);
+    double total = n1 + n2;
+
+    this->heights[0] = std::min(this->heights[0], other.heights[0]);
+    this->heights[4] = std::max(this->heights[4], other.heights[4]);
+
+    for (int i = 1; i <= 3; i++) {
+        this->heights[i] =
+            (n1 * this->heights[i] + n2 * other.heights[i]) / total;
+    }
+
+    double initial_desired[5] = {
+        1.0,
+        1.0 + 2.0 * this->q,
+        1.0 + 4.0 * this->q,
+        3.0 + 2.0 * this->q,
+        5.0
+    };
+
+    for (int i = 0; i < 5; i++) {
+        this->positions[i] += other.positions[i];
+        this->desired[i] += other.desired[i] - initial_desired[i];
+    }
+
+    this->count += other.count;
+}
+
+void P2Quantile::serialize(
+    double* out
+) const {
+
+    out[0] = this->q;
+    out[1] = static_cast<double>(this->count);
+
+    for (int i = 0; i < 5; i++) {
+        out[2 + i] = this->heights[i];
+        out[7 + i] = this->positions[i];
+        out[12 + i] = this->desired[i];
+        out[17 + i] = this->increments[i];
+    }
+}
+
+void P2Quantile::deserialize(
+    const double* in
+) {
+
+    this->q = in[0];
+    this->count = static_cast<size_t>(in[1]);
+
+    for (int i = 0; i < 5; i++) {
+        this->heights[i] = in[2 + i];
+        this->positions[i] = in[7 + i];
+        this->desired[i] = in[12 + i];
+        this->increments[i] = in[17 + i];
+    }
+}
+
+double P2Quantile::parabolic(
+    int i,
+    int sign
+) const {
+
+    double n_prev = this->positions[i - 1];
+    double n_here = this->positions[i];
+    double n_next = this->positions[i + 1];
+
+    return this->heights[i] + sign / (n_next - n_prev) * (
+        (n_here - n_prev + sign) *
+            (this->heights[i + 1] - this->heights[i]) / (n_next - n_here) +
+        (n_next - n_here - sign) *
+            (this->heights[i] - this->heights[i - 1]) / (n_here - n_prev)
+    );
+}
+
+double P2Quantile::linear(
+    int i,
+    int sign
+) const {
+
+    return this->heights[i] + sign *
+        (this->heights[i + sign] - this->heights[i]) /
+        (this->positions[i + sign] - this->positions[i]);
+}
+
+double P2Quantile::value() const {
+
+    if (this->count == 0) {
+        return 0.0;
+    }
+
+    if (this->count >= 5) {
+        return this->heights[2];
+    }
+
+    // partial warm-up sample: sort a copy and pick the nearest rank
+    double sorted[5];
+    std::copy(this->heights, this->heights + this->count, sorted);
+    std::sort(sorted, sorted + this->count);
+
+    size_t rank = static_cast<size_t>(
+        this->q * static_cast<double>(this->count - 1) + 0.5
+    );
+
+    return sorted[std::min(rank, this->count - 1)];
+}
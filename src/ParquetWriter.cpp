@@ -0,0 +1,328 @@
+/**
+ * @file ParquetWriter.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for the dependency-free Parquet trajectory writer
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+
+// Internal Libraries
+#include "singlecell/ParquetWriter.h"
+
+//========================Thrift Compact Encoding===========================//
+namespace {
+
+/**
+ * Minimal Thrift compact-protocol serializer. Parquet footers and page
+ * headers are Thrift structs; the trajectory schema only ever needs i32,
+ * i64, string, list and struct fields, so just those are implemented.
+ * Field headers carry the id as a delta from the previous field in the
+ * same struct, which is what the field stack tracks
+ */
+struct CompactWriter {
+
+    std::string buf;
+
+    std::vector<int> field_stack;
+    int last_field = 0;
+
+    void byte(uint8_t value) {
+        this->buf.push_back(static_cast<char>(value));
+    }
+
+    void varint(uint64_t value) {
+
+        while (value >= 0x80) {
+            this->byte(static_cast<uint8_t>(0x80 | (value & 0x7F)));
+            value >>= 7;
+        }
+
+        this->byte(static_cast<uint8_t>(value));
+    }
+
+    static uint64_t zigzag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1)
+            ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    void structBegin() {
+        this->field_stack.push_back(this->last_field);
+        this->last_field = 0;
+    }
+
+    void structEnd() {
+
+        // stop byte terminates the field list
+        this->byte(0);
+
+        this->last_field = this->field_stack.back();
+        this->field_stack.pop_back();
+    }
+
+    void fieldBegin(int id, uint8_t type) {
+
+        int delta = id - this->last_field;
+
+        if (delta > 0 && delta <= 15) {
+            this->byte(static_cast<uint8_t>((delta << 4) | type));
+        } else {
+            this->byte(type);
+            this->varint(zigzag(id));
+        }
+
+        this->last_field = id;
+    }
+
+    // compact wire types: i32 = 5, i64 = 6, string = 8, list = 9,
+    // struct = 12. Enums travel as zigzag-varint i32
+    void i32Field(int id, int64_t value) {
+        this->fieldBegin(id, 5);
+        this->varint(zigzag(value));
+    }
+
+    void i64Field(int id, int64_t value) {
+        this->fieldBegin(id, 6);
+        this->varint(zigzag(value));
+    }
+
+    void stringField(int id, const std::string& value) {
+        this->fieldBegin(id, 8);
+        this->varint(value.size());
+        this->buf += value;
+    }
+
+    // list header only; the caller writes the elements in the element
+    // type's own wire encoding
+    void listField(int id, uint8_t elem_type, size_t size) {
+
+        this->fieldBegin(id, 9);
+
+        if (size < 15) {
+            this->byte(static_cast<uint8_t>((size << 4) | elem_type));
+        } else {
+            this->byte(static_cast<uint8_t>(0xF0 | elem_type));
+            this->varint(size);
+        }
+    }
+};
+
+} // namespace
+
+//=============================Class Details================================//
+ParquetWriter::ParquetWriter(
+    const std::string& output,
+    std::vector<std::string> col_labels
+) : columns(std::move(col_labels)) {
+
+    this->out.open(output, std::ios::binary);
+
+    this->out.write("PAR1", 4);
+
+    this->column_buffers.resize(this->columns.size());
+
+    for (auto& buffer : this->column_buffers) {
+        buffer.reserve(rows_per_group);
+    }
+}
+
+ParquetWriter::~ParquetWriter() {
+
+    this->finalize();
+}
+
+void ParquetWriter::appendRow(
+    const double* row
+) {
+
+    for (size_t col = 0; col < this->column_buffers.size(); col++) {
+        this->column_buffers[col].push_back(row[col]);
+    }
+
+    this->buffered_rows++;
+
+    if (this->buffered_rows >= rows_per_group) {
+        this->flushRowGroup();
+    }
+}
+
+void ParquetWriter::setMetadata(
+    std::vector<std::pair<std::string, std::string>> metadata
+) {
+
+    this->metadata = std::move(metadata);
+}
+
+void ParquetWriter::flushRowGroup() {
+
+    if (this->buffered_rows == 0) {
+        return;
+    }
+
+    RowGroupInfo group;
+    group.num_rows = static_cast<int64_t>(this->buffered_rows);
+
+    for (size_t col = 0; col < this->column_buffers.size(); col++) {
+
+        size_t payload_bytes = this->buffered_rows * sizeof(double);
+
+        // PageHeader: type DATA_PAGE, both sizes equal (uncompressed),
+        // then the DataPageHeader. Every column is REQUIRED at the root,
+        // so no definition or repetition levels precede the values; the
+        // level encodings are still mandatory fields and set to RLE
+        CompactWriter header;
+
+        header.structBegin();
+        header.i32Field(1, 0);
+        header.i32Field(2, static_cast<int64_t>(payload_bytes));
+        header.i32Field(3, static_cast<int64_t>(payload_bytes));
+
+        header.fieldBegin(5, 12);
+        header.structBegin();
+        header.i32Field(1, group.num_rows);
+        header.i32Field(2, 0); // PLAIN
+        header.i32Field(3, 3); // RLE
+        header.i32Field(4, 3); // RLE
+        header.structEnd();
+
+        header.structEnd();
+
+        ColumnChunkInfo chunk;
+        chunk.offset = static_cast<int64_t>(this->out.tellp());
+        chunk.num_values = group.num_rows;
+
+        this->out.write(header.buf.data(), header.buf.size());
+        this->out.write(
+            reinterpret_cast<const char*>(this->column_buffers[col].data()),
+            payload_bytes
+        );
+
+        chunk.size = static_cast<int64_t>(header.buf.size() + payload_bytes);
+
+        group.total_bytes += chunk.size;
+        group.chunks.push_back(chunk);
+
+        this->column_buffers[col].clear();
+    }
+
+    this->row_groups.push_back(std::move(group));
+
+    this->total_rows += static_cast<int64_t>(this->buffered_rows);
+    this->buffered_rows = 0;
+}
+
+void ParquetWriter::finalize() {
+
+    if (this->finalized) {
+        return;
+    }
+
+    this->finalized = true;
+
+    this->flushRowGroup();
+
+    // FileMetaData footer: version, schema, total rows, row groups,
+    // creator tag. Field ids follow parquet.thrift
+    CompactWriter meta;
+
+    meta.structBegin();
+
+    meta.i32Field(1, 1);
+
+    // schema tree: one root group element, then a required DOUBLE leaf
+    // per column
+    meta.listField(2, 12, this->columns.size() + 1);
+
+    meta.structBegin();
+    meta.stringField(4, "schema");
+    meta.i32Field(5, static_cast<int64_t>(this->columns.size()));
+    meta.structEnd();
+
+    for (const auto& name : this->columns) {
+
+        meta.structBegin();
+        meta.i32Field(1, 5); // Type DOUBLE
+        meta.i32Field(3, 0); // FieldRepetitionType REQUIRED
+        meta.stringField(4, name);
+        meta.structEnd();
+    }
+
+    meta.i64Field(3, this->total_rows);
+
+    meta.listField(4, 12, this->row_groups.size());
+
+    for (const auto& group : this->row_groups) {
+
+        meta.structBegin();
+
+        meta.listField(1, 12, group.chunks.size());
+
+        for (size_t col = 0; col < group.chunks.size(); col++) {
+
+            const ColumnChunkInfo& chunk = group.chunks[col];
+
+            // ColumnChunk: file_offset, then the embedded ColumnMetaData
+            meta.structBegin();
+            meta.i64Field(2, chunk.offset);
+
+            meta.fieldBegin(3, 12);
+            meta.structBegin();
+            meta.i32Field(1, 5); // Type DOUBLE
+
+            meta.listField(2, 5, 1);
+            meta.varint(CompactWriter::zigzag(0)); // Encoding PLAIN
+
+            meta.listField(3, 8, 1);
+            meta.varint(this->columns[col].size());
+            meta.buf += this->columns[col];
+
+            meta.i32Field(4, 0); // CompressionCodec UNCOMPRESSED
+            meta.i64Field(5, chunk.num_values);
+            meta.i64Field(6, chunk.size);
+            meta.i64Field(7, chunk.size);
+            meta.i64Field(9, chunk.offset);
+            meta.structEnd();
+
+            meta.structEnd();
+        }
+
+        meta.i64Field(2, group.total_bytes);
+        meta.i64Field(3, group.num_rows);
+
+        meta.structEnd();
+    }
+
+    // KeyValue pairs carry the run's provenance in the footer itself,
+    // so warehouse queries filter on configuration without reading a
+    // single data page
+    if (!this->metadata.empty()) {
+
+        meta.listField(5, 12, this->metadata.size());
+
+        for (const auto& fact : this->metadata) {
+
+            meta.structBegin();
+            meta.stringField(1, fact.first);
+            meta.stringField(2, fact.second);
+            meta.structEnd();
+        }
+    }
+
+    meta.stringField(6, "SingleCell");
+
+    meta.structEnd();
+
+    uint32_t footer_size = static_cast<uint32_t>(meta.buf.size());
+
+    this->out.write(meta.buf.data(), meta.buf.size());
+    this->out.write(reinterpret_cast<const char*>(&footer_size), sizeof(footer_size));
+    this->out.write("PAR1", 4);
+
+    this->out.close();
+}
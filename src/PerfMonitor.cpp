@@ -0,0 +1,233 @@
+/**
+ * @file PerfMonitor.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for per-phase timing aggregation and JSON reporting
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <fstream>
+#include <algorithm>
+
+#include <sys/resource.h>
+
+// Internal Libraries
+#include "singlecell/PerfMonitor.h"
+
+//=============================Class Details================================//
+void PerfMonitor::addSample(
+    const std::string& phase,
+    double seconds
+) {
+
+    std::lock_guard<std::mutex> lock(this->totals_mutex);
+
+    PhaseStats& stats = this->phase_totals[phase];
+
+    stats.calls += 1;
+    stats.total_seconds += seconds;
+}
+
+size_t PerfMonitor::bucketIndex(
+    double seconds
+) {
+
+    // bucket 0 absorbs everything at or under the 100 ns floor; above
+    // it the index grows eight per octave
+    if (seconds <= 1e-7) {
+        return 0;
+    }
+
+    size_t index = static_cast<size_t>(std::log2(seconds / 1e-7) * 8.0);
+
+    return std::min(index, kHistogramBuckets - 1);
+}
+
+double PerfMonitor::histogramPercentile(
+    const Histogram& histogram,
+    double fraction
+) {
+
+    if (histogram.total_count == 0) {
+        return 0.0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(
+        fraction * static_cast<double>(histogram.total_count - 1)
+    );
+
+    uint64_t seen = 0;
+
+    for (size_t b = 0; b < kHistogramBuckets; b++) {
+
+        seen += histogram.counts[b];
+
+        if (seen > rank) {
+
+            // the bucket's upper bound, capped at the true maximum so
+            // the top percentile never overstates the worst sample
+            double upper = 1e-7 * std::pow(2.0, (b + 1) / 8.0);
+
+            return std::min(upper, histogram.max_seconds);
+        }
+    }
+
+    return histogram.max_seconds;
+}
+
+void PerfMonitor::addHistogramSample(
+    const std::string& name,
+    double seconds
+) {
+
+    std::lock_guard<std::mutex> lock(this->totals_mutex);
+
+    Histogram& histogram = this->histograms[name];
+
+    histogram.counts[bucketIndex(seconds)] += 1;
+    histogram.total_count += 1;
+
+    if (seconds > histogram.max_seconds) {
+        histogram.max_seconds = seconds;
+    }
+}
+
+void PerfMonitor::addBytes(
+    const std::string& subsystem,
+    uint64_t bytes
+) {
+
+    std::lock_guard<std::mutex> lock(this->totals_mutex);
+
+    this->byte_totals[subsystem] += bytes;
+}
+
+void PerfMonitor::setMetadata(
+    const std::string& key,
+    const std::string& value
+) {
+
+    std::lock_guard<std::mutex> lock(this->totals_mutex);
+
+    this->metadata[key] = value;
+}
+
+void PerfMonitor::writeReport(
+    const std::string& output
+) {
+
+    std::lock_guard<std::mutex> lock(this->totals_mutex);
+
+    std::ofstream outFile(output);
+
+    outFile << "{\n";
+
+    if (!this->metadata.empty()) {
+
+        outFile << "  \"metadata\": {";
+
+        size_t fields = 0;
+
+        for (const auto& [key, value] : this->metadata) {
+
+            outFile << "\"" << key << "\": \"" << value << "\"";
+
+            if (++fields < this->metadata.size()) {
+                outFile << ", ";
+            }
+        }
+
+        outFile << "}";
+
+        if (!this->byte_totals.empty() || !this->histograms.empty() ||
+            !this->phase_totals.empty()) {
+            outFile << ",";
+        }
+
+        outFile << "\n";
+    }
+
+    if (!this->byte_totals.empty()) {
+
+        outFile << "  \"memory\": {";
+
+        for (const auto& [subsystem, bytes] : this->byte_totals) {
+            outFile << "\"" << subsystem << "\": " << bytes << ", ";
+        }
+
+        // ru_maxrss is the process high-water mark in kilobytes — the
+        // ceiling the accounted subsystems plus everything else reached
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+
+        outFile << "\"peak_rss_bytes\": "
+                << static_cast<uint64_t>(usage.ru_maxrss) * 1024 << "}";
+
+        if (!this->histograms.empty() || !this->phase_totals.empty()) {
+            outFile << ",";
+        }
+
+        outFile << "\n";
+    }
+
+    if (!this->histograms.empty()) {
+
+        outFile << "  \"histograms\": {\n";
+
+        size_t entries = 0;
+
+        for (const auto& [name, histogram] : this->histograms) {
+
+            outFile << "    \"" << name << "\": {"
+                    << "\"count\": " << histogram.total_count << ", "
+                    << "\"p50_seconds\": "
+                    << histogramPercentile(histogram, 0.50) << ", "
+                    << "\"p90_seconds\": "
+                    << histogramPercentile(histogram, 0.90) << ", "
+                    << "\"p99_seconds\": "
+                    << histogramPercentile(histogram, 0.99) << ", "
+                    << "\"max_seconds\": " << histogram.max_seconds << "}";
+
+            if (++entries < this->histograms.size()) {
+                outFile << ",";
+            }
+
+            outFile << "\n";
+        }
+
+        outFile << "  }";
+
+        if (!this->phase_totals.empty()) {
+            outFile << ",";
+        }
+
+        outFile << "\n";
+    }
+
+    size_t written = 0;
+
+    for (const auto& [phase, stats] : this->phase_totals) {
+
+        double mean = (stats.calls > 0) ? stats.total_seconds / stats.calls : 0.0;
+
+        outFile << "  \"" << phase << "\": {"
+                << "\"calls\": " << stats.calls << ", "
+                << "\"total_seconds\": " << stats.total_seconds << ", "
+                << "\"mean_seconds\": " << mean << "}";
+
+        if (++written < this->phase_totals.size()) {
+            outFile << ",";
+        }
+
+        outFile << "\n";
+    }
+
+    outFile << "}\n";
+
+    outFile.close();
+}
@@ -0,0 +1,511 @@
+/**
+ * @file PopulationDriver.cpp
+ *
+ * @brief MPI driver distributing population replicates across cluster ranks
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ */
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+// Internal Libraries
+#include "singlecell/utils.h"
+#include "singlecell/SingleCell.h"
+#include "singlecell/CellPopulation.h"
+
+// Third Party Libraries
+#include <mpi.h>
+
+//--------------------------Protocol Constants------------------------------//
+// Workers request replicates from rank 0 and stream results back; all
+// aggregation happens in the packed binary trajectory format
+namespace {
+
+const int TAG_WORK_REQUEST = 1;
+const int TAG_WORK_ASSIGN = 2;
+const int TAG_RESULT_HEADER = 3;
+const int TAG_RESULT_DATA = 4;
+const int TAG_STATS_SIZE = 5;
+const int TAG_STATS_DATA = 6;
+
+// Per-replicate result kept alive until its non-blocking sends complete
+struct PendingResult {
+    int header[3]; // replicate, rows, cols
+    std::vector<double> data;
+    MPI_Request requests[2];
+};
+
+/**
+ * @brief writes one replicate's flat trajectory slab as a packed binary
+ * trajectory file beside the output prefix
+ *
+ * @param flat row-major trajectory values
+ * @param rows recorded timestep count
+ * @param cols recorded species count
+ * @param replicate replicate index, used in the file name
+ * @param output_prefix destination prefix for the .bin files
+ * @param step recording interval in seconds, for the row labels
+ * @param species_ids recorded species identifiers, for the column labels
+ */
+void writeReplicate(
+    const std::vector<double>& flat,
+    int rows,
+    int cols,
+    int replicate,
+    const std::string& output_prefix,
+    double step,
+    const std::vector<std::string>& species_ids
+) {
+
+    std::vector<std::vector<double>> matrix(rows, std::vector<double>(cols));
+
+    for (int t = 0; t < rows; t++) {
+        for (int s = 0; s < cols; s++) {
+            matrix[t][s] = flat[static_cast<size_t>(t) * cols + s];
+        }
+    }
+
+    std::vector<std::string> timesteps(rows);
+
+    for (int t = 0; t < rows; t++) {
+        timesteps[t] = std::to_string(t * step);
+    }
+
+    std::ostringstream path;
+    path << output_prefix << "_replicate" << replicate << ".bin";
+
+    matrix_utils::save_matrix_binary(matrix, path.str(), timesteps, species_ids);
+}
+
+/**
+ * @brief writes one summary-statistic matrix beside the output prefix
+ *
+ * @param matrix statistic values, [timestep][species]
+ * @param name statistic name, used in the file name
+ * @param output_prefix destination prefix for the .bin files
+ * @param step recording interval in seconds, for the row labels
+ * @param species_ids recorded species identifiers, for the column labels
+ */
+void writeStatistic(
+    const std::vector<std::vector<double>>& matrix,
+    const std::string& name,
+    const std::string& output_prefix,
+    double step,
+    const std::vector<std::string>& species_ids
+) {
+
+    std::vector<std::string> timesteps(matrix.size());
+
+    for (size_t t = 0; t < matrix.size(); t++) {
+        timesteps[t] = std::to_string(t * step);
+    }
+
+    std::ostringstream path;
+    path << output_prefix << "_" << name << ".bin";
+
+    matrix_utils::save_matrix_binary(matrix, path.str(), timesteps, species_ids);
+}
+
+/**
+ * @brief statistics mode: every rank simulates one shard of the
+ * population and reduces streaming accumulators down a binomial tree to
+ * rank 0, which finalizes and writes the summary matrices. Only the
+ * compact accumulator representation crosses the network — per-rank
+ * traffic is O(timesteps x species), independent of the cell count
+ */
+void runStatisticsMode(
+    const std::vector<std::string>& model_paths,
+    int num_replicates,
+    double start,
+    double stop,
+    double step,
+    double seed,
+    int num_threads,
+    const std::vector<double>& quantiles,
+    const std::vector<std::pair<std::string, double>>& thresholds,
+    const std::string& output_prefix,
+    int rank,
+    int num_ranks
+) {
+
+    CellPopulation population(model_paths, num_replicates);
+
+    if (seed >= 0.0) {
+        population.setSeed(static_cast<unsigned long long>(seed));
+    }
+
+    population.setSummaryQuantiles(quantiles);
+    population.setCrossingThresholds(thresholds);
+    population.setShard(rank, num_ranks);
+
+    population.simulateStatistics(start, stop, step, num_threads);
+
+    // binomial tree reduction: at each stride half the active ranks ship
+    // their packed accumulators one level down and drop out
+    for (int stride = 1; stride < num_ranks; stride *= 2) {
+
+        if (rank % (2 * stride) != 0) {
+
+            std::vector<double> packed = population.exportAccumulators();
+            int size = static_cast<int>(packed.size());
+
+            MPI_Send(&size, 1, MPI_INT, rank - stride,
+                     TAG_STATS_SIZE, MPI_COMM_WORLD);
+            MPI_Send(packed.data(), static_cast<int>(packed.size()),
+                     MPI_DOUBLE, rank - stride, TAG_STATS_DATA,
+                     MPI_COMM_WORLD);
+
+            return;
+        }
+
+        if (rank + stride < num_ranks) {
+
+            int size = 0;
+
+            MPI_Recv(&size, 1, MPI_INT, rank + stride,
+                     TAG_STATS_SIZE, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+            std::vector<double> packed(static_cast<size_t>(size));
+
+            MPI_Recv(packed.data(), size, MPI_DOUBLE,
+                     rank + stride, TAG_STATS_DATA, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+
+            population.mergeAccumulators(packed);
+        }
+    }
+
+    // only rank 0 reaches this point with the full population folded in
+    std::vector<std::vector<std::vector<double>>> statistics =
+        population.finalizeStatistics();
+
+    std::vector<std::string> species_ids = population.getGlobalSpeciesIds();
+
+    writeStatistic(statistics[0], "mean", output_prefix, step, species_ids);
+    writeStatistic(statistics[1], "stddev", output_prefix, step, species_ids);
+
+    for (size_t qi = 0; qi < quantiles.size(); qi++) {
+
+        std::ostringstream name;
+        name << "q" << quantiles[qi];
+
+        writeStatistic(
+            statistics[2 + qi], name.str(), output_prefix, step, species_ids
+        );
+    }
+
+    if (!thresholds.empty()) {
+        writeStatistic(
+            population.getCrossingFractions(),
+            "crossing_fractions", output_prefix, step, species_ids
+        );
+    }
+
+    printf("Reduced %i cells across %i ranks.\n", num_replicates, num_ranks);
+}
+
+} // namespace
+
+//--------------------------Function Definitions----------------------------//
+
+/**
+ * @brief entrypoint: rank 0 hands out replicate indices on demand and
+ * aggregates streamed results; every other rank runs a resident
+ * SingleCell session and ships each finished slab with non-blocking sends
+ */
+int main(
+    int argc,
+    char* argv[]
+) {
+
+    MPI_Init(&argc, &argv);
+
+    int rank = 0;
+    int num_ranks = 1;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    // minimal flag parsing; the driver is launcher-facing, not user-facing
+    std::vector<std::string> model_paths;
+    int num_replicates = 1;
+    double start = 0.0;
+    double stop = 60.0;
+    double step = 30.0;
+    double seed = -1.0;
+    std::string output_prefix = "population";
+    bool statistics_mode = false;
+    int num_threads = 0;
+    std::vector<double> quantiles;
+    std::vector<std::pair<std::string, double>> thresholds;
+
+    for (int i = 1; i < argc; i++) {
+
+        std::string key = argv[i];
+
+        if (key == "--statistics") {
+            statistics_mode = true;
+            continue;
+        }
+
+        if (i + 1 >= argc) {
+            break;
+        }
+
+        std::string value = argv[++i];
+
+        if (key == "--models") {
+
+            // comma-separated SBML paths, same order as the constructors
+            std::stringstream list(value);
+            std::string path;
+
+            while (std::getline(list, path, ',')) {
+                model_paths.push_back(path);
+            }
+
+        } else if (key == "--replicates") {
+            num_replicates = std::atoi(value.c_str());
+        } else if (key == "--start") {
+            start = std::strtod(value.c_str(), nullptr);
+        } else if (key == "--stop") {
+            stop = std::strtod(value.c_str(), nullptr);
+        } else if (key == "--step") {
+            step = std::strtod(value.c_str(), nullptr);
+        } else if (key == "--seed") {
+            seed = std::strtod(value.c_str(), nullptr);
+        } else if (key == "--output") {
+            output_prefix = value;
+        } else if (key == "--threads") {
+            num_threads = std::atoi(value.c_str());
+        } else if (key == "--quantiles") {
+
+            // comma-separated targets, e.g. 0.05,0.5,0.95
+            std::stringstream list(value);
+            std::string entry;
+
+            while (std::getline(list, entry, ',')) {
+                quantiles.push_back(std::strtod(entry.c_str(), nullptr));
+            }
+
+        } else if (key == "--thresholds") {
+
+            // comma-separated id=value crossing thresholds
+            std::stringstream list(value);
+            std::string entry;
+
+            while (std::getline(list, entry, ',')) {
+
+                size_t pos = entry.find('=');
+
+                if (pos != std::string::npos) {
+                    thresholds.push_back({
+                        entry.substr(0, pos),
+                        std::strtod(entry.c_str() + pos + 1, nullptr)
+                    });
+                }
+            }
+        }
+    }
+
+    if (model_paths.empty()) {
+
+        if (rank == 0) {
+            std::cerr << "Usage: SingleCellPopulation --models a.sbml[,b.sbml]"
+                      << " --replicates N [--start S --stop S --step S"
+                      << " --seed S --output prefix]\n"
+                      << "       [--statistics --threads N"
+                      << " --quantiles 0.05,0.5,0.95"
+                      << " --thresholds speciesId=value,...]\n";
+        }
+
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (statistics_mode) {
+
+        runStatisticsMode(
+            model_paths, num_replicates, start, stop, step, seed,
+            num_threads, quantiles, thresholds, output_prefix,
+            rank, num_ranks
+        );
+
+        MPI_Finalize();
+        return 0;
+    }
+
+    if (rank == 0) {
+
+        // column labels are identical across replicates; resolve them once
+        SingleCell reference_cell(model_paths);
+        std::vector<std::string> species_ids =
+            reference_cell.getRecordedSpeciesIds();
+
+        if (num_ranks == 1) {
+
+            // degenerate single-rank launch: run everything locally
+            for (int replicate = 0; replicate < num_replicates; replicate++) {
+
+                if (seed >= 0.0) {
+                    reference_cell.setSeed(
+                        static_cast<unsigned long long>(seed) + replicate
+                    );
+                }
+
+                if (replicate > 0) {
+                    reference_cell.reset();
+                }
+
+                std::vector<double> flat =
+                    reference_cell.simulateFlat(start, stop, step);
+
+                writeReplicate(
+                    flat,
+                    static_cast<int>(reference_cell.last_num_timesteps),
+                    static_cast<int>(reference_cell.last_num_species),
+                    replicate, output_prefix, step, species_ids
+                );
+            }
+
+            MPI_Finalize();
+            return 0;
+        }
+
+        // scheduling loop: hand out the next replicate to whichever worker
+        // asks, and drain result streams as they arrive
+        int next_replicate = 0;
+        int finished_workers = 0;
+        int received_results = 0;
+
+        while (finished_workers < num_ranks - 1 ||
+               received_results < num_replicates) {
+
+            MPI_Status status;
+            MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &status);
+
+            if (status.MPI_TAG == TAG_WORK_REQUEST) {
+
+                int token = 0;
+                MPI_Recv(&token, 1, MPI_INT, status.MPI_SOURCE,
+                         TAG_WORK_REQUEST, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+                int assignment = next_replicate < num_replicates
+                    ? next_replicate++
+                    : -1;
+
+                if (assignment < 0) {
+                    finished_workers++;
+                }
+
+                MPI_Send(&assignment, 1, MPI_INT, status.MPI_SOURCE,
+                         TAG_WORK_ASSIGN, MPI_COMM_WORLD);
+
+            } else if (status.MPI_TAG == TAG_RESULT_HEADER) {
+
+                int header[3];
+                MPI_Recv(header, 3, MPI_INT, status.MPI_SOURCE,
+                         TAG_RESULT_HEADER, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+                std::vector<double> flat(
+                    static_cast<size_t>(header[1]) * header[2]
+                );
+
+                MPI_Recv(flat.data(), static_cast<int>(flat.size()),
+                         MPI_DOUBLE, status.MPI_SOURCE, TAG_RESULT_DATA,
+                         MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+                writeReplicate(
+                    flat, header[1], header[2], header[0],
+                    output_prefix, step, species_ids
+                );
+
+                received_results++;
+            }
+        }
+
+        printf("Aggregated %i replicates across %i ranks.\n",
+               received_results, num_ranks);
+
+    } else {
+
+        // one resident session per worker rank, rewound between replicates
+        SingleCell single_cell(model_paths);
+
+        std::vector<std::unique_ptr<PendingResult>> in_flight;
+
+        bool first_replicate = true;
+
+        while (true) {
+
+            int token = 0;
+            MPI_Send(&token, 1, MPI_INT, 0, TAG_WORK_REQUEST, MPI_COMM_WORLD);
+
+            int replicate = -1;
+            MPI_Recv(&replicate, 1, MPI_INT, 0, TAG_WORK_ASSIGN,
+                     MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+            if (replicate < 0) {
+                break;
+            }
+
+            if (!first_replicate) {
+                single_cell.reset();
+            }
+
+            first_replicate = false;
+
+            if (seed >= 0.0) {
+
+                // per-replicate substream keeps runs independent & replayable
+                single_cell.setSeed(
+                    static_cast<unsigned long long>(seed) + replicate
+                );
+            }
+
+            auto result = std::make_unique<PendingResult>();
+
+            result->data = single_cell.simulateFlat(start, stop, step);
+            result->header[0] = replicate;
+            result->header[1] = static_cast<int>(single_cell.last_num_timesteps);
+            result->header[2] = static_cast<int>(single_cell.last_num_species);
+
+            // stream the slab back without blocking the next replicate;
+            // the buffer stays alive in in_flight until the sends finish
+            MPI_Isend(result->header, 3, MPI_INT, 0, TAG_RESULT_HEADER,
+                      MPI_COMM_WORLD, &result->requests[0]);
+            MPI_Isend(result->data.data(),
+                      static_cast<int>(result->data.size()), MPI_DOUBLE, 0,
+                      TAG_RESULT_DATA, MPI_COMM_WORLD, &result->requests[1]);
+
+            in_flight.push_back(std::move(result));
+
+            // bound worker memory: drain completed sends once a few
+            // slabs are outstanding
+            if (in_flight.size() >= 4) {
+
+                MPI_Waitall(2, in_flight.front()->requests,
+                            MPI_STATUSES_IGNORE);
+
+                in_flight.erase(in_flight.begin());
+            }
+        }
+
+        for (const auto& result : in_flight) {
+            MPI_Waitall(2, result->requests, MPI_STATUSES_IGNORE);
+        }
+    }
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file PopulationLayout.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Definitions for the population slab layout policies
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <chrono>
+#include <vector>
+#include <limits>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+// Internal libraries
+#include "singlecell/PopulationLayout.h"
+
+//=============================Class Details================================//
+namespace {
+
+// probe ceiling: large enough that the sweep pattern dominates, small
+// enough that tuning never thrashes the cache hierarchy it measures
+constexpr size_t kProbeElements = size_t(1) << 20;
+
+/**
+ * @brief times the mixed workload one candidate layout pays: one
+ * cell-major sweep (each cell's values in turn) plus one species-major
+ * sweep (each value across all cells) over a scratch slab
+ *
+ * @param layout candidate to measure, probe-sized
+ *
+ * @returns combined sweep wall time in seconds
+ */
+double probeLayout(
+    const PopulationLayout& layout
+) {
+
+    std::vector<double> slab(layout.size(), 1.0);
+
+    auto begin = std::chrono::steady_clock::now();
+
+    double sink = 0.0;
+
+    for (size_t cell = 0; cell < layout.num_cells; cell++) {
+
+        for (size_t item = 0; item < layout.num_items; item++) {
+            sink += slab[layout.index(cell, item)];
+        }
+    }
+
+    for (size_t item = 0; item < layout.num_items; item++) {
+
+        for (size_t cell = 0; cell < layout.num_cells; cell++) {
+            sink += slab[layout.index(cell, item)];
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - begin
+    ).count();
+
+    // keep the reductions observable so the sweeps cannot fold away
+    return sink != 0.0 ? seconds : seconds + 1.0;
+}
+
+} // namespace
+
+size_t PopulationLayout::size() const {
+
+    if (this->kind != Kind::Tiled) {
+        return this->num_cells * this->num_items;
+    }
+
+    size_t blocks =
+        (this->num_cells + this->tile_cells - 1) / this->tile_cells;
+
+    return blocks * this->tile_cells * this->num_items;
+}
+
+std::string PopulationLayout::describe() const {
+
+    switch (this->kind) {
+
+        case Kind::CellMajor: return "cell";
+
+        case Kind::SpeciesMajor: return "species";
+
+        default: return "tiled:" + std::to_string(this->tile_cells);
+    }
+}
+
+PopulationLayout PopulationLayout::resolve(
+    const std::string& name,
+    size_t num_cells,
+    size_t num_items
+) {
+
+    if (name == "auto") {
+        return autotune(num_cells, num_items);
+    }
+
+    PopulationLayout layout;
+    layout.num_cells = num_cells;
+    layout.num_items = num_items;
+
+    if (name == "cell") {
+        layout.kind = Kind::CellMajor;
+    } else if (name == "species") {
+        layout.kind = Kind::SpeciesMajor;
+    } else if (name == "tiled") {
+        layout.kind = Kind::Tiled;
+    } else {
+        throw std::runtime_error(
+            "Unknown population layout '" + name
+            + "'; expected cell, species, tiled or auto"
+        );
+    }
+
+    return layout;
+}
+
+PopulationLayout PopulationLayout::autotune(
+    size_t num_cells,
+    size_t num_items
+) {
+
+    // shrink the probe grid proportionally so the measured sweep keeps
+    // the real aspect ratio without exceeding the element ceiling
+    size_t probe_cells = std::max<size_t>(num_cells, 1);
+    size_t probe_items = std::max<size_t>(num_items, 1);
+
+    while (probe_cells * probe_items > kProbeElements) {
+
+        if (probe_cells >= probe_items && probe_cells > 1) {
+            probe_cells /= 2;
+        } else if (probe_items > 1) {
+            probe_items /= 2;
+        } else {
+            break;
+        }
+    }
+
+    // both flat layouts plus tile widths bracketing a cache line's
+    // worth of doubles on either side
+    std::vector<PopulationLayout> candidates;
+
+    for (Kind kind : { Kind::CellMajor, Kind::SpeciesMajor }) {
+
+        PopulationLayout layout;
+        layout.kind = kind;
+        candidates.push_back(layout);
+    }
+
+    for (size_t tile : { size_t(8), size_t(16), size_t(32) }) {
+
+        if (tile >= probe_cells) {
+            continue;
+        }
+
+        PopulationLayout layout;
+        layout.kind = Kind::Tiled;
+        layout.tile_cells = tile;
+        candidates.push_back(layout);
+    }
+
+    PopulationLayout winner;
+    double best = std::numeric_limits<double>::infinity();
+
+    for (PopulationLayout& candidate : candidates) {
+
+        candidate.num_cells = probe_cells;
+        candidate.num_items = probe_items;
+
+        double seconds = probeLayout(candidate);
+
+        if (seconds < best) {
+            best = seconds;
+            winner = candidate;
+        }
+    }
+
+    winner.num_cells = num_cells;
+    winner.num_items = num_items;
+
+    return winner;
+}
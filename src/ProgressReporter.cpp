@@ -0,0 +1,111 @@
+/**
+ * @file ProgressReporter.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Background progress sampler reporting rate and smoothed ETA
+ */
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cstdio>
+#include <chrono>
+#include <string>
+#include <fstream>
+
+// Internal Libraries
+#include "singlecell/ProgressReporter.h"
+
+//=============================Class Details================================//
+ProgressReporter::ProgressReporter(
+    size_t total_steps,
+    double interval_seconds,
+    std::string status_path
+) : total_steps(total_steps),
+    interval_seconds(interval_seconds > 0.0 ? interval_seconds : 1.0),
+    status_path(std::move(status_path))
+{
+
+    this->sampler = std::thread(&ProgressReporter::reporterLoop, this);
+}
+
+ProgressReporter::~ProgressReporter() {
+
+    {
+        std::lock_guard<std::mutex> lock(this->wake_mutex);
+        this->shutting_down = true;
+    }
+
+    this->wake_signal.notify_one();
+
+    if (this->sampler.joinable()) {
+        this->sampler.join();
+    }
+}
+
+void ProgressReporter::reporterLoop() {
+
+    auto wake_period = std::chrono::duration<double>(this->interval_seconds);
+
+    int last_step = 0;
+
+    double smoothed_rate = 0.0;
+
+    auto last_sample = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(this->wake_mutex);
+
+    while (!this->shutting_down) {
+
+        this->wake_signal.wait_for(lock, wake_period, [this]() {
+            return this->shutting_down;
+        });
+
+        if (this->shutting_down) {
+            break;
+        }
+
+        int step = this->current_step.load(std::memory_order_relaxed);
+
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - last_sample).count();
+
+        double sample_rate = elapsed > 0.0 ? (step - last_step) / elapsed : 0.0;
+
+        // exponential smoothing keeps the ETA from whipsawing when step
+        // cost varies (e.g. stochastic leap counts changing over time)
+        smoothed_rate = smoothed_rate == 0.0
+            ? sample_rate
+            : 0.3 * sample_rate + 0.7 * smoothed_rate;
+
+        double eta = smoothed_rate > 0.0
+            ? (static_cast<double>(this->total_steps) - step) / smoothed_rate
+            : -1.0;
+
+        double percent = this->total_steps > 0
+            ? 100.0 * step / static_cast<double>(this->total_steps)
+            : 0.0;
+
+        char line[160];
+
+        snprintf(line, sizeof(line),
+                 "Progress: %i / %zu (%.1f%%) | %.1f steps/s | ETA %.0f s\n",
+                 step, this->total_steps, percent, smoothed_rate, eta);
+
+        if (this->status_path.empty()) {
+
+            fputs(line, stderr);
+
+        } else {
+
+            // rewritten in place each sample: pollers always see one
+            // complete, current line
+            std::ofstream status(this->status_path, std::ios::trunc);
+            status << line;
+        }
+
+        last_step = step;
+        last_sample = now;
+    }
+}
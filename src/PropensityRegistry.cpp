@@ -0,0 +1,182 @@
+/**
+ * @file PropensityRegistry.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Lazy, dlopen-based lookup of generated native propensity kernels
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <mutex>
+#include <vector>
+#include <cstdlib>
+#include <sstream>
+#include <unordered_map>
+
+#include <dlfcn.h>
+
+// Internal Libraries
+#include "singlecell/Logger.h"
+#include "singlecell/PropensityRegistry.h"
+
+//=============================Class Details================================//
+namespace {
+
+// Generated libraries export plain C symbols, so dlsym needs no mangling
+constexpr const char* kEvalSymbol = "singlecell_propensities";
+constexpr const char* kNumSpeciesSymbol = "singlecell_propensity_num_species";
+constexpr const char* kNumParamsSymbol = "singlecell_propensity_num_parameters";
+constexpr const char* kNumReactionsSymbol = "singlecell_propensity_num_reactions";
+
+using CountFn = unsigned int (*)();
+
+std::mutex& registryMutex() {
+
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Directories probed for libpropensity_<id>.so, most recently added
+// first; same layout as the AMICI model search so both generated
+// artifacts live side by side
+std::vector<std::string>& searchPaths() {
+
+    static std::vector<std::string> paths = []() {
+
+        std::vector<std::string> initial;
+
+        if (const char* env = std::getenv("SINGLECELL_MODEL_PATH")) {
+
+            std::stringstream stream(env);
+            std::string entry;
+
+            while (std::getline(stream, entry, ':')) {
+
+                if (!entry.empty()) {
+                    initial.push_back(entry);
+                }
+            }
+        }
+
+        initial.push_back("amici_models");
+
+        return initial;
+    }();
+
+    return paths;
+}
+
+// Kernels already resolved this process, nullptr entries included so a
+// model without a library is only probed once; dlopen handles are never
+// dlclosed since resolved kernels stay callable for the process lifetime
+std::unordered_map<std::string, PropensityRegistry::PropensityFn>&
+resolvedKernels() {
+
+    static std::unordered_map<
+        std::string, PropensityRegistry::PropensityFn> kernels;
+    return kernels;
+}
+
+PropensityRegistry::PropensityFn resolveSharedObject(
+    const std::string& model_id,
+    size_t num_species,
+    size_t num_parameters,
+    size_t num_reactions
+) {
+
+    for (const std::string& directory : searchPaths()) {
+
+        // probe both the flat and the per-model nested spelling
+        const std::string candidates[] = {
+            directory + "/libpropensity_" + model_id + ".so",
+            directory + "/" + model_id + "/libpropensity_" + model_id + ".so"
+        };
+
+        for (const std::string& path : candidates) {
+
+            void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+            if (handle == nullptr) {
+                continue;
+            }
+
+            void* eval = dlsym(handle, kEvalSymbol);
+            void* species = dlsym(handle, kNumSpeciesSymbol);
+            void* params = dlsym(handle, kNumParamsSymbol);
+            void* reactions = dlsym(handle, kNumReactionsSymbol);
+
+            if (eval == nullptr || species == nullptr ||
+                params == nullptr || reactions == nullptr) {
+
+                SC_LOG_WARN(path
+                    << " does not export the propensity kernel interface;"
+                    << " skipping");
+
+                dlclose(handle);
+                continue;
+            }
+
+            // a stale library built against a different model layout
+            // would read and write out of bounds; reject it here and
+            // leave the caller on the interpreted path
+            if (reinterpret_cast<CountFn>(species)() != num_species ||
+                reinterpret_cast<CountFn>(params)() != num_parameters ||
+                reinterpret_cast<CountFn>(reactions)() != num_reactions) {
+
+                SC_LOG_WARN(path << " layout does not match model '"
+                    << model_id << "' (expected " << num_species
+                    << " species, " << num_parameters << " parameters, "
+                    << num_reactions << " reactions); rebuild with"
+                    << " createModels.py, falling back to interpreted"
+                    << " propensities");
+
+                dlclose(handle);
+                continue;
+            }
+
+            SC_LOG_INFO("loaded native propensity kernel for '"
+                << model_id << "' from " << path);
+
+            return reinterpret_cast<PropensityRegistry::PropensityFn>(eval);
+        }
+    }
+
+    return nullptr;
+}
+
+}
+
+PropensityRegistry::PropensityFn PropensityRegistry::resolve(
+    const std::string& model_id,
+    size_t num_species,
+    size_t num_parameters,
+    size_t num_reactions
+) {
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+
+    auto resolved = resolvedKernels().find(model_id);
+
+    if (resolved != resolvedKernels().end()) {
+        return resolved->second;
+    }
+
+    PropensityFn kernel = resolveSharedObject(
+        model_id, num_species, num_parameters, num_reactions
+    );
+
+    resolvedKernels()[model_id] = kernel;
+
+    return kernel;
+}
+
+void PropensityRegistry::addSearchPath(
+    const std::string& directory
+) {
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+
+    searchPaths().insert(searchPaths().begin(), directory);
+}
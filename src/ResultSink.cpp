@@ -0,0 +1,249 @@
+/**
+ * @file: ResultSink.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Composable output sinks: one recorded run, many products
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+//Internal Libraries
+#include "singlecell/utils.h"
+#include "singlecell/ResultSink.h"
+
+//=========================Function Definitions=============================//
+namespace {
+
+    /**
+     * @brief writes one matrix in the format its path's extension
+     * selects, matching the single-output path's dispatch
+     */
+    void writeByExtension(
+        const std::vector<std::vector<double>>& results_matrix,
+        const std::string& output_path,
+        const std::vector<std::string>& timesteps,
+        const std::vector<std::string>& species_ids
+    ) {
+
+        bool binary_output = output_path.size() > 4 &&
+            output_path.compare(output_path.size() - 4, 4, ".bin") == 0;
+
+        bool parquet_output = output_path.size() > 8 &&
+            output_path.compare(output_path.size() - 8, 8, ".parquet") == 0;
+
+        if (parquet_output) {
+            matrix_utils::save_matrix_parquet(
+                results_matrix, output_path, timesteps, species_ids
+            );
+        } else if (binary_output) {
+            matrix_utils::save_matrix_binary(
+                results_matrix, output_path, timesteps, species_ids
+            );
+        } else {
+            matrix_utils::save_matrix(
+                results_matrix, output_path, timesteps, species_ids
+            );
+        }
+    }
+
+} // namespace
+
+//=============================Class Details================================//
+SinkSpec SinkSpec::parse(
+    const std::string& text
+) {
+
+    SinkSpec spec;
+
+    size_t field_start = 0;
+
+    while (field_start <= text.size()) {
+
+        size_t field_end = text.find(',', field_start);
+
+        if (field_end == std::string::npos) {
+            field_end = text.size();
+        }
+
+        std::string field = text.substr(
+            field_start, field_end - field_start
+        );
+
+        if (spec.path.empty()) {
+
+            // the path always leads; everything after is options
+            spec.path = field;
+
+        } else if (field.rfind("every=", 0) == 0) {
+
+            spec.every = std::stoi(field.substr(6));
+
+            if (spec.every < 1) {
+                throw std::runtime_error(
+                    "Sink row interval must be positive: " + text
+                );
+            }
+
+        } else if (field.rfind("species=", 0) == 0) {
+
+            // species separate with '+' since ',' delimits the fields
+            std::string list = field.substr(8);
+            size_t id_start = 0;
+
+            while (id_start <= list.size()) {
+
+                size_t id_end = list.find('+', id_start);
+
+                if (id_end == std::string::npos) {
+                    id_end = list.size();
+                }
+
+                if (id_end > id_start) {
+                    spec.species.push_back(
+                        list.substr(id_start, id_end - id_start)
+                    );
+                }
+
+                id_start = id_end + 1;
+            }
+
+        } else {
+            throw std::runtime_error("Unknown sink option: " + field);
+        }
+
+        field_start = field_end + 1;
+    }
+
+    if (spec.path.empty()) {
+        throw std::runtime_error("Sink spec has no path: " + text);
+    }
+
+    return spec;
+}
+
+void SinkSet::addSink(
+    const SinkSpec& spec
+) {
+
+    this->sinks.push_back(spec);
+}
+
+size_t SinkSet::size() const {
+
+    return this->sinks.size();
+}
+
+int SinkSet::writeAll(
+    const std::vector<std::vector<double>>& results_matrix,
+    const std::vector<std::string>& timesteps,
+    const std::vector<std::string>& species_ids
+) const {
+
+    std::atomic<int> failures{0};
+
+    // each sink derives and writes its product independently, so the
+    // small TSV subset never waits behind the full-resolution binary;
+    // threads only read the shared matrix
+    auto writeSink = [&](const SinkSpec& sink) {
+
+        try {
+
+            // resolve the species subset to column indices first, so a
+            // typo fails before any rows are copied
+            std::vector<size_t> columns;
+            columns.reserve(sink.species.size());
+
+            for (const std::string& id : sink.species) {
+
+                size_t col = 0;
+
+                while (col < species_ids.size() &&
+                        species_ids[col] != id) {
+                    col++;
+                }
+
+                if (col == species_ids.size()) {
+                    throw std::runtime_error(
+                        "Sink species '" + id
+                        + "' is not a recorded species"
+                    );
+                }
+
+                columns.push_back(col);
+            }
+
+            bool full_product = sink.every == 1 && columns.empty();
+
+            if (full_product) {
+
+                writeByExtension(
+                    results_matrix, sink.path, timesteps, species_ids
+                );
+
+                return;
+            }
+
+            // derived product: thinned rows, subset columns
+            std::vector<std::vector<double>> product;
+            std::vector<std::string> product_times;
+
+            product.reserve(results_matrix.size() / sink.every + 1);
+            product_times.reserve(product.capacity());
+
+            for (size_t row = 0; row < results_matrix.size();
+                    row += sink.every) {
+
+                if (columns.empty()) {
+                    product.push_back(results_matrix[row]);
+                } else {
+
+                    std::vector<double> kept;
+                    kept.reserve(columns.size());
+
+                    for (size_t col : columns) {
+                        kept.push_back(results_matrix[row][col]);
+                    }
+
+                    product.push_back(std::move(kept));
+                }
+
+                if (row < timesteps.size()) {
+                    product_times.push_back(timesteps[row]);
+                }
+            }
+
+            writeByExtension(
+                product, sink.path, product_times,
+                columns.empty() ? species_ids : sink.species
+            );
+
+        } catch (const std::exception& error) {
+
+            fprintf(stderr, "Sink %s failed: %s\n",
+                    sink.path.c_str(), error.what());
+
+            failures++;
+        }
+    };
+
+    std::vector<std::thread> writers;
+    writers.reserve(this->sinks.size());
+
+    for (const SinkSpec& sink : this->sinks) {
+        writers.emplace_back(writeSink, std::cref(sink));
+    }
+
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    return failures.load();
+}
@@ -0,0 +1,342 @@
+/**
+ * @file ResultsArchive.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Definitions for the multi-run trajectory archive
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+// Internal libraries
+#include "singlecell/ResultsArchive.h"
+
+namespace {
+
+// archive magic: leads the file and closes the 16-byte trailer, so both
+// truncation and wrong-format opens are caught before any index parse
+constexpr char kArchiveMagic[8] =
+    {'S', 'C', 'A', 'R', 'C', '0', '0', '1'};
+
+// per-entry trajectory magic, identical to save_matrix_binary's format
+constexpr char kTrajectoryMagic[8] =
+    {'S', 'C', 'T', 'R', 'J', '0', '0', '1'};
+
+/**
+ * @brief joins labels newline-separated and writes the size-prefixed
+ * block, mirroring save_matrix_binary's label layout
+ *
+ * @param out destination stream
+ * @param labels label strings to join
+ */
+void writeLabelBlock(
+    std::ofstream& out,
+    const std::vector<std::string>& labels
+) {
+
+    std::string joined;
+
+    for (size_t i = 0; i < labels.size(); i++) {
+        joined += labels[i];
+        if (i + 1 < labels.size()) {
+            joined += "\n";
+        }
+    }
+
+    uint64_t block_size = joined.size();
+
+    out.write(reinterpret_cast<const char*>(&block_size), sizeof(block_size));
+    out.write(joined.data(), block_size);
+}
+
+/**
+ * @brief splits one size-prefixed label block out of an in-memory blob
+ *
+ * @param blob raw trajectory bytes
+ * @param cursor read position, advanced past the block
+ *
+ * @returns the block's labels; empty when the block was empty
+ */
+std::vector<std::string> readLabelBlock(
+    const std::vector<char>& blob,
+    size_t& cursor
+) {
+
+    uint64_t block_size = 0;
+    std::memcpy(&block_size, blob.data() + cursor, sizeof(block_size));
+    cursor += sizeof(block_size);
+
+    std::string joined(blob.data() + cursor, block_size);
+    cursor += block_size;
+
+    std::vector<std::string> labels;
+
+    if (joined.empty()) {
+        return labels;
+    }
+
+    size_t start = 0;
+
+    while (true) {
+
+        size_t split = joined.find('\n', start);
+
+        if (split == std::string::npos) {
+            labels.push_back(joined.substr(start));
+            break;
+        }
+
+        labels.push_back(joined.substr(start, split - start));
+        start = split + 1;
+    }
+
+    return labels;
+}
+
+} // namespace
+
+//=============================Class Details================================//
+ResultsArchiveWriter::ResultsArchiveWriter(
+    const std::string& output
+) : out(output, std::ios::binary) {
+
+    if (!this->out) {
+        throw std::runtime_error(
+            "ResultsArchiveWriter: cannot open " + output
+        );
+    }
+
+    this->out.write(kArchiveMagic, sizeof(kArchiveMagic));
+}
+
+ResultsArchiveWriter::~ResultsArchiveWriter() {
+
+    this->finalize();
+}
+
+void ResultsArchiveWriter::append(
+    const std::string& key,
+    const std::vector<double>& flat_results,
+    uint64_t num_cols,
+    const std::vector<std::string>& col_labels,
+    const std::vector<std::string>& row_labels
+) {
+
+    if (this->finalized) {
+        throw std::runtime_error(
+            "ResultsArchiveWriter: append after finalize"
+        );
+    }
+
+    uint64_t num_rows = num_cols > 0 ? flat_results.size() / num_cols : 0;
+
+    uint64_t offset = static_cast<uint64_t>(this->out.tellp());
+
+    // each entry is a complete SCTRJ001 stream: sliced out by byte range,
+    // it parses with the existing single-trajectory tooling
+    this->out.write(kTrajectoryMagic, sizeof(kTrajectoryMagic));
+
+    this->out.write(
+        reinterpret_cast<const char*>(&num_rows), sizeof(num_rows)
+    );
+    this->out.write(
+        reinterpret_cast<const char*>(&num_cols), sizeof(num_cols)
+    );
+
+    writeLabelBlock(this->out, col_labels);
+    writeLabelBlock(this->out, row_labels);
+
+    this->out.write(
+        reinterpret_cast<const char*>(flat_results.data()),
+        flat_results.size() * sizeof(double)
+    );
+
+    uint64_t length = static_cast<uint64_t>(this->out.tellp()) - offset;
+
+    this->entries.push_back({ key, offset, length });
+}
+
+void ResultsArchiveWriter::finalize() {
+
+    if (this->finalized) {
+        return;
+    }
+
+    this->finalized = true;
+
+    uint64_t index_offset = static_cast<uint64_t>(this->out.tellp());
+
+    uint64_t entry_count = this->entries.size();
+
+    this->out.write(
+        reinterpret_cast<const char*>(&entry_count), sizeof(entry_count)
+    );
+
+    for (const IndexEntry& entry : this->entries) {
+
+        uint64_t key_size = entry.key.size();
+
+        this->out.write(
+            reinterpret_cast<const char*>(&key_size), sizeof(key_size)
+        );
+        this->out.write(entry.key.data(), key_size);
+
+        this->out.write(
+            reinterpret_cast<const char*>(&entry.offset),
+            sizeof(entry.offset)
+        );
+        this->out.write(
+            reinterpret_cast<const char*>(&entry.length),
+            sizeof(entry.length)
+        );
+    }
+
+    // 16-byte trailer: index position plus the magic again, so readers
+    // locate the footer from the file's end with one seek
+    this->out.write(
+        reinterpret_cast<const char*>(&index_offset), sizeof(index_offset)
+    );
+    this->out.write(kArchiveMagic, sizeof(kArchiveMagic));
+
+    this->out.close();
+}
+
+ResultsArchiveReader::ResultsArchiveReader(
+    const std::string& path
+) : in(path, std::ios::binary) {
+
+    if (!this->in) {
+        throw std::runtime_error(
+            "ResultsArchiveReader: cannot open " + path
+        );
+    }
+
+    char magic[8];
+
+    this->in.read(magic, sizeof(magic));
+
+    if (std::memcmp(magic, kArchiveMagic, sizeof(magic)) != 0) {
+        throw std::runtime_error(
+            path + " is not a SingleCell results archive"
+        );
+    }
+
+    // trailer: index offset + magic as the last 16 bytes
+    this->in.seekg(-16, std::ios::end);
+
+    uint64_t index_offset = 0;
+
+    this->in.read(
+        reinterpret_cast<char*>(&index_offset), sizeof(index_offset)
+    );
+    this->in.read(magic, sizeof(magic));
+
+    if (std::memcmp(magic, kArchiveMagic, sizeof(magic)) != 0) {
+        throw std::runtime_error(
+            path + " archive is truncated or unfinalized"
+        );
+    }
+
+    this->in.seekg(index_offset, std::ios::beg);
+
+    uint64_t entry_count = 0;
+
+    this->in.read(
+        reinterpret_cast<char*>(&entry_count), sizeof(entry_count)
+    );
+
+    for (uint64_t e = 0; e < entry_count; e++) {
+
+        uint64_t key_size = 0;
+
+        this->in.read(
+            reinterpret_cast<char*>(&key_size), sizeof(key_size)
+        );
+
+        std::string key(key_size, '\0');
+
+        this->in.read(key.data(), key_size);
+
+        Entry entry;
+
+        this->in.read(
+            reinterpret_cast<char*>(&entry.offset), sizeof(entry.offset)
+        );
+        this->in.read(
+            reinterpret_cast<char*>(&entry.length), sizeof(entry.length)
+        );
+
+        this->ordered_keys.push_back(key);
+        this->index[key] = entry;
+    }
+}
+
+std::vector<std::string> ResultsArchiveReader::keys() const {
+
+    return this->ordered_keys;
+}
+
+bool ResultsArchiveReader::contains(
+    const std::string& key
+) const {
+
+    return this->index.count(key) != 0;
+}
+
+std::vector<double> ResultsArchiveReader::read(
+    const std::string& key,
+    uint64_t& num_rows,
+    uint64_t& num_cols,
+    std::vector<std::string>& col_labels,
+    std::vector<std::string>& row_labels
+) {
+
+    auto entry = this->index.find(key);
+
+    if (entry == this->index.end()) {
+        throw std::runtime_error(
+            "ResultsArchiveReader: no entry for key " + key
+        );
+    }
+
+    // the fetch itself: one seek, one read of the blob's byte range
+    std::vector<char> blob(entry->second.length);
+
+    this->in.seekg(entry->second.offset, std::ios::beg);
+    this->in.read(blob.data(), blob.size());
+
+    if (std::memcmp(blob.data(), kTrajectoryMagic, 8) != 0) {
+        throw std::runtime_error(
+            "ResultsArchiveReader: corrupt entry for key " + key
+        );
+    }
+
+    size_t cursor = 8;
+
+    std::memcpy(&num_rows, blob.data() + cursor, sizeof(num_rows));
+    cursor += sizeof(num_rows);
+
+    std::memcpy(&num_cols, blob.data() + cursor, sizeof(num_cols));
+    cursor += sizeof(num_cols);
+
+    col_labels = readLabelBlock(blob, cursor);
+    row_labels = readLabelBlock(blob, cursor);
+
+    std::vector<double> flat_results(num_rows * num_cols);
+
+    std::memcpy(
+        flat_results.data(),
+        blob.data() + cursor,
+        flat_results.size() * sizeof(double)
+    );
+
+    return flat_results;
+}
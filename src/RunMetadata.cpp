@@ -0,0 +1,86 @@
+/**
+ * @file RunMetadata.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for the process-wide provenance registry
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <utility>
+
+// Internal Libraries
+#include "singlecell/RunMetadata.h"
+
+//=========================Static Helpers===================================//
+namespace {
+
+// build tag injected by CMake from git describe; source builds outside
+// a checkout fall back to an honest placeholder
+#ifdef SINGLECELL_GIT_DESCRIBE
+const char* build_version = SINGLECELL_GIT_DESCRIBE;
+#else
+const char* build_version = "unversioned";
+#endif
+
+// registry and guard as function-local statics: construction happens on
+// first use, ahead of any writer, with no global init-order hazard; the
+// ordered map keeps embedded metadata stable across identical runs
+std::map<std::string, std::string>& registry() {
+
+    static std::map<std::string, std::string> facts = {
+        {"build", build_version}
+    };
+
+    return facts;
+}
+
+std::mutex& registryMutex() {
+
+    static std::mutex guard;
+
+    return guard;
+}
+
+} // namespace
+
+//=============================Class Details================================//
+void RunMetadata::set(
+    const std::string& key,
+    const std::string& value
+) {
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+
+    registry()[key] = value;
+}
+
+std::vector<std::pair<std::string, std::string>> RunMetadata::snapshot() {
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+
+    return { registry().begin(), registry().end() };
+}
+
+std::string RunMetadata::serialize() {
+
+    std::string joined;
+
+    for (const auto& fact : snapshot()) {
+
+        if (!joined.empty()) {
+            joined += '\n';
+        }
+
+        joined += fact.first;
+        joined += '=';
+        joined += fact.second;
+    }
+
+    return joined;
+}
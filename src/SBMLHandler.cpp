@@ -16,6 +16,8 @@
 
 // Internal Libraries
 #include "singlecell/utils.h"
+#include "singlecell/Logger.h"
+#include "singlecell/ModelData.h"
 #include "singlecell/SBMLHandler.h"
 
 //--------------------------Class Declaration-------------------------------//
@@ -30,84 +32,150 @@ SBMLHandler::SBMLHandler(
      * @returns None
      */    
     SBMLReader reader;
-    doc = reader.readSBML(filename.c_str());
+
+    this->source_path = filename;
+
+    // shared ownership: copies of this handler are cheap handles onto
+    // the same document, freed once when the last handle drops
+    this->doc = std::shared_ptr<SBMLDocument>(reader.readSBML(filename.c_str()));
 
     this->model = doc->getModel();
 
     // used for determinining AMICI model
     this->name = this->model->getId();
 
-    // List of every species comparmental volume
-    this->species_volumes = getGlobalSpeciesCompartmentVals();
+    // Fill the struct-of-arrays registry before anything reads through
+    // the getters; ModelData extraction below already serves from it
+    this->populateRegistry();
+
+    // Immutable derived data comes from the process-wide per-file cache,
+    // so repeat loads of the same model skip re-extraction entirely.
+    // Only the tau-leap/SSA model ids pay the stoichiometry and
+    // rate-law extraction; everything else resolves to an AMICI-backed
+    // module that never reads them
+    bool needs_stochastic_kernels =
+        this->name == "Stochastic" || this->name == "SSA";
+
+    this->data = ModelData::acquire(
+        filename, *this, needs_stochastic_kernels
+    );
 }
 
-SBMLHandler::~SBMLHandler() { // Destructor Method
-    if (doc != nullptr) {
-        doc = nullptr;
-        delete doc;
+void SBMLHandler::populateRegistry() {
+
+    unsigned int numSpecies = this->model->getNumSpecies();
+
+    this->species_ids.resize(numSpecies);
+    this->species_values.resize(numSpecies);
+    this->species_volumes.resize(numSpecies);
+
+    for (unsigned int i = 0; i < numSpecies; i++) {
+
+        const Species* species = this->model->getSpecies(i);
+
+        this->species_ids[i] = species->getId();
+        this->species_values[i] = species->getInitialConcentration();
+        this->species_index[this->species_ids[i]] = i;
+
+        this->species_volumes[i] =
+            this->model->getCompartment(species->getCompartment())->getVolume();
     }
 
-    if (model != nullptr) {
-        model = nullptr;
-        delete model;
+    unsigned int numParams = this->model->getNumParameters();
+
+    this->parameter_ids.resize(numParams);
+    this->parameter_values.resize(numParams);
+
+    for (unsigned int p = 0; p < numParams; p++) {
+
+        const Parameter* param = this->model->getParameter(p);
+
+        this->parameter_ids[p] = param->getId();
+        this->parameter_values[p] = param->getValue();
+        this->parameter_index[this->parameter_ids[p]] = p;
+    }
+
+    unsigned int numReactions = this->model->getNumReactions();
+
+    this->reaction_ids.resize(numReactions);
+
+    for (unsigned int r = 0; r < numReactions; r++) {
+
+        this->reaction_ids[r] = this->model->getReaction(r)->getId();
     }
 }
 
-std::vector<std::vector<double>> SBMLHandler::getStoichiometricMatrix() {
+SBMLHandler SBMLHandler::clone() const {
 
-    int numSpecies = this->model->getNumSpecies();
+    // start from the cheap handle copy — registry, volumes and the
+    // shared immutable ModelData carry over — then swap in a private
+    // deep copy of the document so mutations stay isolated
+    SBMLHandler copy = *this;
 
-    int numReactions = this->model->getNumReactions();
+    copy.doc = std::shared_ptr<SBMLDocument>(this->doc->clone());
+    copy.model = copy.doc->getModel();
 
-    // make map of species indices
-    std::unordered_map<std::string, unsigned int> species_map = speciesMap(numSpecies);
+    return copy;
+}
 
-    // build a blank stoichiometric matrix of zeros
-    std::vector<std::vector<double>> stoichmat(numSpecies, std::vector<double>(numReactions, 0.0));
+void SBMLHandler::getStoichiometryCSR(
+    SparseMatrix& species_rows,
+    SparseMatrix& reaction_rows
+) {
+
+    unsigned int numSpecies = this->model->getNumSpecies();
+
+    unsigned int numReactions = this->model->getNumReactions();
+
+    // one pass over the reactions, through the typed accessors —
+    // getReactant/getProduct return SpeciesReference directly, so no
+    // dynamic_cast per reference — emitting coordinate triplets that
+    // compress to both CSR forms without a dense intermediate
+    std::vector<SparseMatrix::Triplet> entries;
+
+    std::vector<SparseMatrix::Triplet> transposed;
+
+    for (unsigned int i = 0; i < numReactions; i++) {
 
-    // Populate the matrix:
-    for (int i = 0; i < numReactions; i++) {
-        //Reaction getter
         const Reaction* reaction = this->model->getReaction(i);
-        
-        // Find Reactants
-        const ListOfSpeciesReferences* reactants = reaction->getListOfReactants();
-
-        for (unsigned int r = 0; r < reactants->size(); r++) {
-            const SimpleSpeciesReference* reactant_ref = reactants->get(r);
-            const SpeciesReference* reactant = dynamic_cast<const SpeciesReference*>(reactant_ref);
-            const std::string speciesId = reactant->getSpecies();
-            double coeff = reactant->getStoichiometry();
-            unsigned int speciesIndex = species_map.at(speciesId);
-            stoichmat[speciesIndex][i] -= coeff;
-        }
 
-        const ListOfSpeciesReferences* products = reaction->getListOfProducts();
+        unsigned int numReactants = reaction->getNumReactants();
+
+        for (unsigned int r = 0; r < numReactants; r++) {
+
+            const SpeciesReference* reactant = reaction->getReactant(r);
 
-        // Find Products
-        for (unsigned int p = 0; p < products->size(); p++) {
-            const SimpleSpeciesReference* product_ref = products->get(p);
-            const SpeciesReference* product = dynamic_cast<const SpeciesReference*>(product_ref);
-            const std::string speciesId = product->getSpecies();
-            double coeff = product->getStoichiometry();
-            unsigned int speciesIndex = species_map.at(speciesId);
-            stoichmat[speciesIndex][i] += coeff;
+            unsigned int s = this->species_index.at(reactant->getSpecies());
+
+            entries.push_back({ s, i, -reactant->getStoichiometry() });
+            transposed.push_back({ i, s, -reactant->getStoichiometry() });
         }
-    }
 
-    return stoichmat;
-}
+        unsigned int numProducts = reaction->getNumProducts();
 
-std::unordered_map<std::string, unsigned int> SBMLHandler::speciesMap(const int& numSpecies) {
+        for (unsigned int p = 0; p < numProducts; p++) {
 
-    std::unordered_map<std::string, unsigned int> speciesIndexMap;
+            const SpeciesReference* product = reaction->getProduct(p);
 
-    for (unsigned int i = 0; i < numSpecies; ++i) {
+            unsigned int s = this->species_index.at(product->getSpecies());
 
-        speciesIndexMap[this->model->getSpecies(i)->getId()] = i;
+            entries.push_back({ s, i, product->getStoichiometry() });
+            transposed.push_back({ i, s, product->getStoichiometry() });
+        }
     }
 
-    return speciesIndexMap;
+    species_rows = SparseMatrix::fromTriplets(
+        numSpecies, numReactions, std::move(entries)
+    );
+
+    reaction_rows = SparseMatrix::fromTriplets(
+        numReactions, numSpecies, std::move(transposed)
+    );
+}
+
+const std::unordered_map<std::string, unsigned int>& SBMLHandler::speciesMap(const int& numSpecies) {
+
+    return this->species_index;
 }
 
 std::vector<std::string> SBMLHandler::getReactionExpressions() {
@@ -135,148 +203,210 @@ std::vector<std::string> SBMLHandler::getReactionExpressions() {
     return formulas_vector;
 }
 
-std::vector<std::string> SBMLHandler::getSpeciesIds() {
+std::vector<SBMLHandler::RuleSpec> SBMLHandler::getRuleSpecs() {
+
+    unsigned int numRules = this->model->getNumRules();
+
+    std::vector<RuleSpec> specs;
+    specs.reserve(numRules);
+
+    for (unsigned int i = 0; i < numRules; i++) {
 
-    unsigned int num_species = this->model->getNumSpecies();
+        const Rule* rule = this->model->getRule(i);
 
-    std::vector<std::string> species_ids(num_species);
+        if (rule->getMath() == nullptr) {
+            continue;
+        }
 
-    for (int i = 0; i < num_species; i++) {
+        // algebraic rules name no target variable; solving them needs a
+        // constraint solver the simulation engines do not carry
+        if (!rule->isAssignment() && !rule->isRate()) {
 
-        species_ids[i] = model->getSpecies(i)->getId();
+            SC_LOG_WARN(
+                "Algebraic rule skipped in model " << this->name
+                    << "; only assignment and rate rules are supported"
+            );
+            continue;
+        }
 
+        specs.push_back({
+            rule->getVariable(),
+            SBML_formulaToL3String(rule->getMath()),
+            rule->isRate()
+        });
     }
-    return species_ids;
+
+    return specs;
 }
 
-std::vector<double> SBMLHandler::getInitialState() {
+std::vector<SBMLHandler::EventSpec> SBMLHandler::getEventSpecs() {
 
-     int numSpecies = this->model->getNumSpecies();
+    unsigned int numEvents = this->model->getNumEvents();
 
-     std::vector<double> initial_state(numSpecies);
+    std::vector<EventSpec> specs;
+    specs.reserve(numEvents);
 
-     for (unsigned int i = 0; i < numSpecies; i++) {
+    for (unsigned int i = 0; i < numEvents; i++) {
 
-        double state = this->model->getSpecies(i)->getInitialConcentration();
+        const Event* event = this->model->getEvent(i);
 
-        initial_state[i] = state;
-     }
+        if (event->getTrigger() == nullptr ||
+            event->getTrigger()->getMath() == nullptr) {
+            continue;
+        }
 
-     return initial_state;
-}
+        EventSpec spec;
+
+        spec.trigger_formula =
+            SBML_formulaToL3String(event->getTrigger()->getMath());
 
-std::vector<std::string> SBMLHandler::getParameterIds() {
-    std::vector<std::string> parameter_ids;
+        unsigned int numAssignments = event->getNumEventAssignments();
 
-    int numParams = this->model->getNumParameters();
-    for (int i = 0; i < numParams; ++i) {
-        const Parameter* param = this->model->getParameter(i);
+        for (unsigned int a = 0; a < numAssignments; a++) {
 
-            parameter_ids.push_back(param->getId());
+            const EventAssignment* assignment =
+                event->getEventAssignment(a);
+
+            if (assignment->getMath() == nullptr) {
+                continue;
+            }
+
+            spec.assignments.emplace_back(
+                assignment->getVariable(),
+                SBML_formulaToL3String(assignment->getMath())
+            );
+        }
+
+        specs.push_back(std::move(spec));
     }
 
-    return parameter_ids;
+    return specs;
 }
 
-std::vector<double> SBMLHandler::getParameterValues() {
+const std::vector<std::string>& SBMLHandler::getSpeciesIds() {
+
+    return this->species_ids;
+}
 
-    std::vector<double> parameter_vals;
-    parameter_vals.resize(this->model->getNumParameters());
+const std::vector<double>& SBMLHandler::getInitialState() {
 
+    // species values only change through setState, setModelEntityValue
+    // and convertSpeciesUnits, all of which write the registry through
+    return this->species_values;
+}
+
+const std::vector<std::string>& SBMLHandler::getParameterIds() {
+
+    return this->parameter_ids;
+}
+
+const std::vector<double>& SBMLHandler::getParameterValues() {
+
+    // parameters are also written through raw Parameter* pointers during
+    // exchange, so the registry row is refreshed in place: no allocation,
+    // but the returned values always match the document
     for (int p = 0; p < this->model->getNumParameters(); p++) {
-        parameter_vals[p] = this->model->getParameter(p)->getValue();
+        this->parameter_values[p] = this->model->getParameter(p)->getValue();
     }
 
-    return parameter_vals;
+    return this->parameter_values;
 }
 
 void SBMLHandler::setModelEntityValue(
-    std::string entity_id, 
+    std::string entity_id,
     double new_value
 ) {
-    // Check if in SBML as Parameter || Species || Compartment;
-    if (this->model->getParameter(entity_id) != nullptr) {
+    if (!this->trySetEntityValue(entity_id, new_value)) {
 
-        this->model->getParameter(entity_id)->setValue(new_value);
-
-            std::cout << "Parameter: " << static_cast<std::string>(this->model->getParameter(entity_id)->getId());
-            std::cout << " set value: " << static_cast<double>(this->model->getParameter(entity_id)->getValue()) << "\n";
+        printf("Entity {%s} Not Found In Model", entity_id.c_str());
 
-    } else if (this->model->getSpecies(entity_id) != nullptr) {
+        std::exit(EXIT_FAILURE);
+    }
 
-        this->model->getSpecies(entity_id)->setInitialConcentration(new_value);
+    SC_LOG_DEBUG("Entity: " << entity_id << " set value: " << new_value);
+}
 
-        std::cout << "Species: " << static_cast<std::string>(this->model->getSpecies(entity_id)->getId());
-        std::cout << " set value: " << static_cast<double>(this->model->getSpecies(entity_id)->getInitialConcentration()) << "\n";
+bool SBMLHandler::trySetEntityValue(
+    const std::string& entity_id,
+    double new_value
+) {
+    // Check if in SBML as Parameter || Species || Compartment; the
+    // registry index maps resolve parameters and species in one lookup
+    // instead of re-scanning the document per call
+    auto parameter = this->parameter_index.find(entity_id);
 
-    } else if (this->model->getCompartment(entity_id) != nullptr) {
+    if (parameter != this->parameter_index.end()) {
 
-        this->model->getCompartment(entity_id)->setVolume(new_value);
+        this->model->getParameter(parameter->second)->setValue(new_value);
 
-    }else {
-        printf("Entity {%s} Not Found In Model", entity_id.c_str());
+        // write the registry row through alongside the document
+        this->parameter_values[parameter->second] = new_value;
 
-        std::exit(EXIT_FAILURE);
+        return true;
     }
-}
 
-std::vector<std::string> SBMLHandler::getReactionIds() {
+    auto species = this->species_index.find(entity_id);
 
-    unsigned int numReactions = this->model->getNumReactions();
-
-    // Results storage list
-    std::vector<std::string> reactionIds(numReactions);
+    if (species != this->species_index.end()) {
 
-    for (int i = 0; i < numReactions; i++) {
+        this->model->getSpecies(species->second)
+            ->setInitialConcentration(new_value);
 
-        reactionIds[i] = this->model->getReaction(i)->getId();
+        this->species_values[species->second] = new_value;
 
+        return true;
     }
-    return reactionIds;
-}
 
-std::vector<double> SBMLHandler::getGlobalSpeciesCompartmentVals( 
+    if (this->model->getCompartment(entity_id) != nullptr) {
 
-) {
+        this->model->getCompartment(entity_id)->setVolume(new_value);
 
+        // every species housed in this compartment sees the new volume
+        for (size_t i = 0; i < this->species_ids.size(); i++) {
+            if (this->model->getSpecies(i)->getCompartment() == entity_id) {
+                this->species_volumes[i] = new_value;
+            }
+        }
 
-    unsigned int numSpecies = this->model->getNumSpecies();
+        return true;
+    }
 
-    // Results vector for list of compartment values per species
-    std::vector<double> cell_volumes(numSpecies);
+    return false;
+}
 
-    for (int i = 0; i < numSpecies; i++) {
+const std::vector<std::string>& SBMLHandler::getReactionIds() {
 
-        std::string comp_i = this->model->getSpecies(i)->getCompartment();
+    return this->reaction_ids;
+}
 
-        cell_volumes[i] = this->model->getCompartment(comp_i)->getVolume();
+const std::vector<double>& SBMLHandler::getGlobalSpeciesCompartmentVals( 
 
-    }
+) {
 
-    return cell_volumes;
+    return this->species_volumes;
 
 }
 
 void SBMLHandler::convertSpeciesUnits(
-    std::vector<double> conversion_factors
+    const std::vector<double>& conversion_factors
 ) {
 
     unsigned int numSpecies = this->model->getNumSpecies();
 
-    std::vector<double> current_val = getInitialState();
-
     for (int i = 0; i < numSpecies; i++) {
 
-        double convert2unit = current_val[i] * conversion_factors[i];
+        double convert2unit = this->species_values[i] * conversion_factors[i];
 
         this->model->getSpecies(i)->setInitialConcentration(convert2unit);
 
+        this->species_values[i] = convert2unit;
+
     }
 
 }
 
 void SBMLHandler::setState(
-    std::vector<double> new_state
+    const std::vector<double>& new_state
 ) {
 
     unsigned int numSpecies = this->model->getNumSpecies();
@@ -285,6 +415,8 @@ void SBMLHandler::setState(
 
         this->model->getSpecies(i)->setInitialConcentration(new_state[i]);
 
+        this->species_values[i] = new_state[i];
+
     }
 
 }
\ No newline at end of file
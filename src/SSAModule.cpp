@@ -0,0 +1,333 @@
+/**
+ * @file SSAModule.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Definitions for exact next-reaction SSAModule operations
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <string>
+#include <iostream>
+
+// Internal libraries
+#include "singlecell/utils.h"
+#include "singlecell/Logger.h"
+#include "singlecell/SSAModule.h"
+#include "singlecell/SBMLHandler.h"
+#include "singlecell/PerfMonitor.h"
+
+// Third Party Libraries
+#include "muParser.h"
+
+//=============================Class Details================================//
+SSAModule::SSAModule(
+    SBMLHandler ExactModel
+) : StochasticModule(ExactModel) {
+
+    this->module_kind = ModuleKind::SSA;
+
+    // The parent already compiled the rate laws and built the CSR
+    // stoichiometry; all that is left is the dependency graph
+    size_t numReactions = this->stoich_cols.num_rows;
+
+    // Invert formula membership once: species index -> reactions whose
+    // propensity reads that species, from the shared token lists
+    std::vector<std::vector<unsigned int>> readers(
+        this->model_data->species_ids.size()
+    );
+
+    for (size_t j = 0; j < this->model_data->formulas_vector.size(); j++) {
+
+        for (const std::string& token : this->model_data->formula_tokens[j]) {
+
+            auto species = this->model_data->species_index.find(token);
+
+            if (species != this->model_data->species_index.end()) {
+                readers[species->second].push_back(
+                    static_cast<unsigned int>(j)
+                );
+            }
+        }
+    }
+
+    // dependents[i] = reactions reading any species that firing i changes;
+    // a stamp vector dedupes without per-reaction set allocations
+    this->dependents.resize(numReactions);
+
+    std::vector<unsigned int> stamp(numReactions, 0);
+
+    for (size_t i = 0; i < numReactions; i++) {
+
+        // the fired reaction always redraws its own time
+        this->dependents[i].push_back(static_cast<unsigned int>(i));
+        stamp[i] = static_cast<unsigned int>(i) + 1;
+
+        for (size_t e = this->stoich_cols.row_ptr[i];
+             e < this->stoich_cols.row_ptr[i + 1]; e++) {
+
+            for (unsigned int j : readers[this->stoich_cols.col_idx[e]]) {
+
+                if (stamp[j] != static_cast<unsigned int>(i) + 1) {
+                    stamp[j] = static_cast<unsigned int>(i) + 1;
+                    this->dependents[i].push_back(j);
+                }
+            }
+        }
+    }
+
+    this->propensities.resize(numReactions);
+    this->firing_times.resize(numReactions);
+    this->heap.resize(numReactions);
+    this->heap_pos.resize(numReactions);
+}
+
+double SSAModule::drawFiringTime(
+    double t_now,
+    double propensity
+) {
+
+    if (!(propensity > 0.0)) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // 1 - u keeps the draw in (0, 1] so the log stays finite; the pool
+    // turns the per-event uniform into a pointer bump
+    double u = this->uniform_pool.next();
+
+    return t_now - std::log(1.0 - u) / propensity;
+}
+
+void SSAModule::heapSiftUp(
+    size_t pos
+) {
+
+    while (pos > 0) {
+
+        size_t parent = (pos - 1) / 2;
+
+        if (this->firing_times[this->heap[pos]] >=
+            this->firing_times[this->heap[parent]]) {
+            break;
+        }
+
+        std::swap(this->heap[pos], this->heap[parent]);
+        this->heap_pos[this->heap[pos]] = static_cast<unsigned int>(pos);
+        this->heap_pos[this->heap[parent]] = static_cast<unsigned int>(parent);
+
+        pos = parent;
+    }
+}
+
+void SSAModule::heapSiftDown(
+    size_t pos
+) {
+
+    size_t count = this->heap.size();
+
+    while (true) {
+
+        size_t smallest = pos;
+        size_t left = 2 * pos + 1;
+        size_t right = 2 * pos + 2;
+
+        if (left < count &&
+            this->firing_times[this->heap[left]] <
+            this->firing_times[this->heap[smallest]]) {
+            smallest = left;
+        }
+
+        if (right < count &&
+            this->firing_times[this->heap[right]] <
+            this->firing_times[this->heap[smallest]]) {
+            smallest = right;
+        }
+
+        if (smallest == pos) {
+            break;
+        }
+
+        std::swap(this->heap[pos], this->heap[smallest]);
+        this->heap_pos[this->heap[pos]] = static_cast<unsigned int>(pos);
+        this->heap_pos[this->heap[smallest]] = static_cast<unsigned int>(smallest);
+
+        pos = smallest;
+    }
+}
+
+void SSAModule::heapUpdate(
+    unsigned int reaction
+) {
+
+    size_t pos = this->heap_pos[reaction];
+
+    this->heapSiftUp(pos);
+    this->heapSiftDown(this->heap_pos[reaction]);
+}
+
+void SSAModule::step(
+    int step
+) {
+
+    // block the RNG substream on the step index so this interval's draws
+    // replay in isolation, independent of prior steps' draw counts;
+    // pooled uniforms from the prior block are stale once it changes
+    this->generator.setBlock(static_cast<uint64_t>(step));
+    this->uniform_pool.invalidate();
+
+    const std::vector<double>& last_state_nM = this->getLastStepResult(step);
+
+    size_t numSpecies = last_state_nM.size();
+    size_t numReactions = this->stoich_cols.num_rows;
+
+    // Working copies: propensities evaluate against molecules-per-volume,
+    // firings add integer stoichiometry to whole-molecule counts
+    this->state_mpv.resize(numSpecies);
+    this->state_molecules.resize(numSpecies);
+
+    unit_conversions::convert(
+        last_state_nM.data(),
+        this->nM2mpv_conversion_factors,
+        this->state_mpv.data(),
+        numSpecies
+    );
+
+    for (size_t s = 0; s < numSpecies; s++) {
+
+        double volume = this->species_volume_factors[s];
+
+        this->state_molecules[s] = std::round(this->state_mpv[s] * volume);
+
+        // re-derive per-volume values from the rounded counts so the
+        // propensities see exactly the integer state being advanced
+        this->state_mpv[s] = volume > 0.0
+            ? this->state_molecules[s] / volume
+            : this->state_molecules[s];
+
+        if (this->species_slots[s] >= 0) {
+            this->eval_values[this->species_slots[s]] = this->state_mpv[s];
+        }
+    }
+
+    // Rebuild the event queue from scratch: the exchange phase may have
+    // changed parameter values, so every putative time is stale
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "ssa_queue_rebuild");
+
+        for (size_t i = 0; i < numReactions; i++) {
+
+            // build-time validation made Eval exception-free; invalid
+            // formulas never fire
+            this->propensities[i] = this->formula_valid[i]
+                ? this->compiled_formulas[i].Eval()
+                : 0.0;
+
+            this->firing_times[i] = drawFiringTime(0.0, this->propensities[i]);
+
+            this->heap[i] = static_cast<unsigned int>(i);
+            this->heap_pos[i] = static_cast<unsigned int>(i);
+        }
+
+        for (size_t i = numReactions; i-- > 0;) {
+            this->heapSiftDown(i);
+        }
+
+        // one scan per rebuild replaces per-evaluation error handling
+        this->scanForNonFinite(this->propensities.data(), numReactions);
+    }
+
+    // Fire reactions one at a time until the interval's end
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "ssa_firing_loop");
+
+        double t_now = 0.0;
+
+        while (numReactions > 0) {
+
+            unsigned int next = this->heap[0];
+            double t_fire = this->firing_times[next];
+
+            if (t_fire >= this->delta_t) {
+                break;
+            }
+
+            t_now = t_fire;
+
+            // apply the fired reaction's stoichiometry column
+            for (size_t e = this->stoich_cols.row_ptr[next];
+                 e < this->stoich_cols.row_ptr[next + 1]; e++) {
+
+                unsigned int s = this->stoich_cols.col_idx[e];
+
+                this->state_molecules[s] = std::max(
+                    0.0, this->state_molecules[s] + this->stoich_cols.values[e]
+                );
+
+                double volume = this->species_volume_factors[s];
+
+                this->state_mpv[s] = volume > 0.0
+                    ? this->state_molecules[s] / volume
+                    : this->state_molecules[s];
+
+                if (this->species_slots[s] >= 0) {
+                    this->eval_values[this->species_slots[s]] = this->state_mpv[s];
+                }
+            }
+
+            // only the affected propensities are recomputed; survivors
+            // keep their draw through the Gibson-Bruck time rescale
+            for (unsigned int j : this->dependents[next]) {
+
+                double a_old = this->propensities[j];
+
+                double a_new = this->formula_valid[j]
+                    ? this->compiled_formulas[j].Eval()
+                    : 0.0;
+
+                this->propensities[j] = a_new;
+
+                if (j == next || !(a_old > 0.0) ||
+                    !std::isfinite(this->firing_times[j])) {
+
+                    this->firing_times[j] = drawFiringTime(t_now, a_new);
+
+                } else if (!(a_new > 0.0)) {
+
+                    this->firing_times[j] =
+                        std::numeric_limits<double>::infinity();
+
+                } else {
+
+                    this->firing_times[j] = t_now +
+                        (a_old / a_new) * (this->firing_times[j] - t_now);
+                }
+
+                this->heapUpdate(j);
+            }
+        }
+    }
+
+    //Record iteration's result; partners read the exchange slots, so
+    //the step publishes nothing into libSBML. The molecules -> nM
+    //conversion fuses into the recording copy
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "recording");
+        BaseModule::recordStepResultScaled(
+            this->state_molecules.data(),
+            this->molecules2nM_conversion_factors,
+            numSpecies,
+            step
+        );
+    }
+
+    // rules and events resolve at the step boundary, exactly as in the
+    // tau-leap dispatch; the exact-SSA inner loop stays rule-free
+    if (this->rules_active) {
+        this->applyRulesAndEvents(step);
+    }
+}
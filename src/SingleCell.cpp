@@ -9,42 +9,160 @@
 
 //===========================Library Import=================================//
 //Std Libraries
+#include <atomic>
+#include <optional>
+#include <cstdio>
 #include <vector>
 #include <string>
 #include <chrono>
+#include <thread>
+#include <cstdint>
+#include <future>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
 #include <unordered_set>
+#include <cctype>
 
 
 // Internal Libraries
 #include "singlecell/utils.h"
+#include "singlecell/Logger.h"
+#include "singlecell/RunMetadata.h"
 #include "singlecell/SingleCell.h"
 #include "singlecell/BaseModule.h"
+#include "singlecell/AllocationGuard.h"
+#include "singlecell/TaskScheduler.h"
+#include "singlecell/ProgressReporter.h"
 #include "singlecell/SBMLHandler.h"
+#include "singlecell/AmiciModelRegistry.h"
+#include "singlecell/ResultsArchive.h"
+#include "singlecell/SSAModule.h"
 #include "singlecell/HybridModule.h"
 #include "singlecell/StochasticModule.h"
 #include "singlecell/DeterministicModule.h"
 
 //=============================Class Details================================//
-std::map<std::string, std::function<std::unique_ptr<BaseModule>(const SBMLHandler&)>> SingleCell::moduleFactory = {
+const std::map<std::string, std::function<std::unique_ptr<BaseModule>(const SBMLHandler&)>> SingleCell::moduleFactory = {
     { "Deterministic", [](const SBMLHandler& handler) { return std::make_unique<DeterministicModule>(handler); } },
     { "Stochastic", [](const SBMLHandler& handler) { return std::make_unique<StochasticModule>(handler); } },
+    { "SSA", [](const SBMLHandler& handler) { return std::make_unique<SSAModule>(handler); } },
     { "Hybrid", [](const SBMLHandler& handler) { return std::make_unique<HybridModule>(handler); } }
 };
 
+namespace {
+
+/**
+ * @brief steps one module through its concrete type, chosen once at
+ * construction via the module_kind tag: with the leaf classes final,
+ * each case is a direct call the compiler can inline into the step
+ * pipeline, instead of the virtual dispatch nothing inlines across.
+ * Unknown kinds keep the plain virtual path
+ */
+inline void stepModuleDirect(
+    BaseModule* mod,
+    int timestep
+) {
+
+    switch (mod->module_kind) {
+
+        case BaseModule::ModuleKind::Deterministic:
+            static_cast<DeterministicModule*>(mod)->step(timestep);
+            break;
+
+        case BaseModule::ModuleKind::SSA:
+            static_cast<SSAModule*>(mod)->step(timestep);
+            break;
+
+        case BaseModule::ModuleKind::Stochastic:
+            static_cast<StochasticModule*>(mod)->StochasticModule::step(timestep);
+            break;
+
+        case BaseModule::ModuleKind::Hybrid:
+            static_cast<HybridModule*>(mod)->step(timestep);
+            break;
+
+        default:
+            mod->step(timestep);
+            break;
+    }
+}
+
+}
+
+std::vector<SBMLHandler> SingleCell::loadSBMLModels(
+    const std::vector<std::string>& sbml_paths
+) {
+
+    std::vector<SBMLHandler> handler_list;
+
+    // nothing to overlap with a single model; skip the thread spawn
+    if (sbml_paths.size() <= 1) {
+
+        for (const auto& path : sbml_paths) {
+            handler_list.emplace_back(path);
+        }
+
+        return handler_list;
+    }
+
+    // each file parses into its own slot, so completion order does not
+    // matter and the handler order still matches the path order
+    std::vector<std::optional<SBMLHandler>> slots(sbml_paths.size());
+
+    std::vector<std::thread> workers;
+    workers.reserve(sbml_paths.size());
+
+    for (size_t i = 0; i < sbml_paths.size(); i++) {
+
+        workers.emplace_back([&slots, &sbml_paths, i]() {
+            slots[i].emplace(sbml_paths[i]);
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (auto& slot : slots) {
+        handler_list.push_back(std::move(*slot));
+    }
+
+    return handler_list;
+}
+
+void SingleCell::ensureSessionLoaded() {
+
+    if (!this->modules.empty()) {
+        return;
+    }
+
+    this->loadSimulationModules();
+
+    // a lone module has no partner to exchange with, so target
+    // assignment and overlap resolution have nothing to resolve:
+    // deterministic-only screening goes straight from model load to
+    // the solver without any co-simulation scaffolding
+    if (this->modules.size() > 1) {
+
+        this->assignGlobalTargets();
+
+        this->findModuleOverlaps();
+    }
+}
+
 std::vector<std::vector<double>> SingleCell::simulate(
-    double start, 
+    double start,
     double stop,
     double step
 ) {
 
-    //Create instances of internal simulation modules: dynamic allocation
-    this->loadSimulationModules();
-
-    // Assign Target per Module
-    this->assignGlobalTargets();
+    // Build the session once; repeat calls reuse stoichiometry,
+    // compiled formulas and AMICI objects
+    this->ensureSessionLoaded();
 
-    // Identify all module overlaps between targets
-    this->findModuleOverlaps();
+    // the exchange interval, when set, defines the stepping grid
+    step = this->gridStep(step);
 
     // Add simulation time steps, results matrix
     this->setGlobalSimulationSettings(
@@ -53,7 +171,8 @@ std::vector<std::vector<double>> SingleCell::simulate(
         step
     );
 
-    std::vector<double> timeSteps = BaseModule::setTimeSteps(start, stop, step);
+    const std::vector<double>& timeSteps =
+        *BaseModule::sharedTimeSteps(start, stop, step);
 
     // run simulation:
     this->runGlobal(timeSteps);
@@ -63,198 +182,4272 @@ std::vector<std::vector<double>> SingleCell::simulate(
         timeSteps.size()
     );
 
-    this->modules.clear();
-
     return results_matrix;
 }
 
-void SingleCell::modify(
-    std::string entity_id,
-    double value
+std::vector<double> SingleCell::simulateFlat(
+    double start,
+    double stop,
+    double step
 ) {
-    for ( auto& handler : this->handlers) {
-        handler.setModelEntityValue(
-            entity_id, 
-            value
-            );
-    }
-}
 
-void SingleCell::loadSimulationModules() {
+    // Build the session once; repeat calls reuse stoichiometry,
+    // compiled formulas and AMICI objects
+    this->ensureSessionLoaded();
 
-    for (const SBMLHandler& handler : handlers) {
+    // the exchange interval, when set, defines the stepping grid
+    step = this->gridStep(step);
 
-        const std::string id = handler.model->getId();
+    // Add simulation time steps, results matrix
+    this->setGlobalSimulationSettings(
+        start,
+        stop,
+        step
+    );
 
-        auto matched_module = this->moduleFactory.find(id);
+    const std::vector<double>& timeSteps =
+        *BaseModule::sharedTimeSteps(start, stop, step);
 
-        if (matched_module != moduleFactory.end()) {
+    // run simulation:
+    this->runGlobal(timeSteps);
 
-            // Call the factory function with the SBMLHandler
-            std::unique_ptr<BaseModule> base_mod = matched_module->second(handler);
+    // total row length across modules
+    size_t total_stride = 0;
 
-            // if module is empty; there's no need to add overhead:
-            if (!base_mod->handler.getSpeciesIds().empty()) {
+    for (const auto& mod : this->modules) {
+        total_stride += mod->results_stride;
+    }
 
-                // Move the pointer into the list of modules
-                this->modules.push_back(std::move(base_mod));
+    // with thinned recording only every record_interval-th row exists
+    size_t recorded_steps =
+        (timeSteps.size() + this->record_interval - 1) / this->record_interval;
 
-            }
-        } else {
-            // Fallback if no match
-            std::unique_ptr<BaseModule> base_mod = std::make_unique<DeterministicModule>(handler);
-            this->modules.push_back(std::move(base_mod));
-        }
+    // a rolling window retains only its trailing rows
+    if (this->results_window > 0 &&
+        recorded_steps > static_cast<size_t>(this->results_window)) {
+
+        recorded_steps = static_cast<size_t>(this->results_window);
     }
-}
 
-void SingleCell::assignGlobalTargets() {
+    this->last_num_timesteps = recorded_steps;
+    this->last_num_species = total_stride;
 
-    for (const auto& mod : this->modules) {
+    // the modules already recorded straight into the global matrix; no
+    // per-row assembly pass remains
+    if (!this->global_results.empty()) {
 
-        mod->loadTargetModule(this->modules);
+        if (this->results_species_major) {
+
+            // one cache-blocked pass converts the finished matrix so
+            // per-species scans read contiguously
+            std::vector<double> transposed(this->global_results.size());
+
+            matrix_utils::transpose_blocked(
+                this->global_results.data(),
+                recorded_steps, total_stride,
+                transposed.data()
+            );
 
+            return transposed;
+        }
+
+        return this->global_results;
     }
-}
 
-void SingleCell::findModuleOverlaps() {
+    // backing-store mode: assemble from the per-module mapped rows
+    std::vector<double> flat_results;
+    flat_results.reserve(recorded_steps * total_stride);
 
-    for (const auto& mod : this->modules) {
+    for (size_t t = 0; t < recorded_steps; t++) {
 
-        for (const auto& target : mod->targets) {
+        for (const auto& mod : this->modules) {
 
-            mod->findOverlappingIds(target->sbml);
+            const double* row = mod->getResultsRow(t);
 
+            flat_results.insert(
+                flat_results.end(),
+                row,
+                row + mod->results_stride
+            );
         }
     }
+
+    if (this->results_species_major) {
+
+        std::vector<double> transposed(flat_results.size());
+
+        matrix_utils::transpose_blocked(
+            flat_results.data(),
+            recorded_steps, total_stride,
+            transposed.data()
+        );
+
+        return transposed;
+    }
+
+    return flat_results;
 }
 
-void SingleCell::setGlobalSimulationSettings(
+std::vector<std::vector<double>> SingleCell::resume(
+    std::string ckpt_path,
     double start,
     double stop,
     double step
 ) {
-    for (const auto& mod : this->modules) {
 
-        mod->setSimulationSettings(
-            start,
-            stop,
-            step
+    // Overlap the checkpoint read with module reconstruction: the bytes
+    // stream into memory on a background thread while modules, targets
+    // and overlaps build, so a preempted shard's resume pays
+    // max(model build, checkpoint I/O) instead of their sum
+    std::future<std::string> checkpoint_bytes = std::async(
+        std::launch::async,
+        [ckpt_path]() {
+
+            std::ifstream in(ckpt_path, std::ios::binary);
+
+            if (!in) {
+                throw std::runtime_error(
+                    "Could not open checkpoint: " + ckpt_path
+                );
+            }
+
+            std::ostringstream buffer;
+            buffer << in.rdbuf();
+
+            return buffer.str();
+        }
+    );
+
+    // Build the session once; repeat calls reuse stoichiometry,
+    // compiled formulas and AMICI objects
+    this->ensureSessionLoaded();
+
+    // the exchange interval, when set, defines the stepping grid
+    step = this->gridStep(step);
+
+    // Add simulation time steps, results matrix
+    this->setGlobalSimulationSettings(
+        start,
+        stop,
+        step
+    );
+
+    // Restore module states, RNG streams and recorded rows from the
+    // prefetched bytes; get() only waits out whatever I/O the module
+    // build did not already cover
+    std::istringstream checkpoint_stream(checkpoint_bytes.get());
+
+    int last_step = this->loadCheckpointStream(checkpoint_stream, ckpt_path);
+
+    const std::vector<double>& timeSteps =
+        *BaseModule::sharedTimeSteps(start, stop, step);
+
+    // continue simulation from the step after the checkpointed one:
+    this->runGlobal(timeSteps, last_step + 1);
+
+    // combine each module's results matrix together
+    std::vector<std::vector<double>> results_matrix = combineResultsMatrix(
+        timeSteps.size()
+    );
+
+    return results_matrix;
+}
+
+std::vector<std::vector<double>> SingleCell::extend(
+    double new_stop
+) {
+
+    if (this->modules.empty() || this->last_sim_step <= 0.0) {
+        throw std::runtime_error(
+            "extend called without a completed run; call simulate first"
         );
     }
-}
 
-void SingleCell::runGlobal(
-    std::vector<double> timesteps
-) { 
-    auto start_t = std::chrono::high_resolution_clock::now();
-    printf("Running Simulation for %lu steps.", timesteps.size());
-    printf("\n");
+    if (new_stop <= this->last_sim_stop) {
+        throw std::runtime_error(
+            "extend target must lie beyond the previous stop time"
+        );
+    }
+
+    double start = this->last_sim_start;
+    double step = this->last_sim_step;
+
+    std::shared_ptr<const std::vector<double>> old_grid =
+        BaseModule::sharedTimeSteps(start, this->last_sim_stop, step);
+
+    std::shared_ptr<const std::vector<double>> new_grid =
+        BaseModule::sharedTimeSteps(start, new_stop, step);
+
+    const std::vector<double>& old_steps = *old_grid;
+    const std::vector<double>& timeSteps = *new_grid;
+
+    size_t old_recorded =
+        (old_steps.size() + this->record_interval - 1) / this->record_interval;
+
+    size_t new_recorded =
+        (timeSteps.size() + this->record_interval - 1) / this->record_interval;
+
+    if (!this->global_results.empty()) {
+
+        // rebuild the (possibly padded) layout at the longer horizon and
+        // replant the recorded rows; the run's end folds padding back out
+        const size_t line_doubles = 64 / sizeof(double);
+
+        bool padded = this->parallel_stepping && this->modules.size() > 1;
+
+        size_t total_stride = 0;
+
+        std::vector<size_t> offsets;
 
-    if (this->modules.size() == 1) {
         for (const auto& mod : this->modules) {
 
-            std::cout << "Simulating fully " << mod->getModuleId() << "\n";
+            size_t stride = mod->results_stride;
 
-            mod->run(timesteps);
+            offsets.push_back(total_stride);
 
+            total_stride += padded
+                ? ((stride + line_doubles - 1) / line_doubles + 1) * line_doubles
+                : stride;
         }
 
-    } else {
-        // Main iterating for-loop: we're going to stop it and update vals every second until total time reached.
-        for (int step = 1; step < timesteps.size(); step++) {
+        // the previous run's compact fold fixed the source stride
+        size_t compact_stride = this->global_results.size() / old_recorded;
 
-            //Run Module Simulations
-            this->stepGlobal(step);
+        std::vector<double> grown(new_recorded * total_stride, 0.0);
 
-            // exchange data
-            this->updateGlobalParameters();
+        for (size_t t = 0; t < old_recorded; t++) {
+
+            const double* src_row =
+                this->global_results.data() + t * compact_stride;
+
+            double* dst_row = grown.data() + t * total_stride;
+
+            size_t src_offset = 0;
+
+            for (size_t m = 0; m < this->modules.size(); m++) {
+
+                size_t stride = this->modules[m]->results_stride;
+
+                std::copy(
+                    src_row + src_offset,
+                    src_row + src_offset + stride,
+                    dst_row + offsets[m]
+                );
+
+                src_offset += stride;
+            }
+        }
+
+        this->global_results.swap(grown);
+
+        this->global_row_stride = total_stride;
+        this->global_block_offsets = offsets;
+
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            this->modules[m]->bindExternalResults(
+                this->global_results.data() + offsets[m],
+                static_cast<int>(total_stride)
+            );
+        }
+
+    } else {
 
-            auto iter_t = std::chrono::high_resolution_clock::now();
-            std::chrono::duration<double> iter_time = iter_t - start_t;
-            printf("Iteration [%i / %i] Time: %f", 
-                                (int)(step), 
-                                (int)(timesteps.size()), 
-                                iter_time.count());
-            printf("\n");
+        // backing-store mode grows each module's mapping in place
+        for (const auto& mod : this->modules) {
+            mod->growResultsMatrix(static_cast<int>(timeSteps.size()));
         }
     }
 
+    for (const auto& mod : this->modules) {
+        mod->time_grid = new_grid;
+    }
 
-    auto stop_t = std::chrono::high_resolution_clock::now();
+    this->last_num_timesteps = new_recorded;
+    this->last_sim_stop = new_stop;
 
-    std::chrono::duration<double> duration = stop_t - start_t;
+    // continue at the first step beyond the old horizon: RNG blocks key
+    // on absolute step indices, so every appended draw is the one a
+    // single longer run would have made
+    this->extending_run = true;
 
-    printf("Simulation Completed in %f seconds.", static_cast<double>(duration.count()));
-    printf("\n");
+    this->runGlobal(timeSteps, static_cast<int>(old_steps.size()));
 
+    this->extending_run = false;
+
+    return this->combineResultsMatrix(timeSteps.size());
 }
 
-void SingleCell::stepGlobal(
-    int timestep
+std::vector<double> SingleCell::simulateBatch(
+    const std::vector<std::vector<std::pair<std::string, double>>>& conditions,
+    double start,
+    double stop,
+    double step,
+    int num_threads
 ) {
 
-    for (const auto& mod : this->modules) {
-        
-        mod->step(timestep);
+    int num_conditions = static_cast<int>(conditions.size());
+
+    // the exchange interval, when set, defines the stepping grid
+    step = this->gridStep(step);
+
+    // thread width comes from the process-wide scheduler now; the
+    // parameter remains for callers that tuned it, as a serial escape
+    bool concurrent = num_threads != 1 &&
+        TaskScheduler::instance().threadCount() > 1;
 
+    // slab geometry is identical across conditions, so the stacked buffer
+    // can be preallocated and written lock-free by the workers
+    size_t recorded_steps =
+        (BaseModule::sharedTimeSteps(start, stop, step)->size() + this->record_interval - 1)
+            / this->record_interval;
+
+    // a rolling window retains only its trailing rows
+    if (this->results_window > 0 &&
+        recorded_steps > static_cast<size_t>(this->results_window)) {
+
+        recorded_steps = static_cast<size_t>(this->results_window);
     }
 
-}
+    size_t stride = this->getRecordedSpeciesIds().size();
 
-void SingleCell::updateGlobalParameters() {
+    // workers commit finished slabs concurrently, so the slab stride is
+    // padded out to whole cache lines plus a full line of gap: no line
+    // ever holds bytes of two workers' regions. The pool join is what
+    // publishes the buffer; the padding folds out below, afterwards
+    const size_t line_doubles = 64 / sizeof(double);
 
-    for (const auto& mod : this->modules) {
+    size_t slab_doubles = recorded_steps * stride;
 
-        mod->updateParameters();
+    size_t slab_stride = concurrent
+        ? ((slab_doubles + line_doubles - 1) / line_doubles + 1) * line_doubles
+        : slab_doubles;
 
-    }
+    std::vector<double> batch_results(num_conditions * slab_stride);
 
-}
+    // Warm-pool eligibility: when every overridden entity is a parameter,
+    // one fully-initialized cell per worker serves a whole block of
+    // conditions — modules, compiled formulas, AMICI objects and the
+    // configured solver all persist, and each condition costs a pristine
+    // state rewind plus a bound-override write instead of a cold start.
+    // A species override changes the initial state, which only the
+    // per-condition construction below reproduces
+    std::vector<std::string> pooled_ids;
+    std::vector<double> pooled_baseline;
+    std::unordered_map<std::string, size_t> pooled_slots;
 
-std::vector<std::vector<double>> SingleCell::combineResultsMatrix(
-    int timesteps
-) {
+    bool parameters_only = !this->batch_continuation && num_conditions > 1;
 
-    int numSpecies = this->getGlobalSpeciesIds().size();
+    for (int c = 0; parameters_only && c < num_conditions; c++) {
 
-    std::vector<std::vector<double>> final_matrix;
+        for (const auto& [entity_id, value] : conditions[c]) {
 
-    for (size_t m = 0; m < this->modules.size(); m++) {
+            if (pooled_slots.count(entity_id) != 0) {
+                continue;
+            }
 
-        if (m == 0) {
+            const Parameter* parameter = nullptr;
 
-            final_matrix = this->modules[m]->results_matrix;
-        } else {
+            for (auto& handler : this->handlers) {
 
-            std::vector<std::vector<double>> mod_matrix = this->modules[m]->results_matrix;
+                parameter = handler.model->getParameter(entity_id);
 
-            for (size_t t = 0; t < mod_matrix.size(); t++) {
+                if (parameter != nullptr) {
+                    break;
+                }
+            }
 
-                final_matrix[t].insert(
-                    final_matrix[t].end(),
-                    mod_matrix[t].begin(),
-                    mod_matrix[t].end()
-                );
+            if (parameter == nullptr) {
+                parameters_only = false;
+                break;
             }
+
+            pooled_slots[entity_id] = pooled_ids.size();
+            pooled_ids.push_back(entity_id);
+            pooled_baseline.push_back(parameter->getValue());
         }
     }
-    return final_matrix;
-}
 
-std::vector<std::string> SingleCell::getGlobalSpeciesIds() {
+    // One task per condition on the process-wide scheduler: idle workers
+    // steal stragglers, and the shared pool keeps concurrent batch and
+    // population runs from oversubscribing the node with private pools
+    auto runCondition = [&](int condition) {
 
-    std::vector<std::string> global_ids;
+        // Each condition owns its modules and state; construction
+        // happens inside the task so setup overlaps across workers
+        SingleCell cell(this->model_paths);
 
-    for (auto& handler : this->handlers) {
+        cell.setRecording(this->record_interval, this->record_species);
+
+        cell.record_mantissa_bits = this->record_mantissa_bits;
+
+        cell.results_window = this->results_window;
+
+        cell.setStepIntervals(
+            this->leap_seconds, this->exchange_seconds, this->record_seconds
+        );
+
+        cell.solver_profile = this->solver_profile;
 
-        std::vector<std::string> mod_species_ids = handler.getSpeciesIds();
+        if (this->rng_seed.has_value()) {
 
-        for (const auto& specie : mod_species_ids) {
+            // Per-condition substream keeps runs independent & replayable
+            cell.setSeed(this->rng_seed.value() + condition);
+        }
 
-            global_ids.push_back(specie);
+        for (const auto& [entity_id, value] : conditions[condition]) {
 
+            cell.modify(entity_id, value);
         }
-    }
-    return global_ids;
+
+        std::vector<double> flat = cell.simulateFlat(start, stop, step);
+
+        std::copy(
+            flat.begin(),
+            flat.end(),
+            batch_results.begin() + condition * slab_stride
+        );
+    };
+
+    // continuation mode chains conditions by parameter distance and
+    // warm-starts each solve from its predecessor's final state; paired
+    // with steady-state detection each dose integrates only the
+    // transient between neighbouring doses
+    auto runSegment = [&](int begin, int end,
+                          const std::vector<int>& order) {
+
+        SingleCell cell(this->model_paths);
+
+        cell.setRecording(this->record_interval, this->record_species);
+
+        cell.record_mantissa_bits = this->record_mantissa_bits;
+
+        cell.results_window = this->results_window;
+
+        cell.setStepIntervals(
+            this->leap_seconds, this->exchange_seconds, this->record_seconds
+        );
+
+        cell.solver_profile = this->solver_profile;
+
+        // early termination at equilibrium is what makes the warm start
+        // pay; without it every dose still integrates the full window
+        cell.steady_state_tolerance = this->steady_state_tolerance;
+        cell.steady_state_window = this->steady_state_window;
+
+        for (int i = begin; i < end; i++) {
+
+            int condition = order[i];
+
+            if (this->rng_seed.has_value()) {
+                cell.setSeed(this->rng_seed.value() + condition);
+            }
+
+            // carry the previous dose's final state forward, then apply
+            // this dose's overrides on top of it
+            if (i > begin) {
+                cell.reset(cell.getCurrentState());
+            }
+
+            for (const auto& [entity_id, value] : conditions[condition]) {
+                cell.modify(entity_id, value);
+            }
+
+            std::vector<double> flat = cell.simulateFlat(start, stop, step);
+
+            std::copy(
+                flat.begin(),
+                flat.end(),
+                batch_results.begin() + condition * slab_stride
+            );
+        }
+    };
+
+    // warm pool: one cell per worker over a contiguous block; binding
+    // once makes every later condition raw array writes into the live
+    // engines, and the settings pass keeps the configured solver since
+    // step and profile never change across the batch
+    auto runPooled = [&](int begin, int end) {
+
+        SingleCell cell(this->model_paths);
+
+        cell.setRecording(this->record_interval, this->record_species);
+
+        cell.record_mantissa_bits = this->record_mantissa_bits;
+
+        cell.results_window = this->results_window;
+
+        cell.setStepIntervals(
+            this->leap_seconds, this->exchange_seconds, this->record_seconds
+        );
+
+        cell.solver_profile = this->solver_profile;
+
+        // builds the modules and resolves the override bindings once;
+        // the pool's whole point is that this line runs per worker, not
+        // per condition
+        cell.bindParameters(pooled_ids);
+
+        std::vector<double> values(pooled_baseline.size());
+
+        for (int i = begin; i < end; i++) {
+
+            if (this->rng_seed.has_value()) {
+                cell.setSeed(this->rng_seed.value() + i);
+            }
+
+            // unlike the continuation chain, every condition starts from
+            // the pristine document state
+            cell.reset({});
+
+            // baseline values first, so one condition's overrides never
+            // leak into the next through the shared live engines
+            values = pooled_baseline;
+
+            for (const auto& [entity_id, value] : conditions[i]) {
+                values[pooled_slots.at(entity_id)] = value;
+            }
+
+            cell.setParameters(values);
+
+            std::vector<double> flat = cell.simulateFlat(start, stop, step);
+
+            std::copy(
+                flat.begin(),
+                flat.end(),
+                batch_results.begin() + i * slab_stride
+            );
+        }
+    };
+
+    if (this->batch_continuation && num_conditions > 1) {
+
+        std::vector<int> order = this->continuationOrder(conditions);
+
+        int workers = concurrent
+            ? std::min(TaskScheduler::instance().threadCount(), num_conditions)
+            : 1;
+
+        if (workers > 1) {
+
+            // one contiguous chain segment per worker; only each
+            // segment's first condition pays a cold start
+            int base = num_conditions / workers;
+            int remainder = num_conditions % workers;
+
+            TaskScheduler::instance().parallelFor(workers, [&](int worker) {
+
+                int begin = worker * base + std::min(worker, remainder);
+                int end = begin + base + (worker < remainder ? 1 : 0);
+
+                runSegment(begin, end, order);
+            });
+
+        } else {
+
+            runSegment(0, num_conditions, order);
+        }
+
+    } else if (parameters_only) {
+
+        int workers = concurrent
+            ? std::min(TaskScheduler::instance().threadCount(), num_conditions)
+            : 1;
+
+        if (workers > 1) {
+
+            // contiguous blocks, as in the continuation path; only each
+            // block's first condition pays module and solver construction
+            int base = num_conditions / workers;
+            int remainder = num_conditions % workers;
+
+            TaskScheduler::instance().parallelFor(workers, [&](int worker) {
+
+                int begin = worker * base + std::min(worker, remainder);
+                int end = begin + base + (worker < remainder ? 1 : 0);
+
+                runPooled(begin, end);
+            });
+
+        } else {
+
+            runPooled(0, num_conditions);
+        }
+
+    } else if (concurrent) {
+
+        TaskScheduler::instance().parallelFor(num_conditions, runCondition);
+
+    } else {
+
+        for (int condition = 0; condition < num_conditions; condition++) {
+            runCondition(condition);
+        }
+    }
+
+    // forward in-place fold back to the dense stacked layout; every
+    // destination sits at or before its source
+    if (slab_stride != slab_doubles) {
+
+        for (int condition = 1; condition < num_conditions; condition++) {
+
+            std::copy(
+                batch_results.begin() + condition * slab_stride,
+                batch_results.begin() + condition * slab_stride + slab_doubles,
+                batch_results.begin() + condition * slab_doubles
+            );
+        }
+
+        batch_results.resize(num_conditions * slab_doubles);
+    }
+
+    this->last_num_timesteps = recorded_steps;
+    this->last_num_species = stride;
+
+    return batch_results;
+}
+
+std::vector<double> SingleCell::simulateReplicatesFlat(
+    double start,
+    double stop,
+    double step,
+    int num_replicates
+) {
+
+    if (num_replicates <= 1) {
+        return this->simulateFlat(start, stop, step);
+    }
+
+    // the exchange interval, when set, defines the stepping grid
+    step = this->gridStep(step);
+
+    bool concurrent = TaskScheduler::instance().threadCount() > 1;
+
+    // slab geometry is identical across replicates, so the stacked
+    // buffer can be preallocated and written lock-free by the workers
+    size_t recorded_steps =
+        (BaseModule::sharedTimeSteps(start, stop, step)->size() + this->record_interval - 1)
+            / this->record_interval;
+
+    // a rolling window retains only its trailing rows
+    if (this->results_window > 0 &&
+        recorded_steps > static_cast<size_t>(this->results_window)) {
+
+        recorded_steps = static_cast<size_t>(this->results_window);
+    }
+
+    size_t stride = this->getRecordedSpeciesIds().size();
+
+    const size_t line_doubles = 64 / sizeof(double);
+
+    size_t slab_doubles = recorded_steps * stride;
+
+    size_t slab_stride = concurrent
+        ? ((slab_doubles + line_doubles - 1) / line_doubles + 1) * line_doubles
+        : slab_doubles;
+
+    std::vector<double> replicate_results(num_replicates * slab_stride);
+
+    // every replicate is an independent draw of the same configured
+    // system: workers share the immutable per-model data through the
+    // process-wide cache and differ only in their RNG substream
+    auto runReplicate = [&](int replicate) {
+
+        // Each replicate owns its modules and state; construction
+        // happens inside the task so setup overlaps across workers
+        SingleCell cell(this->model_paths);
+
+        cell.setRecording(this->record_interval, this->record_species);
+
+        cell.record_mantissa_bits = this->record_mantissa_bits;
+
+        cell.results_window = this->results_window;
+
+        cell.setStepIntervals(
+            this->leap_seconds, this->exchange_seconds, this->record_seconds
+        );
+
+        cell.solver_profile = this->solver_profile;
+
+        if (this->rng_seed.has_value()) {
+
+            // Per-replicate substream keeps draws independent & replayable
+            cell.setSeed(this->rng_seed.value() + replicate);
+        }
+
+        std::vector<double> flat = cell.simulateFlat(start, stop, step);
+
+        std::copy(
+            flat.begin(),
+            flat.end(),
+            replicate_results.begin() + replicate * slab_stride
+        );
+    };
+
+    if (concurrent) {
+
+        TaskScheduler::instance().parallelFor(num_replicates, runReplicate);
+
+    } else {
+
+        for (int replicate = 0; replicate < num_replicates; replicate++) {
+            runReplicate(replicate);
+        }
+    }
+
+    // forward in-place fold back to the dense stacked layout; every
+    // destination sits at or before its source
+    if (slab_stride != slab_doubles) {
+
+        for (int replicate = 1; replicate < num_replicates; replicate++) {
+
+            std::copy(
+                replicate_results.begin() + replicate * slab_stride,
+                replicate_results.begin() + replicate * slab_stride + slab_doubles,
+                replicate_results.begin() + replicate * slab_doubles
+            );
+        }
+
+        replicate_results.resize(num_replicates * slab_doubles);
+    }
+
+    this->last_num_timesteps = recorded_steps;
+    this->last_num_species = stride;
+
+    return replicate_results;
+}
+
+std::vector<int> SingleCell::continuationOrder(
+    const std::vector<std::vector<std::pair<std::string, double>>>& conditions
+) const {
+
+    int num_conditions = static_cast<int>(conditions.size());
+
+    std::vector<std::unordered_map<std::string, double>> values(num_conditions);
+
+    for (int c = 0; c < num_conditions; c++) {
+
+        for (const auto& [entity_id, value] : conditions[c]) {
+            values[c][entity_id] = value;
+        }
+    }
+
+    // squared distance over the union of overridden entities; an entity
+    // one side leaves at default contributes its full override
+    auto distance = [&](int a, int b) {
+
+        double d = 0.0;
+
+        for (const auto& [entity_id, va] : values[a]) {
+
+            auto other = values[b].find(entity_id);
+
+            double vb = (other != values[b].end()) ? other->second : 0.0;
+
+            d += (va - vb) * (va - vb);
+        }
+
+        for (const auto& [entity_id, vb] : values[b]) {
+
+            if (!values[a].count(entity_id)) {
+                d += vb * vb;
+            }
+        }
+
+        return d;
+    };
+
+    // start at the smallest-magnitude condition so a 1-D sweep walks
+    // its doses in ascending order
+    int current = 0;
+    double best_norm = std::numeric_limits<double>::infinity();
+
+    for (int c = 0; c < num_conditions; c++) {
+
+        double norm = 0.0;
+
+        for (const auto& [entity_id, value] : values[c]) {
+            norm += value * value;
+        }
+
+        if (norm < best_norm) {
+            best_norm = norm;
+            current = c;
+        }
+    }
+
+    std::vector<bool> visited(num_conditions, false);
+
+    std::vector<int> order;
+    order.reserve(num_conditions);
+
+    order.push_back(current);
+    visited[current] = true;
+
+    // greedy nearest-neighbour chain; ~30-condition sweeps make the
+    // quadratic scan immaterial next to a single solve
+    for (int placed = 1; placed < num_conditions; placed++) {
+
+        int nearest = -1;
+        double nearest_distance = std::numeric_limits<double>::infinity();
+
+        for (int c = 0; c < num_conditions; c++) {
+
+            if (visited[c]) {
+                continue;
+            }
+
+            double d = distance(current, c);
+
+            if (d < nearest_distance) {
+                nearest_distance = d;
+                nearest = c;
+            }
+        }
+
+        order.push_back(nearest);
+        visited[nearest] = true;
+        current = nearest;
+    }
+
+    return order;
+}
+
+void SingleCell::setBatchContinuation(
+    bool enabled
+) {
+
+    this->batch_continuation = enabled;
+}
+
+std::vector<double> SingleCell::simulateEnsembleFlat(
+    double start,
+    double stop,
+    double step,
+    int num_replicates,
+    double feedback_tolerance,
+    int num_threads
+) {
+
+    // Build the session once; repeat calls reuse stoichiometry,
+    // compiled formulas and AMICI objects
+    this->ensureSessionLoaded();
+
+    // the exchange interval, when set, defines the stepping grid
+    step = this->gridStep(step);
+
+    this->setGlobalSimulationSettings(start, stop, step);
+
+    const std::vector<double>& timeSteps =
+        *BaseModule::sharedTimeSteps(start, stop, step);
+
+    size_t num_steps = timeSteps.size();
+    size_t num_modules = this->modules.size();
+
+    // the ODE side is replayed read-only; everything else steps per replicate
+    std::vector<bool> is_deterministic(num_modules, false);
+
+    for (size_t m = 0; m < num_modules; m++) {
+
+        const std::string id = this->modules[m]->getModuleId();
+
+        is_deterministic[m] = (id == "Deterministic" || id == "Hybrid");
+    }
+
+    // reference pass: a normal stepwise run that also keeps every module's
+    // full per-step state, indexed [module][step]
+    std::vector<std::vector<std::vector<double>>> reference_states(num_modules);
+
+    for (auto& trajectory : reference_states) {
+        trajectory.resize(num_steps);
+    }
+
+    for (int t = 1; t < static_cast<int>(num_steps); t++) {
+
+        this->stepGlobal(t);
+
+        this->updateGlobalParameters();
+
+        for (size_t m = 0; m < num_modules; m++) {
+            reference_states[m][t] = this->modules[m]->current_state;
+        }
+    }
+
+    // stepping writes engines only; mirror the reference run's final
+    // values into the documents once, as runGlobal does
+    for (const auto& mod : this->modules) {
+        mod->syncExchangedParameters();
+        mod->syncStateToDocument();
+    }
+
+    // slab geometry is identical across replicates, so the stacked buffer
+    // can be preallocated and written lock-free by the workers
+    size_t recorded_steps =
+        (num_steps + this->record_interval - 1) / this->record_interval;
+
+    // a rolling window retains only its trailing rows
+    if (this->results_window > 0 &&
+        recorded_steps > static_cast<size_t>(this->results_window)) {
+
+        recorded_steps = static_cast<size_t>(this->results_window);
+    }
+
+    size_t total_stride = 0;
+
+    for (const auto& mod : this->modules) {
+        total_stride += mod->results_stride;
+    }
+
+    // workers commit finished slabs concurrently; the slab stride is
+    // padded out to whole cache lines plus a full line of gap so no
+    // line ever holds bytes of two workers' regions, and the padding
+    // folds out after the pool joins
+    const size_t line_doubles = 64 / sizeof(double);
+
+    size_t slab_doubles = recorded_steps * total_stride;
+
+    size_t slab_stride = num_replicates > 2
+        ? ((slab_doubles + line_doubles - 1) / line_doubles + 1) * line_doubles
+        : slab_doubles;
+
+    std::vector<double> ensemble_results(
+        static_cast<size_t>(num_replicates) * slab_stride
+    );
+
+    // replicate 0 is the reference run itself
+    size_t offset = 0;
+
+    for (size_t t = 0; t < recorded_steps; t++) {
+
+        for (const auto& mod : this->modules) {
+
+            const double* row = mod->getResultsRow(t);
+
+            std::copy(row, row + mod->results_stride,
+                      ensemble_results.begin() + offset);
+
+            offset += mod->results_stride;
+        }
+    }
+
+    // the reference pass is this session's only stepping; fold out any
+    // cache-line padding now that its rows are copied
+    this->compactGlobalResults();
+
+    // thread width comes from the process-wide scheduler; the parameter
+    // remains for callers that tuned it
+    (void)num_threads;
+
+    std::atomic<int> forked_replicates{0};
+
+    // One task per non-reference replicate on the process-wide scheduler;
+    // stealing rebalances forked replicates, which cost far more than
+    // ones riding the shared reference trajectory
+    TaskScheduler::instance().parallelFor(
+        num_replicates - 1,
+        [&](int task_index) {
+
+            int replicate = task_index + 1;
+
+            SingleCell cell(this->model_paths);
+
+            cell.setRecording(this->record_interval, this->record_species);
+
+            cell.record_mantissa_bits = this->record_mantissa_bits;
+
+        cell.results_window = this->results_window;
+
+            cell.setStepIntervals(
+                this->leap_seconds, this->exchange_seconds, this->record_seconds
+            );
+
+            cell.solver_profile = this->solver_profile;
+
+            if (this->rng_seed.has_value()) {
+
+                // Per-replicate substream keeps runs independent & replayable
+                cell.setSeed(this->rng_seed.value() + replicate);
+            }
+
+            cell.loadSimulationModules();
+            cell.assignGlobalTargets();
+            cell.findModuleOverlaps();
+
+            cell.setGlobalSimulationSettings(start, stop, step);
+
+            bool forked = false;
+
+            for (int t = 1; t < static_cast<int>(num_steps); t++) {
+
+                if (!forked) {
+
+                    // frozen ODE side: publish the shared reference state
+                    // and record its row without touching the solver
+                    for (size_t m = 0; m < num_modules; m++) {
+
+                        if (!is_deterministic[m]) {
+                            continue;
+                        }
+
+                        BaseModule* mod = cell.modules[m].get();
+
+                        mod->current_state = reference_states[m][t];
+                        mod->syncStateToDocument();
+                        mod->backfillResults(t, t + 1);
+                        mod->publishExchanges();
+                    }
+
+                    for (size_t m = 0; m < num_modules; m++) {
+
+                        if (!is_deterministic[m]) {
+                            stepModuleDirect(cell.modules[m].get(), t);
+                        }
+                    }
+
+                } else {
+
+                    cell.stepGlobal(t);
+                }
+
+                cell.updateGlobalParameters();
+
+                if (!forked) {
+
+                    // feedback monitor: once this replicate's stochastic
+                    // state leaves the reference envelope, its deterministic
+                    // side forks and solves for real from here on
+                    double max_deviation = 0.0;
+
+                    for (size_t m = 0; m < num_modules; m++) {
+
+                        if (is_deterministic[m]) {
+                            continue;
+                        }
+
+                        const std::vector<double>& state =
+                            cell.modules[m]->current_state;
+
+                        const std::vector<double>& reference =
+                            reference_states[m][t];
+
+                        for (size_t s = 0; s < state.size(); s++) {
+
+                            double deviation =
+                                std::abs(state[s] - reference[s]) /
+                                std::max(std::abs(reference[s]), 1.0);
+
+                            max_deviation = std::max(max_deviation, deviation);
+                        }
+                    }
+
+                    if (max_deviation > feedback_tolerance) {
+
+                        forked = true;
+                        forked_replicates.fetch_add(1);
+                    }
+                }
+            }
+
+            // copy this replicate's combined rows into its slab
+            size_t slab_offset =
+                static_cast<size_t>(replicate) * slab_stride;
+
+            for (size_t t = 0; t < recorded_steps; t++) {
+
+                for (const auto& mod : cell.modules) {
+
+                    const double* row = mod->getResultsRow(t);
+
+                    std::copy(row, row + mod->results_stride,
+                              ensemble_results.begin() + slab_offset);
+
+                    slab_offset += mod->results_stride;
+                }
+            }
+        }
+    );
+
+    // forward in-place fold back to the dense stacked layout
+    if (slab_stride != slab_doubles) {
+
+        for (int replicate = 1; replicate < num_replicates; replicate++) {
+
+            std::copy(
+                ensemble_results.begin() + replicate * slab_stride,
+                ensemble_results.begin() + replicate * slab_stride + slab_doubles,
+                ensemble_results.begin() + replicate * slab_doubles
+            );
+        }
+
+        ensemble_results.resize(
+            static_cast<size_t>(num_replicates) * slab_doubles
+        );
+    }
+
+    printf("Ensemble complete: %i of %i replicates forked the deterministic trajectory.\n",
+           forked_replicates.load(), num_replicates);
+
+    this->last_num_timesteps = recorded_steps;
+    this->last_num_species = total_stride;
+
+    return ensemble_results;
+}
+
+void SingleCell::reset(
+    const std::vector<double>& initial_state
+) {
+
+    // allow reset-before-simulate on a fresh session
+    this->ensureSessionLoaded();
+
+    if (initial_state.empty()) {
+
+        // rewind every module to its construction-time initial state
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            this->modules[m]->handler.setState(this->pristine_states[m]);
+        }
+
+        return;
+    }
+
+    // split a global state vector across the modules in module order
+    size_t offset = 0;
+
+    for (const auto& mod : this->modules) {
+
+        size_t numSpecies = mod->handler.getSpeciesIds().size();
+
+        std::vector<double> module_state(
+            initial_state.begin() + offset,
+            initial_state.begin() + offset + numSpecies
+        );
+
+        mod->handler.setState(module_state);
+
+        offset += numSpecies;
+    }
+}
+
+void SingleCell::modify(
+    std::string entity_id,
+    double value
+) {
+    for ( auto& handler : this->handlers) {
+        handler.setModelEntityValue(
+            entity_id,
+            value
+            );
+    }
+
+    // compartment volumes additionally push straight into the live
+    // engines: modules resolved their symbols at load and never re-read
+    // the document mid-run, so without this the compiled rate laws and
+    // conversion factors would keep the stale volume
+    for (const auto& mod : this->modules) {
+
+        if (mod->handler.model->getCompartment(entity_id) != nullptr) {
+            mod->applyCompartmentVolume(entity_id, value);
+        }
+    }
+}
+
+void SingleCell::modifyBulk(
+    const std::unordered_map<std::string, double>& entity_values
+) {
+
+    // grouped by handler: each model's index maps stay hot while its
+    // whole override set applies, and no entity triggers a full rescan
+    std::unordered_set<std::string> resolved;
+
+    for (auto& handler : this->handlers) {
+
+        for (const auto& [entity_id, value] : entity_values) {
+
+            if (handler.trySetEntityValue(entity_id, value)) {
+                resolved.insert(entity_id);
+            }
+        }
+    }
+
+    // as in modify: volumes propagate into the live engines' compiled
+    // slots and conversion lanes, not just the document
+    for (const auto& [entity_id, value] : entity_values) {
+
+        for (const auto& mod : this->modules) {
+
+            if (mod->handler.model->getCompartment(entity_id) != nullptr) {
+                mod->applyCompartmentVolume(entity_id, value);
+            }
+        }
+    }
+
+    if (resolved.size() == entity_values.size()) {
+        return;
+    }
+
+    // unknowns surface once, collectively, and still abort the run the
+    // way a failed per-entity modify does
+    std::string unknown_ids;
+
+    for (const auto& [entity_id, value] : entity_values) {
+
+        if (resolved.count(entity_id) == 0) {
+            unknown_ids += unknown_ids.empty() ? "" : ", ";
+            unknown_ids += entity_id;
+        }
+    }
+
+    printf("Entities {%s} Not Found In Any Model\n", unknown_ids.c_str());
+
+    std::exit(EXIT_FAILURE);
+}
+
+void SingleCell::setSeed(
+    unsigned long long seed
+) {
+
+    this->rng_seed = seed;
+
+    // the seed is the first thing a replay needs; it travels in every
+    // output file's embedded metadata
+    RunMetadata::set("seed", std::to_string(seed));
+
+    // a live session reseeds immediately; fresh sessions apply the seed
+    // when their modules load
+    for (size_t m = 0; m < this->modules.size(); m++) {
+
+        this->modules[m]->setRandomSeed(seed + m);
+    }
+}
+
+void SingleCell::setObservables(
+    const std::vector<std::pair<std::string, std::string>>& observables
+) {
+
+    this->observable_names.clear();
+    this->observable_formulas.clear();
+
+    for (const auto& [name, formula] : observables) {
+        this->observable_names.push_back(name);
+        this->observable_formulas.push_back(formula);
+    }
+
+    // force recompilation against the (possibly new) session layout
+    this->observable_parsers.clear();
+}
+
+std::vector<std::string> SingleCell::getObservableNames() {
+
+    return this->observable_names;
+}
+
+void SingleCell::setObservablePruning(
+    bool enable
+) {
+
+    this->observable_pruning = enable;
+}
+
+void SingleCell::setKernelAutotune(
+    bool enable
+) {
+
+    this->kernel_autotune = enable;
+
+    RunMetadata::set("kernel_autotune", enable ? "on" : "off");
+
+    // a live session resolves its dispatch on the next configure; fresh
+    // sessions forward the flag when their modules load
+    for (const auto& mod : this->modules) {
+        mod->setKernelAutotune(enable);
+    }
+}
+
+void SingleCell::setPipelinedRecording(
+    bool enable
+) {
+
+    this->pipelined_recording = enable;
+
+    for (const auto& mod : this->modules) {
+        mod->setPipelinedRecording(enable);
+    }
+}
+
+void SingleCell::setResultsWindow(
+    int recorded_rows
+) {
+
+    this->results_window = (recorded_rows > 0) ? recorded_rows : 0;
+
+    for (const auto& mod : this->modules) {
+        mod->setResultsWindow(this->results_window);
+    }
+}
+
+size_t SingleCell::getFirstRetainedRow() const {
+
+    return this->last_window_offset;
+}
+
+void SingleCell::preload(
+    const std::vector<std::string>& sbml_paths
+) {
+
+    for (const std::string& path : sbml_paths) {
+
+        // parsing through the handler runs ModelData::acquire: the binary
+        // snapshot is written (or loaded) and the derived structure memos
+        // — stoichiometry CSR, formula tokens, interned symbols — are
+        // built, so the queued job's parse is a snapshot read
+        SBMLHandler handler(path);
+
+        const std::string id = handler.model->getId();
+
+        // stochastic module types never touch AMICI; everything else
+        // dlopens a generated model here so the job finds the shared
+        // object resolved and resident
+        if (id == "Stochastic" || id == "SSA") {
+
+            SC_LOG_INFO("preloaded " << path << " (model '" << id << "')");
+            continue;
+        }
+
+        try {
+
+            AmiciModelRegistry::create(id);
+
+            SC_LOG_INFO("preloaded " << path << " (model '" << id
+                << "', AMICI object mapped)");
+
+        } catch (const std::exception&) {
+
+            SC_LOG_WARN("preloaded " << path << " but no AMICI model '"
+                << id << "' could be mapped");
+        }
+    }
+}
+
+bool SingleCell::resolveConstantSymbol(
+    const std::string& token,
+    double& value
+) {
+
+    for (auto& handler : this->handlers) {
+
+        const Parameter* parameter = handler.model->getParameter(token);
+
+        if (parameter != nullptr) {
+            value = parameter->getValue();
+            return true;
+        }
+
+        const Compartment* compartment = handler.model->getCompartment(token);
+
+        if (compartment != nullptr) {
+            value = compartment->getVolume();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool SingleCell::classifyLinearObservable(
+    const std::string& formula,
+    const std::unordered_map<std::string, unsigned int>& column_of,
+    unsigned int row,
+    std::vector<SparseMatrix::Triplet>& triplets,
+    double& offset
+) {
+
+    // operator shapes the linear form cannot carry
+    if (formula.find_first_of("/^") != std::string::npos) {
+        return false;
+    }
+
+    // split into terms on top-level +/-, tracking sign; a paren-wrapped
+    // term is unwrapped below, deeper nesting disqualifies the formula
+    std::vector<std::pair<std::string, double>> terms;
+
+    int depth = 0;
+    size_t term_start = 0;
+    double sign = 1.0;
+
+    for (size_t i = 0; i <= formula.size(); i++) {
+
+        char c = i < formula.size() ? formula[i] : '+';
+
+        if (c == '(') {
+            depth++;
+        } else if (c == ')') {
+            depth--;
+        }
+
+        if ((c == '+' || c == '-') && depth == 0) {
+
+            std::string term = formula.substr(term_start, i - term_start);
+
+            size_t first = term.find_first_not_of(' ');
+
+            if (first != std::string::npos) {
+                terms.emplace_back(term, sign);
+            }
+
+            sign = (c == '-') ? -1.0 : 1.0;
+            term_start = i + 1;
+        }
+    }
+
+    if (depth != 0 || terms.empty()) {
+        return false;
+    }
+
+    size_t kept_triplets = triplets.size();
+    double term_offset = 0.0;
+
+    for (auto& [term, term_sign] : terms) {
+
+        // unwrap one full-width paren pair per level
+        size_t first = term.find_first_not_of(' ');
+        size_t last = term.find_last_not_of(' ');
+
+        while (first != std::string::npos && term[first] == '(' &&
+               term[last] == ')') {
+
+            // the opening paren must match the closing one, not an
+            // inner pair, for the strip to preserve meaning
+            int inner_depth = 0;
+            bool wraps = true;
+
+            for (size_t i = first; i <= last; i++) {
+
+                if (term[i] == '(') {
+                    inner_depth++;
+                } else if (term[i] == ')') {
+                    inner_depth--;
+                }
+
+                if (inner_depth == 0 && i < last) {
+                    wraps = false;
+                    break;
+                }
+            }
+
+            if (!wraps) {
+                break;
+            }
+
+            term = term.substr(first + 1, last - first - 1);
+            first = term.find_first_not_of(' ');
+            last = term.find_last_not_of(' ');
+        }
+
+        // nested structure beyond a plain product disqualifies
+        if (term.find_first_of("()") != std::string::npos) {
+            triplets.resize(kept_triplets);
+            return false;
+        }
+
+        // factors multiply into one coefficient around at most one
+        // recorded species, the matrix column
+        double coefficient = term_sign;
+        int species_column = -1;
+
+        std::stringstream factor_stream(term);
+        std::string factor;
+
+        while (std::getline(factor_stream, factor, '*')) {
+
+            size_t factor_first = factor.find_first_not_of(' ');
+
+            if (factor_first == std::string::npos) {
+                triplets.resize(kept_triplets);
+                return false;
+            }
+
+            factor = factor.substr(
+                factor_first,
+                factor.find_last_not_of(' ') - factor_first + 1
+            );
+
+            char* end = nullptr;
+            double literal = std::strtod(factor.c_str(), &end);
+
+            auto column = column_of.find(factor);
+            double constant = 0.0;
+
+            if (end == factor.c_str() + factor.size() && end != factor.c_str()) {
+                coefficient *= literal;
+
+            } else if (column != column_of.end()) {
+
+                if (species_column >= 0) {
+                    triplets.resize(kept_triplets);
+                    return false;
+                }
+
+                species_column = static_cast<int>(column->second);
+
+            } else if (this->resolveConstantSymbol(factor, constant)) {
+                coefficient *= constant;
+
+            } else {
+                triplets.resize(kept_triplets);
+                return false;
+            }
+        }
+
+        if (species_column >= 0) {
+            triplets.push_back({
+                row, static_cast<unsigned int>(species_column), coefficient
+            });
+        } else {
+            term_offset += coefficient;
+        }
+    }
+
+    offset = term_offset;
+
+    return true;
+}
+
+void SingleCell::compileObservables() {
+
+    std::vector<std::string> recorded_ids = this->getRecordedSpeciesIds();
+
+    this->observable_input.assign(recorded_ids.size(), 0.0);
+
+    this->observable_parsers.clear();
+    this->observable_parsers.resize(this->observable_formulas.size());
+
+    // observation-matrix construction: linear formulas project through
+    // a CSR row instead of a parser, folding PEtab scale/offset
+    // parameters into the coefficients once here
+    std::unordered_map<std::string, unsigned int> column_of;
+
+    for (size_t s = 0; s < recorded_ids.size(); s++) {
+        column_of[recorded_ids[s]] = static_cast<unsigned int>(s);
+    }
+
+    std::vector<SparseMatrix::Triplet> triplets;
+
+    this->observable_offsets.assign(this->observable_formulas.size(), 0.0);
+    this->observable_is_linear.assign(this->observable_formulas.size(), 0);
+
+    for (size_t o = 0; o < this->observable_formulas.size(); o++) {
+
+        if (this->classifyLinearObservable(
+                this->observable_formulas[o],
+                column_of,
+                static_cast<unsigned int>(o),
+                triplets,
+                this->observable_offsets[o])) {
+
+            // matrix rows skip parser compilation entirely
+            this->observable_is_linear[o] = 1;
+            continue;
+        }
+
+        mu::Parser& parser = this->observable_parsers[o];
+
+        try {
+
+            // bind every recorded id; unreferenced variables cost nothing
+            // at evaluation since only the bytecode's operands are read
+            for (size_t s = 0; s < recorded_ids.size(); s++) {
+                parser.DefineVar(recorded_ids[s], &this->observable_input[s]);
+            }
+
+            parser.SetExpr(this->observable_formulas[o]);
+
+            // compile the bytecode now rather than on the first row
+            parser.Eval();
+
+        } catch (mu::Parser::exception_type &e) {
+            SC_LOG_ERROR("Error while parsing observable '"
+                         << this->observable_names[o] << "': " << e.GetMsg());
+        }
+    }
+
+    this->observable_matrix = SparseMatrix::fromTriplets(
+        this->observable_formulas.size(),
+        recorded_ids.size(),
+        std::move(triplets)
+    );
+}
+
+void SingleCell::addThresholdProbe(
+    const std::string& name,
+    const std::string& species_id,
+    double threshold,
+    bool rising
+) {
+
+    EventProbe probe;
+
+    probe.name = name;
+    probe.kind = EventProbe::Threshold;
+    probe.target = species_id;
+    probe.threshold = threshold;
+    probe.rising = rising;
+
+    this->event_probes.push_back(std::move(probe));
+}
+
+void SingleCell::addPeakProbe(
+    const std::string& name,
+    const std::string& species_id
+) {
+
+    EventProbe probe;
+
+    probe.name = name;
+    probe.kind = EventProbe::Peak;
+    probe.target = species_id;
+
+    this->event_probes.push_back(std::move(probe));
+}
+
+void SingleCell::addPredicateProbe(
+    const std::string& name,
+    const std::string& expression
+) {
+
+    EventProbe probe;
+
+    probe.name = name;
+    probe.kind = EventProbe::Predicate;
+    probe.target = expression;
+
+    this->event_probes.push_back(std::move(probe));
+}
+
+void SingleCell::clearEventProbes() {
+
+    this->event_probes.clear();
+}
+
+std::vector<SingleCell::EventRecord> SingleCell::getEventTable() const {
+
+    std::vector<EventRecord> table;
+
+    table.reserve(this->event_probes.size());
+
+    for (const EventProbe& probe : this->event_probes) {
+
+        // never-fired probes report NaN times, so downstream
+        // distributions can drop or censor them explicitly
+        bool has_event = probe.fired ||
+            (probe.kind == EventProbe::Peak && probe.seeded);
+
+        table.push_back({
+            probe.name,
+            has_event ? probe.event_time
+                      : std::numeric_limits<double>::quiet_NaN(),
+            has_event ? probe.event_value
+                      : std::numeric_limits<double>::quiet_NaN()
+        });
+    }
+
+    return table;
+}
+
+void SingleCell::compileEventProbes() {
+
+    if (this->event_probes.empty()) {
+        return;
+    }
+
+    // an extension carries probe state forward: fired events, running
+    // peaks and crossing seeds all survive across the appended window
+    if (this->extending_run && !this->event_probe_input.empty()) {
+        return;
+    }
+
+    const std::vector<std::string>& global_ids = this->getGlobalSpeciesIds();
+
+    // bound before DefineVar so the parser's slot pointers never move
+    this->event_probe_input.assign(global_ids.size(), 0.0);
+
+    for (EventProbe& probe : this->event_probes) {
+
+        probe.fired = false;
+        probe.seeded = false;
+        probe.event_time = 0.0;
+        probe.event_value = 0.0;
+
+        if (probe.kind == EventProbe::Predicate) {
+
+            probe.parser = mu::Parser();
+
+            try {
+
+                for (size_t s = 0; s < global_ids.size(); s++) {
+                    probe.parser.DefineVar(
+                        global_ids[s], &this->event_probe_input[s]
+                    );
+                }
+
+                probe.parser.SetExpr(probe.target);
+
+                // compile the bytecode now rather than on the first step
+                probe.parser.Eval();
+
+            } catch (mu::Parser::exception_type& e) {
+                SC_LOG_ERROR("Error while parsing event probe '"
+                             << probe.name << "': " << e.GetMsg());
+            }
+
+            continue;
+        }
+
+        probe.module_index = -1;
+        probe.species_offset = -1;
+
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            const auto& species_index =
+                this->modules[m]->model_data->species_index;
+
+            auto species = species_index.find(probe.target);
+
+            if (species != species_index.end()) {
+                probe.module_index = static_cast<int>(m);
+                probe.species_offset = species->second;
+                break;
+            }
+        }
+
+        if (probe.module_index < 0) {
+            SC_LOG_WARN("Event probe '" << probe.name
+                        << "' watches unknown species '" << probe.target
+                        << "'; it will never fire.");
+        }
+    }
+
+    // the initial state, when already recorded, seeds crossing
+    // detection so a crossing inside the very first step is seen
+    bool have_initial = true;
+
+    for (const auto& mod : this->modules) {
+        have_initial = have_initial && !mod->current_state.empty();
+    }
+
+    if (have_initial) {
+        this->evaluateEventProbes(0.0);
+    }
+}
+
+void SingleCell::evaluateEventProbes(
+    double t
+) {
+
+    // one gather per step feeds every predicate probe
+    bool have_predicates = false;
+
+    for (const EventProbe& probe : this->event_probes) {
+        have_predicates = have_predicates ||
+            probe.kind == EventProbe::Predicate;
+    }
+
+    if (have_predicates) {
+
+        size_t offset = 0;
+
+        for (const auto& mod : this->modules) {
+
+            std::copy(
+                mod->current_state.begin(),
+                mod->current_state.end(),
+                this->event_probe_input.begin() + offset
+            );
+
+            offset += mod->current_state.size();
+        }
+    }
+
+    for (EventProbe& probe : this->event_probes) {
+
+        if (probe.kind == EventProbe::Predicate) {
+
+            if (probe.fired) {
+                continue;
+            }
+
+            double value = probe.parser.Eval();
+
+            if (value != 0.0) {
+                probe.fired = true;
+                probe.event_time = t;
+                probe.event_value = value;
+            }
+
+            continue;
+        }
+
+        if (probe.module_index < 0) {
+            continue;
+        }
+
+        double value = this->modules[probe.module_index]
+            ->current_state[probe.species_offset];
+
+        if (probe.kind == EventProbe::Peak) {
+
+            if (!probe.seeded || value > probe.event_value) {
+                probe.event_value = value;
+                probe.event_time = t;
+            }
+
+            probe.seeded = true;
+            continue;
+        }
+
+        // threshold: fire on the first directed crossing; the first
+        // evaluation only seeds the comparison value
+        if (!probe.fired && probe.seeded) {
+
+            bool crossed = probe.rising
+                ? probe.previous_value < probe.threshold &&
+                  value >= probe.threshold
+                : probe.previous_value > probe.threshold &&
+                  value <= probe.threshold;
+
+            if (crossed) {
+                probe.fired = true;
+                probe.event_time = t;
+                probe.event_value = value;
+            }
+        }
+
+        probe.previous_value = value;
+        probe.seeded = true;
+    }
+}
+
+std::vector<double> SingleCell::simulateObservablesFlat(
+    double start,
+    double stop,
+    double step
+) {
+
+    // the full trajectory still exists in the module results buffers; only
+    // the projected observables are assembled and returned
+    std::vector<double> flat_results = this->simulateFlat(start, stop, step);
+
+    std::vector<double> observables_matrix = this->projectObservables(
+        flat_results, this->last_num_species
+    );
+
+    this->last_num_species = this->observable_formulas.size();
+
+    return observables_matrix;
+}
+
+std::vector<double> SingleCell::projectObservables(
+    const std::vector<double>& flat_results,
+    size_t stride
+) {
+
+    size_t num_observables = this->observable_formulas.size();
+    size_t recorded_steps = stride > 0 ? flat_results.size() / stride : 0;
+
+    if (this->observable_parsers.size() != num_observables) {
+        this->compileObservables();
+    }
+
+    std::vector<double> observables_matrix;
+    observables_matrix.reserve(recorded_steps * num_observables);
+
+    // the bound-input copy only pays off when some observable still
+    // evaluates through its parser; all-linear sessions skip it
+    bool any_parser = false;
+
+    for (size_t o = 0; o < num_observables; o++) {
+        if (!this->observable_is_linear[o]) {
+            any_parser = true;
+        }
+    }
+
+    for (size_t t = 0; t < recorded_steps; t++) {
+
+        const double* row = flat_results.data() + t * stride;
+
+        if (any_parser) {
+
+            // project one recorded row: copy into the bound input, then
+            // evaluate each compiled expression
+            std::copy(row, row + stride, this->observable_input.begin());
+        }
+
+        for (size_t o = 0; o < num_observables; o++) {
+
+            // linear observables run the dgemv-like CSR row kernel:
+            // gather-multiply over the row's entries plus its offset
+            if (this->observable_is_linear[o]) {
+
+                double value = this->observable_offsets[o];
+
+                for (size_t e = this->observable_matrix.row_ptr[o];
+                     e < this->observable_matrix.row_ptr[o + 1]; e++) {
+
+                    value += this->observable_matrix.values[e]
+                        * row[this->observable_matrix.col_idx[e]];
+                }
+
+                observables_matrix.push_back(value);
+                continue;
+            }
+
+            try {
+                observables_matrix.push_back(this->observable_parsers[o].Eval());
+            } catch (mu::Parser::exception_type &e) {
+                SC_LOG_ERROR("Error while evaluating observable: "
+                             << e.GetMsg());
+                observables_matrix.push_back(
+                    std::numeric_limits<double>::quiet_NaN()
+                );
+            }
+        }
+    }
+
+    return observables_matrix;
+}
+
+void SingleCell::setSensitivityParameters(
+    const std::vector<std::string>& parameter_ids
+) {
+
+    this->sensitivity_parameter_ids = parameter_ids;
+
+    // live sessions arm immediately; fresh sessions arm at module load
+    for (const auto& mod : this->modules) {
+        mod->setSensitivityParameters(parameter_ids);
+    }
+}
+
+void SingleCell::bindParameters(
+    const std::vector<std::string>& parameter_ids
+) {
+
+    this->override_parameter_ids = parameter_ids;
+
+    // the fast path needs live engines to write into; building here lets
+    // an optimizer bind, then loop setParameters + simulate immediately
+    if (this->modules.empty()) {
+
+        this->ensureSessionLoaded();
+
+    } else {
+
+        for (const auto& mod : this->modules) {
+            mod->bindParameterOverrides(parameter_ids);
+        }
+    }
+}
+
+void SingleCell::setParameters(
+    const std::vector<double>& values
+) {
+
+    for (const auto& mod : this->modules) {
+        mod->applyParameterOverrides(values);
+    }
+}
+
+const std::vector<double>& SingleCell::getSensitivities() {
+
+    for (const auto& mod : this->modules) {
+
+        if (!mod->sensitivities.empty()) {
+
+            this->last_num_sensitivity_parameters =
+                mod->num_sensitivity_parameters;
+            this->last_num_sensitivity_states = mod->num_sensitivity_states;
+
+            return mod->sensitivities;
+        }
+    }
+
+    static const std::vector<double> empty;
+    return empty;
+}
+
+void SingleCell::setSolverProfile(
+    const std::string& name
+) {
+
+    this->solver_profile = SolverProfile::named(name);
+
+    // live sessions pick the profile up on their next settings pass
+    for (const auto& mod : this->modules) {
+        mod->solver_profile = this->solver_profile;
+    }
+
+    // record the active profile beside the timings, so a report is
+    // always attributable to the settings that produced it
+    this->perf.setMetadata("solver_profile", this->solver_profile.name);
+
+    RunMetadata::set("solver_profile", this->solver_profile.name);
+}
+
+void SingleCell::setSteadyStateTolerance(
+    double tolerance,
+    int window
+) {
+
+    this->steady_state_tolerance = tolerance;
+    this->steady_state_window = std::max(window, 1);
+}
+
+void SingleCell::setExchangeTolerance(
+    double tolerance
+) {
+
+    this->exchange_tolerance = tolerance;
+
+    // live sessions pick the tolerance up immediately
+    for (const auto& mod : this->modules) {
+        mod->exchange_tolerance = tolerance;
+    }
+}
+
+void SingleCell::setExchangeView(
+    const std::string& name,
+    const std::vector<std::string>& entity_ids
+) {
+
+    this->exchange_view_name = name;
+    this->exchange_view_ids = entity_ids;
+
+    // a view set before the first simulate applies during overlap
+    // resolution; modules loaded later pick it up at construction
+    for (const auto& mod : this->modules) {
+        mod->exchange_view = entity_ids;
+    }
+}
+
+void SingleCell::setMacroStepping(
+    int micro_steps
+) {
+
+    this->macro_interval = std::max(micro_steps, 1);
+
+    // live sessions pick the interval up on their next settings pass
+    for (const auto& mod : this->modules) {
+        mod->setMacroInterval(this->macro_interval);
+    }
+}
+
+void SingleCell::setSpeculativeStepping(
+    double tolerance
+) {
+
+    this->speculation_tolerance = std::max(tolerance, 0.0);
+
+    for (const auto& mod : this->modules) {
+        mod->setSpeculativeStepping(this->speculation_tolerance);
+    }
+}
+
+void SingleCell::setConservationElimination(
+    bool enable
+) {
+
+    this->conservation_elimination = enable;
+
+    for (const auto& mod : this->modules) {
+        mod->setConservationElimination(enable);
+    }
+}
+
+void SingleCell::setStepIntervals(
+    double leap_seconds,
+    double exchange_seconds,
+    double record_seconds
+) {
+
+    this->leap_seconds = std::max(leap_seconds, 0.0);
+    this->exchange_seconds = std::max(exchange_seconds, 0.0);
+    this->record_seconds = std::max(record_seconds, 0.0);
+
+    // recording thins to whole steps of the exchange grid
+    if (this->exchange_seconds > 0.0 && this->record_seconds > 0.0) {
+
+        this->record_interval = std::max(
+            1,
+            static_cast<int>(std::llround(
+                this->record_seconds / this->exchange_seconds
+            ))
+        );
+    }
+
+    for (const auto& mod : this->modules) {
+        mod->setLeapInterval(this->leap_seconds);
+    }
+}
+
+double SingleCell::gridStep(
+    double step
+) const {
+    return this->exchange_seconds > 0.0 ? this->exchange_seconds : step;
+}
+
+void SingleCell::loadSimulationModules() {
+
+    // module construction is where AMICI models dlopen and muParser
+    // formulas compile; timing it separates setup cost from solve cost
+    // in the perf report
+    PerfMonitor::ScopedTimer timer(&this->perf, "startup_module_construction");
+
+    // fresh modules carry the full reaction set again
+    this->observable_pruning_applied = false;
+
+    for (const SBMLHandler& handler : handlers) {
+
+        const std::string id = handler.model->getId();
+
+        auto matched_module = this->moduleFactory.find(id);
+
+        if (matched_module != moduleFactory.end()) {
+
+            // Call the factory function with the SBMLHandler
+            std::unique_ptr<BaseModule> base_mod = matched_module->second(handler);
+
+            // if module is empty; there's no need to add overhead:
+            if (!base_mod->handler.getSpeciesIds().empty()) {
+
+                // Move the pointer into the list of modules
+                this->modules.push_back(std::move(base_mod));
+
+            }
+        } else {
+            // Fallback if no match
+            std::unique_ptr<BaseModule> base_mod = std::make_unique<DeterministicModule>(handler);
+            this->modules.push_back(std::move(base_mod));
+        }
+    }
+
+    if (this->rng_seed.has_value()) {
+
+        // Offset substreams keep the modules independent but replayable
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            this->modules[m]->setRandomSeed(this->rng_seed.value() + m);
+        }
+    }
+
+    for (const auto& mod : this->modules) {
+
+        mod->perf = &this->perf;
+
+        mod->exchange_tolerance = this->exchange_tolerance;
+
+        mod->exchange_view = this->exchange_view_ids;
+
+        mod->solver_profile = this->solver_profile;
+
+        if (!this->entity_profile_output.empty()) {
+            mod->setEntityProfiling(true);
+        }
+
+        if (this->macro_interval > 1) {
+            mod->setMacroInterval(this->macro_interval);
+        }
+
+        if (this->speculation_tolerance > 0.0) {
+            mod->setSpeculativeStepping(this->speculation_tolerance);
+        }
+
+        if (this->conservation_elimination) {
+            mod->setConservationElimination(true);
+        }
+
+        if (this->leap_seconds > 0.0) {
+            mod->setLeapInterval(this->leap_seconds);
+        }
+
+        if (this->record_mantissa_bits > 0) {
+            mod->setRecordingPrecisionBits(this->record_mantissa_bits);
+        }
+
+        if (this->summary_window_steps > 0) {
+            mod->setSummaryRecording(this->summary_window_steps);
+        }
+
+        if (this->kernel_autotune) {
+            mod->setKernelAutotune(true);
+        }
+
+        if (this->pipelined_recording) {
+            mod->setPipelinedRecording(true);
+        }
+
+        if (!this->sensitivity_parameter_ids.empty()) {
+            mod->setSensitivityParameters(this->sensitivity_parameter_ids);
+        }
+
+        if (!this->override_parameter_ids.empty()) {
+            mod->bindParameterOverrides(this->override_parameter_ids);
+        }
+
+        // snapshot construction-time initial states so reset() can rewind
+        // a reused session without reloading the SBML documents
+        this->pristine_states.push_back(mod->handler.getInitialState());
+
+        // the content hash pins output provenance to the exact model
+        // revision, the same key the snapshot and tuning caches use
+        if (mod->model_data && mod->model_data->source_hash != 0) {
+            RunMetadata::set(
+                "model." + mod->getModuleId(),
+                std::to_string(mod->model_data->source_hash)
+            );
+        }
+    }
+}
+
+void SingleCell::applyObservablePruning() {
+
+    if (!this->observable_pruning || this->observable_pruning_applied) {
+        return;
+    }
+
+    if (this->observable_formulas.empty() || this->modules.empty()) {
+        return;
+    }
+
+    // the observable expressions are plain muParser strings; an
+    // identifier scan recovers every species they can read
+    std::unordered_set<std::string> tokens;
+
+    for (const std::string& formula : this->observable_formulas) {
+
+        size_t i = 0;
+
+        while (i < formula.size()) {
+
+            char c = formula[i];
+
+            if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+
+                size_t start = i;
+
+                while (i < formula.size()
+                        && (std::isalnum(static_cast<unsigned char>(formula[i]))
+                            || formula[i] == '_')) {
+                    i++;
+                }
+
+                tokens.insert(formula.substr(start, i - start));
+
+            } else {
+                i++;
+            }
+        }
+    }
+
+    std::vector<std::string> observable_species;
+
+    for (const auto& mod : this->modules) {
+
+        const std::shared_ptr<const ModelData>& md = mod->model_data;
+
+        // roots of the backward walk: species the observables read plus
+        // species this module exports to another — pruning must never
+        // sever the exchange coupling
+        std::vector<char> species_needed(md->species_ids.size(), 0);
+        std::vector<int> worklist;
+
+        for (size_t s = 0; s < md->species_ids.size(); s++) {
+
+            if (tokens.count(md->species_ids[s])) {
+
+                species_needed[s] = 1;
+                worklist.push_back(static_cast<int>(s));
+
+                observable_species.push_back(md->species_ids[s]);
+            }
+        }
+
+        for (const auto& slot : mod->exchange_slots_out) {
+
+            if (!species_needed[slot.first]) {
+
+                species_needed[slot.first] = 1;
+                worklist.push_back(slot.first);
+            }
+        }
+
+        // deterministic modules carry no reaction network to prune; the
+        // AMICI model integrates every state regardless, so their saving
+        // is the narrowed recording below
+        if (md->stoich_rows.num_rows == 0) {
+            continue;
+        }
+
+        size_t num_reactions = md->stoich_cols.num_rows;
+        std::vector<char> reaction_needed(num_reactions, 0);
+
+        // backward closure: a needed species needs every reaction that
+        // changes it, and each such reaction needs every species its
+        // rate law reads
+        while (!worklist.empty()) {
+
+            int s = worklist.back();
+            worklist.pop_back();
+
+            for (size_t e = md->stoich_rows.row_ptr[s];
+                    e < md->stoich_rows.row_ptr[s + 1]; e++) {
+
+                unsigned int r = md->stoich_rows.col_idx[e];
+
+                if (reaction_needed[r]) {
+                    continue;
+                }
+
+                reaction_needed[r] = 1;
+
+                for (const std::string& tok : md->formula_tokens[r]) {
+
+                    auto it = md->species_index.find(tok);
+
+                    if (it != md->species_index.end()
+                            && !species_needed[it->second]) {
+
+                        species_needed[it->second] = 1;
+                        worklist.push_back(it->second);
+                    }
+                }
+            }
+        }
+
+        size_t kept = 0;
+
+        for (char k : reaction_needed) {
+            kept += (k != 0);
+        }
+
+        SC_LOG_INFO("observable pruning keeps " << kept << " of "
+            << num_reactions << " reactions in module "
+            << mod->handler.model->getId());
+
+        mod->setReactionPruning(reaction_needed);
+    }
+
+    // with no explicit recording subset, narrow recording to the
+    // species the observables actually read; an explicit subset wins
+    if (this->record_species.empty()) {
+        this->record_species = observable_species;
+    }
+
+    this->observable_pruning_applied = true;
+}
+
+void SingleCell::assignGlobalTargets() {
+
+    for (const auto& mod : this->modules) {
+
+        mod->loadTargetModule(this->modules);
+
+    }
+}
+
+void SingleCell::findModuleOverlaps() {
+
+    PerfMonitor::ScopedTimer timer(&this->perf, "startup_overlap_resolution");
+
+    for (const auto& mod : this->modules) {
+
+        for (const auto& target : mod->targets) {
+
+            mod->findOverlappingIds(target->sbml);
+
+        }
+    }
+
+    // wire one lock-free SPSC slot per discovered pair: the producing
+    // module stores its species value after stepping, the consumer loads
+    // it during the exchange without touching the producer's libSBML doc
+    for (const auto& mod : this->modules) {
+
+        for (size_t p = 0; p < mod->exchange_pairs.size(); p++) {
+
+            // producers are matched on interned symbols: a linear scan
+            // of 32-bit handles rather than string hashing, and no ID
+            // copies
+            uint32_t symbol = mod->overlapping_symbols[p];
+
+            BaseModule* producer = nullptr;
+            int species_idx = -1;
+
+            for (const auto& other : this->modules) {
+
+                if (other.get() == mod.get()) {
+                    continue;
+                }
+
+                const std::vector<uint32_t>& candidates =
+                    other->model_data->species_symbols;
+
+                for (size_t s = 0; s < candidates.size(); s++) {
+
+                    if (candidates[s] == symbol) {
+                        producer = other.get();
+                        species_idx = static_cast<int>(s);
+                        break;
+                    }
+                }
+
+                if (producer != nullptr) {
+                    break;
+                }
+            }
+
+            if (producer == nullptr) {
+
+                mod->exchange_slots_in.push_back(nullptr);
+                continue;
+            }
+
+            this->exchange_slots.push_back(
+                std::make_unique<std::atomic<double>>(
+                    mod->exchange_pairs[p].source->getInitialConcentration()
+                )
+            );
+
+            std::atomic<double>* slot = this->exchange_slots.back().get();
+
+            mod->exchange_slots_in.push_back(slot);
+            producer->exchange_slots_out.push_back({ species_idx, slot });
+        }
+    }
+
+    // account the exchange wiring: one atomic slot plus the per-pair
+    // bookkeeping each module carries around it
+    size_t exchange_bytes =
+        this->exchange_slots.size() * sizeof(std::atomic<double>);
+
+    for (const auto& mod : this->modules) {
+        exchange_bytes += mod->exchange_pairs.size()
+            * (sizeof(void*) + 2 * sizeof(double));
+    }
+
+    this->perf.addBytes("exchange_bytes", exchange_bytes);
+}
+
+void SingleCell::setGlobalSimulationSettings(
+    double start,
+    double stop,
+    double step
+) {
+    // pruning may narrow record_species, so it has to run before the
+    // recording options fix each module's row width
+    this->applyObservablePruning();
+
+    // pass 1: recording options fix each module's row width, so the
+    // global matrix can be laid out before any module allocates
+    for (const auto& mod : this->modules) {
+        mod->setRecordingOptions(this->record_interval, this->record_species);
+        mod->setResultsWindow(this->results_window);
+    }
+
+    size_t recorded_steps =
+        (BaseModule::sharedTimeSteps(start, stop, step)->size()
+            + this->record_interval - 1) / this->record_interval;
+
+    // rolling-window mode holds only the trailing window in memory, so
+    // the grid length stops driving the allocation below
+    this->last_window_offset = 0;
+
+    if (this->results_window > 0 &&
+        recorded_steps > static_cast<size_t>(this->results_window)) {
+
+        this->last_window_offset =
+            recorded_steps - static_cast<size_t>(this->results_window);
+
+        recorded_steps = static_cast<size_t>(this->results_window);
+    }
+
+    // preflight: compare the projected run memory against the budget
+    // before anything is allocated, instead of discovering the OOM
+    // mid-run. Over budget either spills to the configured backing
+    // store or refuses the run outright
+    if (this->memory_budget_bytes > 0 && this->results_backing_path.empty()) {
+
+        size_t projected = this->estimateRunMemory(start, stop, step);
+
+        if (projected > this->memory_budget_bytes) {
+
+            if (!this->memory_spill_path.empty()) {
+
+                SC_LOG_WARN("projected run memory (" << projected
+                    << " bytes) exceeds the budget ("
+                    << this->memory_budget_bytes
+                    << " bytes); spilling results to backing store "
+                    << this->memory_spill_path);
+
+                this->setResultsBackingStore(this->memory_spill_path);
+
+            } else {
+
+                throw std::runtime_error(
+                    "projected run memory ("
+                    + std::to_string(projected)
+                    + " bytes) exceeds the configured budget ("
+                    + std::to_string(this->memory_budget_bytes)
+                    + " bytes); coarsen recording, raise the budget or "
+                    + "configure a spill path"
+                );
+            }
+        }
+    }
+
+    if (this->results_backing_path.empty()) {
+
+        // one preallocated matrix; each module records into its own
+        // column block as the run advances, so combining results at the
+        // end is a view rather than a copy.
+        //
+        // Parallel stepping makes the blocks of one row concurrent write
+        // regions, so each block is padded out to whole cache lines plus
+        // a full line of gap: no line ever holds bytes of two stepping
+        // threads, whatever the allocation's base alignment. Rows stay
+        // plain stores — the per-step join publishes them, not atomics —
+        // and compactGlobalResults folds the padding back out once the
+        // threads are done, before any reader sees the matrix
+        const size_t line_doubles = 64 / sizeof(double);
+
+        bool padded = this->parallel_stepping && this->modules.size() > 1;
+
+        size_t total_stride = 0;
+
+        this->global_block_offsets.clear();
+
+        for (const auto& mod : this->modules) {
+
+            size_t stride = this->record_species.empty()
+                ? mod->handler.getSpeciesIds().size()
+                : mod->getRecordedSpeciesIds().size();
+
+            this->global_block_offsets.push_back(total_stride);
+
+            total_stride += padded
+                ? ((stride + line_doubles - 1) / line_doubles + 1) * line_doubles
+                : stride;
+        }
+
+        this->global_results.assign(recorded_steps * total_stride, 0.0);
+
+        this->perf.addBytes(
+            "global_results_bytes",
+            recorded_steps * total_stride * sizeof(double)
+        );
+
+        this->global_row_stride = total_stride;
+
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            this->modules[m]->bindExternalResults(
+                this->global_results.data() + this->global_block_offsets[m],
+                static_cast<int>(total_stride)
+            );
+        }
+
+    } else {
+
+        this->global_results.clear();
+
+        this->global_row_stride = 0;
+
+        for (const auto& mod : this->modules) {
+
+            // backing-store mode keeps per-module storage: the mapping
+            // happens inside createResultsMatrix
+            mod->external_results = false;
+            mod->mmap_backing_path = this->results_backing_path
+                + "." + mod->getModuleId() + ".resmap";
+        }
+    }
+
+    for (const auto& mod : this->modules) {
+
+        mod->setSimulationSettings(
+            start,
+            stop,
+            step
+        );
+
+        if (!this->stream_output.empty()) {
+
+            std::vector<std::string> recorded_ids =
+                mod->getRecordedSpeciesIds();
+
+            // per-column schedule from the declared per-species
+            // intervals; species not listed keep the full row rate, and
+            // an empty schedule leaves the uniform formats untouched
+            std::vector<uint32_t> col_intervals;
+
+            if (!this->stream_interval_ids.empty()) {
+
+                col_intervals.assign(recorded_ids.size(), 1);
+
+                size_t declared = std::min(
+                    this->stream_interval_ids.size(),
+                    this->stream_interval_values.size()
+                );
+
+                for (size_t i = 0; i < declared; i++) {
+
+                    auto position = std::find(
+                        recorded_ids.begin(), recorded_ids.end(),
+                        this->stream_interval_ids[i]
+                    );
+
+                    if (position != recorded_ids.end()) {
+                        col_intervals[
+                            std::distance(recorded_ids.begin(), position)
+                        ] = static_cast<uint32_t>(
+                            std::max(this->stream_interval_values[i], 1)
+                        );
+                    }
+                }
+            }
+
+            // one streamed file per module; the writer finalizes (patches
+            // its header and joins the I/O thread) when the module is torn
+            // down at the end of simulate
+            mod->stream_writer = std::make_shared<AsyncResultsWriter>(
+                this->stream_output + "." + mod->getModuleId() + ".bin",
+                mod->results_stride,
+                std::move(recorded_ids),
+                this->stream_compress,
+                std::move(col_intervals)
+            );
+        }
+    }
+
+    // remember the grid so extend can append to it later
+    this->last_sim_start = start;
+    this->last_sim_stop = stop;
+    this->last_sim_step = step;
+
+    // publish the run geometry here so the query API works after any
+    // entry point, not only simulateFlat
+    this->last_num_timesteps = recorded_steps;
+    this->last_num_species = 0;
+
+    for (const auto& mod : this->modules) {
+        this->last_num_species += mod->results_stride;
+    }
+}
+
+void SingleCell::runGlobal(
+    const std::vector<double>& timesteps,
+    int first_step
+) {
+    auto start_t = std::chrono::high_resolution_clock::now();
+    printf("Running Simulation for %lu steps.", timesteps.size());
+    printf("\n");
+
+    // the single-module fast path has no step hook for checkpointing or
+    // resumption, so those runs take the stepwise loop below
+    bool stepwise = this->modules.size() > 1
+        || this->checkpoint_interval > 0
+        || this->steady_state_tolerance > 0.0
+        || !this->event_probes.empty()
+        || first_step > 1;
+
+    this->compileEventProbes();
+
+    if (!stepwise) {
+        for (const auto& mod : this->modules) {
+
+            SC_LOG_INFO("Simulating fully " << mod->getModuleId());
+
+            mod->run(timesteps);
+
+        }
+
+    } else {
+
+        // background sampler: the loop below only bumps its atomic counter
+        std::unique_ptr<ProgressReporter> reporter;
+
+        if (this->progress_seconds > 0.0) {
+            reporter = std::make_unique<ProgressReporter>(
+                timesteps.size(),
+                this->progress_seconds,
+                this->progress_status_path
+            );
+        }
+
+        // consecutive steps below the steady-state tolerance so far
+        int quiescent_steps = 0;
+
+        std::vector<std::vector<double>> previous_states;
+
+        // Main iterating for-loop: we're going to stop it and update vals every second until total time reached.
+        for (int step = first_step; step < timesteps.size(); step++) {
+
+            //Run Module Simulations
+            this->stepGlobal(step);
+
+            // exchange data
+            this->updateGlobalParameters();
+
+            if (!this->event_probes.empty()) {
+                this->evaluateEventProbes(timesteps[step]);
+            }
+
+            if (this->checkpoint_interval > 0 &&
+                step % this->checkpoint_interval == 0) {
+
+                this->writeCheckpoint(step);
+
+            } else if (this->light_checkpoint_interval > 0 &&
+                       step % this->light_checkpoint_interval == 0) {
+
+                // the tight half of the two-level cadence: state and RNG
+                // only, written off-thread
+                this->writeLightCheckpoint(step);
+            }
+
+            // windowed convergence monitor: the run ends early once every
+            // module's relative state change stays below tolerance for a
+            // full window of consecutive steps
+            if (this->steady_state_tolerance > 0.0) {
+
+                double max_change = 0.0;
+
+                if (previous_states.size() != this->modules.size()) {
+                    previous_states.resize(this->modules.size());
+                    max_change = std::numeric_limits<double>::infinity();
+                }
+
+                for (size_t m = 0; m < this->modules.size(); m++) {
+
+                    const std::vector<double>& state =
+                        this->modules[m]->current_state;
+
+                    std::vector<double>& previous = previous_states[m];
+
+                    if (previous.size() == state.size()) {
+
+                        for (size_t s = 0; s < state.size(); s++) {
+
+                            double change = std::abs(state[s] - previous[s]) /
+                                std::max(std::abs(state[s]), 1.0);
+
+                            max_change = std::max(max_change, change);
+                        }
+
+                    } else {
+                        max_change = std::numeric_limits<double>::infinity();
+                    }
+
+                    previous = state;
+                }
+
+                quiescent_steps = max_change <= this->steady_state_tolerance
+                    ? quiescent_steps + 1
+                    : 0;
+
+                if (quiescent_steps >= this->steady_state_window) {
+
+                    printf("Steady state reached at step %i; terminating early.\n",
+                           step);
+
+                    // keep the requested grid shape: the remaining rows
+                    // hold the equilibrium state; in-flight recorded rows
+                    // land first
+                    for (const auto& mod : this->modules) {
+                        mod->drainRecorder();
+                        mod->backfillResults(
+                            step + 1,
+                            static_cast<int>(timesteps.size())
+                        );
+                    }
+
+                    break;
+                }
+            }
+
+            if (reporter) {
+                reporter->update(step);
+            }
+
+            // progress printing is demoted to every progress_interval steps;
+            // console I/O is measurable on million-step runs
+            if (!reporter && step % this->progress_interval == 0) {
+
+                auto iter_t = std::chrono::high_resolution_clock::now();
+                std::chrono::duration<double> iter_time = iter_t - start_t;
+                printf("Iteration [%i / %i] Time: %f",
+                                    (int)(step),
+                                    (int)(timesteps.size()),
+                                    iter_time.count());
+                printf("\n");
+            }
+        }
+    }
+
+
+    // stepping writes engines only; mirror the final exchanged values
+    // and species state into libSBML once so post-run introspection of
+    // the documents stays consistent. Pipelined recorders drain first,
+    // so every row has landed before anything reads the matrices
+    for (const auto& mod : this->modules) {
+        mod->drainRecorder();
+        mod->syncExchangedParameters();
+        mod->syncStateToDocument();
+    }
+
+    // rolling-window mode recorded modulo the window, so the oldest
+    // retained row sits mid-buffer; one rotation makes the retained
+    // rows chronological before any reader walks them
+    size_t recorded_full =
+        (timesteps.size() + this->record_interval - 1) / this->record_interval;
+
+    if (this->results_window > 0 &&
+        recorded_full > static_cast<size_t>(this->results_window)) {
+
+        size_t window = static_cast<size_t>(this->results_window);
+        size_t shift = recorded_full % window;
+
+        if (shift != 0) {
+
+            if (!this->global_results.empty()) {
+
+                std::rotate(
+                    this->global_results.begin(),
+                    this->global_results.begin()
+                        + shift * this->global_row_stride,
+                    this->global_results.begin()
+                        + window * this->global_row_stride
+                );
+
+            } else {
+
+                for (const auto& mod : this->modules) {
+
+                    double* base = mod->results_data;
+                    size_t stride =
+                        static_cast<size_t>(mod->results_row_stride);
+
+                    std::rotate(
+                        base,
+                        base + shift * stride,
+                        base + window * stride
+                    );
+                }
+            }
+        }
+    }
+
+    // every stepping thread has joined; fold out the cache-line padding
+    // so readers see the dense layout
+    this->compactGlobalResults();
+
+    auto stop_t = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> duration = stop_t - start_t;
+
+    printf("Simulation Completed in %f seconds.", static_cast<double>(duration.count()));
+    printf("\n");
+
+    // stamp the wall time before any writer runs, so archived outputs
+    // carry their own perf summary
+    char seconds[32];
+
+    snprintf(seconds, sizeof(seconds), "%.3f", duration.count());
+
+    RunMetadata::set("simulate_seconds", seconds);
+
+    if (!this->perf_output.empty()) {
+
+        this->perf.writeReport(this->perf_output);
+    }
+
+    if (!this->entity_profile_output.empty()) {
+
+        std::ofstream profile_out(this->entity_profile_output);
+
+        for (const auto& mod : this->modules) {
+            mod->reportEntityProfile(profile_out);
+        }
+    }
+
+}
+
+void SingleCell::beginStepping(
+    double start,
+    double stop,
+    double step
+) {
+
+    // Build the session once; repeat calls reuse stoichiometry,
+    // compiled formulas and AMICI objects
+    this->ensureSessionLoaded();
+
+    // the exchange interval, when set, defines the stepping grid
+    step = this->gridStep(step);
+
+    this->setGlobalSimulationSettings(start, stop, step);
+
+    this->stepping_timesteps = *BaseModule::sharedTimeSteps(start, stop, step);
+
+    this->compileEventProbes();
+
+    this->stepping_next_step = 1;
+}
+
+double SingleCell::advanceTo(
+    double t
+) {
+
+    if (this->stepping_next_step < 1) {
+        throw std::runtime_error(
+            "advanceTo called without an open stepping session; "
+            "call beginStepping first"
+        );
+    }
+
+    // the same step/exchange pair runGlobal drives, minus its loop: the
+    // live solvers and compiled propensities carry over between resumes,
+    // so each call costs only the steps actually taken
+    while (this->stepping_next_step <
+               static_cast<int>(this->stepping_timesteps.size()) &&
+           this->stepping_timesteps[this->stepping_next_step] <= t) {
+
+        this->stepGlobal(this->stepping_next_step);
+
+        this->updateGlobalParameters();
+
+        if (!this->event_probes.empty()) {
+            this->evaluateEventProbes(
+                this->stepping_timesteps[this->stepping_next_step]
+            );
+        }
+
+        this->stepping_next_step++;
+    }
+
+    return this->stepping_timesteps[this->stepping_next_step - 1];
+}
+
+const std::vector<double>& SingleCell::stepOnce() {
+
+    if (this->stepping_next_step < 1) {
+        throw std::runtime_error(
+            "stepOnce called without an open stepping session; "
+            "call beginStepping first"
+        );
+    }
+
+    if (this->stepping_next_step >=
+            static_cast<int>(this->stepping_timesteps.size())) {
+        throw std::runtime_error(
+            "stepOnce called past the session's stop time; "
+            "beginStepping a longer horizon"
+        );
+    }
+
+    this->stepGlobal(this->stepping_next_step);
+
+    this->updateGlobalParameters();
+
+    if (!this->event_probes.empty()) {
+        this->evaluateEventProbes(
+            this->stepping_timesteps[this->stepping_next_step]
+        );
+    }
+
+    this->stepping_next_step++;
+
+    // refresh the persistent view in place; after the first call the
+    // buffer never reallocates, so the steering round trip is copies only
+    size_t total = 0;
+
+    for (const auto& mod : this->modules) {
+        total += mod->current_state.size();
+    }
+
+    this->stepping_state_view.resize(total);
+
+    double* out = this->stepping_state_view.data();
+
+    for (const auto& mod : this->modules) {
+
+        std::copy(
+            mod->current_state.begin(), mod->current_state.end(), out
+        );
+
+        out += mod->current_state.size();
+    }
+
+    return this->stepping_state_view;
+}
+
+std::vector<double> SingleCell::getCurrentState() {
+
+    std::vector<double> state;
+
+    for (const auto& mod : this->modules) {
+        state.insert(
+            state.end(),
+            mod->current_state.begin(),
+            mod->current_state.end()
+        );
+    }
+
+    return state;
+}
+
+void SingleCell::setCurrentState(
+    const std::vector<double>& state
+) {
+
+    if (this->stepping_next_step < 1) {
+        throw std::runtime_error(
+            "setCurrentState called without an open stepping session; "
+            "call beginStepping first"
+        );
+    }
+
+    size_t offset = 0;
+
+    for (const auto& mod : this->modules) {
+        offset += mod->current_state.size();
+    }
+
+    if (state.size() != offset) {
+        throw std::runtime_error(
+            "setCurrentState size mismatch: expected "
+            + std::to_string(offset) + " values, got "
+            + std::to_string(state.size())
+        );
+    }
+
+    // scatter back in module order, then re-record the last completed
+    // row so the matrix matches what the next step will read
+    offset = 0;
+
+    for (const auto& mod : this->modules) {
+
+        std::vector<double> module_state(
+            state.begin() + offset,
+            state.begin() + offset + mod->current_state.size()
+        );
+
+        offset += module_state.size();
+
+        mod->adoptState(module_state, this->stepping_next_step - 1);
+    }
+}
+
+void SingleCell::forkSteppingFrom(
+    SingleCell& parent
+) {
+
+    if (this->stepping_next_step < 1 || parent.stepping_next_step < 1) {
+        throw std::runtime_error(
+            "forkSteppingFrom requires open stepping sessions "
+            "on both cells; call beginStepping first"
+        );
+    }
+
+    if (this->modules.size() != parent.modules.size()) {
+        throw std::runtime_error(
+            "forkSteppingFrom requires both sessions to hold "
+            "the same module set"
+        );
+    }
+
+    // getLastStepResult reads current_state, so adopting it is the whole
+    // fork: one buffer copy per module and the engines resume from the
+    // parent's trajectory at the next step
+    int last_step = parent.stepping_next_step - 1;
+
+    for (size_t m = 0; m < this->modules.size(); m++) {
+
+        this->modules[m]->adoptState(
+            parent.modules[m]->current_state, last_step
+        );
+    }
+
+    this->stepping_next_step = parent.stepping_next_step;
+}
+
+void SingleCell::finishStepping() {
+
+    // stepping writes engines only; mirror the final exchanged values
+    // and species state into libSBML once on close. Pipelined recorders
+    // drain first so the matrix is complete before it is read
+    for (const auto& mod : this->modules) {
+        mod->drainRecorder();
+        mod->syncExchangedParameters();
+        mod->syncStateToDocument();
+    }
+
+    // the session's stepping threads are done; restore the dense layout
+    // before the query API reads the matrix
+    this->compactGlobalResults();
+
+    this->stepping_timesteps.clear();
+
+    this->stepping_state_view.clear();
+
+    this->stepping_next_step = 0;
+}
+
+void SingleCell::beginStreaming(
+    double start,
+    double stop,
+    double step,
+    int chunk_steps
+) {
+
+    if (this->stream_thread.joinable()) {
+        throw std::runtime_error(
+            "beginStreaming called with a streaming session already open; "
+            "call endStreaming first"
+        );
+    }
+
+    // the producer drives the same session the stepping API opens
+    this->beginStepping(start, stop, step);
+
+    this->stream_chunk_steps = (chunk_steps > 0) ? chunk_steps : 1;
+
+    size_t total_stride = 0;
+
+    for (const auto& mod : this->modules) {
+        total_stride += mod->results_stride;
+    }
+
+    this->last_num_species = total_stride;
+
+    this->stream_pending.clear();
+    this->stream_pending_rows = 0;
+    this->stream_pending_full = false;
+    this->stream_finished = false;
+    this->stream_cancelled = false;
+    this->stream_error = nullptr;
+    this->stream_emitted_rows = 0;
+
+    this->stream_thread = std::thread(&SingleCell::streamWorker, this);
+}
+
+void SingleCell::streamWorker() {
+
+    try {
+
+        size_t num_steps = this->stepping_timesteps.size();
+        size_t emitted_rows = 0;
+
+        for (size_t s = 1; s < num_steps; s++) {
+
+            {
+                std::lock_guard<std::mutex> lock(this->stream_mutex);
+
+                if (this->stream_cancelled) {
+                    break;
+                }
+            }
+
+            this->stepGlobal(static_cast<int>(s));
+
+            this->updateGlobalParameters();
+
+            bool last_step = (s + 1 == num_steps);
+
+            if (s % this->stream_chunk_steps != 0 && !last_step) {
+                continue;
+            }
+
+            // rows recorded so far, including the initial-state row;
+            // thinned recording keeps only every record_interval-th step
+            size_t recorded = s / this->record_interval + 1;
+
+            if (recorded <= emitted_rows) {
+                continue;
+            }
+
+            // assemble the newly completed rows outside the lock, then
+            // park them in the slot; waiting here while the consumer
+            // still holds the previous chunk is the backpressure
+            std::vector<double> chunk;
+            chunk.reserve((recorded - emitted_rows) * this->last_num_species);
+
+            for (size_t t = emitted_rows; t < recorded; t++) {
+
+                for (const auto& mod : this->modules) {
+
+                    const double* row = mod->getResultsRow(t);
+
+                    chunk.insert(chunk.end(), row, row + mod->results_stride);
+                }
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(this->stream_mutex);
+
+                this->stream_cv.wait(lock, [this]() {
+                    return !this->stream_pending_full || this->stream_cancelled;
+                });
+
+                if (this->stream_cancelled) {
+                    break;
+                }
+
+                this->stream_pending = std::move(chunk);
+                this->stream_pending_rows = recorded - emitted_rows;
+                this->stream_pending_full = true;
+                this->stream_emitted_rows = recorded;
+            }
+
+            this->stream_cv.notify_all();
+
+            emitted_rows = recorded;
+        }
+
+    } catch (...) {
+
+        std::lock_guard<std::mutex> lock(this->stream_mutex);
+        this->stream_error = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->stream_mutex);
+        this->stream_finished = true;
+    }
+
+    this->stream_cv.notify_all();
+}
+
+bool SingleCell::nextChunk(
+    std::vector<double>& chunk,
+    size_t& num_rows
+) {
+
+    std::unique_lock<std::mutex> lock(this->stream_mutex);
+
+    this->stream_cv.wait(lock, [this]() {
+        return this->stream_pending_full || this->stream_finished;
+    });
+
+    if (this->stream_pending_full) {
+
+        chunk = std::move(this->stream_pending);
+        num_rows = this->stream_pending_rows;
+
+        this->stream_pending.clear();
+        this->stream_pending_rows = 0;
+        this->stream_pending_full = false;
+
+        lock.unlock();
+        this->stream_cv.notify_all();
+
+        return true;
+    }
+
+    if (this->stream_error != nullptr) {
+
+        std::exception_ptr error = this->stream_error;
+        this->stream_error = nullptr;
+
+        lock.unlock();
+        std::rethrow_exception(error);
+    }
+
+    num_rows = 0;
+
+    return false;
+}
+
+void SingleCell::endStreaming() {
+
+    if (!this->stream_thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->stream_mutex);
+        this->stream_cancelled = true;
+    }
+
+    this->stream_cv.notify_all();
+
+    this->stream_thread.join();
+
+    // the recorded rows stay readable through the query API
+    this->last_num_timesteps = this->stream_emitted_rows;
+
+    this->finishStepping();
+}
+
+void SingleCell::setParallelStepping(
+    bool enable
+) {
+
+    this->parallel_stepping = enable;
+
+    RunMetadata::set("parallel_stepping", enable ? "on" : "off");
+}
+
+void SingleCell::setPerfOutput(
+    std::string output
+) {
+
+    this->perf_output = output;
+}
+
+void SingleCell::setEntityProfiling(
+    std::string output
+) {
+
+    this->entity_profile_output = output;
+
+    // live sessions pick the toggle up immediately
+    for (const auto& mod : this->modules) {
+        mod->setEntityProfiling(!this->entity_profile_output.empty());
+    }
+}
+
+void SingleCell::setProgressInterval(
+    int interval
+) {
+
+    this->progress_interval = (interval > 1) ? interval : 1;
+}
+
+void SingleCell::setProgressReporting(
+    double interval_seconds,
+    std::string status_path
+) {
+
+    this->progress_seconds = interval_seconds;
+    this->progress_status_path = std::move(status_path);
+}
+
+void SingleCell::setResultsBackingStore(
+    std::string path_prefix
+) {
+
+    this->results_backing_path = std::move(path_prefix);
+}
+
+size_t SingleCell::estimateRunMemory(
+    double start,
+    double stop,
+    double step
+) {
+
+    if (this->modules.empty()) {
+        this->loadSimulationModules();
+    }
+
+    size_t num_steps = BaseModule::sharedTimeSteps(start, stop, step)->size();
+
+    size_t recorded_steps =
+        (num_steps + this->record_interval - 1) / this->record_interval;
+
+    // rolling-window mode bounds the recorded rows whatever the grid
+    if (this->results_window > 0 &&
+        recorded_steps > static_cast<size_t>(this->results_window)) {
+
+        recorded_steps = static_cast<size_t>(this->results_window);
+    }
+
+    size_t projected = 0;
+
+    for (const auto& mod : this->modules) {
+
+        // recording options fix the row width the same way the settings
+        // pass will, so the estimate matches the eventual layout
+        mod->setRecordingOptions(this->record_interval, this->record_species);
+
+        size_t num_species = mod->handler.getSpeciesIds().size();
+
+        size_t stride = this->record_species.empty()
+            ? num_species
+            : mod->getRecordedSpeciesIds().size();
+
+        // the recorded trajectory plus one full-state trajectory held by
+        // the solver side: AMICI's ReturnData in full-run mode and the
+        // stochastic state arenas are both bounded by the latter
+        projected += recorded_steps * stride * sizeof(double);
+        projected += num_steps * num_species * sizeof(double);
+    }
+
+    return projected;
+}
+
+void SingleCell::setMemoryBudget(
+    size_t max_bytes,
+    std::string spill_path_prefix
+) {
+
+    this->memory_budget_bytes = max_bytes;
+    this->memory_spill_path = std::move(spill_path_prefix);
+}
+
+std::vector<double> SingleCell::getResultsWindow(
+    size_t first_row,
+    size_t num_rows
+) {
+
+    if (first_row + num_rows > this->last_num_timesteps) {
+        num_rows = this->last_num_timesteps > first_row
+            ? this->last_num_timesteps - first_row
+            : 0;
+    }
+
+    std::vector<double> window;
+    window.reserve(num_rows * this->last_num_species);
+
+    for (size_t t = first_row; t < first_row + num_rows; t++) {
+
+        for (const auto& mod : this->modules) {
+
+            const double* row = mod->getResultsRow(t);
+
+            window.insert(window.end(), row, row + mod->results_stride);
+        }
+    }
+
+    return window;
+}
+
+void SingleCell::setRecording(
+    int interval,
+    std::vector<std::string> species_subset
+) {
+
+    this->record_interval = (interval > 1) ? interval : 1;
+    this->record_species = std::move(species_subset);
+}
+
+void SingleCell::setRecordingPrecision(
+    int mantissa_bits
+) {
+
+    this->record_mantissa_bits = mantissa_bits;
+
+    // a live session retunes immediately; fresh sessions apply the
+    // setting when their modules load
+    for (const auto& mod : this->modules) {
+        mod->setRecordingPrecisionBits(mantissa_bits);
+    }
+}
+
+void SingleCell::setSummaryRecording(
+    int window_steps
+) {
+
+    this->summary_window_steps = window_steps;
+
+    for (const auto& mod : this->modules) {
+        mod->setSummaryRecording(window_steps);
+    }
+}
+
+std::vector<double> SingleCell::getSummary(
+    const std::string& statistic
+) {
+
+    std::vector<double> combined;
+
+    size_t total_stride = 0;
+
+    size_t num_windows = 0;
+
+    std::vector<const std::vector<double>*> lanes;
+
+    for (const auto& mod : this->modules) {
+
+        // a run ending mid-window still reports its tail; pipelined
+        // recorders drain first so the accumulators are settled
+        mod->drainRecorder();
+        mod->flushSummaryWindow();
+
+        const std::vector<double>* lane = nullptr;
+
+        if (statistic == "min") {
+            lane = &mod->summary_min_rows;
+        } else if (statistic == "max") {
+            lane = &mod->summary_max_rows;
+        } else if (statistic == "mean") {
+            lane = &mod->summary_mean_rows;
+        } else if (statistic == "variance") {
+            lane = &mod->summary_var_rows;
+        } else {
+            throw std::runtime_error(
+                "unknown summary statistic '" + statistic
+                + "'; expected min, max, mean or variance"
+            );
+        }
+
+        size_t stride = static_cast<size_t>(mod->results_stride);
+
+        size_t windows = stride > 0 ? lane->size() / stride : 0;
+
+        num_windows = (total_stride == 0)
+            ? windows
+            : std::min(num_windows, windows);
+
+        total_stride += stride;
+
+        lanes.push_back(lane);
+    }
+
+    // window-major rows, modules side by side in the same column order
+    // as the combined results matrix
+    combined.resize(num_windows * total_stride);
+
+    size_t column = 0;
+
+    for (size_t m = 0; m < this->modules.size(); m++) {
+
+        size_t stride = static_cast<size_t>(this->modules[m]->results_stride);
+
+        for (size_t w = 0; w < num_windows; w++) {
+
+            std::copy(
+                lanes[m]->begin() + w * stride,
+                lanes[m]->begin() + (w + 1) * stride,
+                combined.begin() + w * total_stride + column
+            );
+        }
+
+        column += stride;
+    }
+
+    return combined;
+}
+
+void SingleCell::setCheckpoint(
+    std::string path,
+    int interval,
+    int light_interval
+) {
+
+    this->checkpoint_path = path;
+    this->checkpoint_interval = (interval > 1) ? interval : 1;
+    this->light_checkpoint_interval = (light_interval > 0) ? light_interval : 0;
+}
+
+void SingleCell::setStreamOutput(
+    std::string path_prefix,
+    bool delta_compress
+) {
+
+    this->stream_output = path_prefix;
+    this->stream_compress = delta_compress;
+}
+
+void SingleCell::setSpeciesRecordingIntervals(
+    const std::vector<std::string>& species_ids,
+    const std::vector<int>& intervals
+) {
+
+    this->stream_interval_ids = species_ids;
+    this->stream_interval_values = intervals;
+}
+
+void SingleCell::stepGlobal(
+    int timestep
+) {
+
+    if (this->parallel_stepping && this->modules.size() > 1) {
+
+        if (this->module_step_costs.size() != this->modules.size()) {
+
+            this->module_step_costs.assign(this->modules.size(), 0.0);
+
+            // histogram names build once, so per-step sampling costs
+            // two clock reads per module and no allocations
+            this->module_step_phases.clear();
+            this->module_wait_phases.clear();
+
+            for (size_t m = 0; m < this->modules.size(); m++) {
+
+                const std::string& id = this->modules[m]->getModuleId();
+
+                this->module_step_phases.push_back("module_step:" + id);
+                this->module_wait_phases.push_back("barrier_wait:" + id);
+            }
+
+            this->module_step_finished.resize(this->modules.size());
+        }
+
+        // Modules only exchange data after stepping, so their step() calls
+        // are independent; the scheduler's completion wait is the barrier
+        // before the exchange, and sharing the process-wide pool keeps
+        // per-step parallelism composable under batch and population runs.
+        // Measured step costs steer placement, so a heavy CVODES module
+        // and a cheap tau-leap kernel never stack on one worker
+        TaskScheduler::instance().parallelForWeighted(
+            static_cast<int>(this->modules.size()),
+            this->module_step_costs,
+            [&](int m) {
+
+                auto step_began = std::chrono::steady_clock::now();
+
+                stepModuleDirect(this->modules[m].get(), timestep);
+
+                // publish on the producing thread: one writer per slot
+                this->modules[m]->publishExchanges();
+
+                // exponential average: stable placement, yet a module
+                // whose cost drifts (leap tiers, solver order) re-ranks
+                auto step_ended = std::chrono::steady_clock::now();
+
+                double seconds = std::chrono::duration<double>(
+                    step_ended - step_began
+                ).count();
+
+                this->module_step_costs[m] =
+                    this->module_step_costs[m] == 0.0
+                        ? seconds
+                        : 0.8 * this->module_step_costs[m] + 0.2 * seconds;
+
+                this->module_step_finished[m] = step_ended;
+
+                this->perf.addHistogramSample(
+                    this->module_step_phases[m], seconds
+                );
+            }
+        );
+
+        // the scheduler's completion wait is the exchange barrier: each
+        // module's wait is the gap between its own finish and the
+        // slowest module's, the imbalance the repartitioner should be
+        // shrinking
+        auto barrier_released = std::chrono::steady_clock::now();
+
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            double waited = std::chrono::duration<double>(
+                barrier_released - this->module_step_finished[m]
+            ).count();
+
+            this->perf.addHistogramSample(this->module_wait_phases[m], waited);
+        }
+
+    } else {
+
+        for (const auto& mod : this->modules) {
+
+            stepModuleDirect(mod.get(), timestep);
+
+            mod->publishExchanges();
+
+        }
+    }
+
+}
+
+void SingleCell::updateGlobalParameters() {
+
+    PerfMonitor::ScopedTimer timer(&this->perf, "parameter_exchange");
+    alloc_guard::PhaseScope alloc_phase("parameter_exchange");
+
+    for (const auto& mod : this->modules) {
+
+        mod->updateParameters();
+
+    }
+
+}
+
+void SingleCell::writeCheckpoint(
+    int step
+) {
+
+    // the checkpoint serializes results rows, so in-flight recorded
+    // rows must land first
+    for (const auto& mod : this->modules) {
+        mod->drainRecorder();
+    }
+
+    // write beside the target then rename, so a preemption mid-write
+    // leaves the previous checkpoint intact
+    std::string tmp_path = this->checkpoint_path + ".tmp";
+
+    std::ofstream out(tmp_path, std::ios::binary);
+
+    const char magic[8] = {'S','C','C','K','P','T','0','1'};
+    out.write(magic, sizeof(magic));
+
+    uint64_t last_step = static_cast<uint64_t>(step);
+    out.write(reinterpret_cast<const char*>(&last_step), sizeof(last_step));
+
+    uint64_t num_modules = this->modules.size();
+    out.write(reinterpret_cast<const char*>(&num_modules), sizeof(num_modules));
+
+    for (const auto& mod : this->modules) {
+
+        std::string id = mod->getModuleId();
+        uint64_t id_len = id.size();
+        out.write(reinterpret_cast<const char*>(&id_len), sizeof(id_len));
+        out.write(id.data(), id_len);
+
+        uint64_t state_size = mod->current_state.size();
+        out.write(reinterpret_cast<const char*>(&state_size), sizeof(state_size));
+        out.write(
+            reinterpret_cast<const char*>(mod->current_state.data()),
+            state_size * sizeof(double)
+        );
+
+        std::string rng_state = mod->getRngState();
+        uint64_t rng_len = rng_state.size();
+        out.write(reinterpret_cast<const char*>(&rng_len), sizeof(rng_len));
+        out.write(rng_state.data(), rng_len);
+
+        // write offset of the results stream: rows recorded through step,
+        // including the initial-state row at position zero; rows are
+        // written one at a time since the module may hold a column block
+        // of the global matrix rather than contiguous storage
+        uint64_t filled_rows = step / this->record_interval + 1;
+        out.write(reinterpret_cast<const char*>(&filled_rows), sizeof(filled_rows));
+
+        for (uint64_t row = 0; row < filled_rows; row++) {
+            out.write(
+                reinterpret_cast<const char*>(
+                    mod->results_data + row * mod->results_row_stride
+                ),
+                mod->results_stride * sizeof(double)
+            );
+        }
+    }
+
+    out.close();
+
+    std::rename(tmp_path.c_str(), this->checkpoint_path.c_str());
+}
+
+void SingleCell::writeLightCheckpoint(
+    int step
+) {
+
+    // snapshot the small state — per module the current state vector and
+    // the RNG counter triple, kilobytes against the full checkpoint's
+    // recorded rows — into one in-memory blob, so only the memcpy runs
+    // on the stepping thread
+    std::ostringstream snapshot(std::ios::binary);
+
+    const char magic[8] = {'S','C','C','K','L','T','0','1'};
+    snapshot.write(magic, sizeof(magic));
+
+    uint64_t last_step = static_cast<uint64_t>(step);
+    snapshot.write(
+        reinterpret_cast<const char*>(&last_step), sizeof(last_step)
+    );
+
+    uint64_t num_modules = this->modules.size();
+    snapshot.write(
+        reinterpret_cast<const char*>(&num_modules), sizeof(num_modules)
+    );
+
+    for (const auto& mod : this->modules) {
+
+        std::string id = mod->getModuleId();
+        uint64_t id_len = id.size();
+        snapshot.write(reinterpret_cast<const char*>(&id_len), sizeof(id_len));
+        snapshot.write(id.data(), id_len);
+
+        uint64_t state_size = mod->current_state.size();
+        snapshot.write(
+            reinterpret_cast<const char*>(&state_size), sizeof(state_size)
+        );
+        snapshot.write(
+            reinterpret_cast<const char*>(mod->current_state.data()),
+            state_size * sizeof(double)
+        );
+
+        std::string rng_state = mod->getRngState();
+        uint64_t rng_len = rng_state.size();
+        snapshot.write(
+            reinterpret_cast<const char*>(&rng_len), sizeof(rng_len)
+        );
+        snapshot.write(rng_state.data(), rng_len);
+    }
+
+    // one write in flight at a time: the previous one has normally long
+    // finished, so this wait is a formality, not a stall
+    if (this->light_checkpoint_inflight.valid()) {
+        this->light_checkpoint_inflight.get();
+    }
+
+    std::string light_path = this->checkpoint_path + ".light";
+
+    this->light_checkpoint_inflight = std::async(
+        std::launch::async,
+        [light_path, blob = snapshot.str()]() {
+
+            // temporary-and-rename, as for the full checkpoint, so a
+            // preemption mid-write leaves the previous light file intact
+            std::string tmp_path = light_path + ".tmp";
+
+            std::ofstream out(tmp_path, std::ios::binary);
+            out.write(blob.data(), blob.size());
+            out.close();
+
+            std::rename(tmp_path.c_str(), light_path.c_str());
+        }
+    );
+}
+
+int SingleCell::loadCheckpoint(
+    const std::string& path
+) {
+
+    std::ifstream in(path, std::ios::binary);
+
+    if (!in) {
+        throw std::runtime_error("Could not open checkpoint: " + path);
+    }
+
+    return this->loadCheckpointStream(in, path);
+}
+
+int SingleCell::loadCheckpointStream(
+    std::istream& in,
+    const std::string& path
+) {
+
+    char magic[8];
+    in.read(magic, sizeof(magic));
+
+    std::string magic_str(magic, 8);
+
+    // light checkpoints carry state and RNG only; recorded rows stay at
+    // their initial values when resuming from one
+    bool light = magic_str == "SCCKLT01";
+
+    if (!light && magic_str != "SCCKPT01") {
+        throw std::runtime_error("Not a SingleCell checkpoint: " + path);
+    }
+
+    uint64_t last_step = 0;
+    in.read(reinterpret_cast<char*>(&last_step), sizeof(last_step));
+
+    uint64_t num_modules = 0;
+    in.read(reinterpret_cast<char*>(&num_modules), sizeof(num_modules));
+
+    if (num_modules != this->modules.size()) {
+        throw std::runtime_error("Checkpoint module count does not match loaded models");
+    }
+
+    for (const auto& mod : this->modules) {
+
+        uint64_t id_len = 0;
+        in.read(reinterpret_cast<char*>(&id_len), sizeof(id_len));
+
+        std::string id(id_len, '\0');
+        in.read(&id[0], id_len);
+
+        if (id != mod->getModuleId()) {
+            throw std::runtime_error("Checkpoint module order does not match loaded models");
+        }
+
+        uint64_t state_size = 0;
+        in.read(reinterpret_cast<char*>(&state_size), sizeof(state_size));
+
+        std::vector<double> state(state_size);
+        in.read(
+            reinterpret_cast<char*>(state.data()),
+            state_size * sizeof(double)
+        );
+
+        // restore stepping state, and publish it to libSBML so the first
+        // resumed exchange reads the checkpointed values
+        mod->current_state = std::move(state);
+        mod->syncStateToDocument();
+
+        uint64_t rng_len = 0;
+        in.read(reinterpret_cast<char*>(&rng_len), sizeof(rng_len));
+
+        std::string rng_state(rng_len, '\0');
+        in.read(&rng_state[0], rng_len);
+
+        if (!rng_state.empty()) {
+            mod->setRngState(rng_state);
+        }
+
+        if (light) {
+            continue;
+        }
+
+        uint64_t filled_rows = 0;
+        in.read(reinterpret_cast<char*>(&filled_rows), sizeof(filled_rows));
+
+        for (uint64_t row = 0; row < filled_rows; row++) {
+            in.read(
+                reinterpret_cast<char*>(
+                    mod->results_data + row * mod->results_row_stride
+                ),
+                mod->results_stride * sizeof(double)
+            );
+        }
+
+        // replay restored rows into a fresh streaming sink, if one is attached
+        if (mod->stream_writer) {
+
+            for (uint64_t row = 0; row < filled_rows; row++) {
+                mod->stream_writer->appendRow(
+                    mod->results_data + row * mod->results_row_stride
+                );
+            }
+        }
+    }
+
+    return static_cast<int>(last_step);
+}
+
+void SingleCell::compactGlobalResults() {
+
+    size_t compact_stride = 0;
+
+    for (const auto& mod : this->modules) {
+        compact_stride += mod->results_stride;
+    }
+
+    if (this->global_results.empty() ||
+        this->global_row_stride == compact_stride) {
+        return;
+    }
+
+    size_t rows = this->global_results.size() / this->global_row_stride;
+
+    // forward in-place fold: every destination sits at or before its
+    // source, so one pass over the rows suffices
+    for (size_t t = 0; t < rows; t++) {
+
+        double* src_row =
+            this->global_results.data() + t * this->global_row_stride;
+
+        double* dst_row =
+            this->global_results.data() + t * compact_stride;
+
+        size_t dst_offset = 0;
+
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            const double* block = src_row + this->global_block_offsets[m];
+
+            std::copy(
+                block,
+                block + this->modules[m]->results_stride,
+                dst_row + dst_offset
+            );
+
+            dst_offset += this->modules[m]->results_stride;
+        }
+    }
+
+    this->global_results.resize(rows * compact_stride);
+
+    this->global_row_stride = compact_stride;
+}
+
+std::vector<std::vector<double>> SingleCell::combineResultsMatrix(
+    int timesteps
+) {
+
+    int numSpecies = this->getGlobalSpeciesIds().size();
+
+    // with thinned recording only every record_interval-th row exists
+    int recorded_steps = (timesteps + this->record_interval - 1) / this->record_interval;
+
+    // a rolling window retains only its trailing rows
+    if (this->results_window > 0 && recorded_steps > this->results_window) {
+        recorded_steps = this->results_window;
+    }
+
+    std::vector<std::vector<double>> final_matrix(recorded_steps);
+
+    // modules recorded into column blocks of one matrix, so a row is one
+    // contiguous slice; no per-module inserts or reallocation
+    if (!this->global_results.empty()) {
+
+        size_t stride = this->global_results.size() / recorded_steps;
+
+        for (size_t t = 0; t < final_matrix.size(); t++) {
+
+            const double* row = this->global_results.data() + t * stride;
+
+            final_matrix[t].assign(row, row + stride);
+        }
+
+        return final_matrix;
+    }
+
+    for (size_t t = 0; t < final_matrix.size(); t++) {
+
+        final_matrix[t].reserve(numSpecies);
+
+        // Append each module's contiguous row for this timestep
+        for (size_t m = 0; m < this->modules.size(); m++) {
+
+            const double* row = this->modules[m]->getResultsRow(t);
+
+            final_matrix[t].insert(
+                final_matrix[t].end(),
+                row,
+                row + this->modules[m]->results_stride
+            );
+        }
+    }
+    return final_matrix;
+}
+
+void SingleCell::saveModuleResults(
+    const std::string& output
+) {
+
+    if (this->modules.empty() || this->last_num_timesteps == 0) {
+        throw std::runtime_error(
+            "saveModuleResults called without a completed run; "
+            "call simulate first"
+        );
+    }
+
+    size_t recorded_steps = this->last_num_timesteps;
+
+    ResultsArchiveWriter writer(output);
+
+    // one archive member per module, sliced straight out of its column
+    // block; the combined matrix is never materialized
+    size_t column_offset = 0;
+
+    for (const auto& mod : this->modules) {
+
+        size_t stride = mod->results_stride;
+
+        std::vector<double> block;
+        block.reserve(recorded_steps * stride);
+
+        for (size_t t = 0; t < recorded_steps; t++) {
+
+            // post-run the global matrix is compact, so module blocks
+            // sit at cumulative stride offsets; backing-store modules
+            // keep their own rows
+            const double* row = this->global_results.empty()
+                ? mod->getResultsRow(static_cast<int>(t))
+                : this->global_results.data()
+                    + t * this->global_row_stride + column_offset;
+
+            block.insert(block.end(), row, row + stride);
+        }
+
+        writer.append(
+            mod->getModuleId(),
+            block,
+            stride,
+            mod->getRecordedSpeciesIds()
+        );
+
+        column_offset += stride;
+    }
+
+    writer.finalize();
+}
+
+std::vector<std::string> SingleCell::getRecordedSpeciesIds() {
+
+    if (this->record_species.empty()) {
+        return this->getGlobalSpeciesIds();
+    }
+
+    std::unordered_set<std::string> lookup(
+        this->record_species.begin(), this->record_species.end()
+    );
+
+    std::vector<std::string> recorded_ids;
+
+    for (const auto& specie : this->getGlobalSpeciesIds()) {
+
+        if (lookup.count(specie)) {
+
+            recorded_ids.push_back(specie);
+        }
+    }
+
+    return recorded_ids;
+}
+
+const std::vector<std::string>& SingleCell::getGlobalSpeciesIds() {
+
+    // the model set is fixed at construction, so the concatenated list
+    // is built once per session instead of re-copied on every call
+    if (this->global_species_ids.empty()) {
+
+        for (auto& handler : this->handlers) {
+
+            const std::vector<std::string>& mod_species_ids =
+                handler.data->species_ids;
+
+            this->global_species_ids.insert(
+                this->global_species_ids.end(),
+                mod_species_ids.begin(),
+                mod_species_ids.end()
+            );
+        }
+    }
+
+    return this->global_species_ids;
+}
+
+size_t SingleCell::findRecordedColumn(
+    const std::string& species_id,
+    BaseModule*& owner,
+    size_t& local_col
+) {
+
+    size_t offset = 0;
+
+    for (const auto& mod : this->modules) {
+
+        std::vector<std::string> ids = mod->getRecordedSpeciesIds();
+
+        for (size_t c = 0; c < ids.size(); c++) {
+
+            if (ids[c] == species_id) {
+                owner = mod.get();
+                local_col = c;
+                return offset + c;
+            }
+        }
+
+        offset += ids.size();
+    }
+
+    throw std::runtime_error(
+        "No recorded species named '" + species_id + "'"
+    );
+}
+
+std::vector<double> SingleCell::getTrajectory(
+    const std::string& species_id
+) {
+
+    BaseModule* owner = nullptr;
+    size_t local_col = 0;
+
+    size_t col = this->findRecordedColumn(species_id, owner, local_col);
+
+    std::vector<double> trajectory(this->last_num_timesteps);
+
+    if (!this->global_results.empty()) {
+
+        // strided column read; only these bytes are touched
+        for (size_t t = 0; t < this->last_num_timesteps; t++) {
+            trajectory[t] =
+                this->global_results[t * this->last_num_species + col];
+        }
+
+    } else {
+
+        // backing-store mode reads through the owner's mapped rows
+        for (size_t t = 0; t < this->last_num_timesteps; t++) {
+            trajectory[t] = owner->getResultsRow(
+                static_cast<int>(t)
+            )[local_col];
+        }
+    }
+
+    return trajectory;
+}
+
+std::vector<double> SingleCell::getTimeSlice(
+    size_t t
+) {
+
+    if (t >= this->last_num_timesteps) {
+        throw std::out_of_range(
+            "Recorded timestep " + std::to_string(t) + " out of range"
+        );
+    }
+
+    if (!this->global_results.empty()) {
+
+        const double* row =
+            this->global_results.data() + t * this->last_num_species;
+
+        return std::vector<double>(row, row + this->last_num_species);
+    }
+
+    std::vector<double> slice;
+    slice.reserve(this->last_num_species);
+
+    for (const auto& mod : this->modules) {
+
+        const double* row = mod->getResultsRow(static_cast<int>(t));
+
+        slice.insert(slice.end(), row, row + mod->results_stride);
+    }
+
+    return slice;
+}
+
+std::vector<double> SingleCell::getWindow(
+    const std::vector<std::string>& species_ids,
+    size_t t0,
+    size_t t1
+) {
+
+    if (t0 > t1 || t1 > this->last_num_timesteps) {
+        throw std::out_of_range("Recorded window out of range");
+    }
+
+    // resolve every id once; the gather below is raw reads
+    std::vector<size_t> columns(species_ids.size());
+    std::vector<BaseModule*> owners(species_ids.size());
+    std::vector<size_t> local_cols(species_ids.size());
+
+    for (size_t i = 0; i < species_ids.size(); i++) {
+        columns[i] = this->findRecordedColumn(
+            species_ids[i], owners[i], local_cols[i]
+        );
+    }
+
+    std::vector<double> window;
+    window.reserve((t1 - t0) * species_ids.size());
+
+    for (size_t t = t0; t < t1; t++) {
+
+        for (size_t i = 0; i < species_ids.size(); i++) {
+
+            window.push_back(
+                !this->global_results.empty()
+                    ? this->global_results[
+                          t * this->last_num_species + columns[i]]
+                    : owners[i]->getResultsRow(
+                          static_cast<int>(t))[local_cols[i]]
+            );
+        }
+    }
+
+    return window;
+}
+
+const std::vector<double>& SingleCell::getResultsView() const {
+
+    return this->global_results;
+}
+
+void SingleCell::setResultsLayout(
+    bool species_major
+) {
+
+    this->results_species_major = species_major;
+}
+
+bool SingleCell::isResultsSpeciesMajor() const {
+
+    return this->results_species_major;
 }
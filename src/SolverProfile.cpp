@@ -0,0 +1,74 @@
+/**
+ * @file: SolverProfile.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for the named solver configuration profiles
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <stdexcept>
+
+//Internal Libraries
+#include "singlecell/SolverProfile.h"
+
+//=============================Class Details================================//
+bool SolverProfile::matches(
+    const SolverProfile& other
+) const {
+
+    return this->absolute_tolerance == other.absolute_tolerance
+        && this->relative_tolerance == other.relative_tolerance
+        && this->max_steps == other.max_steps
+        && this->linear_solver == other.linear_solver
+        && this->stability_limit == other.stability_limit;
+}
+
+SolverProfile SolverProfile::named(
+    const std::string& name
+) {
+
+    SolverProfile profile;
+    profile.name = name;
+
+    if (name == "screening") {
+
+        // throughput first: loose tolerances, sparse linear algebra and
+        // no stability-limit order control
+        profile.absolute_tolerance = 1e-6;
+        profile.relative_tolerance = 1e-4;
+        profile.max_steps = 20000;
+        profile.linear_solver = "KLU";
+        profile.stability_limit = false;
+
+    } else if (name == "standard") {
+
+        // the long-standing tolerance defaults, with the linear solver
+        // following the model size
+        profile.absolute_tolerance = 1e-10;
+        profile.relative_tolerance = 1e-6;
+        profile.max_steps = 100000;
+        profile.linear_solver = "auto";
+        profile.stability_limit = true;
+
+    } else if (name == "precise") {
+
+        // fitting-grade: tight tolerances with generous step headroom
+        profile.absolute_tolerance = 1e-12;
+        profile.relative_tolerance = 1e-8;
+        profile.max_steps = 1000000;
+        profile.linear_solver = "auto";
+        profile.stability_limit = true;
+
+    } else {
+
+        throw std::runtime_error(
+            "Unknown solver profile '" + name +
+            "'; expected screening, standard or precise"
+        );
+    }
+
+    return profile;
+}
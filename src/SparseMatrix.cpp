@@ -0,0 +1,81 @@
+/**
+ * @file SparseMatrix.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for CSR sparse matrix construction
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <vector>
+#include <algorithm>
+
+// Internal Libraries
+#include "singlecell/SparseMatrix.h"
+
+//=============================Class Details================================//
+SparseMatrix SparseMatrix::fromTriplets(
+    size_t num_rows,
+    size_t num_cols,
+    std::vector<Triplet> triplets
+) {
+
+    // row-major, column-ascending order makes duplicate coordinates
+    // adjacent, so coalescing below is one linear pass
+    std::sort(
+        triplets.begin(),
+        triplets.end(),
+        [](const Triplet& a, const Triplet& b) {
+            return a.row != b.row ? a.row < b.row : a.col < b.col;
+        }
+    );
+
+    SparseMatrix sparse;
+
+    sparse.num_rows = num_rows;
+
+    sparse.num_cols = num_cols;
+
+    sparse.row_ptr.reserve(num_rows + 1);
+
+    sparse.row_ptr.push_back(0);
+
+    size_t next_row = 0;
+
+    for (size_t t = 0; t < triplets.size(); ) {
+
+        // sum every triplet sharing this coordinate
+        double value = triplets[t].value;
+
+        size_t run = t + 1;
+
+        while (run < triplets.size()
+            && triplets[run].row == triplets[t].row
+            && triplets[run].col == triplets[t].col) {
+
+            value += triplets[run].value;
+            run++;
+        }
+
+        if (value != 0.0) {
+
+            while (next_row < triplets[t].row) {
+                sparse.row_ptr.push_back(sparse.col_idx.size());
+                next_row++;
+            }
+
+            sparse.col_idx.push_back(triplets[t].col);
+            sparse.values.push_back(value);
+        }
+
+        t = run;
+    }
+
+    while (next_row < num_rows) {
+        sparse.row_ptr.push_back(sparse.col_idx.size());
+        next_row++;
+    }
+
+    return sparse;
+}
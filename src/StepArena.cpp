@@ -0,0 +1,47 @@
+/**
+ * @file StepArena.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for monotonic per-step arena allocation
+*/
+//===========================Library Import=================================//
+//Std Libraries
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+// Internal Libraries
+#include "singlecell/StepArena.h"
+
+//=============================Class Details================================//
+double* StepArena::allocate(
+    size_t count
+) {
+
+    // advance past blocks without room; grow only when none is left
+    while (this->block_index < this->blocks.size() &&
+           this->offset + count > this->blocks[this->block_index].size()) {
+
+        this->block_index++;
+        this->offset = 0;
+    }
+
+    if (this->block_index == this->blocks.size()) {
+
+        this->blocks.emplace_back(std::max(count, block_size));
+    }
+
+    double* out = this->blocks[this->block_index].data() + this->offset;
+
+    this->offset += count;
+
+    return out;
+}
+
+void StepArena::reset() {
+
+    this->block_index = 0;
+    this->offset = 0;
+}
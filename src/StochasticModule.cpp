@@ -11,246 +11,3025 @@
 //Std Libraries
 #include <ctime>
 #include <cmath>
+#include <cctype>
+#include <cstdio>
+#include <cstdint>
+#include <chrono>
 #include <vector>
 #include <string>
 #include <random>
 #include <memory>
+#include <limits>
+#include <thread>
 #include <fstream>
+#include <sstream>
 #include <optional>
 #include <iostream>
 #include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 // Internal libraries
 #include "singlecell/utils.h"
+#include "singlecell/Logger.h"
+#include "singlecell/RunMetadata.h"
+#include "singlecell/AllocationGuard.h"
 #include "singlecell/SBMLHandler.h"
+#include "singlecell/TaskScheduler.h"
 #include "singlecell/StochasticModule.h"
 
 // Third Party Libraries
 #include "muParser.h"
 
+namespace {
+
+// identifier tokens of one rule or trigger formula: the reaction
+// tokenizer's operator set, extended with the comparison and logical
+// characters trigger conditions carry
+std::vector<std::string> tokenizeRuleFormula(
+    const std::string& formula_str
+) {
+
+    const std::string separators = "+-*/^()<>=!&|,%?: ";
+
+    std::vector<std::string> tokens;
+
+    std::string current_token_bin;
+
+    for (char c : formula_str) {
+
+        if (separators.find(c) != std::string::npos) {
+
+            if (!current_token_bin.empty()) {
+                tokens.push_back(current_token_bin);
+            }
+
+            current_token_bin.clear();
+
+        } else {
+            current_token_bin += c;
+        }
+    }
+
+    if (!current_token_bin.empty()) {
+        tokens.push_back(current_token_bin);
+    }
+
+    return tokens;
+}
+
+// strength reduction: identifier^n for integer n in 2..4 rewrites to
+// repeated multiplication, which muParser evaluates as bytecode MUL ops
+// instead of a pow() call. Only plain identifier bases qualify — a
+// parenthesized base or a non-integer, chained or signed exponent keeps
+// the original operator
+std::string reducePowers(
+    const std::string& formula
+) {
+
+    std::string reduced;
+    reduced.reserve(formula.size());
+
+    size_t i = 0;
+
+    while (i < formula.size()) {
+
+        char c = formula[i];
+
+        // numeric literals copy verbatim, exponent marker included, so
+        // the 'e' of 2e3 never scans as an identifier
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+
+            while (i < formula.size() &&
+                   (std::isdigit(static_cast<unsigned char>(formula[i])) ||
+                    formula[i] == '.')) {
+                reduced.push_back(formula[i++]);
+            }
+
+            if (i < formula.size() &&
+                (formula[i] == 'e' || formula[i] == 'E')) {
+
+                reduced.push_back(formula[i++]);
+
+                if (i < formula.size() &&
+                    (formula[i] == '+' || formula[i] == '-')) {
+                    reduced.push_back(formula[i++]);
+                }
+
+                while (i < formula.size() &&
+                       std::isdigit(static_cast<unsigned char>(formula[i]))) {
+                    reduced.push_back(formula[i++]);
+                }
+            }
+
+            continue;
+        }
+
+        if (!std::isalpha(static_cast<unsigned char>(c)) && c != '_') {
+            reduced.push_back(c);
+            i++;
+            continue;
+        }
+
+        size_t start = i;
+
+        while (i < formula.size() &&
+               (std::isalnum(static_cast<unsigned char>(formula[i])) ||
+                formula[i] == '_')) {
+            i++;
+        }
+
+        std::string base = formula.substr(start, i - start);
+
+        // lookahead across optional spaces for '^' and a bare 2..4
+        size_t j = i;
+
+        while (j < formula.size() && formula[j] == ' ') j++;
+
+        if (j < formula.size() && formula[j] == '^') {
+
+            j++;
+
+            while (j < formula.size() && formula[j] == ' ') j++;
+
+            bool exponent_ends = j + 1 >= formula.size() ||
+                (!std::isdigit(static_cast<unsigned char>(formula[j + 1])) &&
+                 formula[j + 1] != '.' && formula[j + 1] != '^');
+
+            if (j < formula.size() &&
+                formula[j] >= '2' && formula[j] <= '4' && exponent_ends) {
+
+                int exponent = formula[j] - '0';
+
+                reduced.push_back('(');
+                reduced += base;
+
+                for (int r = 1; r < exponent; r++) {
+                    reduced.push_back('*');
+                    reduced += base;
+                }
+
+                reduced.push_back(')');
+
+                i = j + 1;
+                continue;
+            }
+        }
+
+        reduced += base;
+    }
+
+    return reduced;
+}
+
+} // namespace
+
 //=============================Class Details================================//
 StochasticModule::StochasticModule(
     SBMLHandler StochasticModel
 ) : BaseModule(StochasticModel) {
 
-    // Retrieve the stoichiometric matrix from the sbml document.
-    this->stoichmat = StochasticModel.getStoichiometricMatrix();
+    this->module_kind = ModuleKind::Stochastic;
+
+    // Both CSR stoichiometry forms live in the shared model data (and
+    // the on-disk snapshot), so neither is re-derived per module
+    this->stoich_rows = this->model_data->stoich_rows;
+    this->stoich_cols = this->model_data->stoich_cols;
+
+    // Keep only reactant (negative-coefficient) entries per reaction, with
+    // magnitudes pre-taken, so constrainTau never inspects products
+    size_t numSpecies = this->stoich_rows.num_rows;
+    size_t numReactions = this->stoich_cols.num_rows;
+
+    this->reactant_entries.num_rows = numReactions;
+    this->reactant_entries.num_cols = numSpecies;
+    this->reactant_entries.row_ptr.assign(numReactions + 1, 0);
+
+    for (size_t i = 0; i < numReactions; i++) {
+
+        for (size_t e = this->stoich_cols.row_ptr[i];
+             e < this->stoich_cols.row_ptr[i + 1]; e++) {
+
+            if (this->stoich_cols.values[e] < 0.0) {
+
+                this->reactant_entries.col_idx.push_back(
+                    this->stoich_cols.col_idx[e]
+                );
+                this->reactant_entries.values.push_back(
+                    -this->stoich_cols.values[e]
+                );
+            }
+        }
+
+        this->reactant_entries.row_ptr[i + 1] =
+            this->reactant_entries.col_idx.size();
+    }
+
+    // Highest reactant order touching each species, the g_i factor in
+    // the Cao-Gillespie tau bound; derived from the reactant CSR above
+    this->tau_g_values.assign(numSpecies, 1.0);
+
+    for (size_t i = 0; i < numReactions; i++) {
+
+        double order = 0.0;
+
+        for (size_t e = this->reactant_entries.row_ptr[i];
+             e < this->reactant_entries.row_ptr[i + 1]; e++) {
+            order += this->reactant_entries.values[e];
+        }
+
+        for (size_t e = this->reactant_entries.row_ptr[i];
+             e < this->reactant_entries.row_ptr[i + 1]; e++) {
+
+            unsigned int s = this->reactant_entries.col_idx[e];
+
+            this->tau_g_values[s] = std::max(this->tau_g_values[s], order);
+        }
+    }
+
+    //Instantiate SBML model
+    this->sbml = StochasticModel.model;
+
+    this->algorithm_id = this->sbml->getId();
+    this->target_id = "Hybrid";
+
+    // Rule and event specs come out before formula compilation, so
+    // symbol resolution can reserve their slots alongside the rate laws'
+    this->rule_specs = StochasticModel.getRuleSpecs();
+    this->event_specs = StochasticModel.getEventSpecs();
+
+    // Parse each rate law exactly once; evaluation re-uses the bytecode
+    this->compileFormulas();
+
+    // Rules and events compile through the same pipeline, after the
+    // storage is fully sized and stable
+    this->compileRulesAndEvents();
+
+    // Group identical rate-law shapes for the vectorized propensity pass
+    this->classifyFormulaShapes();
+
+    // Invert formula membership for the incremental propensity pass
+    this->buildPropensityReaders();
+
+    // Production models carry a compiled propensity library beside their
+    // AMICI models; ad-hoc models stay on the interpreted paths above
+    this->loadNativePropensities();
+
+    // Small models pick a fixed-capacity step kernel from the
+    // pre-instantiated tiers, so species and reaction counts become
+    // compile-time constants on the hot path; tier capacities double per
+    // level and anything larger keeps the general arena path
+    for (int tier = 0; tier < 3; tier++) {
+
+        if (numSpecies <= (8u << tier) && numReactions <= (16u << tier)) {
+            this->fixed_tier = tier;
+            break;
+        }
+    }
+
+    // lanes pad to the tier's species capacity when one applies: the
+    // fixed-width sweeps run full lanes and the extra lanes multiply
+    // against zero instead of branching on the model size
+    size_t lane_stride = (this->fixed_tier >= 0)
+        ? (8u << this->fixed_tier)
+        : numSpecies;
+
+    this->packSpeciesConstants(StochasticModel.species_volumes, lane_stride);
+
+    // invert species -> compartment once, so a mid-run volume change
+    // refreshes only the housed species' lanes instead of re-resolving
+    for (size_t s = 0; s < numSpecies; s++) {
+
+        this->compartment_species[
+            this->sbml->getSpecies(s)->getCompartment()
+        ].push_back(static_cast<unsigned int>(s));
+    }
+
+    // Entropy-seed the persistent generator once; setRandomSeed replays
+    this->generator.seed(std::random_device{}());
+
+ }
+
+void StochasticModule::packSpeciesConstants(
+    const std::vector<double>& volumes,
+    size_t lane_stride
+) {
+
+    // round the stride to a whole cache line of doubles so every lane
+    // starts on its own line; the padded tail lanes stay zero
+    const size_t line_doubles = 64 / sizeof(double);
+
+    lane_stride = (lane_stride + line_doubles - 1)
+        / line_doubles * line_doubles;
+
+    // one spare line lets the first lane start on a cache-line boundary
+    // whatever the vector's base alignment turns out to be
+    this->species_constant_block.assign(4 * lane_stride + line_doubles, 0.0);
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(
+        this->species_constant_block.data()
+    );
+
+    double* lanes = reinterpret_cast<double*>(
+        (base + 63u) & ~static_cast<uintptr_t>(63u)
+    );
+
+    double* volume_lane = lanes;
+    double* to_mpv = lanes + lane_stride;
+    double* to_molecules = lanes + 2 * lane_stride;
+    double* to_nM = lanes + 3 * lane_stride;
+
+    std::vector<double> mpv_factors =
+        unit_conversions::nanomolar2mpv(volumes);
+    std::vector<double> nM_factors =
+        unit_conversions::molecules2nanomolar(volumes);
+
+    for (size_t s = 0; s < volumes.size(); s++) {
+        volume_lane[s] = volumes[s];
+        to_mpv[s] = mpv_factors[s];
+
+        // fused nM -> whole-molecule factor: one multiply replaces the
+        // old nM -> per-volume -> molecules chain
+        to_molecules[s] = mpv_factors[s] * volumes[s];
+        to_nM[s] = nM_factors[s];
+    }
+
+    this->species_volume_factors = volume_lane;
+    this->nM2mpv_conversion_factors = to_mpv;
+    this->nM2molecules_conversion_factors = to_molecules;
+    this->molecules2nM_conversion_factors = to_nM;
+
+    // writable view for incremental volume updates
+    this->species_lane_base = lanes;
+    this->species_lane_stride = lane_stride;
+}
+
+std::string StochasticModule::getModuleId() { return this->algorithm_id; }
+
+void StochasticModule::loadTargetModule(
+    const std::vector<std::unique_ptr<BaseModule>>& module_list
+) {
+    for (const auto& mod : module_list) {
+
+        if (mod->getModuleId() == this->target_id) {
+
+            this->targets.push_back(mod.get());
+        }
+
+    }
+}
+
+void StochasticModule::computeReactions(
+    const double* state,
+    size_t numSpecies,
+    double* v
+) {
+
+#if !defined(NDEBUG) || defined(SINGLECELL_ALLOC_PROFILE)
+    // the evaluation context is preallocated slot storage; once the
+    // first full pass has built the muParser bytecode, no path through
+    // here may touch the heap. The tally only moves in builds linking a
+    // counting operator new - the benchmark target and the profiling
+    // core flavor enforce this
+    alloc_guard::Scope alloc_scope(this->eval_warmed);
+#endif
+    this->eval_warmed = true;
+
+    size_t numReactions = this->compiled_formulas.size();
+
+    // Native path: one ahead-of-time compiled call evaluates every rate
+    // law, replacing both the group kernels and the muParser walks; the
+    // incremental cache machinery is pointless against a single native
+    // call, so it is bypassed entirely. Profiled passes stay scalar and
+    // interpreted, since per-reaction attribution needs per-reaction
+    // clocking
+    if (this->native_propensities != nullptr && !this->entity_profiling) {
+
+        for (size_t k = 0; k < this->native_param_slots.size(); k++) {
+
+            if (this->native_param_slots[k] >= 0) {
+                this->native_param_values[k] =
+                    this->eval_values[this->native_param_slots[k]];
+            }
+        }
+
+        this->native_propensities(
+            state, this->native_param_values.data(), v
+        );
+
+        // the compiled kernel evaluates the full set; pruned reactions
+        // are pinned to zero afterwards so they never fire
+        for (unsigned int i : this->pruned_reactions) {
+            v[i] = 0.0;
+        }
+
+        this->scanForNonFinite(v, numReactions);
+
+        return;
+    }
+
+    // Incremental path: with a valid cache, compare the incoming state to
+    // the one the cache was evaluated at and re-evaluate only reactions
+    // reading a species that changed. At small delta_t most species did
+    // not fire, so the dirty set is a sliver of the reaction set
+    if (this->use_incremental_propensities &&
+        this->propensity_cache_valid &&
+        this->propensity_state_cache.size() == numSpecies) {
+
+        this->dirty_reactions.assign(numReactions, 0);
+
+        size_t num_dirty = 0;
+
+        for (size_t s = 0; s < numSpecies; s++) {
+
+            if (state[s] == this->propensity_state_cache[s]) {
+                continue;
+            }
+
+            this->propensity_state_cache[s] = state[s];
+
+            if (this->species_slots[s] >= 0) {
+                this->eval_values[this->species_slots[s]] = state[s];
+            }
+
+            for (size_t e = this->reader_row_ptr[s];
+                 e < this->reader_row_ptr[s + 1]; e++) {
+
+                unsigned int j = this->reader_reactions[e];
+
+                if (!this->dirty_reactions[j]) {
+                    this->dirty_reactions[j] = 1;
+                    num_dirty++;
+                }
+            }
+        }
+
+        // dense firing patterns fall through to the full pass below; the
+        // crossover is where scattered scalar evals stop beating the
+        // group kernels
+        if (num_dirty * 2 <= numReactions) {
+
+            // hoisted subexpressions refresh once per pass — the dirty
+            // scalar evals below read their pool slots, and exchanged
+            // or overridden parameters may have moved under them
+            this->refreshSharedSubexpressions();
+
+            if (this->entity_profiling) {
+
+                this->reaction_eval_seconds.resize(numReactions, 0.0);
+
+                for (unsigned int j = 0; j < numReactions; j++) {
+
+                    if (!this->dirty_reactions[j]) {
+                        continue;
+                    }
+
+                    auto eval_start = std::chrono::steady_clock::now();
+
+                    this->propensity_cache[j] =
+                        this->evaluateSingleReaction(j);
+
+                    std::chrono::duration<double> elapsed =
+                        std::chrono::steady_clock::now() - eval_start;
+
+                    this->reaction_eval_seconds[j] += elapsed.count();
+                }
+
+            } else {
+
+                for (unsigned int j = 0; j < numReactions; j++) {
+
+                    if (this->dirty_reactions[j]) {
+                        this->propensity_cache[j] =
+                            this->evaluateSingleReaction(j);
+                    }
+                }
+            }
+
+            std::copy(
+                this->propensity_cache.begin(),
+                this->propensity_cache.end(),
+                v
+            );
+
+            this->scanForNonFinite(v, numReactions);
+
+            return;
+        }
+    }
+
+    // Copy the current state into the bound species slots; straight array
+    // writes, no libSBML string lookups on this path
+    for (size_t s = 0; s < numSpecies; s++) {
+        if (this->species_slots[s] >= 0) {
+            this->eval_values[this->species_slots[s]] = state[s];
+        }
+    }
+
+    // hoisted subexpressions refresh once per pass, after the species
+    // scatter so they see the incoming state
+    this->refreshSharedSubexpressions();
+
+    // Profiled full pass goes scalar so the clock can attribute time to
+    // individual rate laws; the vectorized group kernels below blend
+    // their members into one timing. Opt-in only, so the hot default
+    // path pays nothing
+    if (this->entity_profiling) {
+
+        this->reaction_eval_seconds.resize(numReactions, 0.0);
+
+        for (unsigned int j = 0; j < numReactions; j++) {
+
+            auto eval_start = std::chrono::steady_clock::now();
+
+            v[j] = this->evaluateSingleReaction(j);
+
+            std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - eval_start;
+
+            this->reaction_eval_seconds[j] += elapsed.count();
+        }
+
+        for (unsigned int i : this->pruned_reactions) {
+            v[i] = 0.0;
+        }
+
+        this->propensity_cache.assign(v, v + numReactions);
+        this->propensity_state_cache.assign(state, state + numSpecies);
+        this->propensity_cache_valid = true;
+
+        this->scanForNonFinite(v, numReactions);
+
+        return;
+    }
+
+    // Product-shape groups evaluate as gather-multiply kernels: with the
+    // factor count fixed per group, the member loop vectorizes instead of
+    // walking muParser bytecode per reaction
+    for (const auto& group : this->product_groups) {
+
+        size_t num_factors = group.num_factors;
+        size_t num_members = group.reactions.size();
+
+        const unsigned int* slots = group.factor_slots.data();
+        const double* values = this->eval_values.data();
+
+        #pragma omp simd
+        for (size_t m = 0; m < num_members; m++) {
+
+            double product = values[slots[m * num_factors]];
+
+            for (size_t f = 1; f < num_factors; f++) {
+                product *= values[slots[m * num_factors + f]];
+            }
+
+            v[group.reactions[m]] = product;
+        }
+    }
+
+    // Evaluate one pre-compiled rate law; no string work and no exception
+    // frame on this path — formulas were validated by the build-time warm
+    // Eval, invalid ones pin to NaN and surface in the non-finite scan
+    auto evaluate_one = [this, v](unsigned int i) {
+
+        v[i] = this->formula_valid[i]
+            ? compiled_formulas[i].Eval()
+            : std::numeric_limits<double>::quiet_NaN();
+    };
+
+    size_t num_fallback = this->fallback_reactions.size();
+
+#ifdef _OPENMP
+    // Each reaction owns its parser and only reads shared eval_values, so
+    // big reaction sets split cleanly; bytecode was pre-warmed at compile
+    // time so no parser mutates itself here
+    if (num_fallback >= this->parallel_propensity_threshold) {
+
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < static_cast<int>(num_fallback); i++) {
+            evaluate_one(this->fallback_reactions[i]);
+        }
+
+    } else {
+
+        for (unsigned int i = 0; i < num_fallback; i++) {
+            evaluate_one(this->fallback_reactions[i]);
+        }
+    }
+#else
+    // Small reaction sets stay serial; fork/join overhead would dominate
+    for (unsigned int i = 0; i < num_fallback; i++) {
+        evaluate_one(this->fallback_reactions[i]);
+    }
+#endif
+
+    // pruned reactions left both evaluation sets; their slots would
+    // otherwise carry stale stack garbage into the cache
+    for (unsigned int i : this->pruned_reactions) {
+        v[i] = 0.0;
+    }
+
+    // a full pass re-baselines the incremental cache
+    this->propensity_cache.assign(v, v + numReactions);
+    this->propensity_state_cache.assign(state, state + numSpecies);
+    this->propensity_cache_valid = true;
+
+    this->scanForNonFinite(v, numReactions);
+}
+
+void StochasticModule::scanForNonFinite(
+    const double* v,
+    size_t numReactions
+) {
+
+    // one branch-free reduction over the contiguous propensity array per
+    // evaluation pass, in place of per-evaluation exception handling
+    size_t num_nonfinite = 0;
+
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:num_nonfinite)
+#endif
+    for (size_t i = 0; i < numReactions; i++) {
+        num_nonfinite += std::isfinite(v[i]) ? 0 : 1;
+    }
+
+    if (num_nonfinite > 0 && !this->nonfinite_reported) {
+
+        this->nonfinite_reported = true;
+
+        SC_LOG_ERROR(num_nonfinite << " of " << numReactions
+            << " propensities are NaN/Inf in module "
+            << this->algorithm_id
+            << "; reporting once, check rate laws and parameter values");
+    }
+}
+
+double StochasticModule::evaluateSingleReaction(
+    unsigned int i
+) {
+
+    int offset = this->reaction_factor_offset[i];
+
+    if (offset >= 0) {
+
+        const unsigned int* slots =
+            this->reaction_factor_slots_flat.data() + offset;
+
+        double product = this->eval_values[slots[0]];
+
+        for (unsigned int f = 1; f < this->reaction_factor_count[i]; f++) {
+            product *= this->eval_values[slots[f]];
+        }
+
+        return product;
+    }
+
+    return this->formula_valid[i]
+        ? this->compiled_formulas[i].Eval()
+        : std::numeric_limits<double>::quiet_NaN();
+}
+
+void StochasticModule::buildPropensityReaders() {
+
+    size_t numSpecies = this->model_data->species_ids.size();
+    size_t numReactions = this->model_data->formulas_vector.size();
+
+    std::vector<std::vector<unsigned int>> readers(numSpecies);
+
+    for (size_t j = 0; j < numReactions; j++) {
+
+        for (const std::string& token : this->model_data->formula_tokens[j]) {
+
+            auto species = this->model_data->species_index.find(token);
+
+            if (species != this->model_data->species_index.end()) {
+
+                std::vector<unsigned int>& list = readers[species->second];
+
+                // formulas scan in index order, so repeats are adjacent
+                if (list.empty() || list.back() != j) {
+                    list.push_back(static_cast<unsigned int>(j));
+                }
+            }
+        }
+    }
+
+    this->reader_row_ptr.assign(numSpecies + 1, 0);
+
+    for (size_t s = 0; s < numSpecies; s++) {
+        this->reader_row_ptr[s + 1] =
+            this->reader_row_ptr[s] + readers[s].size();
+    }
+
+    this->reader_reactions.clear();
+    this->reader_reactions.reserve(this->reader_row_ptr[numSpecies]);
+
+    for (size_t s = 0; s < numSpecies; s++) {
+        this->reader_reactions.insert(
+            this->reader_reactions.end(), readers[s].begin(), readers[s].end()
+        );
+    }
+}
+
+void StochasticModule::loadNativePropensities() {
+
+    size_t numSpecies = this->model_data->species_ids.size();
+    size_t numReactions = this->model_data->formulas_vector.size();
+
+    const std::vector<std::string>& parameter_ids =
+        this->model_data->parameter_ids;
+
+    this->native_propensities = PropensityRegistry::resolve(
+        this->algorithm_id,
+        numSpecies,
+        parameter_ids.size(),
+        numReactions
+    );
+
+    if (this->native_propensities == nullptr) {
+        return;
+    }
+
+    // the kernel takes parameters in document order; exchanged and
+    // overridden values land in eval_values, so gather from there. A
+    // parameter no formula references has no slot and keeps its
+    // document value for the process lifetime
+    this->native_param_values = this->handler.getParameterValues();
+    this->native_param_slots.assign(parameter_ids.size(), -1);
+
+    for (size_t k = 0; k < parameter_ids.size(); k++) {
+
+        auto slot = this->symbol_slots.find(parameter_ids[k]);
+
+        if (slot != this->symbol_slots.end()) {
+            this->native_param_slots[k] = static_cast<int>(slot->second);
+        }
+    }
+}
+
+void StochasticModule::compileFormulas() {
+
+    // token lists are shared model data, tokenized once per file (and
+    // carried by the snapshot); they feed both the slot resolution below
+    // and the variable binding pass
+    const std::vector<std::vector<std::string>>& formula_tokens =
+        this->model_data->formula_tokens;
+
+    // Resolve every formula symbol to a slot in eval_values first, so the
+    // storage is fully sized before any parser binds an address into it
+    this->resolveSymbols(formula_tokens);
+
+    // the shared temporary pool claims its slots in the same sizing
+    // pass; re-optimization rewrites pool values in place and never
+    // grows the storage, so bound addresses stay stable for the run
+    this->cse_pool_base = this->eval_values.size();
+    this->eval_values.resize(this->cse_pool_base + cse_pool_capacity, 0.0);
+
+    this->optimizeFormulaSet();
+    this->compileOptimizedFormulas();
+}
+
+std::string StochasticModule::foldConstants(
+    const std::string& formula,
+    const std::unordered_set<std::string>& mutable_names
+) {
+
+    std::string folded;
+    folded.reserve(formula.size());
+
+    size_t i = 0;
+
+    while (i < formula.size()) {
+
+        char c = formula[i];
+
+        // numeric literals copy verbatim so an exponent marker never
+        // scans as an identifier
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+
+            while (i < formula.size() &&
+                   (std::isdigit(static_cast<unsigned char>(formula[i])) ||
+                    formula[i] == '.')) {
+                folded.push_back(formula[i++]);
+            }
+
+            if (i < formula.size() &&
+                (formula[i] == 'e' || formula[i] == 'E')) {
+
+                folded.push_back(formula[i++]);
+
+                if (i < formula.size() &&
+                    (formula[i] == '+' || formula[i] == '-')) {
+                    folded.push_back(formula[i++]);
+                }
+
+                while (i < formula.size() &&
+                       std::isdigit(static_cast<unsigned char>(formula[i]))) {
+                    folded.push_back(formula[i++]);
+                }
+            }
+
+            continue;
+        }
+
+        if (!std::isalpha(static_cast<unsigned char>(c)) && c != '_') {
+            folded.push_back(c);
+            i++;
+            continue;
+        }
+
+        size_t start = i;
+
+        while (i < formula.size() &&
+               (std::isalnum(static_cast<unsigned char>(formula[i])) ||
+                formula[i] == '_')) {
+            i++;
+        }
+
+        std::string token = formula.substr(start, i - start);
+
+        auto slot = this->symbol_slots.find(token);
+
+        // a resolved symbol outside the mutable set holds its document
+        // value for the whole run; the literal lets muParser fold it
+        // further and frees the parser of one variable lookup. Function
+        // names and unresolved tokens have no slot and pass through
+        if (slot == this->symbol_slots.end() ||
+            mutable_names.count(token)) {
+
+            folded += token;
+            continue;
+        }
+
+        char literal[32];
+        std::snprintf(
+            literal, sizeof(literal), "%.17g",
+            this->eval_values[slot->second]
+        );
+
+        // negative values parenthesize so the literal never fuses with
+        // a preceding operator
+        if (literal[0] == '-') {
+            folded.push_back('(');
+            folded += literal;
+            folded.push_back(')');
+        } else {
+            folded += literal;
+        }
+
+        this->folded_symbols.insert(token);
+    }
+
+    return folded;
+}
+
+void StochasticModule::optimizeFormulaSet() {
+
+    size_t numReactions = this->model_data->formulas_vector.size();
+
+    // rule and event targets mutate at step boundaries; their specs are
+    // consumed by compileRulesAndEvents, so record the names in the
+    // persistent mutable set while they are still here
+    for (const auto& rule : this->rule_specs) {
+        this->runtime_mutable_symbols.insert(rule.variable);
+    }
+
+    for (const auto& event : this->event_specs) {
+
+        for (const auto& [variable, formula] : event.assignments) {
+            this->runtime_mutable_symbols.insert(variable);
+        }
+    }
+
+    // species slots rewrite every propensity pass and compartment slots
+    // follow volume updates, so neither ever folds
+    std::unordered_set<std::string> mutable_names =
+        this->runtime_mutable_symbols;
+
+    for (const std::string& id : this->model_data->species_ids) {
+        mutable_names.insert(id);
+    }
+
+    for (unsigned int c = 0; c < sbml->getNumCompartments(); c++) {
+        mutable_names.insert(sbml->getCompartment(c)->getId());
+    }
+
+    this->folded_symbols.clear();
+    this->optimized_formulas.resize(numReactions);
+
+    for (size_t i = 0; i < numReactions; i++) {
+
+        this->optimized_formulas[i] = reducePowers(this->foldConstants(
+            this->model_data->formulas_vector[i], mutable_names
+        ));
+    }
+
+    // CSE: greedily hoist the parenthesized span repeated most often
+    // across the rewritten set, one pool slot per round. Replacement
+    // happens in the formula text, so a later round sees temp names in
+    // place and nested repeats collapse naturally; refresh order is
+    // creation order, which keeps temp-on-temp references sound
+    this->shared_subexpressions.clear();
+
+    // a span whose '(' belongs to a function call must neither count
+    // nor substitute — exp(x) is not exp followed by (x)
+    auto is_call_paren = [](const std::string& text, size_t open) {
+        return open > 0 &&
+            (std::isalnum(static_cast<unsigned char>(text[open - 1])) ||
+             text[open - 1] == '_');
+    };
+
+    while (this->shared_subexpressions.size() < cse_pool_capacity) {
+
+        std::unordered_map<std::string, size_t> span_counts;
+
+        for (const std::string& formula : this->optimized_formulas) {
+
+            for (size_t open = 0; open < formula.size(); open++) {
+
+                if (formula[open] != '(' || is_call_paren(formula, open)) {
+                    continue;
+                }
+
+                int depth = 0;
+
+                for (size_t close = open; close < formula.size(); close++) {
+
+                    if (formula[close] == '(') depth++;
+                    if (formula[close] == ')') depth--;
+
+                    if (depth == 0) {
+                        span_counts[
+                            formula.substr(open, close - open + 1)]++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // most repeats wins; ties break to the longer span so nested
+        // repeats collapse outside-in. A span with no operator (a bare
+        // identifier in parens) computes nothing worth a slot
+        std::string best;
+        size_t best_count = 1;
+
+        for (const auto& [span, count] : span_counts) {
+
+            if (count < 2 || span.size() < 5 ||
+                span.find_first_of("+-*/^") == std::string::npos) {
+                continue;
+            }
+
+            if (count > best_count ||
+                (count == best_count && span.size() > best.size())) {
+                best = span;
+                best_count = count;
+            }
+        }
+
+        if (best.empty()) {
+            break;
+        }
+
+        SharedSubexpression temp;
+        temp.name =
+            "__cse" + std::to_string(this->shared_subexpressions.size());
+        temp.expression = best;
+        temp.slot = this->cse_pool_base + this->shared_subexpressions.size();
+
+        for (std::string& formula : this->optimized_formulas) {
+
+            size_t at = 0;
+
+            while ((at = formula.find(best, at)) != std::string::npos) {
+
+                if (is_call_paren(formula, at)) {
+                    at++;
+                    continue;
+                }
+
+                formula.replace(at, best.size(), temp.name);
+                at += temp.name.size();
+            }
+        }
+
+        this->shared_subexpressions.push_back(std::move(temp));
+    }
+}
+
+void StochasticModule::compileOptimizedFormulas() {
+
+    size_t numReactions = this->optimized_formulas.size();
+
+    const std::vector<std::vector<std::string>>& formula_tokens =
+        this->model_data->formula_tokens;
+
+    // temps compile and seed their slots first, so the reaction warm
+    // Evals below read real values through them
+    for (size_t k = 0; k < this->shared_subexpressions.size(); k++) {
+
+        SharedSubexpression& temp = this->shared_subexpressions[k];
+
+        temp.parser = mu::Parser();
+        temp.valid = 0;
+
+        try {
+
+            for (const auto& [name, slot] : this->symbol_slots) {
+                temp.parser.DefineVar(name, &this->eval_values[slot]);
+            }
+
+            // earlier temps only — refresh runs in creation order
+            for (size_t e = 0; e < k; e++) {
+                temp.parser.DefineVar(
+                    this->shared_subexpressions[e].name,
+                    &this->eval_values[this->shared_subexpressions[e].slot]
+                );
+            }
+
+            temp.parser.SetExpr(temp.expression);
+
+            this->eval_values[temp.slot] = temp.parser.Eval();
+
+            temp.valid = 1;
+
+        } catch (mu::Parser::exception_type &e) {
+            SC_LOG_ERROR("Error while parsing: " << e.GetMsg());
+            this->eval_values[temp.slot] =
+                std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    this->compiled_formulas.resize(numReactions);
+    this->formula_valid.assign(numReactions, 0);
+
+    for (size_t i = 0; i < numReactions; i++) {
+
+        // re-optimization reaches here with stale bindings; a fresh
+        // parser per formula keeps the pass idempotent
+        this->compiled_formulas[i] = mu::Parser();
+
+        mu::Parser& parser = this->compiled_formulas[i];
+
+        try {
+
+            for (const std::string& token : formula_tokens[i]) {
+
+                auto slot = this->symbol_slots.find(token);
+
+                if (slot != this->symbol_slots.end()) {
+
+                    parser.DefineVar(token, &this->eval_values[slot->second]);
+                }
+            }
+
+            for (const SharedSubexpression& temp :
+                 this->shared_subexpressions) {
+                parser.DefineVar(temp.name, &this->eval_values[temp.slot]);
+            }
+
+            parser.SetExpr(this->optimized_formulas[i]);
+
+            // Force bytecode compilation now: muParser compiles lazily on
+            // the first Eval, which would otherwise race in the parallel
+            // propensity pass. A formula that survives this warm Eval
+            // cannot throw again at runtime, so the hot paths evaluate
+            // without exception frames
+            parser.Eval();
+
+            this->formula_valid[i] = 1;
+
+        } catch (mu::Parser::exception_type &e) {
+            SC_LOG_ERROR("Error while parsing: " << e.GetMsg());
+        }
+    }
+}
+
+void StochasticModule::reoptimizeFormulas(
+    const std::vector<std::string>& ids
+) {
+
+    bool refold_needed = false;
+
+    for (const std::string& id : ids) {
+
+        this->runtime_mutable_symbols.insert(id);
+
+        if (this->folded_symbols.count(id)) {
+            refold_needed = true;
+        }
+    }
+
+    if (!refold_needed) {
+        return;
+    }
+
+    // a literal folded from the old value would silently pin the
+    // parameter; rebuild the optimized set and recompile against the
+    // same slot storage — resolveSymbols does not re-run, no bound
+    // address moves
+    this->optimizeFormulaSet();
+    this->compileOptimizedFormulas();
+
+    this->propensity_cache_valid = false;
+}
+
+void StochasticModule::refreshSharedSubexpressions() {
+
+    for (SharedSubexpression& temp : this->shared_subexpressions) {
+
+        if (temp.valid) {
+            this->eval_values[temp.slot] = temp.parser.Eval();
+        }
+    }
+}
+
+void StochasticModule::classifyFormulaShapes() {
+
+    unsigned int numReactions = sbml->getNumReactions();
+
+    this->product_groups.clear();
+    this->fallback_reactions.clear();
+
+    this->reaction_factor_offset.assign(numReactions, -1);
+    this->reaction_factor_count.assign(numReactions, 0);
+    this->reaction_factor_slots_flat.clear();
+
+    // shape key is just the factor count; group index per count
+    std::unordered_map<size_t, size_t> group_of_count;
+
+    for (unsigned int i = 0; i < numReactions; i++) {
+
+        const std::string& formula_i = this->model_data->formulas_vector[i];
+
+        // anything beyond symbols joined by '*' falls back to muParser
+        if (formula_i.find_first_of("+-/^()") != std::string::npos) {
+
+            this->fallback_reactions.push_back(i);
+            continue;
+        }
+
+        // split on '*' and resolve every factor to an eval_values slot
+        std::vector<unsigned int> slots;
+        bool qualifies = true;
+
+        std::stringstream factors(formula_i);
+        std::string factor;
+
+        while (std::getline(factors, factor, '*')) {
+
+            // trim surrounding whitespace
+            size_t first = factor.find_first_not_of(' ');
+            size_t last = factor.find_last_not_of(' ');
+
+            if (first == std::string::npos) {
+                qualifies = false;
+                break;
+            }
+
+            factor = factor.substr(first, last - first + 1);
+
+            auto slot = this->symbol_slots.find(factor);
+
+            if (slot == this->symbol_slots.end()) {
+                qualifies = false;
+                break;
+            }
+
+            slots.push_back(static_cast<unsigned int>(slot->second));
+        }
+
+        if (!qualifies || slots.empty()) {
+
+            this->fallback_reactions.push_back(i);
+            continue;
+        }
+
+        auto group_it = group_of_count.find(slots.size());
+
+        if (group_it == group_of_count.end()) {
+
+            group_it = group_of_count.emplace(
+                slots.size(), this->product_groups.size()
+            ).first;
+
+            this->product_groups.push_back({ slots.size(), {}, {} });
+        }
+
+        ProductGroup& group = this->product_groups[group_it->second];
+
+        group.reactions.push_back(i);
+        group.factor_slots.insert(
+            group.factor_slots.end(), slots.begin(), slots.end()
+        );
+
+        // flat per-reaction span for scalar re-evaluation of dirty members
+        this->reaction_factor_offset[i] =
+            static_cast<int>(this->reaction_factor_slots_flat.size());
+        this->reaction_factor_count[i] =
+            static_cast<unsigned int>(slots.size());
+        this->reaction_factor_slots_flat.insert(
+            this->reaction_factor_slots_flat.end(), slots.begin(), slots.end()
+        );
+    }
+}
+
+void StochasticModule::resolveSymbols(
+    const std::vector<std::vector<std::string>>& formula_tokens
+) {
+
+    // Pass 1: classify each unique token through libSBML, exactly once
+    for (const auto& tokens_i : formula_tokens) {
+
+        for (const std::string& token : tokens_i) {
+
+            if (this->symbol_slots.count(token)) {
+                continue;
+            }
+
+            // Check if in SBML as Parameter || Species || Compartment;
+            if (sbml->getParameter(token) != nullptr ||
+                sbml->getSpecies(token) != nullptr ||
+                sbml->getCompartment(token) != nullptr) {
+
+                this->symbol_slots[token] = this->symbol_slots.size();
+            }
+        }
+    }
+
+    // Rule and event formulas compile through the same pipeline, so
+    // their symbols — and their target variables, referenced by another
+    // formula or not — claim slots now, before any parser binds an
+    // address into the storage
+    auto claimToken = [this](const std::string& token) {
+
+        if (this->symbol_slots.count(token)) {
+            return;
+        }
+
+        if (sbml->getParameter(token) != nullptr ||
+            sbml->getSpecies(token) != nullptr ||
+            sbml->getCompartment(token) != nullptr) {
+
+            this->symbol_slots[token] = this->symbol_slots.size();
+        }
+    };
+
+    for (const auto& rule : this->rule_specs) {
+
+        claimToken(rule.variable);
+
+        for (const std::string& token : tokenizeRuleFormula(rule.formula)) {
+            claimToken(token);
+        }
+    }
+
+    for (const auto& event : this->event_specs) {
+
+        for (const std::string& token :
+             tokenizeRuleFormula(event.trigger_formula)) {
+            claimToken(token);
+        }
+
+        for (const auto& [variable, formula] : event.assignments) {
+
+            claimToken(variable);
+
+            for (const std::string& token : tokenizeRuleFormula(formula)) {
+                claimToken(token);
+            }
+        }
+    }
+
+    // Pass 2: size the storage once, then fill in resolved values
+    this->eval_values.resize(this->symbol_slots.size());
+
+    for (const auto& [name, slot] : this->symbol_slots) {
+
+        if (sbml->getParameter(name) != nullptr) {
+            this->eval_values[slot] = sbml->getParameter(name)->getValue();
+        } else if (sbml->getSpecies(name) != nullptr) {
+            this->eval_values[slot] = sbml->getSpecies(name)->getInitialConcentration();
+        } else if (sbml->getCompartment(name) != nullptr) {
+            this->eval_values[slot] = sbml->getCompartment(name)->getVolume();
+        }
+    }
+
+    // Record species slots by index, so per-step refresh is index-based
+    std::vector<std::string> speciesIds = this->handler.getSpeciesIds();
+
+    this->species_slots.assign(speciesIds.size(), -1);
+
+    for (size_t s = 0; s < speciesIds.size(); s++) {
+
+        auto slot = this->symbol_slots.find(speciesIds[s]);
+
+        if (slot != this->symbol_slots.end()) {
+            this->species_slots[s] = static_cast<int>(slot->second);
+        }
+    }
+}
+
+void StochasticModule::compileRulesAndEvents() {
+
+    if (this->rule_specs.empty() && this->event_specs.empty()) {
+        return;
+    }
+
+    // one binding pass per formula, same as the rate-law compiler; the
+    // SBML time csymbol binds to the step-boundary clock
+    auto bindParser = [this](mu::Parser& parser, const std::string& formula) {
+
+        for (const std::string& token : tokenizeRuleFormula(formula)) {
+
+            auto slot = this->symbol_slots.find(token);
+
+            if (slot != this->symbol_slots.end()) {
+                parser.DefineVar(token, &this->eval_values[slot->second]);
+
+            } else if (token == "time" || token == "t") {
+                parser.DefineVar(token, &this->rule_clock);
+            }
+        }
+
+        parser.SetExpr(formula);
+    };
+
+    // resolve a target variable to its eval slot and, for species, the
+    // state index the boundary pass writes through
+    const std::vector<std::string>& species_ids =
+        this->handler.getSpeciesIds();
+
+    auto resolveTarget = [&](
+        const std::string& variable, size_t& slot_out, int& species_out
+    ) {
+
+        auto slot = this->symbol_slots.find(variable);
+
+        if (slot == this->symbol_slots.end()) {
+
+            SC_LOG_WARN(
+                "Rule/event target '" << variable
+                    << "' not found in model; target skipped"
+            );
+            return false;
+        }
+
+        slot_out = slot->second;
+
+        auto position = std::find(
+            species_ids.begin(), species_ids.end(), variable
+        );
+
+        species_out = position != species_ids.end()
+            ? static_cast<int>(std::distance(species_ids.begin(), position))
+            : -1;
+
+        return true;
+    };
+
+    // partition the specs, keeping document order within each kind
+    std::vector<size_t> assignment_order;
+    std::vector<size_t> rate_order;
+
+    for (size_t i = 0; i < this->rule_specs.size(); i++) {
+
+        if (this->rule_specs[i].is_rate) {
+            rate_order.push_back(i);
+        } else {
+            assignment_order.push_back(i);
+        }
+    }
+
+    // dependency-order the assignment rules: an edge runs from a rule to
+    // every rule whose formula reads its variable, and Kahn's algorithm
+    // with an in-order scan keeps the result stable. Rules a reference
+    // cycle traps fall back to document order, reported once
+    size_t num_assignments = assignment_order.size();
+
+    std::unordered_map<std::string, size_t> rule_of_variable;
+
+    for (size_t i = 0; i < num_assignments; i++) {
+        rule_of_variable[
+            this->rule_specs[assignment_order[i]].variable] = i;
+    }
+
+    std::vector<std::vector<size_t>> dependents(num_assignments);
+    std::vector<size_t> num_inputs(num_assignments, 0);
+
+    for (size_t i = 0; i < num_assignments; i++) {
+
+        const std::string& formula =
+            this->rule_specs[assignment_order[i]].formula;
+
+        for (const std::string& token : tokenizeRuleFormula(formula)) {
+
+            auto source = rule_of_variable.find(token);
+
+            if (source != rule_of_variable.end() && source->second != i) {
+                dependents[source->second].push_back(i);
+                num_inputs[i]++;
+            }
+        }
+    }
+
+    std::vector<size_t> sorted;
+    sorted.reserve(num_assignments);
+
+    for (size_t i = 0; i < num_assignments; i++) {
+        if (num_inputs[i] == 0) {
+            sorted.push_back(i);
+        }
+    }
+
+    for (size_t head = 0; head < sorted.size(); head++) {
+
+        for (size_t next : dependents[sorted[head]]) {
+
+            if (--num_inputs[next] == 0) {
+                sorted.push_back(next);
+            }
+        }
+    }
+
+    if (sorted.size() < num_assignments) {
+
+        SC_LOG_WARN(
+            "Assignment rules form a reference cycle; "
+                << (num_assignments - sorted.size())
+                << " rule(s) evaluate in document order"
+        );
+
+        for (size_t i = 0; i < num_assignments; i++) {
+            if (num_inputs[i] > 0) {
+                sorted.push_back(i);
+            }
+        }
+    }
+
+    // compile the assignment rules in evaluation order; the warm Eval
+    // both forces bytecode compilation (as in compileFormulas) and
+    // seeds the target slot with its initial derived value, so the
+    // first step's propensities already see a consistent context
+    for (size_t i : sorted) {
+
+        const SBMLHandler::RuleSpec& spec =
+            this->rule_specs[assignment_order[i]];
+
+        CompiledRule rule;
+
+        if (!resolveTarget(
+                spec.variable, rule.target_slot, rule.target_species)) {
+            continue;
+        }
+
+        try {
+
+            bindParser(rule.parser, spec.formula);
+
+            this->eval_values[rule.target_slot] = rule.parser.Eval();
+
+        } catch (mu::Parser::exception_type& e) {
+            SC_LOG_ERROR("Error while parsing rule: " << e.GetMsg());
+            continue;
+        }
+
+        this->assignment_rules.push_back(std::move(rule));
+    }
+
+    // rate rules only warm-compile; integration starts with the run
+    for (size_t i : rate_order) {
+
+        const SBMLHandler::RuleSpec& spec = this->rule_specs[i];
+
+        CompiledRule rule;
+
+        if (!resolveTarget(
+                spec.variable, rule.target_slot, rule.target_species)) {
+            continue;
+        }
+
+        try {
+
+            bindParser(rule.parser, spec.formula);
+
+            rule.parser.Eval();
+
+        } catch (mu::Parser::exception_type& e) {
+            SC_LOG_ERROR("Error while parsing rule: " << e.GetMsg());
+            continue;
+        }
+
+        this->rate_rules.push_back(std::move(rule));
+    }
+
+    // events: the warm trigger Eval doubles as the arming baseline, so a
+    // trigger already true in the initial context never fires spuriously
+    for (const SBMLHandler::EventSpec& spec : this->event_specs) {
+
+        CompiledEvent event;
+
+        try {
+
+            bindParser(event.trigger, spec.trigger_formula);
+
+            event.trigger_was_true = event.trigger.Eval() != 0.0;
+
+        } catch (mu::Parser::exception_type& e) {
+            SC_LOG_ERROR("Error while parsing trigger: " << e.GetMsg());
+            continue;
+        }
+
+        for (const auto& [variable, formula] : spec.assignments) {
+
+            size_t target_slot = 0;
+            int target_species = -1;
+
+            if (!resolveTarget(variable, target_slot, target_species)) {
+                continue;
+            }
+
+            mu::Parser parser;
+
+            try {
+
+                bindParser(parser, formula);
+
+                parser.Eval();
+
+            } catch (mu::Parser::exception_type& e) {
+                SC_LOG_ERROR(
+                    "Error while parsing event assignment: " << e.GetMsg()
+                );
+                continue;
+            }
+
+            event.assignments.push_back(std::move(parser));
+            event.target_slots.push_back(target_slot);
+            event.target_species.push_back(target_species);
+        }
+
+        this->compiled_events.push_back(std::move(event));
+    }
+
+    this->rules_active = !this->assignment_rules.empty() ||
+        !this->rate_rules.empty() ||
+        !this->compiled_events.empty();
+
+    // construction scaffolding only
+    this->rule_specs.clear();
+    this->event_specs.clear();
+}
+
+void StochasticModule::applyRulesAndEvents(
+    int step
+) {
+
+    size_t numSpecies = this->current_state.size();
+
+    // refresh the species slots to the step's end state in per-volume
+    // units, the same context the rate laws evaluate in
+    for (size_t s = 0; s < numSpecies; s++) {
+
+        if (this->species_slots[s] >= 0) {
+            this->eval_values[this->species_slots[s]] =
+                this->current_state[s] *
+                    this->nM2mpv_conversion_factors[s];
+        }
+    }
+
+    // row `step` records time step * delta_t
+    this->rule_clock = static_cast<double>(step) * this->delta_t;
+
+    bool species_dirty = false;
+
+    // species targets write in nM — the recorded and exchanged unit —
+    // with the slot mirrored in per-volume units
+    auto writeTarget = [&](size_t slot, int species, double value) {
+
+        if (species >= 0) {
+
+            this->current_state[species] = value;
+
+            this->eval_values[slot] =
+                value * this->nM2mpv_conversion_factors[species];
+
+            species_dirty = true;
+
+        } else {
+            this->eval_values[slot] = value;
+        }
+    };
+
+    // assignment rules, in dependency order
+    for (CompiledRule& rule : this->assignment_rules) {
+        writeTarget(
+            rule.target_slot, rule.target_species, rule.parser.Eval()
+        );
+    }
+
+    // rate rules: one forward-Euler span over the co-simulation interval
+    for (CompiledRule& rule : this->rate_rules) {
+
+        double derivative = rule.parser.Eval();
+
+        double current = rule.target_species >= 0
+            ? this->current_state[rule.target_species]
+            : this->eval_values[rule.target_slot];
+
+        writeTarget(
+            rule.target_slot, rule.target_species,
+            current + this->delta_t * derivative
+        );
+    }
+
+    // events fire on the false -> true edge of their trigger
+    for (CompiledEvent& event : this->compiled_events) {
+
+        bool is_true = event.trigger.Eval() != 0.0;
+
+        bool fire = is_true && !event.trigger_was_true;
+
+        event.trigger_was_true = is_true;
+
+        if (!fire) {
+            continue;
+        }
+
+        for (size_t a = 0; a < event.assignments.size(); a++) {
+            writeTarget(
+                event.target_slots[a],
+                event.target_species[a],
+                event.assignments[a].Eval()
+            );
+        }
+    }
+
+    // the slots moved under the cached propensities; the next
+    // computeReactions call re-baselines with a full pass
+    this->propensity_cache_valid = false;
+
+    if (species_dirty) {
+
+        // overwrite the step's recorded row with the post-rule state
+        BaseModule::recordCurrentState(step);
+    }
+}
+
+void StochasticModule::setRuntimePartitioning(
+    double fast_mean_threshold,
+    int repartition_interval
+) {
+    this->fast_mean_threshold = fast_mean_threshold;
+    this->repartition_interval = std::max(repartition_interval, 1);
+    this->leaps_since_repartition = 0;
+    this->reaction_is_fast.clear();
+}
+
+void StochasticModule::setPartitionedStepping(
+    int num_threads
+) {
+
+    this->partition_threads = std::max(num_threads, 1);
+
+    this->partition_reactions.clear();
+    this->partition_species.clear();
+
+    if (this->partition_threads > 1) {
+        this->buildPartitions();
+    }
+}
+
+void StochasticModule::buildPartitions() {
+
+    size_t numSpecies = this->stoich_rows.num_rows;
+    size_t numReactions = this->stoich_cols.num_rows;
+
+    // union-find over species with path halving: every reaction unites
+    // the species it touches, so roots identify the network's
+    // connected components
+    std::vector<unsigned int> parent(numSpecies);
+
+    for (size_t s = 0; s < numSpecies; s++) {
+        parent[s] = static_cast<unsigned int>(s);
+    }
+
+    auto find = [&](unsigned int s) {
+
+        while (parent[s] != s) {
+            parent[s] = parent[parent[s]];
+            s = parent[s];
+        }
+
+        return s;
+    };
+
+    for (size_t i = 0; i < numReactions; i++) {
+
+        size_t first = this->stoich_cols.row_ptr[i];
+        size_t last = this->stoich_cols.row_ptr[i + 1];
+
+        for (size_t e = first + 1; e < last; e++) {
+            parent[find(this->stoich_cols.col_idx[e])] =
+                find(this->stoich_cols.col_idx[first]);
+        }
+    }
+
+    // gather per-component reaction and species lists
+    std::unordered_map<unsigned int, size_t> component_index;
+    std::vector<std::vector<unsigned int>> component_reactions;
+    std::vector<std::vector<unsigned int>> component_species;
+
+    auto componentOf = [&](unsigned int root) {
+
+        auto it = component_index.find(root);
+
+        if (it != component_index.end()) {
+            return it->second;
+        }
+
+        component_index[root] = component_reactions.size();
+        component_reactions.emplace_back();
+        component_species.emplace_back();
+
+        return component_reactions.size() - 1;
+    };
+
+    for (size_t s = 0; s < numSpecies; s++) {
+        component_species[componentOf(find(static_cast<unsigned int>(s)))]
+            .push_back(static_cast<unsigned int>(s));
+    }
+
+    for (size_t i = 0; i < numReactions; i++) {
+
+        size_t first = this->stoich_cols.row_ptr[i];
+
+        // reactions touching no species (source-only inputs) go to the
+        // first component; their updates cannot conflict anywhere
+        size_t component = first < this->stoich_cols.row_ptr[i + 1]
+            ? componentOf(find(this->stoich_cols.col_idx[first]))
+            : componentOf(find(0));
+
+        component_reactions[component].push_back(static_cast<unsigned int>(i));
+    }
+
+    if (component_reactions.size() < 2) {
+        // one strongly-connected network: nothing to run in parallel
+        return;
+    }
+
+    // greedy balance: biggest components first, each onto the lightest
+    // group, so group reaction counts stay within one component of even
+    size_t num_groups = std::min(
+        static_cast<size_t>(this->partition_threads),
+        component_reactions.size()
+    );
+
+    std::vector<size_t> order(component_reactions.size());
+
+    for (size_t c = 0; c < order.size(); c++) {
+        order[c] = c;
+    }
+
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return component_reactions[a].size() > component_reactions[b].size();
+    });
+
+    this->partition_reactions.assign(num_groups, {});
+    this->partition_species.assign(num_groups, {});
+
+    std::vector<size_t> group_load(num_groups, 0);
+
+    for (size_t c : order) {
+
+        size_t lightest = 0;
+
+        for (size_t g = 1; g < num_groups; g++) {
+
+            if (group_load[g] < group_load[lightest]) {
+                lightest = g;
+            }
+        }
+
+        this->partition_reactions[lightest].insert(
+            this->partition_reactions[lightest].end(),
+            component_reactions[c].begin(), component_reactions[c].end()
+        );
+        this->partition_species[lightest].insert(
+            this->partition_species[lightest].end(),
+            component_species[c].begin(), component_species[c].end()
+        );
+
+        group_load[lightest] += component_reactions[c].size();
+    }
+}
+
+void StochasticModule::setAdaptiveTau(
+    double epsilon
+) {
+    this->adaptive_tau_epsilon = epsilon;
+}
+
+void StochasticModule::setLeapInterval(
+    double leap_seconds
+) {
+    this->fixed_leap_dt = std::max(leap_seconds, 0.0);
+}
+
+void StochasticModule::setConservationElimination(
+    bool enable
+) {
+
+    this->conservation_elimination = enable;
+}
+
+void StochasticModule::findConservationLaws() {
+
+    this->conservation_analyzed = true;
+
+    size_t numSpecies = this->stoich_rows.num_rows;
+    size_t numReactions = this->stoich_rows.num_cols;
+
+    // dense elimination is O(n^2 m); past this the load-time cost stops
+    // being a blip, and such models gain more from partitioned stepping
+    constexpr size_t kMaxAnalyzedSpecies = 512;
+    constexpr double kZeroTolerance = 1e-9;
+
+    if (numSpecies == 0 || numSpecies > kMaxAnalyzedSpecies) {
+        return;
+    }
+
+    // dense working copy of the stoichiometry, augmented with an
+    // identity tracker: every row operation applies to both, so a row
+    // that eliminates to zero leaves its conservation coefficients in
+    // the tracker
+    std::vector<double> matrix(numSpecies * numReactions, 0.0);
+    std::vector<double> tracker(numSpecies * numSpecies, 0.0);
+
+    for (size_t s = 0; s < numSpecies; s++) {
+
+        for (size_t n = this->stoich_rows.row_ptr[s];
+             n < this->stoich_rows.row_ptr[s + 1]; n++) {
+            matrix[s * numReactions + this->stoich_rows.col_idx[n]] =
+                this->stoich_rows.values[n];
+        }
+
+        tracker[s * numSpecies + s] = 1.0;
+    }
+
+    size_t pivot_row = 0;
+
+    for (size_t col = 0; col < numReactions && pivot_row < numSpecies;
+         col++) {
+
+        // partial pivoting keeps the elimination stable against the
+        // small integer stoichiometries' cancellations
+        size_t best = pivot_row;
+
+        for (size_t r = pivot_row + 1; r < numSpecies; r++) {
+
+            if (std::abs(matrix[r * numReactions + col]) >
+                std::abs(matrix[best * numReactions + col])) {
+                best = r;
+            }
+        }
+
+        if (std::abs(matrix[best * numReactions + col]) < kZeroTolerance) {
+            continue;
+        }
+
+        if (best != pivot_row) {
+
+            for (size_t c = 0; c < numReactions; c++) {
+                std::swap(matrix[pivot_row * numReactions + c],
+                          matrix[best * numReactions + c]);
+            }
+
+            for (size_t c = 0; c < numSpecies; c++) {
+                std::swap(tracker[pivot_row * numSpecies + c],
+                          tracker[best * numSpecies + c]);
+            }
+        }
+
+        double pivot = matrix[pivot_row * numReactions + col];
+
+        for (size_t r = pivot_row + 1; r < numSpecies; r++) {
+
+            double factor = matrix[r * numReactions + col] / pivot;
+
+            if (factor == 0.0) {
+                continue;
+            }
+
+            for (size_t c = col; c < numReactions; c++) {
+                matrix[r * numReactions + c] -=
+                    factor * matrix[pivot_row * numReactions + c];
+            }
+
+            for (size_t c = 0; c < numSpecies; c++) {
+                tracker[r * numSpecies + c] -=
+                    factor * tracker[pivot_row * numSpecies + c];
+            }
+        }
+
+        pivot_row++;
+    }
+
+    // every zero row's tracker entries are one conserved moiety; claim
+    // one dependent species per law, never the same species twice
+    std::vector<char> already_dependent(numSpecies, 0);
+
+    for (size_t r = pivot_row; r < numSpecies; r++) {
+
+        bool row_zero = true;
+
+        for (size_t c = 0; c < numReactions; c++) {
+
+            if (std::abs(matrix[r * numReactions + c]) > kZeroTolerance) {
+                row_zero = false;
+                break;
+            }
+        }
+
+        if (!row_zero) {
+            continue;
+        }
+
+        // scale so the smallest coefficient is one; the laws this pass
+        // targets (total receptor = free + bound) come out integral
+        double smallest = 0.0;
+
+        for (size_t s = 0; s < numSpecies; s++) {
+
+            double coeff = std::abs(tracker[r * numSpecies + s]);
+
+            if (coeff > kZeroTolerance &&
+                (smallest == 0.0 || coeff < smallest)) {
+                smallest = coeff;
+            }
+        }
+
+        if (smallest == 0.0) {
+            continue;
+        }
+
+        // the member with the heaviest CSR row buys the most skipped
+        // gather work when it goes dependent
+        ConservationLaw law;
+        law.dependent_species = numSpecies;
+
+        size_t heaviest = 0;
+
+        for (size_t s = 0; s < numSpecies; s++) {
+
+            double coeff = tracker[r * numSpecies + s] / smallest;
+
+            if (std::abs(coeff) <= kZeroTolerance) {
+                continue;
+            }
+
+            law.terms.push_back({ s, coeff });
+
+            size_t row_weight = this->stoich_rows.row_ptr[s + 1]
+                - this->stoich_rows.row_ptr[s];
+
+            if (!already_dependent[s] && row_weight >= heaviest &&
+                row_weight > 0) {
+                heaviest = row_weight;
+                law.dependent_species = s;
+            }
+        }
+
+        if (law.dependent_species == numSpecies || law.terms.size() < 2) {
+            continue;
+        }
+
+        // pull the dependent out of the term list; what remains is the
+        // independent sum each recovery subtracts from the total
+        for (size_t i = 0; i < law.terms.size(); i++) {
+
+            if (law.terms[i].first == law.dependent_species) {
+                law.dependent_coefficient = law.terms[i].second;
+                law.terms.erase(law.terms.begin() + i);
+                break;
+            }
+        }
+
+        already_dependent[law.dependent_species] = 1;
+        this->conservation_laws.push_back(std::move(law));
+    }
+
+    if (this->conservation_laws.empty()) {
+        return;
+    }
+
+    // compact both CSR orientations: the dependent species' delta
+    // gather rows empty out and the reaction-major scatter drops their
+    // entries, so every later leap skips that work outright
+    std::vector<SparseMatrix::Triplet> kept;
+    kept.reserve(this->stoich_rows.values.size());
+
+    for (size_t s = 0; s < numSpecies; s++) {
+
+        if (already_dependent[s]) {
+            continue;
+        }
+
+        for (size_t n = this->stoich_rows.row_ptr[s];
+             n < this->stoich_rows.row_ptr[s + 1]; n++) {
+            kept.push_back({
+                static_cast<unsigned int>(s),
+                this->stoich_rows.col_idx[n],
+                this->stoich_rows.values[n]
+            });
+        }
+    }
+
+    size_t dropped = this->stoich_rows.values.size() - kept.size();
+
+    this->stoich_rows = SparseMatrix::fromTriplets(
+        numSpecies, numReactions, kept
+    );
+
+    for (auto& entry : kept) {
+        std::swap(entry.row, entry.col);
+    }
+
+    this->stoich_cols = SparseMatrix::fromTriplets(
+        numReactions, numSpecies, kept
+    );
+
+    SC_LOG_INFO("conservation analysis for module " << this->algorithm_id
+        << ": " << this->conservation_laws.size() << " law(s), "
+        << dropped << " stoichiometric entries eliminated");
+
+    RunMetadata::set(
+        "conservation." + this->algorithm_id,
+        std::to_string(this->conservation_laws.size()) + " laws, "
+            + std::to_string(dropped) + " entries dropped"
+    );
+}
+
+void StochasticModule::captureConservationTotals(
+    const double* state_molecules
+) {
+
+    for (ConservationLaw& law : this->conservation_laws) {
+
+        double total = law.dependent_coefficient
+            * state_molecules[law.dependent_species];
+
+        for (const auto& [species, coefficient] : law.terms) {
+            total += coefficient * state_molecules[species];
+        }
+
+        law.total = total;
+    }
+}
+
+void StochasticModule::applyConservationLaws(
+    double* state_molecules
+) {
+
+    for (const ConservationLaw& law : this->conservation_laws) {
+
+        double remainder = law.total;
+
+        for (const auto& [species, coefficient] : law.terms) {
+            remainder -= coefficient * state_molecules[species];
+        }
+
+        // whole molecules, clamped like the direct update: a clamp on
+        // an independent member can push the remainder negative
+        double value = std::round(
+            remainder / law.dependent_coefficient
+        );
+
+        state_molecules[law.dependent_species] =
+            value > 0.0 ? value : 0.0;
+    }
+}
+
+void StochasticModule::setParallelPropensityThreshold(
+    size_t threshold
+) {
+
+    this->parallel_propensity_threshold = threshold;
+}
+
+void StochasticModule::setKernelAutotune(
+    bool enable
+) {
+
+    this->autotune_kernels = enable;
+}
+
+void StochasticModule::applyKernelConfig(
+    const KernelTuner::Config& config
+) {
+
+    this->use_incremental_propensities = config.incremental_propensities;
+    this->scatter_state_update = config.scatter_state_update;
+    this->ptrs_mean_cutoff = config.ptrs_mean_cutoff;
+
+    // the timing verdict covers this model's fallback set specifically,
+    // so the count heuristic collapses to always or never
+    this->parallel_propensity_threshold = config.parallel_propensities
+        ? 1
+        : std::numeric_limits<size_t>::max();
+
+    // tuned and default dispatch both funnel through here, so the
+    // resolved choices land in every output file's provenance block
+    RunMetadata::set(
+        "kernels." + this->algorithm_id,
+        std::string(config.incremental_propensities ? "incremental" : "full")
+            + (config.parallel_propensities ? "+parallel" : "")
+            + (config.scatter_state_update ? "+scatter" : "+gather")
+    );
+}
+
+void StochasticModule::autotuneKernels() {
+
+    this->kernels_tuned = true;
+
+    uint64_t model_hash =
+        this->model_data ? this->model_data->source_hash : 0;
+
+    std::string tune_path = this->handler.source_path + ".sctune";
+
+    KernelTuner::Config config;
+
+    // a persisted verdict for this model revision and host wins outright
+    if (KernelTuner::load(tune_path, model_hash, config)) {
+
+        this->applyKernelConfig(config);
+
+        SC_LOG_INFO("kernel dispatch for module " << this->algorithm_id
+            << " loaded from " << tune_path);
+
+        return;
+    }
+
+    size_t numReactions = this->compiled_formulas.size();
+
+    std::vector<double> state_nM = this->handler.getInitialState();
+    size_t numSpecies = state_nM.size();
+
+    if (numReactions == 0 || numSpecies == 0) {
+        return;
+    }
+
+    // candidate kernels run against the real initial state in the units
+    // the hot path uses
+    std::vector<double> state_mpv(numSpecies);
+    std::vector<double> state_molecules(numSpecies);
+
+    for (size_t s = 0; s < numSpecies; s++) {
+        state_mpv[s] = state_nM[s] * this->nM2mpv_conversion_factors[s];
+        state_molecules[s] =
+            state_nM[s] * this->nM2molecules_conversion_factors[s];
+    }
+
+    std::vector<double> propensities(numReactions);
+    std::vector<double> realizations(numReactions);
+
+    const int warmup = 256;
+
+    // full propensity pass, serial and (when available) parallel; the
+    // incremental machinery is held off so every iteration pays the
+    // group kernels and the fallback loop
+    auto timeFullPass = [&](size_t threshold) {
+
+        size_t saved_threshold = this->parallel_propensity_threshold;
+        this->parallel_propensity_threshold = threshold;
+        this->use_incremental_propensities = false;
+
+        auto pass_start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < warmup; i++) {
+            this->computeReactions(
+                state_mpv.data(), numSpecies, propensities.data()
+            );
+        }
+
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - pass_start;
+
+        this->parallel_propensity_threshold = saved_threshold;
+        this->use_incremental_propensities = true;
+
+        return elapsed.count();
+    };
+
+    double serial_seconds =
+        timeFullPass(std::numeric_limits<size_t>::max());
+
+    double full_seconds = serial_seconds;
+
+#ifdef _OPENMP
+    if (!this->fallback_reactions.empty()) {
+
+        double parallel_seconds = timeFullPass(1);
+
+        config.parallel_propensities = parallel_seconds < serial_seconds;
+        full_seconds = std::min(serial_seconds, parallel_seconds);
+    }
+#else
+    config.parallel_propensities = false;
+#endif
+
+    // incremental pass: seed the cache, then perturb a sliver of the
+    // species each iteration, the firing pattern of a quiescent leap
+    this->propensity_cache_valid = false;
+    this->computeReactions(
+        state_mpv.data(), numSpecies, propensities.data()
+    );
+
+    size_t dirty_species = std::max<size_t>(1, numSpecies / 16);
+
+    auto incremental_start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < warmup; i++) {
+
+        for (size_t d = 0; d < dirty_species; d++) {
+            size_t s = (static_cast<size_t>(i) + d * 16) % numSpecies;
+            state_mpv[s] *= 1.0 + 1e-9;
+        }
+
+        this->computeReactions(
+            state_mpv.data(), numSpecies, propensities.data()
+        );
+    }
+
+    std::chrono::duration<double> incremental_elapsed =
+        std::chrono::steady_clock::now() - incremental_start;
+
+    config.incremental_propensities =
+        incremental_elapsed.count() < full_seconds;
+
+    // sampling crossover: the cached distribution against PTRS at a
+    // moderate mean; the loser's regime shrinks. Counter-RNG blocks are
+    // keyed per step, so these draws cannot shift the run's streams
+    const int draws = warmup * 64;
+    const double probe_mean = 15.0;
+
+    std::poisson_distribution<int> probe_dist(probe_mean);
+    double sink = 0.0;
+
+    auto dist_start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < draws; i++) {
+        sink += probe_dist(this->generator);
+    }
+
+    std::chrono::duration<double> dist_elapsed =
+        std::chrono::steady_clock::now() - dist_start;
+
+    auto ptrs_start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < draws; i++) {
+        sink += this->samplePoissonPTRS(probe_mean, this->uniform_pool);
+    }
+
+    std::chrono::duration<double> ptrs_elapsed =
+        std::chrono::steady_clock::now() - ptrs_start;
+
+    (void)sink;
+
+    config.ptrs_mean_cutoff =
+        ptrs_elapsed.count() < dist_elapsed.count() ? 10.0 : 50.0;
+
+    // state update: species-major gather against reaction-major scatter,
+    // fed one real sampled realization vector
+    this->step_arena.reset();
+    this->samplePoisson(
+        propensities.data(), numReactions, this->delta_t,
+        realizations.data()
+    );
+
+    std::vector<double> new_state(numSpecies);
+
+    auto timeStateUpdate = [&](bool scatter) {
+
+        this->scatter_state_update = scatter;
+
+        auto update_start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < warmup; i++) {
+
+            this->step_arena.reset();
+
+            this->computeNewState(
+                state_molecules.data(), numSpecies, realizations.data(),
+                new_state.data()
+            );
+        }
+
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - update_start;
+
+        return elapsed.count();
+    };
+
+    double gather_seconds = timeStateUpdate(false);
+    double scatter_seconds = timeStateUpdate(true);
+
+    config.scatter_state_update = scatter_seconds < gather_seconds;
+
+    // the benchmark perturbed the cached state; the run starts clean
+    this->propensity_cache_valid = false;
+    this->step_arena.reset();
+    this->negative_clamp_events = 0;
+
+    this->applyKernelConfig(config);
+
+    KernelTuner::save(tune_path, model_hash, config);
+
+    SC_LOG_INFO("kernel autotune for module " << this->algorithm_id
+        << ": " << (config.incremental_propensities ? "incremental" : "full")
+        << " propensities, "
+        << (config.parallel_propensities ? "parallel" : "serial")
+        << " fallback, "
+        << (config.scatter_state_update ? "scatter" : "gather")
+        << " state update, ptrs cutoff " << config.ptrs_mean_cutoff);
+}
+
+void StochasticModule::setReactionPruning(
+    const std::vector<char>& keep_reactions
+) {
+
+    this->pruned_reactions.clear();
+
+    size_t numReactions = this->compiled_formulas.size();
+
+    if (keep_reactions.size() != numReactions) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < numReactions; i++) {
+
+        if (!keep_reactions[i]) {
+            this->pruned_reactions.push_back(i);
+        }
+    }
+
+    if (this->pruned_reactions.empty()) {
+        return;
+    }
+
+    // pruned members leave the gather-multiply kernels in place
+    for (auto& group : this->product_groups) {
+
+        size_t kept = 0;
+
+        for (size_t m = 0; m < group.reactions.size(); m++) {
+
+            if (!keep_reactions[group.reactions[m]]) {
+                continue;
+            }
+
+            group.reactions[kept] = group.reactions[m];
+
+            for (size_t f = 0; f < group.num_factors; f++) {
+                group.factor_slots[kept * group.num_factors + f] =
+                    group.factor_slots[m * group.num_factors + f];
+            }
+
+            kept++;
+        }
+
+        group.reactions.resize(kept);
+        group.factor_slots.resize(kept * group.num_factors);
+    }
+
+    size_t kept_fallback = 0;
+
+    for (unsigned int r : this->fallback_reactions) {
+
+        if (keep_reactions[r]) {
+            this->fallback_reactions[kept_fallback++] = r;
+        }
+    }
+
+    this->fallback_reactions.resize(kept_fallback);
+
+    // rebuild the reader CSR without pruned entries, so the incremental
+    // path never re-dirties a pruned reaction
+    std::vector<unsigned int> kept_readers;
+
+    kept_readers.reserve(this->reader_reactions.size());
+
+    size_t row_start = this->reader_row_ptr.empty()
+        ? 0
+        : this->reader_row_ptr[0];
+
+    for (size_t s = 0; s + 1 < this->reader_row_ptr.size(); s++) {
+
+        size_t row_end = this->reader_row_ptr[s + 1];
+
+        this->reader_row_ptr[s] = kept_readers.size();
+
+        for (size_t e = row_start; e < row_end; e++) {
+
+            if (keep_reactions[this->reader_reactions[e]]) {
+                kept_readers.push_back(this->reader_reactions[e]);
+            }
+        }
+
+        row_start = row_end;
+    }
+
+    if (!this->reader_row_ptr.empty()) {
+        this->reader_row_ptr.back() = kept_readers.size();
+    }
+
+    this->reader_reactions = std::move(kept_readers);
+
+    // the cache may hold pre-prune values; the next pass re-baselines
+    this->propensity_cache_valid = false;
+}
+
+void StochasticModule::setRandomSeed(
+    unsigned long long seed
+) {
+
+    this->generator.seed(seed);
+    this->uniform_pool.invalidate();
+}
+
+void StochasticModule::reportEntityProfile(
+    std::ostream& out
+) {
+
+    if (!this->entity_profiling || this->reaction_eval_seconds.empty()) {
+        return;
+    }
+
+    size_t numReactions = this->reaction_eval_seconds.size();
+
+    this->reaction_firings.resize(numReactions, 0.0);
+
+    // rank by accumulated evaluation time, worst first; that ordering is
+    // the list of rate laws worth simplifying
+    std::vector<size_t> order(numReactions);
+
+    for (size_t i = 0; i < numReactions; i++) {
+        order[i] = i;
+    }
+
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return this->reaction_eval_seconds[a] > this->reaction_eval_seconds[b];
+    });
+
+    const std::vector<std::string>& ids = this->handler.getReactionIds();
+
+    out << "module " << this->algorithm_id
+        << ": reactions ranked by evaluation time\n";
+    out << "rank\treaction\teval_seconds\tfirings\n";
+
+    for (size_t rank = 0; rank < order.size(); rank++) {
+
+        size_t i = order[rank];
+
+        out << (rank + 1) << '\t'
+            << (i < ids.size() ? ids[i] : std::to_string(i)) << '\t'
+            << this->reaction_eval_seconds[i] << '\t'
+            << this->reaction_firings[i] << '\n';
+    }
+
+    // a nonzero tally means constrainTau's per-reaction bounds missed a
+    // combined drain and the update policy clamped the species at zero
+    out << "negative_clamp_events\t" << this->negative_clamp_events << '\n';
+}
+
+std::string StochasticModule::getRngState() {
+
+    // the counter generator streams its (key, block, counter) triple
+    std::ostringstream stream;
+    stream << this->generator;
+
+    return stream.str();
+}
+
+void StochasticModule::setRngState(const std::string& state) {
+
+    std::istringstream stream(state);
+    stream >> this->generator;
+
+    // prefetched uniforms belong to the pre-restore stream position
+    this->uniform_pool.invalidate();
+}
+
+void StochasticModule::samplePoisson(
+    const double* mu,
+    size_t numReactions,
+    double tau,
+    double* m_i
+) {
+
+    // Pass 1: scale every propensity by the leap length in one branch-free
+    // sweep over contiguous doubles, which the compiler vectorizes
+    double* means = this->step_arena.allocate(numReactions);
+
+    double dt = tau;
+
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (size_t i = 0; i < numReactions; ++i) {
+        means[i] = mu[i] * dt;
+    }
+
+    // Refresh the runtime fast/slow partition on its interval: a reaction
+    // counts as fast while its expected firing count stays above the
+    // threshold, and fast reactions skip sampling entirely below
+    if (this->fast_mean_threshold > 0.0) {
+
+        bool refresh = this->reaction_is_fast.size() != numReactions ||
+            this->leaps_since_repartition %
+                static_cast<uint64_t>(this->repartition_interval) == 0;
+
+        this->leaps_since_repartition++;
+
+        if (refresh) {
+
+            this->reaction_is_fast.resize(numReactions);
+
+            for (size_t i = 0; i < numReactions; ++i) {
+                this->reaction_is_fast[i] =
+                    means[i] >= this->fast_mean_threshold;
+            }
+        }
+    }
+
+    // Pass 2: draw the samples; inherently serial on the shared RNG
+    // stream. Strategy per element keeps sampling cost flat in the mean:
+    // cached per-reaction distributions for small means, PTRS rejection
+    // for moderate ones, normal approximation for the very large
+    this->poisson_dists.resize(numReactions);
+    this->cached_dist_means.resize(numReactions, -1.0);
+
+    for (size_t i = 0; i < numReactions; ++i) {
+
+        double mean = means[i];
+
+        if (this->fast_mean_threshold > 0.0 && this->reaction_is_fast[i]) {
 
-    // List of formula strings to be parsed.
-    this->formulas_vector = StochasticModel.getReactionExpressions();
+            // fast partition: effectively continuous, advance by the
+            // deterministic expectation with no sampling cost or noise
+            m_i[i] = mean;
 
-    //Instantiate SBML model
-    this->sbml = StochasticModel.model;
+        } else if (!(mean > 0.0)) {
 
-    //call conversion method here:
-    this->nM2mpv_conversion_factors = unit_conversions::nanomolar2mpv(StochasticModel.species_volumes);
-    this->molecules2nM_conversion_factors = unit_conversions::molecules2nanomolar(StochasticModel.species_volumes);
+            m_i[i] = 0.0;
 
+        } else if (mean < ptrs_mean_cutoff) {
 
-    this->algorithm_id = this->sbml->getId();
-    this->target_id = "Hybrid";
+            if (this->cached_dist_means[i] != mean) {
+                this->poisson_dists[i].param(
+                    std::poisson_distribution<int>::param_type(mean)
+                );
+                this->cached_dist_means[i] = mean;
+            }
 
- }
+            m_i[i] = this->poisson_dists[i](this->generator);
 
-std::string StochasticModule::getModuleId() { return this->algorithm_id; }
+        } else if (mean < normal_approx_mean_cutoff) {
 
-void StochasticModule::loadTargetModule(
-    const std::vector<std::unique_ptr<BaseModule>>& module_list
-) {
-    for (const auto& mod : module_list) {
+            m_i[i] = samplePoissonPTRS(mean, this->uniform_pool);
 
-        if (mod->getModuleId() == this->target_id) {
+        } else {
 
-            this->targets.push_back(mod.get());
+            // Poisson(mean) ~ N(mean, mean) at these magnitudes
+            double draw = std::round(
+                mean + std::sqrt(mean) * this->standard_normal(this->generator)
+            );
+
+            m_i[i] = (draw > 0.0) ? draw : 0.0;
         }
+    }
+
+    if (this->entity_profiling) {
 
+        this->reaction_firings.resize(numReactions, 0.0);
+
+        for (size_t i = 0; i < numReactions; ++i) {
+            this->reaction_firings[i] += m_i[i];
+        }
     }
 }
 
-std::vector<double> StochasticModule::computeReactions(const std::vector<double>& state) {
-    /** 
-     * @brief Computes all reactions in the SBML model
-     * 
-     * @param state the initial states of all species in the SBML model
-     * 
-     * @returns v vector of state values after initial stochiometric calculations
-    */
-    
-    unsigned int numReactions = sbml->getNumReactions();
+double StochasticModule::samplePoissonPTRS(
+    double mean,
+    UniformPool& uniforms
+) {
 
-    std::vector<double> v(numReactions);
+    // Hoermann (1993), "The transformed rejection method for generating
+    // Poisson random variables", algorithm PTRS
+    double b = 0.931 + 2.53 * std::sqrt(mean);
+    double a = -0.059 + 0.02483 * b;
+    double inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+    double v_r = 0.9277 - 3.6224 / (b - 2.0);
 
-    // Populate the matrix:
-    for (unsigned int i = 0; i < numReactions; i++) {
-        //Reaction getter
-        std::string formula_i = formulas_vector[i];
+    double log_mean = std::log(mean);
+
+    // pooled draws: each uniform is a pointer bump into the pool's
+    // bulk-generated block instead of a six-round Philox call
+    while (true) {
+
+        double u = uniforms.next() - 0.5;
+        double v = uniforms.next();
+
+        double u_shifted = 0.5 - std::abs(u);
+        double k = std::floor((2.0 * a / u_shifted + b) * u + mean + 0.43);
 
-        v[i] = computeReaction(formula_i);
+        if (u_shifted >= 0.07 && v <= v_r) {
+            return k;
+        }
+
+        if (k < 0.0 || (u_shifted < 0.013 && v > u_shifted)) {
+            continue;
+        }
+
+        if (std::log(v) * inv_alpha <=
+            k * log_mean - mean - std::lgamma(k + 1.0)) {
+            return k;
+        }
     }
-    
-    return v;
 }
-    
-double StochasticModule::computeReaction(std::string formula_str) {
 
-    // Create instance of Parser object
-    mu::Parser parser;
+void StochasticModule::constrainTau(
+    const double* m_i,
+    const double* xhat_tn,
+    double* mhat_actual
+) {
+
+    // Pass 1: gather |coefficient|*state for every reactant entry into one
+    // contiguous scratch span. The CSR gather is the part SIMD dislikes,
+    // so it runs alone here; the entries are precomputed reactant-only
+    // magnitudes, so nothing needs abs() or filtering. Zero copies can
+    // never fire, so they are demoted to +inf and fall out of the min
+    size_t num_entries = this->reactant_entries.values.size();
 
-    // get variables in formula
-    std::unordered_map<std::string, double> components = mapComponentsToValues(formula_str);
-    //Persistent copy of component values:
-    std::unordered_map<std::string, double> component_values;
+    double* limits = this->step_arena.allocate(num_entries);
 
-    try {
-    for (const auto& [name, value] : components) {
-        component_values[name] = value;
-        parser.DefineVar(name, &component_values[name]);
-    }
-    parser.SetExpr(formula_str);
+    constexpr double kUnbounded = std::numeric_limits<double>::infinity();
 
-    double v_i = parser.Eval();
+    for (size_t n = 0; n < num_entries; n++) {
 
-    return v_i;
+        double limit = xhat_tn[reactant_entries.col_idx[n]]
+            * reactant_entries.values[n];
 
+        limits[n] = limit > 0.0 ? limit : kUnbounded;
     }
-    catch (mu::Parser::exception_type &e) {
-        std::cout << "Error while parsing: " << e.GetMsg() << "\n";
-        return std::numeric_limits<double>::quiet_NaN();
+
+    // Pass 2: per-reaction min-reduction over the contiguous products,
+    // branchless and written straight into the caller's realization
+    // buffer; the select above means the body is a pure min chain
+    for (size_t i = 0; i < this->reactant_entries.num_rows; i++) {
+
+        double R_mi = m_i[i]; // was set 0.0
+
+#ifdef _OPENMP
+        #pragma omp simd reduction(min:R_mi)
+#endif
+        for (size_t n = reactant_entries.row_ptr[i];
+             n < reactant_entries.row_ptr[i + 1]; n++) {
+
+            R_mi = std::min(R_mi, limits[n]);
+        }
+
+        mhat_actual[i] = R_mi;
     }
 }
 
-std::unordered_map<std::string,double> StochasticModule::mapComponentsToValues(const std::string& formula_str) {
+void StochasticModule::samplePoissonSubset(
+    const double* means,
+    const std::vector<unsigned int>& reactions,
+    CounterRng& generator,
+    double* m_i
+) {
 
-    std::unordered_map<std::string, double> component_value_map;
+    // local distribution for the normal tail; std::normal_distribution
+    // carries a cached spare draw, so the member copy cannot be shared
+    // across the concurrent groups
+    std::normal_distribution<double> normal(0.0, 1.0);
 
-    std::vector<std::string> components_vector = tokenizeFormula(formula_str);
+    // group-local uniform pool over the group's own substream: PTRS
+    // draws bump through its bulk-generated block, and the pool dying
+    // with this call keeps the group streams independent
+    UniformPool group_uniforms(generator);
 
-    // Iterate over each component and return SBML components with values associated
-    for ( int i = 0; i < components_vector.size(); i++) {
+    for (unsigned int i : reactions) {
 
-        const std::string component = components_vector[i];
+        double mean = means[i];
 
-        // Check if in SBML as Parameter || Species || Compartment;
-        if (sbml->getParameter(component)!= nullptr) {
-            double value = sbml->getParameter(component)->getValue();
-            component_value_map[component] = value;
-        } else if (sbml->getSpecies(component) != nullptr) {
-            double value = sbml->getSpecies(component)->getInitialConcentration();
-            component_value_map[component] = value;
-        } else if (sbml->getCompartment(component)!= nullptr) {
-            double value = sbml->getCompartment(component)->getVolume();
-            component_value_map[component] = value;
-        } 
-    }
+        if (this->fast_mean_threshold > 0.0 &&
+            i < this->reaction_is_fast.size() && this->reaction_is_fast[i]) {
 
-    return component_value_map;
-        
-}
+            m_i[i] = mean;
 
-std::vector<std::string> StochasticModule::tokenizeFormula(const std::string& formula_str) {
+        } else if (!(mean > 0.0)) {
 
-    std::vector<std::string> tokens;
+            m_i[i] = 0.0;
 
-    std::string current_token_bin;
+        } else if (mean < ptrs_mean_cutoff) {
 
-    for (char c : formula_str) {
-        if (c == '+' || c == '-' || c == '*' || c == '/' || c == '^' || c == '(' || c == ')') {
-            if (!current_token_bin.empty()) {
-                tokens.push_back(current_token_bin);
-            } 
-            current_token_bin.clear();
-        } else if (c != ' ') {
-            current_token_bin += c;
-        } else if (!current_token_bin.empty()) {
-            tokens.push_back(current_token_bin);
-            current_token_bin.clear();
+            // per-reaction cache slots are disjoint across groups
+            if (this->cached_dist_means[i] != mean) {
+                this->poisson_dists[i].param(
+                    std::poisson_distribution<int>::param_type(mean)
+                );
+                this->cached_dist_means[i] = mean;
+            }
+
+            m_i[i] = this->poisson_dists[i](generator);
+
+        } else if (mean < normal_approx_mean_cutoff) {
+
+            m_i[i] = samplePoissonPTRS(mean, group_uniforms);
+
+        } else {
+
+            double draw = std::round(mean + std::sqrt(mean) * normal(generator));
+
+            m_i[i] = (draw > 0.0) ? draw : 0.0;
+        }
+
+        // accumulators were sized serially before the fan-out; groups
+        // own disjoint reactions, so these writes never collide
+        if (this->entity_profiling) {
+            this->reaction_firings[i] += m_i[i];
         }
     }
-    if (!current_token_bin.empty()) {
-        tokens.push_back(current_token_bin);
-    }
-    return tokens;
 }
 
-std::vector<double> StochasticModule::samplePoisson(
-    std::vector<double> mu
+void StochasticModule::constrainTauSubset(
+    const double* m_i,
+    const double* xhat_tn,
+    const std::vector<unsigned int>& reactions,
+    double* mhat_actual
 ) {
 
-    std::random_device rd;
-    std::mt19937 generator(rd());
+    for (unsigned int i : reactions) {
 
-    // realization vector for storing random poisson samples
-    std::vector<double> m_i(mu.size()); 
+        double R_mi = m_i[i];
 
-    for (size_t i = 0; i < mu.size(); ++i) {
+        for (size_t n = reactant_entries.row_ptr[i];
+             n < reactant_entries.row_ptr[i + 1]; n++) {
 
-        std::poisson_distribution<int> dist((mu[i] * this->delta_t)); 
-        m_i[i] = dist(generator);
+            double limit = xhat_tn[reactant_entries.col_idx[n]]
+                * reactant_entries.values[n];
 
+            if (limit > 0 && limit < R_mi) { // zero copies can never fire
+                R_mi = limit;
+            }
+        }
+
+        mhat_actual[i] = R_mi;
     }
-    return m_i;
 }
 
-std::vector<double> StochasticModule::constrainTau(
-    std::vector<double> m_i,
-    std::vector<double> xhat_tn
+double StochasticModule::computeNewStateSubset(
+    const double* state_t,
+    const double* real_vec,
+    const std::vector<unsigned int>& species,
+    double* new_state
 ) {
 
-    std::vector<double> mhat_actual(m_i.size()); // results storage vector
+    double clamped = 0.0;
+
+    // each group owns its species rows exclusively, so these writes into
+    // the shared output buffer never conflict; the clamp tally is local
+    // and folded into the shared counter after the join
+    for (unsigned int s : species) {
+
+        double delta = 0.0;
+
+        for (size_t n = stoich_rows.row_ptr[s];
+             n < stoich_rows.row_ptr[s + 1]; n++) {
+            delta += stoich_rows.values[n] * real_vec[stoich_rows.col_idx[n]];
+        }
+
+        double rounded = std::round(state_t[s] + delta);
+
+        clamped += (rounded < 0.0) ? 1.0 : 0.0;
+        new_state[s] = (rounded > 0.0) ? rounded : 0.0;
+    }
+
+    return clamped;
+}
+
+void StochasticModule::computeNewState(
+    const double* state_t,
+    size_t numSpecies,
+    const double* real_vec,
+    double* new_state
+) {
 
-    for (int i = 0; i < this->stoichmat[0].size(); i++) {
+    // Pass 1: sparse delta accumulation; the CSR gather resists SIMD, so
+    // it stays scalar and writes a contiguous scratch span
+    double* deltas = this->step_arena.allocate(numSpecies);
 
-        // Vector for current ratelaw stoichiometries per species (i.e. column of S)
-        std::vector<double> S_i = matrix_utils::getColumn(this->stoichmat, i);
+    if (this->scatter_state_update) {
 
-        std::vector<double> Rhat_i(xhat_tn.size()); // double for storing each reaction product
+        // tuned alternative: reaction-major scatter that skips silent
+        // reactions entirely — with sparse firing sets, work tracks the
+        // reactions that fired instead of every stoichiometric entry
+        size_t numReactions = this->stoich_cols.num_rows;
 
-        for (int j = 0; j < xhat_tn.size(); j++) {
-            Rhat_i[j] = xhat_tn[j] * S_i[j]; // calculate coefficient products of current state
+        for (size_t i = 0; i < numSpecies; ++i) {
+            deltas[i] = 0.0;
         }
 
-        std::vector<double> abs_r;
-        abs_r.reserve(Rhat_i.size());
+        for (size_t r = 0; r < numReactions; r++) {
 
-        for (const auto& rct : Rhat_i) {
-            double abs_val = std::abs(rct);
-            if (abs_val > 0)
-                abs_r.push_back(abs_val);
+            double fired = real_vec[r];
+
+            if (fired == 0.0) {
+                continue;
+            }
+
+            for (size_t n = stoich_cols.row_ptr[r];
+                 n < stoich_cols.row_ptr[r + 1]; n++) {
+                deltas[stoich_cols.col_idx[n]] +=
+                    stoich_cols.values[n] * fired;
+            }
         }
 
-        double R_mi = m_i[i]; // was set 0.0
-        for (const auto& reactant : abs_r) {
+    } else {
 
-            if (reactant < R_mi) { // drop reactants != negative (-): i.e. not rate-limiting
-                R_mi = reactant;
+        for (size_t i = 0; i < numSpecies; ++i) {
+            double delta = 0.0;
+
+            // Accumulate only nonzero stoichiometric entries for species i
+            for (size_t n = stoich_rows.row_ptr[i]; n < stoich_rows.row_ptr[i + 1]; n++) {
+                delta += stoich_rows.values[n] * real_vec[stoich_rows.col_idx[n]];
             }
+
+            deltas[i] = delta;
         }
+    }
 
-        mhat_actual[i] = R_mi;
+    // Pass 2: the post-update policy — add, round, clamp to zero and
+    // count the clamps — in one branch-free sweep over contiguous
+    // doubles, which the compiler vectorizes; the selects lower to
+    // max/blend instructions, not branches. constrainTau bounds each
+    // reaction in isolation, so the combined drain of several reactions
+    // on one low-copy species can still land negative; the clamp makes
+    // that policy explicit and the tally surfaces how often it fires.
+    // The state stays in whole molecules — the nanomolar conversion is
+    // fused into the recording copy and paid only once per step
+    double clamped = 0.0;
+
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:clamped)
+#endif
+    for (size_t i = 0; i < numSpecies; ++i) {
+
+        double rounded = std::round(state_t[i] + deltas[i]);
+
+        clamped += (rounded < 0.0) ? 1.0 : 0.0;
+        new_state[i] = (rounded > 0.0) ? rounded : 0.0;
     }
 
-    return mhat_actual;
+    this->negative_clamp_events += static_cast<uint64_t>(clamped);
 }
 
-std::vector<double> StochasticModule::computeNewState(
-    std::vector<double> state_t,
-    std::vector<double> real_vec
+void StochasticModule::fusedLeap(
+    const double* propensities,
+    double tau,
+    const double* state_t,
+    size_t numReactions,
+    size_t numSpecies,
+    double* new_state
 ) {
 
-        // Update the stochastic state vector: new_state = old_state * v
-    std::vector<double> new_state(state_t.size());
-    
-    for (size_t i = 0; i < state_t.size(); ++i) {
-        double delta = 0.0;
-        for (size_t j = 0; j < real_vec.size(); ++j) {
-            delta += stoichmat[i][j] * real_vec[j];
+    // fast/slow partition refresh, as in samplePoisson; the means are
+    // recomputed per reaction inside the fused loop, so only this
+    // refresh pass materializes them
+    if (this->fast_mean_threshold > 0.0) {
+
+        bool refresh = this->reaction_is_fast.size() != numReactions ||
+            this->leaps_since_repartition %
+                static_cast<uint64_t>(this->repartition_interval) == 0;
+
+        this->leaps_since_repartition++;
+
+        if (refresh) {
+
+            this->reaction_is_fast.resize(numReactions);
+
+            for (size_t i = 0; i < numReactions; ++i) {
+                this->reaction_is_fast[i] =
+                    propensities[i] * tau >= this->fast_mean_threshold;
+            }
+        }
+    }
+
+    this->poisson_dists.resize(numReactions);
+    this->cached_dist_means.resize(numReactions, -1.0);
+
+    if (this->entity_profiling) {
+        this->reaction_firings.resize(numReactions, 0.0);
+    }
+
+    double* deltas = this->step_arena.allocate(numSpecies);
+
+    for (size_t s = 0; s < numSpecies; ++s) {
+        deltas[s] = 0.0;
+    }
+
+    // one reaction at a time: sample, constrain and scatter while the
+    // realization is still in a register. A reaction's reactant and
+    // stoichiometry rows are short CSR spans, so its whole working set
+    // stays in L1 instead of streaming three full-length intermediate
+    // arrays between the stages
+    for (size_t i = 0; i < numReactions; ++i) {
+
+        double mean = propensities[i] * tau;
+
+        double m;
+
+        if (this->fast_mean_threshold > 0.0 && this->reaction_is_fast[i]) {
+
+            // fast partition: effectively continuous, advance by the
+            // deterministic expectation with no sampling cost or noise
+            m = mean;
+
+        } else if (!(mean > 0.0)) {
+
+            m = 0.0;
+
+        } else if (mean < ptrs_mean_cutoff) {
+
+            if (this->cached_dist_means[i] != mean) {
+                this->poisson_dists[i].param(
+                    std::poisson_distribution<int>::param_type(mean)
+                );
+                this->cached_dist_means[i] = mean;
+            }
+
+            m = this->poisson_dists[i](this->generator);
+
+        } else if (mean < normal_approx_mean_cutoff) {
+
+            m = samplePoissonPTRS(mean, this->uniform_pool);
+
+        } else {
+
+            // Poisson(mean) ~ N(mean, mean) at these magnitudes
+            double draw = std::round(
+                mean + std::sqrt(mean) * this->standard_normal(this->generator)
+            );
+
+            m = (draw > 0.0) ? draw : 0.0;
+        }
+
+        // the tally counts the unconstrained sample, as samplePoisson does
+        if (this->entity_profiling) {
+            this->reaction_firings[i] += m;
+        }
+
+        // reactant constraint in-register; zero copies can never fire
+        for (size_t n = reactant_entries.row_ptr[i];
+             n < reactant_entries.row_ptr[i + 1]; n++) {
+
+            double limit = state_t[reactant_entries.col_idx[n]]
+                * reactant_entries.values[n];
+
+            if (limit > 0 && limit < m) {
+                m = limit;
+            }
         }
 
-        new_state[i] = std::round(state_t[i] + delta);
+        if (m == 0.0) {
+            continue;
+        }
+
+        // scatter the constrained firing straight into the deltas
+        for (size_t n = stoich_cols.row_ptr[i];
+             n < stoich_cols.row_ptr[i + 1]; n++) {
+            deltas[stoich_cols.col_idx[n]] += stoich_cols.values[n] * m;
+        }
+    }
+
+    // the post-update policy sweep is computeNewState's, unchanged:
+    // add, round, clamp to zero and count the clamps
+    double clamped = 0.0;
+
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:clamped)
+#endif
+    for (size_t i = 0; i < numSpecies; ++i) {
+
+        double rounded = std::round(state_t[i] + deltas[i]);
+
+        clamped += (rounded < 0.0) ? 1.0 : 0.0;
+        new_state[i] = (rounded > 0.0) ? rounded : 0.0;
     }
 
-    return new_state;
+    this->negative_clamp_events += static_cast<uint64_t>(clamped);
 }
 
 void StochasticModule::setSimulationSettings(
@@ -261,11 +3040,17 @@ void StochasticModule::setSimulationSettings(
 
     this->delta_t = step;
 
+    // resolve the kernel dispatch before any stepping; at most one
+    // timing pass per session, and none when a tuning file matches
+    if (this->autotune_kernels && !this->kernels_tuned) {
+        this->autotuneKernels();
+    }
+
     int numSpecies = this->sbml->getNumSpecies();
 
-    this->timesteps = BaseModule::setTimeSteps(start, stop, step);
+    this->time_grid = BaseModule::sharedTimeSteps(start, stop, step);
 
-    this->results_matrix = BaseModule::createResultsMatrix(numSpecies, timesteps.size());
+    BaseModule::createResultsMatrix(numSpecies, this->time_grid->size());
 
     BaseModule::recordStepResult(
         this->handler.getInitialState(), 
@@ -274,6 +3059,52 @@ void StochasticModule::setSimulationSettings(
 
 }
 
+double StochasticModule::selectTau(
+    const double* propensities,
+    const double* state_molecules
+) {
+
+    size_t numSpecies = this->stoich_rows.num_rows;
+
+    double tau = std::numeric_limits<double>::infinity();
+
+    // Cao-Gillespie bounds: per species, the leap may move the count by at
+    // most max(epsilon * x_i / g_i, 1) in both expectation and deviation
+    for (size_t s = 0; s < numSpecies; s++) {
+
+        double mean_change = 0.0;
+        double var_change = 0.0;
+
+        for (size_t e = this->stoich_rows.row_ptr[s];
+             e < this->stoich_rows.row_ptr[s + 1]; e++) {
+
+            double coef = this->stoich_rows.values[e];
+            double a = propensities[this->stoich_rows.col_idx[e]];
+
+            mean_change += coef * a;
+            var_change += coef * coef * a;
+        }
+
+        double bound = std::max(
+            this->adaptive_tau_epsilon * state_molecules[s] /
+                this->tau_g_values[s],
+            1.0
+        );
+
+        if (mean_change != 0.0) {
+            tau = std::min(tau, bound / std::abs(mean_change));
+        }
+
+        if (var_change > 0.0) {
+            tau = std::min(tau, bound * bound / var_change);
+        }
+    }
+
+    // floor keeps a pathological propensity spike from stalling the run;
+    // below this the leap error is dominated by the fixed-grid error anyway
+    return std::max(tau, this->delta_t * 1e-6);
+}
+
 void StochasticModule::setModelState(const std::vector<double>& state) {
 
     std::vector<std::string> speciesIds = handler.getSpeciesIds();
@@ -286,45 +3117,254 @@ void StochasticModule::setModelState(const std::vector<double>& state) {
 void StochasticModule::step(
     int step
 ) {
-    // get (step minus 1) position in results_matrix member
-    std::vector<double> last_state_nM = getLastStepResult(step);  // nM
+    alloc_guard::PhaseScope alloc_phase("stochastic_step");
 
-    //reset SBML species values:
-    this->handler.setState(last_state_nM); // nM 
+    // deferred so the analysis sees the post-configuration CSR; runs at
+    // most once per session
+    if (this->conservation_elimination && !this->conservation_analyzed) {
+        this->findConservationLaws();
+    }
 
-    //convert from nanomolar to mpc:
-    this->handler.convertSpeciesUnits(this->nM2mpv_conversion_factors); // molecules per volume
+    // dispatch chosen once at load: small models run the stack-resident
+    // fixed-capacity kernel for their tier, everything else the general
+    // arena path
+    switch (this->fixed_tier) {
 
-    // Sample stochastic answer from Poisson distribution
-    std::vector<double> realizations = samplePoisson(computeReactions(this->handler.getInitialState()));
+        case 0: this->stepFixed<8, 16>(step); break;
+        case 1: this->stepFixed<16, 32>(step); break;
+        case 2: this->stepFixed<32, 64>(step); break;
 
-    //reassign molecules per volume to just molecules:
-    this->handler.convertSpeciesUnits(this->handler.species_volumes);
+        default: this->stepGeneral(step);
+    }
 
-    // Constrain Tau-leap algorithm for conservation of mass
-    std::vector<double> constrained_realizations = constrainTau(
-        realizations, 
-        this->handler.getInitialState()
-    );
-    
-    // Calculate the updated state for current step:
-    std::vector<double> new_state = computeNewState(
-        this->handler.getInitialState(),
-        constrained_realizations
+    // rules and events resolve once per co-simulation step at the
+    // boundary; the leap kernels above stay rule-free
+    if (this->rules_active) {
+        this->applyRulesAndEvents(step);
+    }
+}
+
+void StochasticModule::stepGeneral(
+    int step
+) {
+    // every temporary below lives in the arena; one rewind reclaims all
+    this->step_arena.reset();
+
+    // block the RNG substream on the step index: this step's draws are a
+    // pure function of (seed, step), independent of prior steps' history;
+    // pooled uniforms from the prior block are stale once it changes
+    this->generator.setBlock(static_cast<uint64_t>(step));
+    this->uniform_pool.invalidate();
+
+    // (step minus 1) state view; state stays in native arrays for the
+    // whole step, libSBML is not consulted for any math
+    const std::vector<double>& last_state_nM = this->getLastStepResult(step);  // nM
+
+    size_t numSpecies = last_state_nM.size();
+    size_t numReactions = this->sbml->getNumReactions();
+
+    // allocate every leap buffer once; adaptive sub-leaps reuse them
+    double* state_mpv = this->step_arena.allocate(numSpecies);
+    double* propensities = this->step_arena.allocate(numReactions);
+    double* realizations = this->step_arena.allocate(numReactions);
+    double* state_molecules = this->step_arena.allocate(numSpecies);
+    double* constrained_realizations = this->step_arena.allocate(numReactions);
+    double* new_state = this->step_arena.allocate(numSpecies);
+
+    //convert from nanomolar to mpc:
+    unit_conversions::convert(
+        last_state_nM.data(),
+        this->nM2mpv_conversion_factors,
+        state_mpv,
+        numSpecies
+    ); // molecules per volume
+
+    // fused nM -> molecules; no intermediate per-volume pass
+    unit_conversions::convert(
+        last_state_nM.data(),
+        this->nM2molecules_conversion_factors,
+        state_molecules,
+        numSpecies
     );
 
-    this->handler.setState(new_state);
+    // refit each law's total to the post-boundary state
+    if (!this->conservation_laws.empty()) {
+        this->captureConservationTotals(state_molecules);
+    }
+
+    // Adaptive mode covers the recording interval with several short
+    // leaps sized by the Cao-Gillespie bounds; fixed mode is the
+    // degenerate case of one full-length leap. The final leap is always
+    // clipped to the interval's end, so recorded states land exactly on
+    // the requested grid with no interpolation
+    double t_local = 0.0;
+
+    while (true) {
+
+        {
+            PerfMonitor::ScopedTimer timer(this->perf, "propensity_evaluation");
+            computeReactions(state_mpv, numSpecies, propensities);
+        }
+
+        double tau = this->delta_t - t_local;
+
+        if (this->fixed_leap_dt > 0.0) {
+            tau = std::min(tau, this->fixed_leap_dt);
+        }
+
+        if (this->adaptive_tau_epsilon > 0.0) {
+            tau = std::min(tau, selectTau(propensities, state_molecules));
+        }
+
+        if (this->partition_reactions.size() > 1) {
+
+            // Model-partitioned leap: every group samples, constrains and
+            // applies its connected components on its own core. Groups own
+            // disjoint reactions and species, so no writes conflict and no
+            // boundary synchronization exists; the join below is the only
+            // meeting point per leap
+            double* means = this->step_arena.allocate(numReactions);
+
+#ifdef _OPENMP
+            #pragma omp simd
+#endif
+            for (size_t i = 0; i < numReactions; ++i) {
+                means[i] = propensities[i] * tau;
+            }
+
+            // fast/slow refresh stays serial, as in samplePoisson
+            if (this->fast_mean_threshold > 0.0) {
+
+                bool refresh = this->reaction_is_fast.size() != numReactions ||
+                    this->leaps_since_repartition %
+                        static_cast<uint64_t>(this->repartition_interval) == 0;
+
+                this->leaps_since_repartition++;
+
+                if (refresh) {
+
+                    this->reaction_is_fast.resize(numReactions);
+
+                    for (size_t i = 0; i < numReactions; ++i) {
+                        this->reaction_is_fast[i] =
+                            means[i] >= this->fast_mean_threshold;
+                    }
+                }
+            }
+
+            // size the shared per-reaction caches before the fan-out
+            this->poisson_dists.resize(numReactions);
+            this->cached_dist_means.resize(numReactions, -1.0);
+
+            if (this->entity_profiling) {
+                this->reaction_firings.resize(numReactions, 0.0);
+            }
+
+            // per-group clamp tallies; slots are written disjointly by
+            // group index and summed after the join
+            double* group_clamps = this->step_arena.allocate(
+                this->partition_reactions.size()
+            );
+
+            PerfMonitor::ScopedTimer timer(this->perf, "partitioned_leap");
+
+            // groups fan out over the shared scheduler instead of a
+            // per-leap thread spawn: group p's home queue is stable, so
+            // its reaction and species working set revisits the same
+            // worker leap after leap
+            TaskScheduler::instance().parallelFor(
+                static_cast<int>(this->partition_reactions.size()),
+                [&](int p) {
+
+                    // group substream keyed by (seed, step, group): draws
+                    // are deterministic regardless of thread scheduling
+                    CounterRng group_generator = this->generator;
+                    group_generator.setBlock(
+                        (static_cast<uint64_t>(p + 1) << 32)
+                            ^ static_cast<uint64_t>(step)
+                    );
+
+                    this->samplePoissonSubset(
+                        means, this->partition_reactions[p],
+                        group_generator, realizations
+                    );
+
+                    this->constrainTauSubset(
+                        realizations, state_molecules,
+                        this->partition_reactions[p],
+                        constrained_realizations
+                    );
+
+                    group_clamps[p] = this->computeNewStateSubset(
+                        state_molecules, constrained_realizations,
+                        this->partition_species[p],
+                        new_state
+                    );
+                }
+            );
+
+            for (size_t p = 0; p < this->partition_reactions.size(); p++) {
+                this->negative_clamp_events +=
+                    static_cast<uint64_t>(group_clamps[p]);
+            }
+
+        } else {
+
+            // fused serial leap: sampling, the reactant constraint and
+            // the stoichiometry scatter make one pass over the sparse
+            // structure instead of three reaction-indexed sweeps with
+            // full intermediate arrays streamed between them
+            PerfMonitor::ScopedTimer timer(this->perf, "fused_leap");
+
+            this->fusedLeap(
+                propensities, tau, state_molecules,
+                numReactions, numSpecies, new_state
+            );
+        }
+
+        // dependent species left the CSR; recover them from their laws
+        // before anything reads the new state
+        if (!this->conservation_laws.empty()) {
+            this->applyConservationLaws(new_state);
+        }
+
+        t_local += tau;
 
-    // Convert back into nanomolar
-    this->handler.convertSpeciesUnits(this->molecules2nM_conversion_factors);
+        if (t_local >= this->delta_t * (1.0 - 1e-12)) {
+            break;
+        }
+
+        // the leap's end state becomes the next leap's input
+        std::swap(state_molecules, new_state);
+
+        // feed the sub-leap's end state back in per-volume units
+        for (size_t s = 0; s < numSpecies; s++) {
+
+            double volume = this->species_volume_factors[s];
 
-    //Record iteration's result
-    BaseModule::recordStepResult(this->handler.getInitialState(), step);
+            state_mpv[s] = volume > 0.0
+                ? state_molecules[s] / volume
+                : state_molecules[s];
+        }
+    }
+
+    //Record iteration's result; partners read the exchange slots, so
+    //the step publishes nothing into libSBML. The molecules -> nM
+    //conversion fuses into this copy, once per step
+    {
+        PerfMonitor::ScopedTimer timer(this->perf, "recording");
+        BaseModule::recordStepResultScaled(
+            new_state,
+            this->molecules2nM_conversion_factors,
+            numSpecies,
+            step
+        );
+    }
 
 }
 
 void StochasticModule::run(
-    std::vector<double> timesteps
+    const std::vector<double>& timesteps
 ) {
     for (int t = 0; t < timesteps.size(); t++) {
 
@@ -333,46 +3373,156 @@ void StochasticModule::run(
     }
 }
 
-void StochasticModule::updateParameters() {
+void StochasticModule::findOverlappingIds(
+    const Model* alternate_model
+) {
 
-    for (const auto& alt_module : this->targets) {
+    size_t first_new = this->exchange_pairs.size();
 
-        SBMLHandler alternate_model = alt_module->handler;
+    BaseModule::findOverlappingIds(alternate_model);
 
-        std::vector<std::string> species_list = alternate_model.getSpeciesIds();
+    // bind each newly resolved pair to its compiled-formula slot
+    std::vector<std::string> new_ids;
+    new_ids.reserve(this->exchange_pairs.size() - first_new);
 
-        for (int i = 0; i < this->overlapping_params.size(); ++i) {
-            const std::string& id = this->overlapping_params[i];
+    for (size_t i = first_new; i < this->exchange_pairs.size(); i++) {
 
-            Parameter* parameter = this->sbml->getParameter(id);
+        auto slot = this->symbol_slots.find(
+            this->exchange_pairs[i].parameter->getId()
+        );
 
-            Species* species = alternate_model.model->getSpecies(id);
+        this->exchange_value_slots.push_back(
+            slot != this->symbol_slots.end()
+                ? &this->eval_values[slot->second]
+                : nullptr
+        );
 
-            if (species == nullptr) {
-                std::cerr << "[Warning] Species with ID '" << id << "' not found in alternate model.\n";
-                continue; // skip to next iteration
-            }
+        new_ids.push_back(this->exchange_pairs[i].parameter->getId());
+    }
 
-            if (parameter == nullptr) {
-                std::cerr << "[Warning] Parameter with ID '" << id << "' not found in sbml.\n";
-                continue;
-            }
+    // an exchanged parameter is runtime-mutable from here on; if the
+    // optimizer folded its document value into a literal, the compiled
+    // set must rebuild or the exchange writes a slot nothing reads
+    this->reoptimizeFormulas(new_ids);
+}
 
-            parameter->setValue(species->getInitialConcentration());
-        }
+void StochasticModule::bindParameterOverrides(
+    const std::vector<std::string>& parameter_ids
+) {
+
+    BaseModule::bindParameterOverrides(parameter_ids);
+
+    this->override_value_slots.clear();
+    this->override_value_slots.reserve(parameter_ids.size());
+
+    for (const std::string& id : parameter_ids) {
+
+        auto slot = this->symbol_slots.find(id);
+
+        this->override_value_slots.push_back(
+            slot != this->symbol_slots.end()
+                ? &this->eval_values[slot->second]
+                : nullptr
+        );
+    }
+
+    // same contract as the exchange path: an overridden parameter must
+    // survive in the compiled formulas as a variable, not a literal
+    this->reoptimizeFormulas(parameter_ids);
+}
+
+void StochasticModule::applyParameterOverrides(
+    const std::vector<double>& values
+) {
+
+    BaseModule::applyParameterOverrides(values);
 
+    size_t count = std::min(values.size(), this->override_value_slots.size());
+
+    for (size_t i = 0; i < count; i++) {
+
+        if (this->override_value_slots[i] != nullptr) {
+            *this->override_value_slots[i] = values[i];
+        }
     }
+
+    // the cached propensities were evaluated under the old parameters
+    this->propensity_cache_valid = false;
 }
 
-std::vector<double> StochasticModule::getLastStepResult(
-    int timestep
+void StochasticModule::applyCompartmentVolume(
+    const std::string& compartment_id,
+    double volume
 ) {
 
-    std::vector<double> state_vector(this->results_matrix.size());
+    auto housed = this->compartment_species.find(compartment_id);
+
+    if (housed == this->compartment_species.end()) {
+        return;
+    }
+
+    BaseModule::applyCompartmentVolume(compartment_id, volume);
+
+    // rate laws referencing the compartment read its slot; one write
+    // serves every compiled parser and the native-kernel gather alike
+    auto slot = this->symbol_slots.find(compartment_id);
+
+    if (slot != this->symbol_slots.end()) {
+        this->eval_values[slot->second] = volume;
+    }
+
+    // recompute the housed species' lane entries in place, the same
+    // constants packSpeciesConstants derived them from; the nM ->
+    // per-volume factor carries no volume term and stays untouched
+    const double avagadros = 6.022e23;
+    const double molar2nM = 1.0e9;
+
+    double* volume_lane = this->species_lane_base;
+    double* to_molecules =
+        this->species_lane_base + 2 * this->species_lane_stride;
+    double* to_nM =
+        this->species_lane_base + 3 * this->species_lane_stride;
 
-    state_vector = this->results_matrix[
-        (timestep > 0) ? timestep - 1 : timestep
-    ];
+    for (unsigned int s : housed->second) {
 
-    return state_vector;
+        volume_lane[s] = volume;
+        to_molecules[s] = (avagadros / molar2nM) * volume;
+        to_nM[s] = molar2nM / (volume * avagadros);
+    }
+
+    // the cached propensities and the incremental baseline were
+    // evaluated under the old volume
+    this->propensity_cache_valid = false;
+}
+
+void StochasticModule::updateParameters() {
+
+    // every lookup was resolved once in findOverlappingIds; the per-step
+    // exchange is raw pointer reads and writes
+    for (size_t i = 0; i < this->exchange_pairs.size(); i++) {
+
+        double value = this->readExchangedValue(i);
+
+        // quiescent pairs are skipped; most of the overlap set does not
+        // change on any given step
+        double last = this->last_exchanged_values[i];
+
+        if (last == last && std::abs(value - last) <= this->exchange_tolerance) {
+            continue;
+        }
+
+        this->last_exchanged_values[i] = value;
+
+        // the libSBML mirror is deferred to syncExchangedParameters; the
+        // compiled formulas read eval_values, not the document
+
+        // Mirror the exchanged value into the compiled-formula storage
+        if (this->exchange_value_slots[i] != nullptr) {
+            *this->exchange_value_slots[i] = value;
+        }
+
+        // a parameter moved under the cached propensities; next
+        // computeReactions call re-baselines with a full pass
+        this->propensity_cache_valid = false;
+    }
 }
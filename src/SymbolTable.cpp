@@ -0,0 +1,65 @@
+/**
+ * @file SymbolTable.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for the process-wide identifier interning table
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Internal Libraries
+#include "singlecell/SymbolTable.h"
+
+//=============================Class Details================================//
+std::mutex SymbolTable::table_mutex;
+std::deque<std::string> SymbolTable::symbols;
+std::unordered_map<std::string, uint32_t> SymbolTable::index;
+
+uint32_t SymbolTable::intern(
+    const std::string& id
+) {
+
+    std::lock_guard<std::mutex> lock(table_mutex);
+
+    auto known = index.find(id);
+
+    if (known != index.end()) {
+        return known->second;
+    }
+
+    uint32_t symbol = static_cast<uint32_t>(symbols.size());
+
+    symbols.push_back(id);
+    index.emplace(id, symbol);
+
+    return symbol;
+}
+
+std::vector<uint32_t> SymbolTable::internAll(
+    const std::vector<std::string>& ids
+) {
+
+    std::vector<uint32_t> handles;
+    handles.reserve(ids.size());
+
+    for (const auto& id : ids) {
+        handles.push_back(intern(id));
+    }
+
+    return handles;
+}
+
+const std::string& SymbolTable::text(
+    uint32_t symbol
+) {
+
+    std::lock_guard<std::mutex> lock(table_mutex);
+
+    return symbols[symbol];
+}
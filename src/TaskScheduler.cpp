@@ -0,0 +1,373 @@
+/**
+ * @file TaskScheduler.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Details for the process-wide work-stealing task scheduler
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Internal Libraries
+#include "singlecell/TaskScheduler.h"
+
+//===========================Worker placement===============================//
+namespace {
+
+    // worker index of the current thread; -1 on any off-pool thread
+    thread_local int tls_worker_index = -1;
+
+    /**
+     * @brief pins the calling thread to one NUMA node's CPU list read
+     * from sysfs, so its first-touched allocations stay node-local; a
+     * no-op off Linux or on single-node machines
+     */
+    void pinWorkerToNode(int worker, int num_workers) {
+
+#ifdef __linux__
+        std::vector<std::vector<int>> nodes;
+
+        for (int node = 0; ; node++) {
+
+            std::ifstream cpulist(
+                "/sys/devices/system/node/node" + std::to_string(node)
+                + "/cpulist"
+            );
+
+            if (!cpulist.is_open()) {
+                break;
+            }
+
+            // cpulist entries look like "0-15,32-47"
+            std::vector<int> cpus;
+            std::string range;
+
+            while (std::getline(cpulist, range, ',')) {
+
+                size_t dash = range.find('-');
+
+                int first = std::stoi(range.substr(0, dash));
+                int last = dash != std::string::npos
+                    ? std::stoi(range.substr(dash + 1))
+                    : first;
+
+                for (int cpu = first; cpu <= last; cpu++) {
+                    cpus.push_back(cpu);
+                }
+            }
+
+            if (!cpus.empty()) {
+                nodes.push_back(std::move(cpus));
+            }
+        }
+
+        if (nodes.size() < 2) {
+            return;
+        }
+
+        const std::vector<int>& cpus = nodes[worker % nodes.size()];
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+
+        for (int cpu : cpus) {
+            CPU_SET(cpu, &set);
+        }
+
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)worker;
+        (void)num_workers;
+#endif
+    }
+
+} // namespace
+
+//=============================Class Details================================//
+TaskScheduler& TaskScheduler::instance() {
+
+    // function-local static: constructed on first use, torn down at exit
+    static TaskScheduler scheduler;
+
+    return scheduler;
+}
+
+TaskScheduler::~TaskScheduler() {
+
+    this->shutdown();
+}
+
+void TaskScheduler::configure(
+    int num_threads
+) {
+
+    std::lock_guard<std::mutex> lifecycle(this->lifecycle_lock);
+
+    this->shutdown();
+
+    this->configured_threads = num_threads;
+}
+
+int TaskScheduler::threadCount() {
+
+    if (!this->workers.empty()) {
+        return static_cast<int>(this->workers.size());
+    }
+
+    return this->configured_threads > 0
+        ? this->configured_threads
+        : static_cast<int>(std::thread::hardware_concurrency());
+}
+
+int TaskScheduler::workerIndex() {
+
+    return tls_worker_index;
+}
+
+void TaskScheduler::ensureStarted() {
+
+    std::lock_guard<std::mutex> lifecycle(this->lifecycle_lock);
+
+    if (!this->workers.empty()) {
+        return;
+    }
+
+    int num_threads = this->threadCount();
+
+    this->stopping.store(false);
+
+    this->queues.clear();
+
+    for (int w = 0; w < num_threads; w++) {
+        this->queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    this->workers.reserve(num_threads);
+
+    for (int w = 0; w < num_threads; w++) {
+        this->workers.emplace_back(&TaskScheduler::workerLoop, this, w);
+    }
+}
+
+void TaskScheduler::shutdown() {
+
+    if (this->workers.empty()) {
+        return;
+    }
+
+    this->stopping.store(true);
+
+    {
+        std::lock_guard<std::mutex> lock(this->wake_lock);
+        this->wake.notify_all();
+    }
+
+    for (auto& worker : this->workers) {
+        worker.join();
+    }
+
+    this->workers.clear();
+    this->queues.clear();
+}
+
+bool TaskScheduler::claimTask(
+    int self,
+    std::function<void()>& task
+) {
+
+    int num_queues = static_cast<int>(this->queues.size());
+
+    // own queue first, newest task first: the work this thread just
+    // pushed is the work whose data is still hot in its cache
+    if (self >= 0) {
+
+        WorkerQueue& own = *this->queues[self];
+
+        std::lock_guard<std::mutex> lock(own.lock);
+
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // steal the oldest task of the first non-empty victim; oldest is
+    // the task the owner is least likely to reach soon
+    for (int offset = 1; offset <= num_queues; offset++) {
+
+        int victim = (self >= 0 ? self + offset : offset - 1) % num_queues;
+
+        WorkerQueue& queue = *this->queues[victim];
+
+        std::lock_guard<std::mutex> lock(queue.lock);
+
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TaskScheduler::workerLoop(
+    int index
+) {
+
+    tls_worker_index = index;
+
+    pinWorkerToNode(index, static_cast<int>(this->queues.size()));
+
+    std::function<void()> task;
+
+    while (true) {
+
+        if (this->claimTask(index, task)) {
+
+            task();
+            task = nullptr;
+
+            this->pending.fetch_sub(1, std::memory_order_release);
+
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(this->wake_lock);
+
+        this->wake.wait(lock, [&] {
+            return this->stopping.load() ||
+                this->pending.load(std::memory_order_acquire) > 0;
+        });
+
+        if (this->stopping.load() &&
+            this->pending.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+void TaskScheduler::parallelFor(
+    int num_tasks,
+    const std::function<void(int)>& body
+) {
+
+    this->parallelForWeighted(num_tasks, {}, body);
+}
+
+void TaskScheduler::parallelForWeighted(
+    int num_tasks,
+    const std::vector<double>& costs,
+    const std::function<void(int)>& body
+) {
+
+    if (num_tasks <= 0) {
+        return;
+    }
+
+    if (num_tasks == 1) {
+        body(0);
+        return;
+    }
+
+    this->ensureStarted();
+
+    int num_queues = static_cast<int>(this->queues.size());
+
+    // cost-steered placement: longest-processing-time-first onto the
+    // least-loaded queue, so one heavy task class never stacks a worker
+    // while cheap ones idle; empty costs keep the modulo affinity below
+    std::vector<int> homes;
+
+    if (costs.size() == static_cast<size_t>(num_tasks) && num_queues > 1) {
+
+        homes.resize(num_tasks);
+
+        std::vector<int> order(num_tasks);
+
+        for (int i = 0; i < num_tasks; i++) {
+            order[i] = i;
+        }
+
+        std::stable_sort(order.begin(), order.end(),
+            [&costs](int a, int b) { return costs[a] > costs[b]; });
+
+        std::vector<double> load(num_queues, 0.0);
+
+        for (int i : order) {
+
+            int lightest = 0;
+
+            for (int q = 1; q < num_queues; q++) {
+                if (load[q] < load[lightest]) {
+                    lightest = q;
+                }
+            }
+
+            homes[i] = lightest;
+            load[lightest] += costs[i];
+        }
+    }
+
+    // completion count of this call only; other parallelFor calls in
+    // flight keep their own
+    auto remaining = std::make_shared<std::atomic<int>>(num_tasks);
+
+    // index i's home queue is worker i mod T — the affinity hint that
+    // keeps cell i's tasks landing on the same worker run after run —
+    // unless the cost model placed it above
+    for (int i = 0; i < num_tasks; i++) {
+
+        WorkerQueue& home = *this->queues[
+            homes.empty() ? i % num_queues : homes[i]
+        ];
+
+        std::lock_guard<std::mutex> lock(home.lock);
+
+        home.tasks.emplace_back([&body, i, remaining] {
+            body(i);
+            remaining->fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    this->pending.fetch_add(num_tasks, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(this->wake_lock);
+        this->wake.notify_all();
+    }
+
+    // help instead of blocking: the caller (pool worker or not) runs
+    // tasks until this call's set has drained, so a task submitting a
+    // nested parallelFor keeps the pool making progress
+    int self = tls_worker_index;
+
+    std::function<void()> task;
+
+    while (remaining->load(std::memory_order_acquire) > 0) {
+
+        if (this->claimTask(self, task)) {
+
+            task();
+            task = nullptr;
+
+            this->pending.fetch_sub(1, std::memory_order_release);
+
+        } else {
+
+            // every task is claimed but some are still running
+            std::this_thread::yield();
+        }
+    }
+}
@@ -0,0 +1,247 @@
+/**
+ * @file TraceWriter.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Definitions for the chrome-trace span collector
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <unordered_set>
+
+//POSIX libraries
+#include <unistd.h>
+
+// Internal libraries
+#include "singlecell/Logger.h"
+#include "singlecell/TraceWriter.h"
+
+//=============================Class Details================================//
+namespace {
+
+// per-thread cap: a six-hour run of sub-leap spans must not grow the
+// trace without bound; overflow is counted and reported, not fatal
+constexpr size_t kMaxEventsPerThread = size_t(1) << 20;
+
+struct TraceEvent {
+    const char* name;
+    const char* category;
+    uint64_t ts_us;
+    uint64_t dur_us;
+};
+
+// one buffer per thread, registered on first use and drained by
+// endTrace. The mutex is per-buffer and all but uncontended — the
+// owning thread appends, the drain visits once per trace
+struct ThreadBuffer {
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::string thread_name;
+    uint64_t tid = 0;
+    uint64_t dropped = 0;
+};
+
+std::mutex registry_mutex;
+std::vector<std::shared_ptr<ThreadBuffer>> registry;
+uint64_t next_tid = 1;
+
+// names arriving from the bindings are transient Python strings; the
+// event records only pointers, so foreign names intern here for the
+// process lifetime (span labels are few even when spans are not)
+std::mutex intern_mutex;
+std::unordered_set<std::string> interned_names;
+
+ThreadBuffer& threadBuffer() {
+
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+
+        auto fresh = std::make_shared<ThreadBuffer>();
+
+        std::lock_guard<std::mutex> lock(registry_mutex);
+
+        fresh->tid = next_tid++;
+        registry.push_back(fresh);
+
+        return fresh;
+    }();
+
+    return *buffer;
+}
+
+// minimal JSON string escaping; span labels are identifiers in
+// practice, but a stray quote must not corrupt the file
+std::string escapeJson(
+    const std::string& text
+) {
+
+    std::string escaped;
+    escaped.reserve(text.size());
+
+    for (char c : text) {
+
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(c);
+        } else if (static_cast<unsigned char>(c) >= 0x20) {
+            escaped.push_back(c);
+        }
+    }
+
+    return escaped;
+}
+
+} // namespace
+
+TraceWriter& TraceWriter::instance() {
+
+    static TraceWriter writer;
+
+    return writer;
+}
+
+uint64_t TraceWriter::nowMicros() {
+
+    static const std::chrono::steady_clock::time_point origin =
+        std::chrono::steady_clock::now();
+
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - origin
+        ).count()
+    );
+}
+
+void TraceWriter::beginTrace(
+    const std::string& path
+) {
+
+    // fix the clock origin before the first span stamps against it
+    nowMicros();
+
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+
+        for (const auto& buffer : registry) {
+
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            buffer->events.clear();
+            buffer->dropped = 0;
+        }
+    }
+
+    this->output_path = path;
+    this->armed.store(true, std::memory_order_relaxed);
+}
+
+void TraceWriter::emit(
+    const char* name,
+    const char* category,
+    uint64_t ts_us,
+    uint64_t dur_us
+) {
+
+    if (!this->enabled()) {
+        return;
+    }
+
+    ThreadBuffer& buffer = threadBuffer();
+
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+
+    if (buffer.events.size() >= kMaxEventsPerThread) {
+
+        buffer.dropped++;
+
+        return;
+    }
+
+    buffer.events.push_back({ name, category, ts_us, dur_us });
+}
+
+void TraceWriter::nameThread(
+    const std::string& name
+) {
+
+    ThreadBuffer& buffer = threadBuffer();
+
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.thread_name = name;
+}
+
+void TraceWriter::endTrace() {
+
+    this->armed.store(false, std::memory_order_relaxed);
+
+    std::ofstream out(this->output_path);
+
+    if (!out) {
+
+        SC_LOG_WARN("trace file '" << this->output_path
+            << "' could not be opened; trace discarded");
+
+        return;
+    }
+
+    uint64_t pid = static_cast<uint64_t>(getpid());
+
+    out << "{\"traceEvents\":[\n";
+    out << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":" << pid
+        << ",\"args\":{\"name\":\"singlecell\"}}";
+
+    uint64_t total_dropped = 0;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    for (const auto& buffer : registry) {
+
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+
+        if (!buffer->thread_name.empty()) {
+
+            out << ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":"
+                << pid << ",\"tid\":" << buffer->tid
+                << ",\"args\":{\"name\":\""
+                << escapeJson(buffer->thread_name) << "\"}}";
+        }
+
+        for (const TraceEvent& event : buffer->events) {
+
+            out << ",\n{\"ph\":\"X\",\"name\":\""
+                << escapeJson(event.name)
+                << "\",\"cat\":\"" << escapeJson(event.category)
+                << "\",\"pid\":" << pid
+                << ",\"tid\":" << buffer->tid
+                << ",\"ts\":" << event.ts_us
+                << ",\"dur\":" << event.dur_us << "}";
+        }
+
+        total_dropped += buffer->dropped;
+        buffer->events.clear();
+        buffer->dropped = 0;
+    }
+
+    out << "\n]}\n";
+
+    if (total_dropped > 0) {
+
+        SC_LOG_WARN("trace dropped " << total_dropped
+            << " event(s) past the per-thread cap");
+    }
+}
+
+const char* TraceWriter::internName(
+    const std::string& name
+) {
+
+    std::lock_guard<std::mutex> lock(intern_mutex);
+
+    return interned_names.insert(name).first->c_str();
+}
@@ -0,0 +1,451 @@
+/**
+ * @file TrajectoryDiff.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief singlecell-diff: streaming comparison of two trajectory files
+ *
+ * Streams a candidate trajectory against a golden one row at a time —
+ * binary SCTRJ001 or the save_matrix TSV form, mixed freely — and
+ * accumulates per-species max deviation, RMS deviation and the first
+ * divergent timestep in O(row) memory. Exits nonzero on a tolerance
+ * violation, so the perf-test harness can gate every benchmark on it
+ * without a pandas round trip
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+//=========================Reader Definitions===============================//
+namespace {
+
+    /**
+     * @brief one trajectory file opened for sequential row reads; the
+     * format is sniffed from the leading bytes, so golden and candidate
+     * may be TSV and binary in any combination
+     */
+    class TrajectoryReader {
+        public:
+
+            bool open(const std::string& path) {
+
+                this->stream.open(path, std::ios::binary);
+
+                if (!this->stream) {
+                    fprintf(stderr, "singlecell-diff: cannot open %s\n",
+                            path.c_str());
+                    return false;
+                }
+
+                char magic[8] = {};
+                this->stream.read(magic, sizeof(magic));
+
+                this->binary = this->stream.gcount() == 8 &&
+                    std::memcmp(magic, "SCTRJ001", 8) == 0;
+
+                if (this->binary) {
+                    return this->readBinaryHeader(path);
+                }
+
+                // TSV: restart and consume the header line when present
+                this->stream.clear();
+                this->stream.seekg(0);
+
+                return this->readTsvHeader();
+            }
+
+            /**
+             * @brief reads the next row of values; row labels and the
+             * index column are skipped so only species values land
+             *
+             * @returns false once the file is exhausted
+             */
+            bool nextRow(std::vector<double>& row) {
+
+                if (this->binary) {
+
+                    if (this->rows_read >= this->binary_rows) {
+                        return false;
+                    }
+
+                    row.resize(this->num_cols);
+
+                    this->stream.read(
+                        reinterpret_cast<char*>(row.data()),
+                        this->num_cols * sizeof(double)
+                    );
+
+                    this->rows_read++;
+
+                    return this->stream.gcount() ==
+                        static_cast<std::streamsize>(
+                            this->num_cols * sizeof(double));
+                }
+
+                std::string line;
+
+                if (!std::getline(this->stream, line) || line.empty()) {
+                    return false;
+                }
+
+                // rows are 'label\tv1\tv2...' or '\tv1\tv2...'; either
+                // way everything after the first tab is values
+                row.clear();
+
+                size_t field_start = line.find('\t');
+
+                while (field_start != std::string::npos) {
+
+                    field_start++;
+
+                    size_t field_end = line.find('\t', field_start);
+
+                    row.push_back(std::strtod(
+                        line.c_str() + field_start, nullptr
+                    ));
+
+                    field_start = field_end;
+                }
+
+                if (this->num_cols == 0) {
+                    this->num_cols = row.size();
+                }
+
+                this->rows_read++;
+
+                return row.size() == this->num_cols;
+            }
+
+            size_t cols() const { return this->num_cols; }
+
+            const std::vector<std::string>& columnLabels() const {
+                return this->col_labels;
+            }
+
+        private:
+
+            bool readBinaryHeader(const std::string& path) {
+
+                uint64_t rows = 0;
+                uint64_t cols = 0;
+
+                this->stream.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+                this->stream.read(reinterpret_cast<char*>(&cols), sizeof(cols));
+
+                if (!this->stream) {
+                    fprintf(stderr, "singlecell-diff: truncated header in %s\n",
+                            path.c_str());
+                    return false;
+                }
+
+                this->binary_rows = rows;
+                this->num_cols = cols;
+
+                // column labels first, then row labels; both are
+                // newline-joined blocks prefixed by their byte size
+                this->col_labels = this->readLabelBlock();
+                this->readLabelBlock();
+
+                return static_cast<bool>(this->stream);
+            }
+
+            std::vector<std::string> readLabelBlock() {
+
+                uint64_t block_size = 0;
+
+                this->stream.read(
+                    reinterpret_cast<char*>(&block_size), sizeof(block_size)
+                );
+
+                std::string joined(block_size, '\0');
+
+                this->stream.read(joined.data(), block_size);
+
+                std::vector<std::string> labels;
+
+                size_t start = 0;
+
+                while (start <= joined.size() && !joined.empty()) {
+
+                    size_t end = joined.find('\n', start);
+
+                    labels.push_back(joined.substr(
+                        start, end == std::string::npos
+                            ? std::string::npos : end - start
+                    ));
+
+                    if (end == std::string::npos) {
+                        break;
+                    }
+
+                    start = end + 1;
+                }
+
+                return labels;
+            }
+
+            bool readTsvHeader() {
+
+                // provenance comment lines lead newer TSVs; skip down
+                // to the table itself
+                while (this->stream.peek() == '#') {
+
+                    std::string comment;
+
+                    if (!std::getline(this->stream, comment)) {
+                        return false;
+                    }
+                }
+
+                // header lines start 'index\t'; anything else is data
+                if (this->stream.peek() != 'i') {
+                    return true;
+                }
+
+                std::string line;
+
+                if (!std::getline(this->stream, line)) {
+                    return false;
+                }
+
+                size_t start = line.find('\t');
+
+                while (start != std::string::npos) {
+
+                    start++;
+
+                    size_t end = line.find('\t', start);
+
+                    this->col_labels.push_back(line.substr(
+                        start, end == std::string::npos
+                            ? std::string::npos : end - start
+                    ));
+
+                    start = end;
+                }
+
+                this->num_cols = this->col_labels.size();
+
+                return true;
+            }
+
+            std::ifstream stream;
+            bool binary = false;
+            uint64_t binary_rows = 0;
+            uint64_t rows_read = 0;
+            size_t num_cols = 0;
+            std::vector<std::string> col_labels;
+    };
+
+    void printUsage() {
+
+        printf("singlecell-diff: streaming trajectory comparison\n"
+               "\n"
+               "Example usage:\n"
+               "    singlecell-diff <golden> <candidate> [options]\n"
+               "===================flags======================\n"
+               "     --tolerance <Double> {[Optional] Default:1e-9 absolute deviation bound}\n"
+               "     --relative <Double> {[Optional] Default:0.0 relative deviation bound}\n"
+               "     --report <Integer> {[Optional] Default:10 worst species lines printed}\n"
+               "\n"
+               "Exit status: 0 within tolerance, 1 on violation, 2 on a\n"
+               "file or shape error.\n");
+    }
+
+} // namespace
+
+//=========================Function Definitions=============================//
+int main(
+    int argc,
+    char* argv[]
+) {
+
+    std::string golden_path;
+    std::string candidate_path;
+
+    double abs_tolerance = 1e-9;
+    double rel_tolerance = 0.0;
+    int report_lines = 10;
+
+    for (int i = 1; i < argc; i++) {
+
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            printUsage();
+            return 0;
+
+        } else if (arg == "--tolerance" && i + 1 < argc) {
+            abs_tolerance = std::strtod(argv[++i], nullptr);
+
+        } else if (arg == "--relative" && i + 1 < argc) {
+            rel_tolerance = std::strtod(argv[++i], nullptr);
+
+        } else if (arg == "--report" && i + 1 < argc) {
+            report_lines = static_cast<int>(
+                std::strtol(argv[++i], nullptr, 10));
+
+        } else if (golden_path.empty()) {
+            golden_path = arg;
+
+        } else if (candidate_path.empty()) {
+            candidate_path = arg;
+
+        } else {
+            fprintf(stderr, "singlecell-diff: unexpected argument %s\n",
+                    argv[i]);
+            return 2;
+        }
+    }
+
+    if (golden_path.empty() || candidate_path.empty()) {
+        printUsage();
+        return 2;
+    }
+
+    TrajectoryReader golden;
+    TrajectoryReader candidate;
+
+    if (!golden.open(golden_path) || !candidate.open(candidate_path)) {
+        return 2;
+    }
+
+    if (golden.cols() != 0 && candidate.cols() != 0 &&
+        golden.cols() != candidate.cols()) {
+
+        fprintf(stderr,
+                "singlecell-diff: column mismatch (%zu vs %zu)\n",
+                golden.cols(), candidate.cols());
+        return 2;
+    }
+
+    // one pass, O(row) state: streaming accumulators per species
+    std::vector<double> max_deviation;
+    std::vector<double> sum_squared;
+    std::vector<long long> first_divergence;
+
+    std::vector<double> golden_row;
+    std::vector<double> candidate_row;
+
+    long long row = 0;
+
+    while (true) {
+
+        bool golden_more = golden.nextRow(golden_row);
+        bool candidate_more = candidate.nextRow(candidate_row);
+
+        if (!golden_more && !candidate_more) {
+            break;
+        }
+
+        if (golden_more != candidate_more) {
+            fprintf(stderr,
+                    "singlecell-diff: row count mismatch after %lld rows\n",
+                    row);
+            return 2;
+        }
+
+        if (golden_row.size() != candidate_row.size()) {
+            fprintf(stderr,
+                    "singlecell-diff: column mismatch at row %lld\n", row);
+            return 2;
+        }
+
+        if (max_deviation.empty()) {
+            max_deviation.assign(golden_row.size(), 0.0);
+            sum_squared.assign(golden_row.size(), 0.0);
+            first_divergence.assign(golden_row.size(), -1);
+        }
+
+        for (size_t s = 0; s < golden_row.size(); s++) {
+
+            double deviation = std::abs(golden_row[s] - candidate_row[s]);
+
+            max_deviation[s] = std::max(max_deviation[s], deviation);
+            sum_squared[s] += deviation * deviation;
+
+            double bound = abs_tolerance + rel_tolerance *
+                std::max(std::abs(golden_row[s]), std::abs(candidate_row[s]));
+
+            if (deviation > bound && first_divergence[s] < 0) {
+                first_divergence[s] = row;
+            }
+        }
+
+        row++;
+    }
+
+    if (row == 0) {
+        fprintf(stderr, "singlecell-diff: no rows to compare\n");
+        return 2;
+    }
+
+    // worst species first; only the top report_lines are printed
+    std::vector<size_t> order(max_deviation.size());
+
+    for (size_t s = 0; s < order.size(); s++) {
+        order[s] = s;
+    }
+
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return max_deviation[a] > max_deviation[b];
+    });
+
+    const std::vector<std::string>& labels =
+        !golden.columnLabels().empty()
+            ? golden.columnLabels()
+            : candidate.columnLabels();
+
+    int violations = 0;
+
+    for (size_t s = 0; s < first_divergence.size(); s++) {
+        violations += first_divergence[s] >= 0 ? 1 : 0;
+    }
+
+    printf("Compared %lld rows x %zu species.\n", row, max_deviation.size());
+
+    for (int i = 0; i < report_lines &&
+             i < static_cast<int>(order.size()); i++) {
+
+        size_t s = order[i];
+
+        if (max_deviation[s] == 0.0) {
+            break;
+        }
+
+        std::string label = s < labels.size()
+            ? labels[s]
+            : "col" + std::to_string(s);
+
+        printf("  %-24s max %.6e rms %.6e first-divergence %s\n",
+               label.c_str(),
+               max_deviation[s],
+               std::sqrt(sum_squared[s] / static_cast<double>(row)),
+               first_divergence[s] >= 0
+                   ? std::to_string(first_divergence[s]).c_str()
+                   : "-");
+    }
+
+    if (violations > 0) {
+
+        printf("FAIL: %d of %zu species exceeded tolerance "
+               "(abs %.3e, rel %.3e).\n",
+               violations, max_deviation.size(),
+               abs_tolerance, rel_tolerance);
+        return 1;
+    }
+
+    printf("OK: all species within tolerance (abs %.3e, rel %.3e).\n",
+           abs_tolerance, rel_tolerance);
+
+    return 0;
+}
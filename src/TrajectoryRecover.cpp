@@ -0,0 +1,285 @@
+/**
+ * @file TrajectoryRecover.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief singlecell-recover: salvages interrupted trajectory streams
+ *
+ * A streamed run that dies leaves "<output>.partial" and a sibling
+ * "<output>.journal" of per-chunk row counts, byte counts and FNV-1a
+ * checksums. This tool replays the journal against the partial stream,
+ * keeps every chunk whose checksum still matches, truncates anything
+ * after the first damaged one, patches the header row count and renames
+ * the result into place — the same finalization a clean run performs.
+ * Combined with checkpoint resumption a preempted multi-day run loses
+ * minutes of output, not the whole file
+ */
+//===========================Library Import=================================//
+//Std Libraries
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+// POSIX truncate; the salvage is an O(1) in-place trim, not a copy
+#include <unistd.h>
+
+//=========================Function Definitions=============================//
+namespace {
+
+    /**
+     * @brief FNV-1a over a byte range, matching the journal writer
+     */
+    uint64_t hashBytes(const unsigned char* bytes, size_t count) {
+
+        uint64_t hash = 1469598103934665603ull;
+
+        for (size_t i = 0; i < count; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    void printUsage() {
+
+        printf("singlecell-recover: salvage an interrupted trajectory stream\n"
+               "\n"
+               "Example usage:\n"
+               "    singlecell-recover <output>.partial [recovered path]\n"
+               "\n"
+               "Reads the \"<output>.journal\" checksum journal beside the\n"
+               "partial stream, keeps every intact chunk, patches the header\n"
+               "and renames the recovered file into place (the stream's own\n"
+               "path unless a recovered path is given).\n"
+               "\n"
+               "Exit status: 0 on recovery, 2 on a file or format error.\n");
+    }
+
+} // namespace
+
+int main(
+    int argc,
+    char* argv[]
+) {
+
+    std::string partial_path;
+    std::string recovered_path;
+
+    for (int i = 1; i < argc; i++) {
+
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            printUsage();
+            return 0;
+
+        } else if (partial_path.empty()) {
+            partial_path = arg;
+
+        } else if (recovered_path.empty()) {
+            recovered_path = arg;
+
+        } else {
+            fprintf(stderr, "singlecell-recover: unexpected argument %s\n",
+                    argv[i]);
+            return 2;
+        }
+    }
+
+    if (partial_path.empty()) {
+        printUsage();
+        return 2;
+    }
+
+    // the stream's final path is the partial path minus its suffix
+    const std::string suffix = ".partial";
+
+    if (partial_path.size() <= suffix.size() ||
+        partial_path.compare(
+            partial_path.size() - suffix.size(), suffix.size(), suffix
+        ) != 0) {
+
+        fprintf(stderr,
+                "singlecell-recover: %s does not end in .partial\n",
+                partial_path.c_str());
+        return 2;
+    }
+
+    std::string final_path =
+        partial_path.substr(0, partial_path.size() - suffix.size());
+
+    std::string journal_path = final_path + ".journal";
+
+    if (recovered_path.empty()) {
+        recovered_path = final_path;
+    }
+
+    std::ifstream stream(partial_path, std::ios::binary);
+
+    if (!stream) {
+        fprintf(stderr, "singlecell-recover: cannot open %s\n",
+                partial_path.c_str());
+        return 2;
+    }
+
+    std::ifstream journal(journal_path, std::ios::binary);
+
+    if (!journal) {
+        fprintf(stderr, "singlecell-recover: cannot open journal %s\n",
+                journal_path.c_str());
+        return 2;
+    }
+
+    // header: magic, row-count placeholder, column count, two label blocks
+    char magic[8] = {};
+    stream.read(magic, sizeof(magic));
+
+    bool delta_stream = std::memcmp(magic, "SCTRJ002", 8) == 0;
+    bool ragged_stream = std::memcmp(magic, "SCTRJ003", 8) == 0;
+
+    // delta and ragged streams share the per-chunk frame layout
+    bool framed_stream = delta_stream || ragged_stream;
+
+    if (!framed_stream && std::memcmp(magic, "SCTRJ001", 8) != 0) {
+        fprintf(stderr,
+                "singlecell-recover: %s is not a SingleCell binary stream\n",
+                partial_path.c_str());
+        return 2;
+    }
+
+    uint64_t header_rows = 0;
+    uint64_t num_cols = 0;
+
+    stream.read(reinterpret_cast<char*>(&header_rows), sizeof(header_rows));
+    stream.read(reinterpret_cast<char*>(&num_cols), sizeof(num_cols));
+
+    for (int block = 0; block < 2; block++) {
+
+        uint64_t block_size = 0;
+        stream.read(reinterpret_cast<char*>(&block_size), sizeof(block_size));
+        stream.seekg(static_cast<std::streamoff>(block_size), std::ios::cur);
+    }
+
+    // ragged streams append their per-column interval schedule
+    if (ragged_stream) {
+
+        uint64_t interval_count = 0;
+        stream.read(reinterpret_cast<char*>(&interval_count),
+                    sizeof(interval_count));
+        stream.seekg(
+            static_cast<std::streamoff>(interval_count * sizeof(uint32_t)),
+            std::ios::cur
+        );
+    }
+
+    if (!stream) {
+        fprintf(stderr, "singlecell-recover: %s header is truncated\n",
+                partial_path.c_str());
+        return 2;
+    }
+
+    uint64_t valid_rows = 0;
+    uint64_t valid_end = static_cast<uint64_t>(stream.tellg());
+    uint64_t dropped_chunks = 0;
+
+    std::vector<unsigned char> payload;
+
+    // replay the journal: each intact chunk extends the keepable prefix,
+    // the first mismatch (or short read) ends the salvage
+    while (true) {
+
+        uint64_t chunk_rows = 0;
+        uint64_t payload_bytes = 0;
+        uint64_t checksum = 0;
+
+        journal.read(reinterpret_cast<char*>(&chunk_rows), sizeof(chunk_rows));
+        journal.read(reinterpret_cast<char*>(&payload_bytes), sizeof(payload_bytes));
+        journal.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+
+        if (!journal) {
+            break;
+        }
+
+        // framed streams carry each chunk's own row and byte counts
+        // ahead of the payload; those must match the journal entry
+        if (framed_stream) {
+
+            uint64_t framed_rows = 0;
+            uint64_t framed_bytes = 0;
+
+            stream.read(reinterpret_cast<char*>(&framed_rows), sizeof(framed_rows));
+            stream.read(reinterpret_cast<char*>(&framed_bytes), sizeof(framed_bytes));
+
+            if (!stream || framed_rows != chunk_rows ||
+                framed_bytes != payload_bytes) {
+
+                dropped_chunks++;
+                break;
+            }
+        }
+
+        payload.resize(payload_bytes);
+        stream.read(reinterpret_cast<char*>(payload.data()),
+                    static_cast<std::streamsize>(payload_bytes));
+
+        if (!stream ||
+            hashBytes(payload.data(), payload_bytes) != checksum) {
+
+            dropped_chunks++;
+            break;
+        }
+
+        valid_rows += chunk_rows;
+        valid_end = static_cast<uint64_t>(stream.tellg());
+    }
+
+    stream.close();
+    journal.close();
+
+    if (valid_rows == 0) {
+        fprintf(stderr,
+                "singlecell-recover: no intact chunks in %s\n",
+                partial_path.c_str());
+        return 2;
+    }
+
+    // trim damage, patch the row count, then publish with the same
+    // rename a clean finalize performs
+    if (truncate(partial_path.c_str(),
+                 static_cast<off_t>(valid_end)) != 0) {
+
+        fprintf(stderr, "singlecell-recover: cannot truncate %s\n",
+                partial_path.c_str());
+        return 2;
+    }
+
+    {
+        std::fstream patch(
+            partial_path, std::ios::binary | std::ios::in | std::ios::out
+        );
+
+        patch.seekp(8, std::ios::beg);
+        patch.write(reinterpret_cast<const char*>(&valid_rows),
+                    sizeof(valid_rows));
+    }
+
+    if (std::rename(partial_path.c_str(), recovered_path.c_str()) != 0) {
+        fprintf(stderr, "singlecell-recover: cannot rename %s to %s\n",
+                partial_path.c_str(), recovered_path.c_str());
+        return 2;
+    }
+
+    std::remove(journal_path.c_str());
+
+    printf("recovered %llu rows (%llu columns) to %s%s\n",
+           static_cast<unsigned long long>(valid_rows),
+           static_cast<unsigned long long>(num_cols),
+           recovered_path.c_str(),
+           dropped_chunks > 0 ? ", dropped a damaged tail chunk" : "");
+
+    return 0;
+}
@@ -0,0 +1,315 @@
+/**
+ * @file TsvReader.cpp
+ *
+ * @authors Jonah R. Huggins, Marc R. Birtwistle
+ * @date 01-09-2026
+ *
+ * @brief Memory-mapped chunk-parallel columnar TSV reader
+*/
+
+//===========================Library Import=================================//
+//Std Libraries
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <utility>
+#include <charconv>
+#include <stdexcept>
+
+// POSIX file mapping
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Internal libraries
+#include "singlecell/TaskScheduler.h"
+#include "singlecell/TsvReader.h"
+
+namespace {
+
+// chunk granularity: large enough that per-chunk bookkeeping is noise,
+// small enough that a handful of chunks still spread across the pool
+constexpr size_t kChunkBytes = 8u << 20;
+
+// full-cell double parse; an empty cell or trailing characters
+// disqualify, so "3.5x" stays text instead of silently truncating
+bool parseCell(
+    const char* begin,
+    const char* end,
+    double& value
+) {
+
+    if (begin == end) {
+        return false;
+    }
+
+    auto result = std::from_chars(begin, end, value);
+
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+// walks the complete lines of one span, skipping blank lines and '#'
+// comment lines; both passes share this walk, so their row counts and
+// row contents agree by construction
+template <typename Fn>
+void forEachLine(
+    const char* begin,
+    const char* end,
+    Fn&& fn
+) {
+
+    const char* p = begin;
+
+    while (p < end) {
+
+        const char* newline =
+            static_cast<const char*>(std::memchr(p, '\n', end - p));
+
+        const char* line_end = newline ? newline : end;
+
+        if (line_end > p && line_end[-1] == '\r') {
+            line_end--;
+        }
+
+        if (line_end > p && *p != '#') {
+            fn(p, line_end);
+        }
+
+        p = newline ? newline + 1 : end;
+    }
+}
+
+// splits one line into [begin, end) cell spans; no copies on this path
+void splitCells(
+    const char* begin,
+    const char* end,
+    char delimiter,
+    std::vector<std::pair<const char*, const char*>>& cells
+) {
+
+    cells.clear();
+
+    const char* p = begin;
+
+    while (true) {
+
+        const char* cut =
+            static_cast<const char*>(std::memchr(p, delimiter, end - p));
+
+        cells.emplace_back(p, cut ? cut : end);
+
+        if (cut == nullptr) {
+            break;
+        }
+
+        p = cut + 1;
+    }
+}
+
+} // namespace
+
+//=============================Class Details================================//
+TsvReader::Table TsvReader::read(
+    const std::string& path,
+    char delimiter
+) {
+
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        throw std::runtime_error("TsvReader: cannot open " + path);
+    }
+
+    struct stat file_info;
+
+    if (fstat(fd, &file_info) != 0) {
+        close(fd);
+        throw std::runtime_error("TsvReader: cannot stat " + path);
+    }
+
+    size_t file_bytes = static_cast<size_t>(file_info.st_size);
+
+    Table table;
+
+    if (file_bytes == 0) {
+        close(fd);
+        return table;
+    }
+
+    void* base = mmap(nullptr, file_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("TsvReader: cannot map " + path);
+    }
+
+    // the two passes stream the mapping front to back; tell the kernel
+    // so readahead runs at device depth
+    madvise(base, file_bytes, MADV_SEQUENTIAL);
+
+    const char* text = static_cast<const char*>(base);
+    const char* text_end = text + file_bytes;
+
+    // provenance comment lines hop, then the header row names the
+    // columns; everything below it is data
+    const char* data_begin = text_end;
+
+    std::vector<std::pair<const char*, const char*>> cells;
+
+    forEachLine(text, text_end, [&](const char* begin, const char* end) {
+
+        if (!table.column_names.empty()) {
+            return;
+        }
+
+        splitCells(begin, end, delimiter, cells);
+
+        for (const auto& [cell_begin, cell_end] : cells) {
+            table.column_names.emplace_back(cell_begin, cell_end);
+        }
+
+        // data starts at the next line boundary after the header
+        const char* newline = static_cast<const char*>(
+            std::memchr(end, '\n', text_end - end)
+        );
+
+        data_begin = newline ? newline + 1 : text_end;
+    });
+
+    size_t num_cols = table.column_names.size();
+
+    if (num_cols == 0 || data_begin >= text_end) {
+        munmap(base, file_bytes);
+        return table;
+    }
+
+    // type sniff against the first data row
+    table.is_numeric.assign(num_cols, 0);
+
+    bool sniffed = false;
+
+    forEachLine(data_begin, text_end, [&](const char* begin, const char* end) {
+
+        if (sniffed) {
+            return;
+        }
+
+        sniffed = true;
+
+        splitCells(begin, end, delimiter, cells);
+
+        for (size_t j = 0; j < num_cols && j < cells.size(); j++) {
+
+            double value;
+
+            if (parseCell(cells[j].first, cells[j].second, value)) {
+                table.is_numeric[j] = 1;
+            }
+        }
+    });
+
+    // chunk boundaries snap forward to the next newline, so every line
+    // belongs to exactly one chunk
+    std::vector<const char*> bounds;
+    bounds.push_back(data_begin);
+
+    while (bounds.back() < text_end) {
+
+        const char* target = bounds.back() + kChunkBytes;
+
+        if (target >= text_end) {
+            bounds.push_back(text_end);
+            break;
+        }
+
+        const char* newline = static_cast<const char*>(
+            std::memchr(target, '\n', text_end - target)
+        );
+
+        bounds.push_back(newline ? newline + 1 : text_end);
+    }
+
+    int num_chunks = static_cast<int>(bounds.size()) - 1;
+
+    // pass 1: count each chunk's rows, so the parse pass can write
+    // straight into precomputed row ranges with no locks
+    std::vector<size_t> chunk_rows(num_chunks, 0);
+
+    TaskScheduler::instance().parallelFor(num_chunks, [&](int c) {
+
+        size_t rows = 0;
+
+        forEachLine(bounds[c], bounds[c + 1],
+                    [&](const char*, const char*) { rows++; });
+
+        chunk_rows[c] = rows;
+    });
+
+    std::vector<size_t> row_base(num_chunks + 1, 0);
+
+    for (int c = 0; c < num_chunks; c++) {
+        row_base[c + 1] = row_base[c] + chunk_rows[c];
+    }
+
+    table.num_rows = row_base[num_chunks];
+
+    table.numeric_columns.resize(num_cols);
+    table.text_columns.resize(num_cols);
+
+    for (size_t j = 0; j < num_cols; j++) {
+
+        if (table.is_numeric[j]) {
+            table.numeric_columns[j].assign(
+                table.num_rows, std::numeric_limits<double>::quiet_NaN()
+            );
+        } else {
+            table.text_columns[j].resize(table.num_rows);
+        }
+    }
+
+    // pass 2: parse. Each chunk owns rows [row_base[c], row_base[c+1]),
+    // so concurrent writes never touch the same element
+    TaskScheduler::instance().parallelFor(num_chunks, [&](int c) {
+
+        std::vector<std::pair<const char*, const char*>> row_cells;
+
+        size_t row = row_base[c];
+
+        forEachLine(bounds[c], bounds[c + 1],
+                    [&](const char* begin, const char* end) {
+
+            splitCells(begin, end, delimiter, row_cells);
+
+            size_t filled = std::min(num_cols, row_cells.size());
+
+            for (size_t j = 0; j < filled; j++) {
+
+                if (table.is_numeric[j]) {
+
+                    double value;
+
+                    if (parseCell(
+                            row_cells[j].first, row_cells[j].second, value)) {
+                        table.numeric_columns[j][row] = value;
+                    }
+
+                } else {
+
+                    table.text_columns[j][row].assign(
+                        row_cells[j].first, row_cells[j].second
+                    );
+                }
+            }
+
+            row++;
+        });
+    });
+
+    munmap(base, file_bytes);
+
+    return table;
+}
@@ -14,14 +14,130 @@
 
 // Internal Libraries
 #include "singlecell/SingleCell.h"    // class header
+#include "singlecell/TaskScheduler.h"
+#include "singlecell/CellPopulation.h"
+#include "singlecell/ExperimentRunner.h"
+#include "singlecell/ResultsArchive.h"
+#include "singlecell/TsvReader.h"
+#include "singlecell/TraceWriter.h"
 
 // Third Party Libraries
 #include <pybind11/stl.h>  // needed for std::vector, std::string
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 namespace py = pybind11;
 
+/* Python-side handle for a streaming run: iterating it yields one NumPy
+array per completed chunk while the C++ producer thread keeps
+simulating; a keep_alive tie on simulate_stream keeps the session alive
+for the stream's lifetime */
+struct SingleCellStream {
+    SingleCell* session;
+    bool closed = false;
+};
+
 PYBIND11_MODULE(pySingleCell, m) {
+
+    // fixes the shared worker-pool width for every parallel feature;
+    // call before the first parallel run (0 = all cores)
+    m.def(
+        "configureThreads",
+        [](int num_threads) {
+            TaskScheduler::instance().configure(num_threads);
+        },
+        py::arg("num_threads") = 0
+    );
+
+    // cache-warm the listed SBML files (binary snapshots, derived-
+    // structure memos, AMICI shared objects) without simulating;
+    // schedulers call this ahead of queued jobs
+    m.def(
+        "preload",
+        [](const std::vector<std::string>& sbml_paths) {
+            SingleCell::preload(sbml_paths);
+        },
+        py::arg("sbml_paths")
+    );
+
+    // columnar TSV ingestion through the memory-mapped chunk-parallel
+    // C++ reader: returns {column name: float64 array | str list}, the
+    // shape pandas.DataFrame consumes directly, so multi-GB measurement
+    // files skip the scalar python parse entirely
+    m.def(
+        "read_tsv",
+        [](const std::string& path) {
+
+            TsvReader::Table table = TsvReader::read(path);
+
+            py::dict columns;
+
+            for (size_t j = 0; j < table.column_names.size(); j++) {
+
+                py::str name(table.column_names[j]);
+
+                if (table.is_numeric[j]) {
+
+                    columns[name] = py::array_t<double>(
+                        { table.num_rows },
+                        { sizeof(double) },
+                        table.numeric_columns[j].data()
+                    );
+
+                } else {
+
+                    columns[name] = py::cast(table.text_columns[j]);
+                }
+            }
+
+            return columns;
+        },
+        py::arg("path")
+    );
+
+    /* chrome-trace span collection: Python orchestration stamps spans
+    on the same steady clock the C++ phase timers use, so one perfetto
+    file nests the whole pipeline — orchestration, bindings, stepping
+    phases and the I/O threads */
+    m.def(
+        "trace_begin",
+        [](const std::string& path) {
+            TraceWriter::instance().beginTrace(path);
+        },
+        py::arg("path")
+    );
+
+    m.def("trace_end", []() { TraceWriter::instance().endTrace(); });
+
+    m.def("trace_now_us", []() { return TraceWriter::nowMicros(); });
+
+    m.def(
+        "trace_emit",
+        [](const std::string& name, const std::string& category,
+           uint64_t ts_us, uint64_t dur_us) {
+
+            /* events hold bare pointers; transient Python labels intern
+            for the process lifetime */
+            TraceWriter::instance().emit(
+                TraceWriter::internName(name),
+                TraceWriter::internName(category),
+                ts_us, dur_us
+            );
+        },
+        py::arg("name"),
+        py::arg("category"),
+        py::arg("ts_us"),
+        py::arg("dur_us")
+    );
+
+    m.def(
+        "trace_name_thread",
+        [](const std::string& name) {
+            TraceWriter::instance().nameThread(name);
+        },
+        py::arg("name")
+    );
+
     py::class_<SingleCell, py::smart_holder>(m, "SingleCell")
         /* lines 27:29 are a makeshift solution for dynamic module loading, as
         Pybind11 does not support variadic constructors. If 4+ SBML paths are 
@@ -30,15 +146,932 @@ PYBIND11_MODULE(pySingleCell, m) {
         .def(py::init<const std::string&>())
         .def(py::init<const std::string&, const std::string&>())
         .def(py::init<const std::string&, const std::string&, const std::string&>())
-        .def("simulate", &SingleCell::simulate, 
+        .def("simulate",
+            [](SingleCell& self, double start, double stop, double step,
+               double steady_state_tol, int n_replicates) -> py::array_t<double> {
+
+                self.setSteadyStateTolerance(steady_state_tol);
+
+                /* run into one contiguous buffer, then hand the memory to
+                NumPy without copying: a capsule owns the heap vector and
+                frees it when the array is garbage-collected */
+                std::vector<double> results;
+
+                {
+                    /* the whole run is pure C++; let other Python threads
+                    (e.g. Worker.py cell threads) execute concurrently */
+                    py::gil_scoped_release release;
+
+                    results = n_replicates > 1
+                        ? self.simulateReplicatesFlat(
+                              start, stop, step, n_replicates
+                          )
+                        : self.simulateFlat(start, stop, step);
+                }
+
+                auto* buffer = new std::vector<double>(std::move(results));
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                /* replicate runs stack to (replicate, time, species);
+                derived substreams were drawn inside the C++ layer */
+                if (n_replicates > 1) {
+
+                    return py::array_t<double>(
+                        {static_cast<size_t>(n_replicates),
+                         self.last_num_timesteps,
+                         self.last_num_species},
+                        {self.last_num_timesteps * self.last_num_species * sizeof(double),
+                         self.last_num_species * sizeof(double),
+                         sizeof(double)},
+                        buffer->data(),
+                        owner
+                    );
+                }
+
+                /* species-major sessions hand back the transposed
+                geometry; the buffer was converted in simulateFlat */
+                size_t rows = self.isResultsSpeciesMajor()
+                    ? self.last_num_species : self.last_num_timesteps;
+                size_t cols = self.isResultsSpeciesMajor()
+                    ? self.last_num_timesteps : self.last_num_species;
+
+                return py::array_t<double>(
+                    {rows, cols},
+                    {cols * sizeof(double), sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("steady_state_tol") = 0.0,
+            py::arg("n_replicates") = 1
+        )
+        .def("setResultsLayout", &SingleCell::setResultsLayout,
+        py::arg("species_major")
+        )
+        .def("simulateBatch",
+            [](SingleCell& self,
+               const std::vector<std::vector<std::pair<std::string, double>>>& conditions,
+               double start, double stop, double step, int num_threads) {
+                /* the whole batch runs on a C++ thread pool; hand the
+                stacked buffer to NumPy without copying, same capsule
+                ownership scheme as simulate above */
+                std::vector<double> results;
+
+                {
+                    py::gil_scoped_release release;
+
+                    results = self.simulateBatch(
+                        conditions, start, stop, step, num_threads
+                    );
+                }
+
+                auto* buffer = new std::vector<double>(std::move(results));
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                return py::array_t<double>(
+                    {conditions.size(),
+                     self.last_num_timesteps,
+                     self.last_num_species},
+                    {self.last_num_timesteps * self.last_num_species * sizeof(double),
+                     self.last_num_species * sizeof(double),
+                     sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
+            py::arg("conditions"),
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("num_threads") = 0
+        )
+        .def("simulateEnsemble",
+            [](SingleCell& self,
+               double start, double stop, double step,
+               int num_replicates, double feedback_tolerance,
+               int num_threads) {
+                /* replicates share the reference ODE trajectory on a C++
+                thread pool; hand the stacked buffer to NumPy without
+                copying, same capsule ownership scheme as simulate above */
+                std::vector<double> results;
+
+                {
+                    py::gil_scoped_release release;
+
+                    results = self.simulateEnsembleFlat(
+                        start, stop, step,
+                        num_replicates, feedback_tolerance, num_threads
+                    );
+                }
+
+                auto* buffer = new std::vector<double>(std::move(results));
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                return py::array_t<double>(
+                    {static_cast<size_t>(num_replicates),
+                     self.last_num_timesteps,
+                     self.last_num_species},
+                    {self.last_num_timesteps * self.last_num_species * sizeof(double),
+                     self.last_num_species * sizeof(double),
+                     sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("num_replicates") = 1,
+            py::arg("feedback_tolerance") = 0.05,
+            py::arg("num_threads") = 0
+        )
+        .def("setSeed", &SingleCell::setSeed,
+        py::arg("seed")
+        )
+        .def("setParallelStepping", &SingleCell::setParallelStepping,
+        py::arg("enable")
+        )
+        .def("setProgressReporting", &SingleCell::setProgressReporting,
+        py::arg("interval_seconds"),
+        py::arg("status_path") = ""
+        )
+        .def("setStreamOutput", &SingleCell::setStreamOutput,
+        py::arg("path_prefix"),
+        py::arg("delta_compress") = false
+        )
+        .def("setSpeciesRecordingIntervals",
+        &SingleCell::setSpeciesRecordingIntervals,
+        py::arg("species_ids"),
+        py::arg("intervals")
+        )
+        .def("setResultsBackingStore", &SingleCell::setResultsBackingStore,
+        py::arg("path_prefix")
+        )
+        .def("estimateRunMemory", &SingleCell::estimateRunMemory,
+        py::arg("start"),
+        py::arg("stop"),
+        py::arg("step")
+        )
+        .def("setMemoryBudget", &SingleCell::setMemoryBudget,
+        py::arg("max_bytes"),
+        py::arg("spill_path_prefix") = std::string()
+        )
+        .def("getResultsWindow",
+            [](SingleCell& self, size_t first_row, size_t num_rows) {
+                /* slice of the recorded matrix; only the requested rows
+                are assembled, so mapped larger-than-RAM runs stay cold */
+                auto* buffer = new std::vector<double>(
+                    self.getResultsWindow(first_row, num_rows)
+                );
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                size_t rows = self.last_num_species > 0
+                    ? buffer->size() / self.last_num_species
+                    : 0;
+
+                return py::array_t<double>(
+                    {rows, self.last_num_species},
+                    {self.last_num_species * sizeof(double), sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
+            py::arg("first_row"),
+            py::arg("num_rows")
+        )
+        .def("resume", &SingleCell::resume,
+        py::arg("ckpt_path"),
+        py::arg("start") = 0.0,
+        py::arg("stop") = 60.0,
+        py::arg("step") = 30.0,
+        py::call_guard<py::gil_scoped_release>()
+        )
+        .def("saveModuleResults", &SingleCell::saveModuleResults,
+        py::arg("output"),
+        py::call_guard<py::gil_scoped_release>()
+        )
+        .def("setBatchContinuation", &SingleCell::setBatchContinuation,
+        py::arg("enabled")
+        )
+        .def("extend", &SingleCell::extend,
+        py::arg("new_stop"),
+        py::call_guard<py::gil_scoped_release>()
+        )
+        .def("reset", &SingleCell::reset,
+        py::arg("initial_state") = std::vector<double>()
+        )
+        .def("setCheckpoint", &SingleCell::setCheckpoint,
+        py::arg("path"),
+        py::arg("interval"),
+        py::arg("light_interval") = 0
+        )
+        .def("setExchangeTolerance", &SingleCell::setExchangeTolerance,
+        py::arg("tolerance")
+        )
+        .def("setExchangeView", &SingleCell::setExchangeView,
+        py::arg("name"),
+        py::arg("entity_ids")
+        )
+        .def("setMacroStepping", &SingleCell::setMacroStepping,
+        py::arg("micro_steps")
+        )
+        .def("setSpeculativeStepping", &SingleCell::setSpeculativeStepping,
+        py::arg("tolerance")
+        )
+        .def("setConservationElimination", &SingleCell::setConservationElimination,
+        py::arg("enable")
+        )
+        .def("setStepIntervals", &SingleCell::setStepIntervals,
+        py::arg("leap_seconds"),
+        py::arg("exchange_seconds"),
+        py::arg("record_seconds")
+        )
+        .def("beginStepping", &SingleCell::beginStepping,
+        py::arg("start") = 0.0,
+        py::arg("stop") = 60.0,
+        py::arg("step") = 30.0
+        )
+        .def("advanceTo", &SingleCell::advanceTo,
+        py::arg("t"),
+        py::call_guard<py::gil_scoped_release>()
+        )
+        .def("getCurrentState", &SingleCell::getCurrentState)
+        .def("stepOnce",
+            [](py::object self_obj) {
+                /* latency path: the returned array aliases the session's
+                persistent view buffer — no copy, no fresh allocation —
+                with the session object as base so the buffer outlives
+                the array. Contents change on the next stepOnce */
+                SingleCell& self = self_obj.cast<SingleCell&>();
+
+                const std::vector<double>& state = self.stepOnce();
+
+                return py::array_t<double>(
+                    { static_cast<py::ssize_t>(state.size()) },
+                    { static_cast<py::ssize_t>(sizeof(double)) },
+                    state.data(),
+                    self_obj
+                );
+            }
+        )
+        .def("finishStepping", &SingleCell::finishStepping)
+        .def("simulate_stream",
+            [](SingleCell& self, double start, double stop, double step,
+               int chunk_steps) {
+                /* the producer thread starts here; chunks are consumed
+                through the returned iterator */
+                {
+                    py::gil_scoped_release release;
+
+                    self.beginStreaming(start, stop, step, chunk_steps);
+                }
+
+                return SingleCellStream{&self};
+            },
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("chunk_steps") = 1,
+            /* the stream handle keeps its session alive */
+            py::keep_alive<0, 1>()
+        )
+        .def("setSteadyStateTolerance", &SingleCell::setSteadyStateTolerance,
+        py::arg("tolerance"),
+        py::arg("window") = 5
+        )
+        .def("setSolverProfile", &SingleCell::setSolverProfile,
+        py::arg("name")
+        )
+        .def("setPerfOutput", &SingleCell::setPerfOutput,
+        py::arg("output")
+        )
+        .def("setEntityProfiling", &SingleCell::setEntityProfiling,
+        py::arg("output")
+        )
+        .def("setProgressInterval", &SingleCell::setProgressInterval,
+        py::arg("interval")
+        )
+        .def("setRecording", &SingleCell::setRecording,
+        py::arg("interval"),
+        py::arg("species_subset") = std::vector<std::string>{}
+        )
+        .def("setRecordingPrecision", &SingleCell::setRecordingPrecision,
+        py::arg("mantissa_bits")
+        )
+        .def("setSummaryRecording", &SingleCell::setSummaryRecording,
+        py::arg("window_steps")
+        )
+        .def("getSummary",
+            [](SingleCell& self, const std::string& statistic) {
+                /* one envelope statistic, shaped windows x species to
+                match the combined results column order */
+                auto* buffer = new std::vector<double>(
+                    self.getSummary(statistic)
+                );
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                size_t rows = self.last_num_species > 0
+                    ? buffer->size() / self.last_num_species
+                    : 0;
+
+                return py::array_t<double>(
+                    {rows, self.last_num_species},
+                    {self.last_num_species * sizeof(double), sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
+        py::arg("statistic")
+        )
+        .def("setObservables", &SingleCell::setObservables,
+        py::arg("observables")
+        )
+        .def("setObservablePruning", &SingleCell::setObservablePruning,
+        py::arg("enable")
+        )
+        .def("setKernelAutotune", &SingleCell::setKernelAutotune,
+        py::arg("enable")
+        )
+        .def("setPipelinedRecording", &SingleCell::setPipelinedRecording,
+        py::arg("enable")
+        )
+        .def("setResultsWindow", &SingleCell::setResultsWindow,
+        py::arg("recorded_rows")
+        )
+        .def("getFirstRetainedRow", &SingleCell::getFirstRetainedRow)
+        .def("simulateObservables",
+            [](SingleCell& self, double start, double stop, double step) {
+                /* same capsule ownership scheme as simulate, but rows are
+                the registered observables instead of raw species */
+                std::vector<double> results;
+
+                {
+                    py::gil_scoped_release release;
+
+                    results = self.simulateObservablesFlat(start, stop, step);
+                }
+
+                auto* buffer = new std::vector<double>(std::move(results));
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                return py::array_t<double>(
+                    {self.last_num_timesteps, self.last_num_species},
+                    {self.last_num_species * sizeof(double), sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
             py::arg("start") = 0.0,
             py::arg("stop") = 60.0,
             py::arg("step") = 30.0
         )
+        .def("getObservableNames", &SingleCell::getObservableNames)
+        .def("addThresholdProbe", &SingleCell::addThresholdProbe,
+        py::arg("name"),
+        py::arg("species_id"),
+        py::arg("threshold"),
+        py::arg("rising") = true
+        )
+        .def("addPeakProbe", &SingleCell::addPeakProbe,
+        py::arg("name"),
+        py::arg("species_id")
+        )
+        .def("addPredicateProbe", &SingleCell::addPredicateProbe,
+        py::arg("name"),
+        py::arg("expression")
+        )
+        .def("getEventTable",
+            [](const SingleCell& self) {
+                /* list of (probe, time, value) tuples; never-fired probes
+                carry NaN so pandas drops or censors them cleanly */
+                py::list table;
+
+                for (const auto& record : self.getEventTable()) {
+                    table.append(py::make_tuple(
+                        record.probe, record.time, record.value
+                    ));
+                }
+
+                return table;
+            }
+        )
+        .def("clearEventProbes", &SingleCell::clearEventProbes)
+        .def("setSensitivityParameters", &SingleCell::setSensitivityParameters,
+        py::arg("parameter_ids")
+        )
+        .def("bindParameters", &SingleCell::bindParameters,
+        py::arg("parameter_ids")
+        )
+        .def("setParameters", &SingleCell::setParameters,
+        py::arg("values")
+        )
+        .def("getSensitivities",
+            [](SingleCell& self) {
+                /* copy out of the module-owned buffer into a 3-D array of
+                shape (timepoints, parameters, states) */
+                const std::vector<double>& sens = self.getSensitivities();
+
+                size_t n_params = self.last_num_sensitivity_parameters;
+                size_t n_states = self.last_num_sensitivity_states;
+                size_t n_steps = (n_params && n_states)
+                    ? sens.size() / (n_params * n_states)
+                    : 0;
+
+                auto* buffer = new std::vector<double>(sens);
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                return py::array_t<double>(
+                    {n_steps, n_params, n_states},
+                    {n_params * n_states * sizeof(double),
+                     n_states * sizeof(double),
+                     sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            }
+        )
+        .def("getRecordedSpeciesIds", &SingleCell::getRecordedSpeciesIds)
+        .def("getTrajectory",
+            [](py::object self_obj, const std::string& species_id) -> py::object {
+                SingleCell& self = self_obj.cast<SingleCell&>();
+
+                const std::vector<double>& flat = self.getResultsView();
+
+                std::vector<std::string> ids = self.getRecordedSpeciesIds();
+                auto position = std::find(ids.begin(), ids.end(), species_id);
+
+                if (!flat.empty() && position != ids.end()) {
+
+                    /* zero-copy strided column view into the session's
+                    results buffer; passing the session as base keeps the
+                    buffer alive for the view's lifetime */
+                    size_t col = std::distance(ids.begin(), position);
+
+                    return py::array_t<double>(
+                        {self.last_num_timesteps},
+                        {self.last_num_species * sizeof(double)},
+                        flat.data() + col,
+                        self_obj
+                    );
+                }
+
+                /* backing-store mode (and unknown-id errors) go through
+                the gathering C++ path */
+                std::vector<double> trajectory = self.getTrajectory(species_id);
+
+                return py::array_t<double>(
+                    static_cast<py::ssize_t>(trajectory.size()),
+                    trajectory.data()
+                );
+            },
+            py::arg("species_id")
+        )
+        .def("getTimeSlice",
+            [](py::object self_obj, size_t t) -> py::object {
+                SingleCell& self = self_obj.cast<SingleCell&>();
+
+                const std::vector<double>& flat = self.getResultsView();
+
+                if (!flat.empty() && t < self.last_num_timesteps) {
+
+                    /* zero-copy row view, same base-object scheme as
+                    getTrajectory above */
+                    return py::array_t<double>(
+                        {self.last_num_species},
+                        {sizeof(double)},
+                        flat.data() + t * self.last_num_species,
+                        self_obj
+                    );
+                }
+
+                std::vector<double> slice = self.getTimeSlice(t);
+
+                return py::array_t<double>(
+                    static_cast<py::ssize_t>(slice.size()),
+                    slice.data()
+                );
+            },
+            py::arg("t")
+        )
+        .def("getWindow",
+            [](SingleCell& self,
+               const std::vector<std::string>& species_ids,
+               size_t t0, size_t t1) {
+                /* arbitrary species subsets are not contiguous, so the
+                window is gathered once into an owned array; only the
+                requested bytes are read from the results */
+                auto* buffer = new std::vector<double>(
+                    self.getWindow(species_ids, t0, t1)
+                );
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                size_t cols = species_ids.size();
+                size_t rows = cols > 0 ? buffer->size() / cols : 0;
+
+                return py::array_t<double>(
+                    {rows, cols},
+                    {cols * sizeof(double), sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
+            py::arg("species_ids"),
+            py::arg("t0"),
+            py::arg("t1")
+        )
         .def("modify", &SingleCell::modify,
-        py::arg("entity_id"), 
+        py::arg("entity_id"),
         py::arg("value")
         )
-        .def("getGlobalSpeciesIds", &SingleCell::getGlobalSpeciesIds);
+        .def("modifyBulk", &SingleCell::modifyBulk,
+        py::arg("entity_values")
+        )
+        .def("getGlobalSpeciesIds", &SingleCell::getGlobalSpeciesIds)
+        .def("getModelMetadata",
+            [](SingleCell& self) {
+                /* one call replaces per-task TSV-header parsing: every
+                list comes from the cached ModelData registries, so no
+                libSBML traversal happens here. Callers keep the dict */
+                py::dict meta;
+
+                py::list modules;
+                py::list species_offsets;
+                py::dict parameter_ids;
+                py::dict reaction_ids;
+
+                size_t offset = 0;
+
+                for (auto& handler : self.handlers) {
+
+                    modules.append(handler.name);
+
+                    // start of this module's block in the global
+                    // species id (and results column) ordering
+                    species_offsets.append(offset);
+
+                    offset += handler.getSpeciesIds().size();
+
+                    parameter_ids[py::str(handler.name)] =
+                        handler.getParameterIds();
+
+                    reaction_ids[py::str(handler.name)] =
+                        handler.getReactionIds();
+                }
+
+                meta["modules"] = modules;
+                meta["species_ids"] = self.getGlobalSpeciesIds();
+                meta["species_offsets"] = species_offsets;
+                meta["parameter_ids"] = parameter_ids;
+                meta["reaction_ids"] = reaction_ids;
+
+                return meta;
+            }
+        );
         // JONAH-->Add more methods here as needed
+
+    py::class_<SingleCellStream>(m, "SingleCellStream")
+        .def("__iter__", [](py::object self) { return self; })
+        .def("__next__",
+            [](SingleCellStream& stream) {
+                if (stream.closed) {
+                    throw py::stop_iteration();
+                }
+
+                std::vector<double> chunk;
+                size_t num_rows = 0;
+                bool have_chunk;
+
+                {
+                    /* blocking on the producer without the GIL lets the
+                    consumer's other Python threads keep running */
+                    py::gil_scoped_release release;
+
+                    have_chunk = stream.session->nextChunk(chunk, num_rows);
+
+                    if (!have_chunk) {
+                        stream.session->endStreaming();
+                    }
+                }
+
+                if (!have_chunk) {
+                    stream.closed = true;
+                    throw py::stop_iteration();
+                }
+
+                /* same capsule ownership scheme as simulate: the chunk
+                buffer is handed to NumPy without copying */
+                auto* buffer = new std::vector<double>(std::move(chunk));
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                size_t cols = stream.session->last_num_species;
+
+                return py::object(py::array_t<double>(
+                    {num_rows, cols},
+                    {cols * sizeof(double), sizeof(double)},
+                    buffer->data(),
+                    owner
+                ));
+            }
+        )
+        .def("close",
+            [](SingleCellStream& stream) {
+                /* early termination (e.g. apoptosis commitment detected):
+                cancels the producer and closes the session */
+                if (!stream.closed) {
+
+                    stream.closed = true;
+
+                    py::gil_scoped_release release;
+
+                    stream.session->endStreaming();
+                }
+            }
+        )
+        .def("__enter__", [](py::object self) { return self; })
+        .def("__exit__",
+            [](py::object self, py::object, py::object, py::object) {
+                self.attr("close")();
+                return false;
+            }
+        );
+
+    py::class_<CellPopulation, py::smart_holder>(m, "CellPopulation")
+        .def(py::init<std::vector<std::string>, int>(),
+        py::arg("sbml_paths"),
+        py::arg("num_cells")
+        )
+        .def("setSeed", &CellPopulation::setSeed,
+        py::arg("seed")
+        )
+        .def("setRecording", &CellPopulation::setRecording,
+        py::arg("interval"),
+        py::arg("species_subset") = std::vector<std::string>{}
+        )
+        .def("setExchangeView", &CellPopulation::setExchangeView,
+        py::arg("name"),
+        py::arg("entity_ids")
+        )
+        .def("simulate", &CellPopulation::simulate,
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("num_threads") = 0,
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def("simulateSynchronized", &CellPopulation::simulateSynchronized,
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("num_threads") = 0,
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def("setSlabLayout", &CellPopulation::setSlabLayout,
+        py::arg("layout")
+        )
+        .def("getSlabLayout", &CellPopulation::getSlabLayout)
+        .def("simulateSynchronizedFlat",
+            [](CellPopulation& self, double start, double stop, double step,
+               int num_threads) -> py::array_t<double> {
+
+                std::vector<double> slab;
+
+                {
+                    py::gil_scoped_release release;
+
+                    slab = self.simulateSynchronizedFlat(
+                        start, stop, step, num_threads
+                    );
+                }
+
+                auto* buffer = new std::vector<double>(std::move(slab));
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                std::string layout = self.getSlabLayout();
+                size_t cells = self.last_slab_cells;
+                size_t rows = self.last_slab_timesteps;
+                size_t cols = self.last_slab_species;
+
+                /* the two flat layouts map onto NumPy strides directly;
+                the tiled layout has no stride representation, so it
+                hands back the raw 1-D slab and get_slab_layout tells the
+                caller the tile width to index with */
+                if (layout == "cell") {
+
+                    return py::array_t<double>(
+                        {cells, rows, cols},
+                        {rows * cols * sizeof(double),
+                         cols * sizeof(double),
+                         sizeof(double)},
+                        buffer->data(),
+                        owner
+                    );
+                }
+
+                if (layout == "species") {
+
+                    return py::array_t<double>(
+                        {rows, cols, cells},
+                        {cols * cells * sizeof(double),
+                         cells * sizeof(double),
+                         sizeof(double)},
+                        buffer->data(),
+                        owner
+                    );
+                }
+
+                return py::array_t<double>(
+                    {buffer->size()},
+                    {sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+            },
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("num_threads") = 0
+        )
+        .def("setNumaAware", &CellPopulation::setNumaAware,
+        py::arg("enable")
+        )
+        .def("setSummaryQuantiles", &CellPopulation::setSummaryQuantiles,
+        py::arg("quantiles")
+        )
+        .def("setCrossingThresholds", &CellPopulation::setCrossingThresholds,
+        py::arg("thresholds")
+        )
+        .def("simulateStatistics", &CellPopulation::simulateStatistics,
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::arg("num_threads") = 0,
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def("replayCell", &CellPopulation::replayCell,
+            py::arg("cell_index"),
+            py::arg("start") = 0.0,
+            py::arg("stop") = 60.0,
+            py::arg("step") = 30.0,
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def("setShard", &CellPopulation::setShard,
+        py::arg("shard_index"),
+        py::arg("num_shards")
+        )
+        .def("exportAccumulators", &CellPopulation::exportAccumulators)
+        .def("mergeAccumulators", &CellPopulation::mergeAccumulators,
+        py::arg("packed")
+        )
+        .def("finalizeStatistics", &CellPopulation::finalizeStatistics)
+        .def("getCrossingFractions", &CellPopulation::getCrossingFractions)
+        .def("getGlobalSpeciesIds", &CellPopulation::getGlobalSpeciesIds);
+
+    py::class_<ExperimentRunner, py::smart_holder>(m, "ExperimentRunner")
+        .def(py::init<std::vector<std::string>, std::string, std::string, int>(),
+        py::arg("sbml_paths"),
+        py::arg("conditions_tsv"),
+        py::arg("measurements_tsv"),
+        py::arg("cell_count") = 1
+        )
+        .def("setSeed", &ExperimentRunner::setSeed,
+        py::arg("seed")
+        )
+        .def("setObservables", &ExperimentRunner::setObservables,
+        py::arg("observables")
+        )
+        .def("run",
+            [](ExperimentRunner& self, double step, int num_threads,
+               const std::string& archive_path) {
+                /* the whole work graph executes on a C++ thread pool; the
+                per-task matrices come back as one dict of arrays, each
+                owned by a capsule like the SingleCell returns above */
+                {
+                    py::gil_scoped_release release;
+
+                    self.run(step, num_threads);
+
+                    /* archive before the move below empties the task
+                    matrices */
+                    if (!archive_path.empty()) {
+                        self.saveArchive(archive_path);
+                    }
+                }
+
+                py::dict aggregated;
+
+                for (size_t t = 0; t < self.task_ids.size(); t++) {
+
+                    auto* buffer = new std::vector<double>(
+                        std::move(self.task_results[t])
+                    );
+
+                    py::capsule owner(buffer, [](void* ptr) {
+                        delete static_cast<std::vector<double>*>(ptr);
+                    });
+
+                    size_t cols = self.task_columns[t];
+                    size_t rows = cols > 0 ? buffer->size() / cols : 0;
+
+                    aggregated[py::str(self.task_ids[t])] = py::array_t<double>(
+                        {rows, cols},
+                        {cols * sizeof(double), sizeof(double)},
+                        buffer->data(),
+                        owner
+                    );
+                }
+
+                return aggregated;
+            },
+            py::arg("step") = 30.0,
+            py::arg("num_threads") = 0,
+            py::arg("archive_path") = ""
+        )
+        .def("saveArchive", &ExperimentRunner::saveArchive,
+        py::arg("output")
+        )
+        .def("getGlobalSpeciesIds", &ExperimentRunner::getGlobalSpeciesIds);
+
+    py::class_<ResultsArchiveWriter>(m, "ResultsArchiveWriter")
+        .def(py::init<const std::string&>(),
+        py::arg("output")
+        )
+        .def("append", &ResultsArchiveWriter::append,
+        py::arg("key"),
+        py::arg("flat_results"),
+        py::arg("num_cols"),
+        py::arg("col_labels") = std::vector<std::string>{},
+        py::arg("row_labels") = std::vector<std::string>{}
+        )
+        .def("finalize", &ResultsArchiveWriter::finalize);
+
+    py::class_<ResultsArchiveReader>(m, "ResultsArchiveReader")
+        .def(py::init<const std::string&>(),
+        py::arg("path")
+        )
+        .def("keys", &ResultsArchiveReader::keys)
+        .def("contains", &ResultsArchiveReader::contains,
+        py::arg("key")
+        )
+        .def("read",
+            [](ResultsArchiveReader& self, const std::string& key) {
+                /* one seek+read fetch; the flat buffer is wrapped as a
+                2D array owned by a capsule, labels ride alongside */
+                uint64_t num_rows = 0;
+                uint64_t num_cols = 0;
+                std::vector<std::string> col_labels;
+                std::vector<std::string> row_labels;
+
+                auto* buffer = new std::vector<double>(
+                    self.read(key, num_rows, num_cols, col_labels, row_labels)
+                );
+
+                py::capsule owner(buffer, [](void* ptr) {
+                    delete static_cast<std::vector<double>*>(ptr);
+                });
+
+                py::array_t<double> matrix(
+                    {static_cast<size_t>(num_rows),
+                     static_cast<size_t>(num_cols)},
+                    {num_cols * sizeof(double), sizeof(double)},
+                    buffer->data(),
+                    owner
+                );
+
+                return py::make_tuple(matrix, col_labels, row_labels);
+            },
+            py::arg("key")
+        );
 }
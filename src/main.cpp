@@ -1,38 +1,121 @@
 /**
  * @file main.cpp
- * 
+ *
  * @brief entrypoint file for simulation in C++
- * 
+ *
  * @authors Jonah R. Huggins, Marc R. Birtwistle
  * @date 20-05-2025
  */
 
  // --------------------------Library Import--------------------------------//
-#include <unordered_map>
- #include <any>
 #include <vector>
 #include <string>
 #include <memory>
 #include <fstream>
+#include <sstream>
 #include <iostream>
+#include <charconv>
 
 
 // Internal Libraries
 #include "singlecell/utils.h"
 #include "singlecell/ArgParsing.h"
+#include "singlecell/RunMetadata.h"
 #include "singlecell/SingleCell.h"
+#include "singlecell/ResultSink.h"
+#include "singlecell/DaemonServer.h"
+#include "singlecell/ModelAnalyzer.h"
+#include "singlecell/ArchiveReprojector.h"
+#include "singlecell/TaskScheduler.h"
+#include "singlecell/ExperimentRunner.h"
+#include "singlecell/ExperimentManifest.h"
 
 //--------------------------Function Definitions----------------------------//
 
+/**
+ * @brief resolves one shard's output path from the --output template: a
+ * "{r}" placeholder is replaced with the replicate index; without one
+ * the index is inserted before the extension, so results.tsv shards as
+ * results.r3.tsv
+ *
+ * @param template_path the --output value
+ * @param replicate this shard's replicate index
+ *
+ * @returns the shard's output path
+ */
+static std::string shardPath(
+    const std::string& template_path,
+    int replicate
+) {
+
+    size_t placeholder = template_path.find("{r}");
+
+    if (placeholder != std::string::npos) {
+
+        return template_path.substr(0, placeholder)
+            + std::to_string(replicate)
+            + template_path.substr(placeholder + 3);
+    }
+
+    size_t dot = template_path.rfind('.');
+
+    if (dot == std::string::npos || template_path.rfind('/') > dot) {
+        return template_path + ".r" + std::to_string(replicate);
+    }
+
+    return template_path.substr(0, dot)
+        + ".r" + std::to_string(replicate)
+        + template_path.substr(dot);
+}
+
+/**
+ * @brief writes one matrix in the format its path's extension selects
+ *
+ * @param results_matrix recorded rows to write
+ * @param output_path destination; .bin selects the packed binary format,
+ * .parquet the columnar format
+ * @param timesteps row labels
+ * @param species_ids column labels
+ *
+ * @returns None
+ */
+static void saveShard(
+    const std::vector<std::vector<double>>& results_matrix,
+    const std::string& output_path,
+    const std::vector<std::string>& timesteps,
+    const std::vector<std::string>& species_ids
+) {
+
+    bool binary_output = output_path.size() > 4 &&
+        output_path.compare(output_path.size() - 4, 4, ".bin") == 0;
+
+    bool parquet_output = output_path.size() > 8 &&
+        output_path.compare(output_path.size() - 8, 8, ".parquet") == 0;
+
+    if (parquet_output) {
+        matrix_utils::save_matrix_parquet(
+            results_matrix, output_path, timesteps, species_ids
+        );
+    } else if (binary_output) {
+        matrix_utils::save_matrix_binary(
+            results_matrix, output_path, timesteps, species_ids
+        );
+    } else {
+        matrix_utils::save_matrix(
+            results_matrix, output_path, timesteps, species_ids
+        );
+    }
+}
+
 /**
  * @brief executes simulation instructions
- * 
+ *
  * @param
- * 
+ *
  * @returns None
  */
 int main(
-    int argc, 
+    int argc,
     char* argv[]
 ) {
 
@@ -40,70 +123,373 @@ int main(
         argc, argv
     );
 
-    std::unordered_map<std::string, std::any> cli_map = argparser->cli_map;
+    // parsed once into typed fields; no any_cast probing downstream
+    const RunConfig& config = argparser->config;
+
+    // fix the shared pool's width before any parallel feature spawns it
+    TaskScheduler::instance().configure(config.threads);
+
+    // the pool width joins the provenance every writer embeds; 0 records
+    // that the hardware-sized default was in effect
+    RunMetadata::set("threads", std::to_string(config.threads));
+
+    // Analyze mode: print the preflight cost report and exit without
+    // committing to the run itself
+    if (config.analyze) {
+        ModelAnalyzer::analyze({config.deterministic_model}, config.step);
+        return 0;
+    }
+
+    // Preload mode: warm the model caches for the listed SBML files and
+    // exit; schedulers run this ahead of a queued job so its startup
+    // reads snapshots and mapped shared objects instead of parsing
+    if (!config.preload.empty()) {
+
+        std::vector<std::string> paths;
+        std::stringstream stream(config.preload);
+        std::string entry;
+
+        while (std::getline(stream, entry, ',')) {
+
+            if (!entry.empty()) {
+                paths.push_back(entry);
+            }
+        }
+
+        SingleCell::preload(paths);
+        return 0;
+    }
+
+    // Reproject mode: stream an existing study archive once through new
+    // observable definitions — no model, no solver, no simulation — so
+    // an analyst's formula tweak re-derives the observable tables at
+    // I/O speed instead of re-running the study
+    if (!config.reproject.empty()) {
+
+        if (config.observables.empty()) {
+            std::cerr << "Error: --reproject requires --observables\n";
+            return 1;
+        }
+
+        std::vector<std::string> observable_tsvs;
+        std::stringstream stream(config.observables);
+        std::string entry;
+
+        while (std::getline(stream, entry, ',')) {
+
+            if (!entry.empty()) {
+                observable_tsvs.push_back(entry);
+            }
+        }
+
+        ArchiveReprojector reprojector(config.reproject);
+
+        // an untouched --output lands the product next to its source
+        std::string projected_path = config.output;
+
+        if (projected_path == RunConfig{}.output) {
+            projected_path = config.reproject + ".obs.scarc";
+        }
+
+        size_t projected = reprojector.reproject(
+            ExperimentManifest::loadObservables(observable_tsvs),
+            projected_path
+        );
+
+        std::cout << "Reprojected " << projected << " trajectories ("
+            << reprojector.skipped_entries << " skipped) => "
+            << projected_path << '\n';
+
+        return 0;
+    }
+
+    // Manifest mode: run every condition of one benchmarks/* directory
+    // through the batch engine in a single launch, replacing the ad-hoc
+    // per-condition Python drivers; the whole sweep shares one process,
+    // one model cache and one worker pool
+    if (!config.manifest.empty()) {
+
+        ExperimentManifest manifest =
+            ExperimentManifest::load(config.manifest);
+
+        if (manifest.sbml_files.empty() ||
+            manifest.condition_files.empty() ||
+            manifest.measurement_files.empty()) {
+
+            std::cerr << "Error: manifest " << config.manifest
+                << " must list sbml_files, condition_files and "
+                   "measurement_files\n";
+            return 1;
+        }
+
+        // the in-tree manifests all carry one conditions and one
+        // measurements table per problem; extras are reported, not lost
+        if (manifest.condition_files.size() > 1 ||
+            manifest.measurement_files.size() > 1) {
+
+            std::cerr << "Warning: only the first conditions and "
+                         "measurements tables of " << manifest.name
+                << " are run\n";
+        }
+
+        ExperimentRunner runner(
+            manifest.sbml_files,
+            manifest.condition_files.front(),
+            manifest.measurement_files.front(),
+            manifest.cell_count
+        );
+
+        if (config.seed >= 0) {
+            runner.setSeed(static_cast<unsigned long long>(config.seed));
+        }
+
+        if (!manifest.observable_files.empty()) {
+            runner.setObservables(
+                ExperimentManifest::loadObservables(
+                    manifest.observable_files
+                )
+            );
+        }
+
+        runner.run(config.step, config.threads);
+
+        // an untouched --output keeps the archive next to its manifest
+        // rather than landing a benchmark sweep on the single-run default
+        std::string archive_path = config.output;
+
+        if (archive_path == RunConfig{}.output) {
 
-    double start = std::any_cast<double>(argparser->cli_map["--start"]);
-    double stop = std::any_cast<double>(argparser->cli_map["--stop"]);
-    double step = std::any_cast<double>(argparser->cli_map["--step"]);
+            size_t dot = config.manifest.rfind('.');
+            size_t slash = config.manifest.rfind('/');
 
-    std::string stochastic_sbml = std::any_cast<std::string>(argparser->cli_map["--stochastic_model"]);
-    std::string deterministic_sbml = std::any_cast<std::string>(argparser->cli_map["--deterministic_model"]);
+            bool has_extension = dot != std::string::npos &&
+                (slash == std::string::npos || slash < dot);
+
+            archive_path = (has_extension
+                ? config.manifest.substr(0, dot)
+                : config.manifest) + ".scarc";
+        }
+
+        runner.saveArchive(archive_path);
+
+        std::cout << "Ran " << runner.task_ids.size()
+            << " tasks from " << manifest.name
+            << "; archive => " << archive_path << '\n';
+
+        return 0;
+    }
+
+    // Daemon mode: load the models once, then serve simulate requests
+    // over the Unix socket until a shutdown frame arrives. Per-request
+    // latency is the simulation itself, not process + model setup
+    if (!config.daemon_socket.empty()) {
+
+        DaemonServer daemon({config.deterministic_model});
+
+        return daemon.serve(config.daemon_socket);
+    }
+
+    // Ensemble mode: every replicate owns its cell and writes its own
+    // shard from the worker that ran it, so output I/O scales with the
+    // pool instead of serializing behind one writer; a manifest ties
+    // the shards back together
+    if (config.replicates > 1) {
+
+        std::vector<std::string> shard_paths(config.replicates);
+
+        TaskScheduler::instance().parallelFor(
+            config.replicates,
+            [&](int replicate) {
+
+                SingleCell cell(config.deterministic_model);
+
+                if (config.seed >= 0) {
+
+                    // per-replicate substream keeps shards independent
+                    // and individually replayable
+                    cell.setSeed(
+                        static_cast<unsigned long long>(config.seed)
+                            + replicate
+                    );
+                }
+
+                if (config.parallel) {
+                    cell.setParallelStepping(true);
+                }
+
+                if (config.autotune) {
+                    cell.setKernelAutotune(true);
+                }
+
+                cell.setSteadyStateTolerance(config.steady_state_tol);
+
+                cell.setSolverProfile(config.solver_profile);
+
+                if (!argparser->entity_map.empty()) {
+                    cell.modifyBulk(argparser->entity_map);
+                }
+
+                std::vector<std::vector<double>> shard = cell.simulate(
+                    config.start, config.stop, config.step
+                );
+
+                // per-shard labels: steady-state early stops can leave
+                // shards with different row counts
+                std::vector<std::string> timesteps(shard.size());
+
+                char label[32];
+
+                for (size_t i = 0; i < shard.size(); i++) {
+
+                    auto [end, ec] = std::to_chars(
+                        label, label + sizeof(label), i * config.step,
+                        std::chars_format::fixed, 6
+                    );
+
+                    timesteps[i].assign(label, end);
+                }
+
+                shard_paths[replicate] =
+                    shardPath(config.output, replicate);
+
+                saveShard(
+                    shard,
+                    shard_paths[replicate],
+                    timesteps,
+                    cell.getRecordedSpeciesIds()
+                );
+            }
+        );
+
+        // the manifest is what downstream tooling loads: one line per
+        // shard, written after every owner has finished its file
+        std::string manifest_path = config.output + ".manifest.tsv";
+
+        std::ofstream manifest(manifest_path);
+
+        manifest << "replicate\tseed\tpath\n";
+
+        for (int r = 0; r < config.replicates; r++) {
+
+            manifest << r << '\t';
+
+            if (config.seed >= 0) {
+                manifest << (config.seed + r);
+            } else {
+                manifest << "entropy";
+            }
+
+            manifest << '\t' << shard_paths[r] << '\n';
+        }
+
+        std::cout << "Wrote " << config.replicates
+            << " shards; manifest => " << manifest_path << '\n';
+
+        return 0;
+    }
 
     //Load instance of SingleCell
     std::unique_ptr<SingleCell> single_cell = std::make_unique<SingleCell>(
-        // stochastic_sbml,
-        deterministic_sbml
+        // config.stochastic_model,
+        config.deterministic_model
     );
-    std::cout << "Simulation Details:\n";
-    for (const auto& [key, value] : argparser->cli_map) {
-        std::cout << "  " << key << " => ";
-        try {
-            std::cout << std::any_cast<std::string>(value);
-            
-        } catch (std::bad_any_cast) {
-            std::cout << std::any_cast<double>(value);
-        } 
-        std::cout << '\n';
+    // negative seed keeps the default entropy-seeded behavior
+    if (config.seed >= 0) {
+        single_cell->setSeed(static_cast<unsigned long long>(config.seed));
     }
 
+    if (config.parallel) {
+        single_cell->setParallelStepping(true);
+    }
+
+    if (config.autotune) {
+        single_cell->setKernelAutotune(true);
+    }
+
+    single_cell->setProgressInterval(config.progress_interval);
+
+    single_cell->setSteadyStateTolerance(config.steady_state_tol);
+
+    single_cell->setSolverProfile(config.solver_profile);
+
+    if (!config.perf_output.empty()) {
+        single_cell->setPerfOutput(config.perf_output);
+    }
+
+    if (!config.profile_entities.empty()) {
+        single_cell->setEntityProfiling(config.profile_entities);
+    }
+
+    std::cout << "Simulation Details:\n"
+        << "  start => " << config.start << '\n'
+        << "  stop => " << config.stop << '\n'
+        << "  step => " << config.step << '\n'
+        << "  seed => " << config.seed << '\n'
+        << "  parallel => " << (config.parallel ? "true" : "false") << '\n'
+        << "  progress_interval => " << config.progress_interval << '\n'
+        << "  steady_state_tol => " << config.steady_state_tol << '\n'
+        << "  solver_profile => " << config.solver_profile << '\n'
+        << "  stochastic_model => " << config.stochastic_model << '\n'
+        << "  deterministic_model => " << config.deterministic_model << '\n'
+        << "  output => " << config.output << '\n';
+
         // modify sbml model prior to AMICI-model assignment
     std::vector<double> init_states;
 
     if (argparser->entity_map.empty()) {
         printf("Using default model states for simulation.\n");
-    } else { 
-        for (const auto& [key, value] : argparser->entity_map) {
-            single_cell->modify(
-                key, 
-                value
-            );
-        }
+    } else {
+        // one resolution pass over all overrides; unknown ids are
+        // reported collectively instead of a line per entity
+        single_cell->modifyBulk(argparser->entity_map);
     }
 
     std::vector<std::vector<double>> results_matrix = single_cell->simulate(
-        start, 
-        stop, 
-        step
+        config.start,
+        config.stop,
+        config.step
     );
 
+    // bulk label formatting: to_chars into one reusable buffer replaces
+    // a locale-aware to_string round trip per row, which is measurable
+    // output cost on 1e7-step runs
     std::vector<std::string> timesteps(results_matrix.size());
 
-    for (int i = 0; i < results_matrix.size(); i++) {
+    char label[32];
 
-        double time_i = i * step;
+    for (size_t i = 0; i < results_matrix.size(); i++) {
 
-        timesteps[i] = std::to_string(time_i);
+        double time_i = i * config.step;
 
+        auto [end, ec] = std::to_chars(
+            label, label + sizeof(label), time_i,
+            std::chars_format::fixed, 6
+        );
+
+        timesteps[i].assign(label, end);
     }
 
-    std::vector<std::string> global_species_ids = single_cell->getGlobalSpeciesIds();
+    std::vector<std::string> global_species_ids = single_cell->getRecordedSpeciesIds();
 
-    matrix_utils::save_matrix(
-        results_matrix,
-        std::any_cast<std::string>(argparser->cli_map["--output"]),
-        timesteps,
-        global_species_ids
-    );
+    // configured sinks fan the one recorded matrix out concurrently —
+    // full-resolution binary, thinned subsets, parquet exports — so
+    // small products never require re-reading the big one downstream
+    if (!config.sinks.empty()) {
+
+        SinkSet sinks;
+
+        for (const std::string& spec : config.sinks) {
+            sinks.addSink(SinkSpec::parse(spec));
+        }
+
+        int failures = sinks.writeAll(
+            results_matrix, timesteps, global_species_ids
+        );
+
+        return failures > 0 ? 1 : 0;
+    }
+
+    saveShard(results_matrix, config.output, timesteps, global_species_ids);
 
     return 0;
-}
\ No newline at end of file
+}
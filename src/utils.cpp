@@ -9,12 +9,18 @@
 //===========================Library Import=================================//
 // Standard Libraries
 #include <string>
+#include <thread>
 #include <vector>
+#include <cstdint>
 #include <fstream>
+#include <charconv>
 #include <iostream>
+#include <algorithm>
 
 // Internal Libraries
 #include "singlecell/utils.h"
+#include "singlecell/RunMetadata.h"
+#include "singlecell/ParquetWriter.h"
 
 namespace matrix_utils {
     void save_matrix(
@@ -30,33 +36,230 @@ namespace matrix_utils {
 
         int numCols = (numRows > 0) ? results_matrix[0].size() : 0;
 
+        // provenance facts lead the file as comment lines, so the TSV
+        // carries the configuration that produced it; tab-splitting
+        // readers skip them on the '#' prefix
+        for (const auto& fact : RunMetadata::snapshot()) {
+
+            std::string comment = "# " + fact.first + "=" + fact.second + "\n";
+
+            outFile.write(comment.data(), comment.size());
+        }
+
         if (!col_labels.empty()) {
-            outFile << "index";
+            std::string header = "index";
             for (const auto& label : col_labels) {
-                outFile << "\t" << label;
+                header += "\t";
+                header += label;
             }
-            outFile << "\n";
+            header += "\n";
+            outFile.write(header.data(), header.size());
+        }
+
+        // rows format in parallel via locale-free to_chars into per-chunk
+        // strings, each flushed with a single write; the ofstream <<
+        // path formatted one locale-aware value at a time
+        unsigned int num_threads = std::thread::hardware_concurrency();
+
+        if (num_threads == 0 || numRows < 256) {
+            num_threads = 1;
         }
 
-        for (int i = 0; i < numRows; i++) {
-            if (!row_labels.empty()) {
-                outFile << row_labels[i];
+        if (static_cast<int>(num_threads) > numRows && numRows > 0) {
+            num_threads = numRows;
+        }
+
+        std::vector<std::string> chunks(num_threads);
+
+        auto formatRows = [&](int first, int last, std::string& chunk) {
+
+            // shortest round-trip formatting is at most ~24 chars + tab
+            chunk.reserve(static_cast<size_t>(last - first) * (numCols * 26 + 32));
+
+            char number[32];
+
+            for (int i = first; i < last; i++) {
+
+                if (!row_labels.empty()) {
+                    chunk += row_labels[i];
+                }
+
+                for (int j = 0; j < numCols; j++) {
+
+                    chunk += '\t';
+
+                    auto [end, ec] = std::to_chars(
+                        number, number + sizeof(number), results_matrix[i][j]
+                    );
+
+                    chunk.append(number, end - number);
+                }
+
+                chunk += '\n';
             }
-            for (int j = 0; j < numCols; j++) {
-                outFile << "\t" << results_matrix[i][j];
+        };
+
+        if (num_threads == 1) {
+
+            formatRows(0, numRows, chunks[0]);
+
+        } else {
+
+            int rows_per_chunk = (numRows + num_threads - 1) / num_threads;
+
+            std::vector<std::thread> workers;
+            workers.reserve(num_threads);
+
+            for (unsigned int t = 0; t < num_threads; t++) {
+
+                int first = t * rows_per_chunk;
+                int last = std::min(numRows, first + rows_per_chunk);
 
+                workers.emplace_back(formatRows, first, last, std::ref(chunks[t]));
             }
 
-            outFile << "\n";
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
 
+        for (const auto& chunk : chunks) {
+            outFile.write(chunk.data(), chunk.size());
         }
 
         outFile.close();
 
     }
 
+    void save_matrix_binary(
+        std::vector<std::vector<double>> results_matrix,
+            std::string output,
+            std::vector<std::string> row_labels,
+            std::vector<std::string> col_labels
+    ) {
+
+        std::ofstream outFile(output, std::ios::binary);
+
+        uint64_t numRows = results_matrix.size();
+
+        uint64_t numCols = (numRows > 0) ? results_matrix[0].size() : 0;
+
+        // 8-byte magic identifies the format and its version
+        outFile.write("SCTRJ001", 8);
+
+        outFile.write(reinterpret_cast<const char*>(&numRows), sizeof(numRows));
+        outFile.write(reinterpret_cast<const char*>(&numCols), sizeof(numCols));
+
+        // labels are stored newline-joined, each block prefixed by its size
+        auto writeLabelBlock = [&outFile](const std::vector<std::string>& labels) {
+
+            std::string joined;
+
+            for (size_t i = 0; i < labels.size(); i++) {
+                joined += labels[i];
+                if (i + 1 < labels.size()) {
+                    joined += "\n";
+                }
+            }
+
+            uint64_t block_size = joined.size();
+
+            outFile.write(reinterpret_cast<const char*>(&block_size), sizeof(block_size));
+            outFile.write(joined.data(), block_size);
+        };
+
+        writeLabelBlock(col_labels);
+        writeLabelBlock(row_labels);
+
+        // raw row-major doubles; mappable directly as (numRows, numCols)
+        for (uint64_t i = 0; i < numRows; i++) {
+
+            outFile.write(
+                reinterpret_cast<const char*>(results_matrix[i].data()),
+                numCols * sizeof(double)
+            );
+        }
+
+        // provenance trailer behind the payload: readers bounded by the
+        // header's row count never reach it, so the block rides along
+        // without a format version bump
+        std::string facts = RunMetadata::serialize();
+
+        uint64_t facts_size = facts.size();
+
+        outFile.write("SCMETA01", 8);
+        outFile.write(reinterpret_cast<const char*>(&facts_size), sizeof(facts_size));
+        outFile.write(facts.data(), facts_size);
+
+        outFile.close();
+
+    }
+
+    void save_matrix_parquet(
+        std::vector<std::vector<double>> results_matrix,
+            std::string output,
+            std::vector<std::string> row_labels,
+            std::vector<std::string> col_labels
+    ) {
+
+        size_t numRows = results_matrix.size();
+
+        size_t numCols = (numRows > 0) ? results_matrix[0].size() : 0;
+
+        // leading "time" column, then one column per species so the file
+        // lands warehouse-ready without pivoting
+        std::vector<std::string> names;
+        names.reserve(numCols + 1);
+        names.push_back("time");
+
+        for (size_t j = 0; j < numCols; j++) {
+            names.push_back(
+                j < col_labels.size()
+                    ? col_labels[j]
+                    : "col_" + std::to_string(j)
+            );
+        }
+
+        ParquetWriter writer(output, names);
+
+        // same provenance set as the TSV and binary paths, surfaced as
+        // footer key/value metadata
+        writer.setMetadata(RunMetadata::snapshot());
+
+        std::vector<double> row(numCols + 1);
+
+        for (size_t i = 0; i < numRows; i++) {
+
+            // row labels are the recorder's formatted timepoints; rows
+            // without a parseable label fall back to their index
+            double timepoint = static_cast<double>(i);
+
+            if (i < row_labels.size()) {
+
+                const std::string& label = row_labels[i];
+
+                std::from_chars(
+                    label.data(), label.data() + label.size(), timepoint
+                );
+            }
+
+            row[0] = timepoint;
+
+            std::copy(
+                results_matrix[i].begin(),
+                results_matrix[i].begin() + numCols,
+                row.begin() + 1
+            );
+
+            writer.appendRow(row.data());
+        }
+
+        writer.finalize();
+
+    }
+
     std::vector<double> getColumn(
-        const std::vector<std::vector<double>>& matrix, 
+        const std::vector<std::vector<double>>& matrix,
         size_t indexCol
     ) {
         std::vector<double>column;
@@ -67,11 +270,41 @@ namespace matrix_utils {
 
         return column;
     }
+
+    void transpose_blocked(
+        const double* src,
+        size_t rows,
+        size_t cols,
+        double* dst
+    ) {
+
+        // 64x64 doubles = two 32 KB tiles, comfortably inside L1+L2 on
+        // anything this runs on; within a tile both walks are sequential
+        constexpr size_t block = 64;
+
+        for (size_t r0 = 0; r0 < rows; r0 += block) {
+
+            size_t r1 = std::min(r0 + block, rows);
+
+            for (size_t c0 = 0; c0 < cols; c0 += block) {
+
+                size_t c1 = std::min(c0 + block, cols);
+
+                for (size_t r = r0; r < r1; r++) {
+
+                    for (size_t c = c0; c < c1; c++) {
+
+                        dst[c * rows + r] = src[r * cols + c];
+                    }
+                }
+            }
+        }
+    }
 }
 
 namespace unit_conversions {
     std::vector<double> nanomolar2mpv(
-        std::vector<double> cell_volumes
+        const std::vector<double>& cell_volumes
     ) {
 
         const double nm2Molar = 1e9;
@@ -91,7 +324,7 @@ namespace unit_conversions {
     }
 
     std::vector<double> molecules2nanomolar(
-        std::vector<double> cell_volumes
+        const std::vector<double>& cell_volumes
     ) {
 
         const double avagadros = 6.022e23;
@@ -110,8 +343,8 @@ namespace unit_conversions {
     }
 
     std::vector<double> convert(
-        std::vector<double> prior_values,
-        std::vector<double> conversion_factors
+        const std::vector<double>& prior_values,
+        const std::vector<double>& conversion_factors
     ) {
 
         std::vector<double> converted_vals(prior_values.size());
@@ -123,4 +356,17 @@ namespace unit_conversions {
         }
         return converted_vals;
     }
+
+void convert(
+    const double* prior_values,
+    const double* conversion_factors,
+    double* converted_vals,
+    size_t count
+) {
+
+    for (size_t i = 0; i < count; i++) {
+
+        converted_vals[i] = prior_values[i] * conversion_factors[i];
+    }
+}
 }
\ No newline at end of file